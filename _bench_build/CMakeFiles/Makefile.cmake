@@ -0,0 +1,86 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmarks/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/third-party/catch/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third-party/catch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/CMakeFiles/nmea2000.dir/DependInfo.cmake"
+  "third-party/catch/CMakeFiles/catch.dir/DependInfo.cmake"
+  "test/CMakeFiles/SeasmartTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kMessagesTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kMessageViewsTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kMessageStructsTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kBatchDecoderTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kCZoneTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kFixedPointTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kCANMsgIndexTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kMsgHandlerTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kMsgBufPoolTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kParseMessagesTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kPGNDescriptorsTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kSendMsgTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kPeriodicMsgTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kVirtualBusTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kStatisticsTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kWakeupTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kGatewayTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kLatencyStatsTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kPostMsgTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kThreadedReceiveTests.dir/DependInfo.cmake"
+  "test/CMakeFiles/N2kThreadedGatewayTests.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchmarks.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmarks/BatchDecoderBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/BatchDecoderBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/BatchDecoderBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/Benchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/Benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/Benchmark.cpp.o.d"
+  "/root/repo/benchmarks/MessageStructBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/MessageStructBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/MessageStructBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/MessageViewBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/MessageViewBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/MessageViewBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/MsgHandlerBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/MsgHandlerBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/MsgHandlerBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/PGNClassifyBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/PGNClassifyBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/PGNClassifyBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/PGNCodecBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/PGNCodecBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/PGNCodecBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/PGNDescriptorBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/PGNDescriptorBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/PGNDescriptorBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/PeriodicMsgBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/PeriodicMsgBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/PeriodicMsgBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/ReassemblyBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/ReassemblyBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/ReassemblyBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/RingBufferBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/RingBufferBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/RingBufferBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/SendMsgBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/SendMsgBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/SendMsgBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/SingleFrameBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/SingleFrameBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/SingleFrameBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/StreamFormatBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/StreamFormatBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/StreamFormatBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/VirtualBusBenchmark.cpp" "benchmarks/CMakeFiles/benchmarks.dir/VirtualBusBenchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/VirtualBusBenchmark.cpp.o.d"
+  "/root/repo/benchmarks/millis.cpp" "benchmarks/CMakeFiles/benchmarks.dir/millis.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/millis.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/CMakeFiles/nmea2000.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarks.dir/BatchDecoderBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/BatchDecoderBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/Benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/Benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/MessageStructBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/MessageStructBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/MessageViewBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/MessageViewBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/MsgHandlerBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/MsgHandlerBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/PGNClassifyBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/PGNClassifyBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/PGNCodecBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/PGNCodecBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/PGNDescriptorBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/PGNDescriptorBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/PeriodicMsgBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/PeriodicMsgBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/ReassemblyBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/ReassemblyBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/RingBufferBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/RingBufferBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/SendMsgBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/SendMsgBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/SingleFrameBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/SingleFrameBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/StreamFormatBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/StreamFormatBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/VirtualBusBenchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/VirtualBusBenchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/millis.cpp.o"
+  "CMakeFiles/benchmarks.dir/millis.cpp.o.d"
+  "benchmarks"
+  "benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ActisenseReader.cpp" "src/CMakeFiles/nmea2000.dir/ActisenseReader.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/ActisenseReader.cpp.o.d"
+  "/root/repo/src/N2kBatchDecoder.cpp" "src/CMakeFiles/nmea2000.dir/N2kBatchDecoder.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kBatchDecoder.cpp.o.d"
+  "/root/repo/src/N2kCANMsg.cpp" "src/CMakeFiles/nmea2000.dir/N2kCANMsg.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kCANMsg.cpp.o.d"
+  "/root/repo/src/N2kCZone.cpp" "src/CMakeFiles/nmea2000.dir/N2kCZone.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kCZone.cpp.o.d"
+  "/root/repo/src/N2kDeviceList.cpp" "src/CMakeFiles/nmea2000.dir/N2kDeviceList.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kDeviceList.cpp.o.d"
+  "/root/repo/src/N2kFixedPoint.cpp" "src/CMakeFiles/nmea2000.dir/N2kFixedPoint.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kFixedPoint.cpp.o.d"
+  "/root/repo/src/N2kGateway.cpp" "src/CMakeFiles/nmea2000.dir/N2kGateway.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kGateway.cpp.o.d"
+  "/root/repo/src/N2kGroupFunction.cpp" "src/CMakeFiles/nmea2000.dir/N2kGroupFunction.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kGroupFunction.cpp.o.d"
+  "/root/repo/src/N2kGroupFunctionDefaultHandlers.cpp" "src/CMakeFiles/nmea2000.dir/N2kGroupFunctionDefaultHandlers.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kGroupFunctionDefaultHandlers.cpp.o.d"
+  "/root/repo/src/N2kLatencyStats.cpp" "src/CMakeFiles/nmea2000.dir/N2kLatencyStats.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kLatencyStats.cpp.o.d"
+  "/root/repo/src/N2kMaretron.cpp" "src/CMakeFiles/nmea2000.dir/N2kMaretron.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kMaretron.cpp.o.d"
+  "/root/repo/src/N2kMessages.cpp" "src/CMakeFiles/nmea2000.dir/N2kMessages.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kMessages.cpp.o.d"
+  "/root/repo/src/N2kMsg.cpp" "src/CMakeFiles/nmea2000.dir/N2kMsg.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kMsg.cpp.o.d"
+  "/root/repo/src/N2kPGNDescriptors.cpp" "src/CMakeFiles/nmea2000.dir/N2kPGNDescriptors.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kPGNDescriptors.cpp.o.d"
+  "/root/repo/src/N2kStream.cpp" "src/CMakeFiles/nmea2000.dir/N2kStream.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kStream.cpp.o.d"
+  "/root/repo/src/N2kTimer.cpp" "src/CMakeFiles/nmea2000.dir/N2kTimer.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/N2kTimer.cpp.o.d"
+  "/root/repo/src/NMEA2000.cpp" "src/CMakeFiles/nmea2000.dir/NMEA2000.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/NMEA2000.cpp.o.d"
+  "/root/repo/src/NMEA2000_virtual.cpp" "src/CMakeFiles/nmea2000.dir/NMEA2000_virtual.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/NMEA2000_virtual.cpp.o.d"
+  "/root/repo/src/Seasmart.cpp" "src/CMakeFiles/nmea2000.dir/Seasmart.cpp.o" "gcc" "src/CMakeFiles/nmea2000.dir/Seasmart.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nmea2000.dir/ActisenseReader.cpp.o"
+  "CMakeFiles/nmea2000.dir/ActisenseReader.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kBatchDecoder.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kBatchDecoder.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kCANMsg.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kCANMsg.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kCZone.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kCZone.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kDeviceList.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kDeviceList.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kFixedPoint.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kFixedPoint.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kGateway.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kGateway.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kGroupFunction.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kGroupFunction.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kGroupFunctionDefaultHandlers.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kGroupFunctionDefaultHandlers.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kLatencyStats.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kLatencyStats.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kMaretron.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kMaretron.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kMessages.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kMessages.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kMsg.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kMsg.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kPGNDescriptors.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kPGNDescriptors.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kStream.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kStream.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/N2kTimer.cpp.o"
+  "CMakeFiles/nmea2000.dir/N2kTimer.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/NMEA2000.cpp.o"
+  "CMakeFiles/nmea2000.dir/NMEA2000.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/NMEA2000_virtual.cpp.o"
+  "CMakeFiles/nmea2000.dir/NMEA2000_virtual.cpp.o.d"
+  "CMakeFiles/nmea2000.dir/Seasmart.cpp.o"
+  "CMakeFiles/nmea2000.dir/Seasmart.cpp.o.d"
+  "libnmea2000.a"
+  "libnmea2000.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nmea2000.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
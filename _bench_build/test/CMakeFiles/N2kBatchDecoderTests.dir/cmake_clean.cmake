@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kBatchDecoderTests.dir/N2kBatchDecoderTest.cpp.o"
+  "CMakeFiles/N2kBatchDecoderTests.dir/N2kBatchDecoderTest.cpp.o.d"
+  "CMakeFiles/N2kBatchDecoderTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kBatchDecoderTests.dir/millis.cpp.o.d"
+  "N2kBatchDecoderTests"
+  "N2kBatchDecoderTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kBatchDecoderTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
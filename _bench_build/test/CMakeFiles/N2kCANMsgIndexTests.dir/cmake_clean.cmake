@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kCANMsgIndexTests.dir/N2kCANMsgIndexTest.cpp.o"
+  "CMakeFiles/N2kCANMsgIndexTests.dir/N2kCANMsgIndexTest.cpp.o.d"
+  "CMakeFiles/N2kCANMsgIndexTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kCANMsgIndexTests.dir/millis.cpp.o.d"
+  "N2kCANMsgIndexTests"
+  "N2kCANMsgIndexTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kCANMsgIndexTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kCZoneTests.dir/N2kCZoneTest.cpp.o"
+  "CMakeFiles/N2kCZoneTests.dir/N2kCZoneTest.cpp.o.d"
+  "CMakeFiles/N2kCZoneTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kCZoneTests.dir/millis.cpp.o.d"
+  "N2kCZoneTests"
+  "N2kCZoneTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kCZoneTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
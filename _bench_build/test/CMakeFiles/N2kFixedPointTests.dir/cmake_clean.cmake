@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kFixedPointTests.dir/N2kFixedPointTest.cpp.o"
+  "CMakeFiles/N2kFixedPointTests.dir/N2kFixedPointTest.cpp.o.d"
+  "CMakeFiles/N2kFixedPointTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kFixedPointTests.dir/millis.cpp.o.d"
+  "N2kFixedPointTests"
+  "N2kFixedPointTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kFixedPointTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kGatewayTests.dir/N2kGatewayTest.cpp.o"
+  "CMakeFiles/N2kGatewayTests.dir/N2kGatewayTest.cpp.o.d"
+  "CMakeFiles/N2kGatewayTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kGatewayTests.dir/millis.cpp.o.d"
+  "N2kGatewayTests"
+  "N2kGatewayTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kGatewayTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/N2kLatencyStatsTest.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/N2kLatencyStatsTest.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/N2kLatencyStatsTest.cpp.o.d"
+  "/root/repo/src/ActisenseReader.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/ActisenseReader.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/ActisenseReader.cpp.o.d"
+  "/root/repo/src/N2kBatchDecoder.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kBatchDecoder.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kBatchDecoder.cpp.o.d"
+  "/root/repo/src/N2kCANMsg.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kCANMsg.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kCANMsg.cpp.o.d"
+  "/root/repo/src/N2kCZone.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kCZone.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kCZone.cpp.o.d"
+  "/root/repo/src/N2kDeviceList.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kDeviceList.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kDeviceList.cpp.o.d"
+  "/root/repo/src/N2kFixedPoint.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kFixedPoint.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kFixedPoint.cpp.o.d"
+  "/root/repo/src/N2kGateway.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kGateway.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kGateway.cpp.o.d"
+  "/root/repo/src/N2kGroupFunction.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kGroupFunction.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kGroupFunction.cpp.o.d"
+  "/root/repo/src/N2kGroupFunctionDefaultHandlers.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kGroupFunctionDefaultHandlers.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kGroupFunctionDefaultHandlers.cpp.o.d"
+  "/root/repo/src/N2kLatencyStats.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kLatencyStats.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kLatencyStats.cpp.o.d"
+  "/root/repo/src/N2kMaretron.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kMaretron.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kMaretron.cpp.o.d"
+  "/root/repo/src/N2kMessages.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kMessages.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kMessages.cpp.o.d"
+  "/root/repo/src/N2kMsg.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kMsg.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kMsg.cpp.o.d"
+  "/root/repo/src/N2kPGNDescriptors.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kPGNDescriptors.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kPGNDescriptors.cpp.o.d"
+  "/root/repo/src/N2kStream.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kStream.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kStream.cpp.o.d"
+  "/root/repo/src/N2kTimer.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kTimer.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/N2kTimer.cpp.o.d"
+  "/root/repo/src/NMEA2000.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/NMEA2000.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/NMEA2000.cpp.o.d"
+  "/root/repo/src/NMEA2000_virtual.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/NMEA2000_virtual.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/NMEA2000_virtual.cpp.o.d"
+  "/root/repo/src/Seasmart.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/Seasmart.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/__/src/Seasmart.cpp.o.d"
+  "/root/repo/test/millis.cpp" "test/CMakeFiles/N2kLatencyStatsTests.dir/millis.cpp.o" "gcc" "test/CMakeFiles/N2kLatencyStatsTests.dir/millis.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/third-party/catch/CMakeFiles/catch.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kMessageStructsTests.dir/N2kMessageStructsTest.cpp.o"
+  "CMakeFiles/N2kMessageStructsTests.dir/N2kMessageStructsTest.cpp.o.d"
+  "CMakeFiles/N2kMessageStructsTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kMessageStructsTests.dir/millis.cpp.o.d"
+  "N2kMessageStructsTests"
+  "N2kMessageStructsTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kMessageStructsTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
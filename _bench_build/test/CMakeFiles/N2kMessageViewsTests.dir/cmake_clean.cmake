@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kMessageViewsTests.dir/N2kMessageViewsTest.cpp.o"
+  "CMakeFiles/N2kMessageViewsTests.dir/N2kMessageViewsTest.cpp.o.d"
+  "CMakeFiles/N2kMessageViewsTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kMessageViewsTests.dir/millis.cpp.o.d"
+  "N2kMessageViewsTests"
+  "N2kMessageViewsTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kMessageViewsTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
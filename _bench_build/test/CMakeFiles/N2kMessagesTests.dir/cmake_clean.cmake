@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kMessagesTests.dir/N2kMessagesTest.cpp.o"
+  "CMakeFiles/N2kMessagesTests.dir/N2kMessagesTest.cpp.o.d"
+  "CMakeFiles/N2kMessagesTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kMessagesTests.dir/millis.cpp.o.d"
+  "N2kMessagesTests"
+  "N2kMessagesTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kMessagesTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kMsgBufPoolTests.dir/N2kMsgBufPoolTest.cpp.o"
+  "CMakeFiles/N2kMsgBufPoolTests.dir/N2kMsgBufPoolTest.cpp.o.d"
+  "CMakeFiles/N2kMsgBufPoolTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kMsgBufPoolTests.dir/millis.cpp.o.d"
+  "N2kMsgBufPoolTests"
+  "N2kMsgBufPoolTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kMsgBufPoolTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/N2kMsgHandlerTest.cpp" "test/CMakeFiles/N2kMsgHandlerTests.dir/N2kMsgHandlerTest.cpp.o" "gcc" "test/CMakeFiles/N2kMsgHandlerTests.dir/N2kMsgHandlerTest.cpp.o.d"
+  "/root/repo/test/millis.cpp" "test/CMakeFiles/N2kMsgHandlerTests.dir/millis.cpp.o" "gcc" "test/CMakeFiles/N2kMsgHandlerTests.dir/millis.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/third-party/catch/CMakeFiles/catch.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/CMakeFiles/nmea2000.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
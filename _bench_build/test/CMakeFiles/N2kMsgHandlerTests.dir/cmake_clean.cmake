@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kMsgHandlerTests.dir/N2kMsgHandlerTest.cpp.o"
+  "CMakeFiles/N2kMsgHandlerTests.dir/N2kMsgHandlerTest.cpp.o.d"
+  "CMakeFiles/N2kMsgHandlerTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kMsgHandlerTests.dir/millis.cpp.o.d"
+  "N2kMsgHandlerTests"
+  "N2kMsgHandlerTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kMsgHandlerTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kPGNDescriptorsTests.dir/N2kPGNDescriptorsTest.cpp.o"
+  "CMakeFiles/N2kPGNDescriptorsTests.dir/N2kPGNDescriptorsTest.cpp.o.d"
+  "CMakeFiles/N2kPGNDescriptorsTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kPGNDescriptorsTests.dir/millis.cpp.o.d"
+  "N2kPGNDescriptorsTests"
+  "N2kPGNDescriptorsTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kPGNDescriptorsTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kParseMessagesTests.dir/N2kParseMessagesTest.cpp.o"
+  "CMakeFiles/N2kParseMessagesTests.dir/N2kParseMessagesTest.cpp.o.d"
+  "CMakeFiles/N2kParseMessagesTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kParseMessagesTests.dir/millis.cpp.o.d"
+  "N2kParseMessagesTests"
+  "N2kParseMessagesTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kParseMessagesTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kPeriodicMsgTests.dir/N2kPeriodicMsgTest.cpp.o"
+  "CMakeFiles/N2kPeriodicMsgTests.dir/N2kPeriodicMsgTest.cpp.o.d"
+  "CMakeFiles/N2kPeriodicMsgTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kPeriodicMsgTests.dir/millis.cpp.o.d"
+  "N2kPeriodicMsgTests"
+  "N2kPeriodicMsgTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kPeriodicMsgTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kSendMsgTests.dir/N2kSendMsgTest.cpp.o"
+  "CMakeFiles/N2kSendMsgTests.dir/N2kSendMsgTest.cpp.o.d"
+  "CMakeFiles/N2kSendMsgTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kSendMsgTests.dir/millis.cpp.o.d"
+  "N2kSendMsgTests"
+  "N2kSendMsgTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kSendMsgTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
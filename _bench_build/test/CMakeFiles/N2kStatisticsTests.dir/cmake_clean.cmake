@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kStatisticsTests.dir/N2kStatisticsTest.cpp.o"
+  "CMakeFiles/N2kStatisticsTests.dir/N2kStatisticsTest.cpp.o.d"
+  "CMakeFiles/N2kStatisticsTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kStatisticsTests.dir/millis.cpp.o.d"
+  "N2kStatisticsTests"
+  "N2kStatisticsTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kStatisticsTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kThreadedGatewayTests.dir/N2kGatewayTest.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/N2kGatewayTest.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/ActisenseReader.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/ActisenseReader.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kBatchDecoder.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kBatchDecoder.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kCANMsg.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kCANMsg.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kCZone.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kCZone.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kDeviceList.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kDeviceList.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kFixedPoint.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kFixedPoint.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kGateway.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kGateway.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kGroupFunction.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kGroupFunction.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kGroupFunctionDefaultHandlers.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kGroupFunctionDefaultHandlers.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kLatencyStats.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kLatencyStats.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kMaretron.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kMaretron.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kMessages.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kMessages.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kMsg.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kMsg.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kPGNDescriptors.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kPGNDescriptors.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kStream.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kStream.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kTimer.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/N2kTimer.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/NMEA2000.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/NMEA2000.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/NMEA2000_virtual.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/NMEA2000_virtual.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/Seasmart.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/__/src/Seasmart.cpp.o.d"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kThreadedGatewayTests.dir/millis.cpp.o.d"
+  "N2kThreadedGatewayTests"
+  "N2kThreadedGatewayTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kThreadedGatewayTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
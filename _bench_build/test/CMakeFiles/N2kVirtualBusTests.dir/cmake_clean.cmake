@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kVirtualBusTests.dir/N2kVirtualBusTest.cpp.o"
+  "CMakeFiles/N2kVirtualBusTests.dir/N2kVirtualBusTest.cpp.o.d"
+  "CMakeFiles/N2kVirtualBusTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kVirtualBusTests.dir/millis.cpp.o.d"
+  "N2kVirtualBusTests"
+  "N2kVirtualBusTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kVirtualBusTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/N2kWakeupTests.dir/N2kWakeupTest.cpp.o"
+  "CMakeFiles/N2kWakeupTests.dir/N2kWakeupTest.cpp.o.d"
+  "CMakeFiles/N2kWakeupTests.dir/millis.cpp.o"
+  "CMakeFiles/N2kWakeupTests.dir/millis.cpp.o.d"
+  "N2kWakeupTests"
+  "N2kWakeupTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/N2kWakeupTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
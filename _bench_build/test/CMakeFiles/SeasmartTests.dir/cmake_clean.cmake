@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SeasmartTests.dir/SeasmartTests.cpp.o"
+  "CMakeFiles/SeasmartTests.dir/SeasmartTests.cpp.o.d"
+  "CMakeFiles/SeasmartTests.dir/millis.cpp.o"
+  "CMakeFiles/SeasmartTests.dir/millis.cpp.o.d"
+  "SeasmartTests"
+  "SeasmartTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SeasmartTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,50 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_bench_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Seasmart "SeasmartTests")
+set_tests_properties(Seasmart PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;30;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kMessages "N2kMessagesTests")
+set_tests_properties(N2kMessages PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;39;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kMessageViews "N2kMessageViewsTests")
+set_tests_properties(N2kMessageViews PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;48;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kMessageStructs "N2kMessageStructsTests")
+set_tests_properties(N2kMessageStructs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;57;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kBatchDecoder "N2kBatchDecoderTests")
+set_tests_properties(N2kBatchDecoder PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;66;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kCZone "N2kCZoneTests")
+set_tests_properties(N2kCZone PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;75;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kFixedPoint "N2kFixedPointTests")
+set_tests_properties(N2kFixedPoint PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;84;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kCANMsgIndex "N2kCANMsgIndexTests")
+set_tests_properties(N2kCANMsgIndex PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;93;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kMsgHandler "N2kMsgHandlerTests")
+set_tests_properties(N2kMsgHandler PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;102;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kMsgBufPool "N2kMsgBufPoolTests")
+set_tests_properties(N2kMsgBufPool PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;111;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kParseMessages "N2kParseMessagesTests")
+set_tests_properties(N2kParseMessages PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;120;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kPGNDescriptors "N2kPGNDescriptorsTests")
+set_tests_properties(N2kPGNDescriptors PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kSendMsg "N2kSendMsgTests")
+set_tests_properties(N2kSendMsg PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;138;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kPeriodicMsg "N2kPeriodicMsgTests")
+set_tests_properties(N2kPeriodicMsg PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;147;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kVirtualBus "N2kVirtualBusTests")
+set_tests_properties(N2kVirtualBus PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;156;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kStatistics "N2kStatisticsTests")
+set_tests_properties(N2kStatistics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;165;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kWakeup "N2kWakeupTests")
+set_tests_properties(N2kWakeup PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;174;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kGateway "N2kGatewayTests")
+set_tests_properties(N2kGateway PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;183;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kLatencyStats "N2kLatencyStatsTests")
+set_tests_properties(N2kLatencyStats PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kPostMsg "N2kPostMsgTests")
+set_tests_properties(N2kPostMsg PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;216;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kThreadedReceive "N2kThreadedReceiveTests")
+set_tests_properties(N2kThreadedReceive PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;228;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(N2kThreadedGateway "N2kThreadedGatewayTests")
+set_tests_properties(N2kThreadedGateway PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;240;add_test;/root/repo/test/CMakeLists.txt;0;")
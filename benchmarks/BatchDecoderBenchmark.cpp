@@ -0,0 +1,119 @@
+/*
+ * BatchDecoderBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include <string.h>
+#include <N2kMessages.h>
+#include <N2kBatchDecoder.h>
+
+// *****************************************************************************
+// Columnar batch decoding compared to ParseN2kPGN* for each message. All
+// cases write same columns. Payload cases use packed 8 byte payloads as
+// read from log.
+#define N2K_BATCH_SIZE 1024
+
+static tN2kMsg Msgs[N2K_BATCH_SIZE];
+static unsigned char Payloads[N2K_BATCH_SIZE][8];
+static unsigned char SIDs[N2K_BATCH_SIZE];
+static double ColA[N2K_BATCH_SIZE], ColB[N2K_BATCH_SIZE], ColC[N2K_BATCH_SIZE];
+static tN2kHeadingReference HeadingRefs[N2K_BATCH_SIZE];
+static tN2kWindReference WindRefs[N2K_BATCH_SIZE];
+
+static void CopyPayloads() {
+  for ( int i=0; i<N2K_BATCH_SIZE; i++ ) memcpy(Payloads[i],Msgs[i].Data,8);
+}
+
+template <typename TWork>
+static void MeasureBatch(const char *Param, TWork Work) {
+  BenchmarkMeasure(Param,"msgs",[&]() {
+      Work();
+      BenchmarkKeep(ColA[N2K_BATCH_SIZE-1]+ColB[N2K_BATCH_SIZE/2]);
+      return N2K_BATCH_SIZE;
+    });
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(BatchDecode127250) {
+  for ( int i=0; i<N2K_BATCH_SIZE; i++ ) {
+    SetN2kPGN127250(Msgs[i],i,0.001*i,( i%7==0 ? N2kDoubleNA : -0.01 ),0.0001*i,N2khr_true);
+  }
+  CopyPayloads();
+
+  MeasureBatch("pgn=127250,decoder=parse",[]() {
+      for ( int i=0; i<N2K_BATCH_SIZE; i++ ) {
+        ParseN2kPGN127250(Msgs[i],SIDs[i],ColA[i],ColB[i],ColC[i],HeadingRefs[i]);
+      }
+    });
+  MeasureBatch("pgn=127250,decoder=batch,input=msgs",[]() {
+      tN2kPGN127250Columns Columns={SIDs,ColA,ColB,ColC,HeadingRefs};
+      N2kBatchDecodePGN127250(Msgs,N2K_BATCH_SIZE,Columns);
+    });
+  MeasureBatch("pgn=127250,decoder=batch,input=payloads",[]() {
+      tN2kPGN127250Columns Columns={SIDs,ColA,ColB,ColC,HeadingRefs};
+      N2kBatchDecodePGN127250(Payloads[0],8,N2K_BATCH_SIZE,Columns);
+    });
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(BatchDecode129025) {
+  for ( int i=0; i<N2K_BATCH_SIZE; i++ ) {
+    SetN2kPGN129025(Msgs[i],60.0+1e-5*i,( i%7==0 ? N2kDoubleNA : 22.0-1e-5*i ));
+  }
+  CopyPayloads();
+
+  MeasureBatch("pgn=129025,decoder=parse",[]() {
+      for ( int i=0; i<N2K_BATCH_SIZE; i++ ) {
+        ParseN2kPGN129025(Msgs[i],ColA[i],ColB[i]);
+      }
+    });
+  MeasureBatch("pgn=129025,decoder=batch,input=msgs",[]() {
+      tN2kPGN129025Columns Columns={ColA,ColB};
+      N2kBatchDecodePGN129025(Msgs,N2K_BATCH_SIZE,Columns);
+    });
+  MeasureBatch("pgn=129025,decoder=batch,input=payloads",[]() {
+      tN2kPGN129025Columns Columns={ColA,ColB};
+      N2kBatchDecodePGN129025(Payloads[0],8,N2K_BATCH_SIZE,Columns);
+    });
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(BatchDecode130306) {
+  for ( int i=0; i<N2K_BATCH_SIZE; i++ ) {
+    SetN2kPGN130306(Msgs[i],i,( i%7==0 ? N2kDoubleNA : 0.01*i ),0.001*i,N2kWind_Apparent);
+  }
+  CopyPayloads();
+
+  MeasureBatch("pgn=130306,decoder=parse",[]() {
+      for ( int i=0; i<N2K_BATCH_SIZE; i++ ) {
+        ParseN2kPGN130306(Msgs[i],SIDs[i],ColA[i],ColB[i],WindRefs[i]);
+      }
+    });
+  MeasureBatch("pgn=130306,decoder=batch,input=msgs",[]() {
+      tN2kPGN130306Columns Columns={SIDs,ColA,ColB,WindRefs};
+      N2kBatchDecodePGN130306(Msgs,N2K_BATCH_SIZE,Columns);
+    });
+  MeasureBatch("pgn=130306,decoder=batch,input=payloads",[]() {
+      tN2kPGN130306Columns Columns={SIDs,ColA,ColB,WindRefs};
+      N2kBatchDecodePGN130306(Payloads[0],8,N2K_BATCH_SIZE,Columns);
+    });
+}
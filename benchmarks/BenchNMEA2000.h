@@ -0,0 +1,192 @@
+/*
+ * BenchNMEA2000.h
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+/*
+ * tBenchNMEA2000 is NMEA2000 object for benchmarks. It replays prerecorded
+ * frame list endlessly to ParseMessages and counts received messages. Sent
+ * frames are just accepted and counted.
+ */
+
+#ifndef _BENCH_NMEA2000_H_
+#define _BENCH_NMEA2000_H_
+
+#include <NMEA2000.h>
+#include <vector>
+#include <thread>
+#include <chrono>
+
+struct tBenchFrame {
+  unsigned long id;
+  unsigned char len;
+  unsigned char buf[8];
+};
+
+typedef std::vector<tBenchFrame> tBenchFrames;
+
+// *****************************************************************************
+inline unsigned long BenchCanId(const tN2kMsg &N2kMsg) {
+  unsigned long id=((unsigned long)(N2kMsg.Priority & 0x7))<<26 | N2kMsg.PGN<<8 | N2kMsg.Source;
+  if ( ((N2kMsg.PGN>>8) & 0xff)<240 ) id|=((unsigned long)N2kMsg.Destination)<<8;
+  return id;
+}
+
+// *****************************************************************************
+// Split message to frames as single frame or fast packet.
+inline void BenchAddFrames(tBenchFrames &Frames, const tN2kMsg &N2kMsg, bool FastPacket, uint8_t Sequence=0) {
+  tBenchFrame Frame;
+  Frame.id=BenchCanId(N2kMsg);
+
+  if ( !FastPacket ) {
+    Frame.len=N2kMsg.DataLen;
+    for (int i=0; i<N2kMsg.DataLen; i++) Frame.buf[i]=N2kMsg.Data[i];
+    Frames.push_back(Frame);
+    return;
+  }
+
+  int cur=0;
+  Frame.len=8;
+  for ( uint8_t iFrame=0; cur<N2kMsg.DataLen; iFrame++ ) {
+    int j=1;
+    Frame.buf[0]=((Sequence&0x7)<<5) | iFrame;
+    if ( iFrame==0 ) Frame.buf[j++]=N2kMsg.DataLen;
+    for ( ; j<8; j++ ) Frame.buf[j]=(cur<N2kMsg.DataLen?N2kMsg.Data[cur++]:0xff);
+    Frames.push_back(Frame);
+  }
+}
+
+// *****************************************************************************
+// Split message to ISO TP broadcast frames: TP.CM BAM and TP.DT frames.
+inline void BenchAddTPFrames(tBenchFrames &Frames, const tN2kMsg &N2kMsg) {
+  tN2kMsg TPMsg;
+  tBenchFrame Frame;
+  uint8_t Packets=(N2kMsg.DataLen+6)/7;
+
+  TPMsg.Priority=7; TPMsg.Source=N2kMsg.Source; TPMsg.Destination=0xff;
+  TPMsg.PGN=60416L; // TP.CM
+  Frame.id=BenchCanId(TPMsg);
+  Frame.len=8;
+  Frame.buf[0]=32; // BAM
+  Frame.buf[1]=N2kMsg.DataLen & 0xff;
+  Frame.buf[2]=N2kMsg.DataLen>>8;
+  Frame.buf[3]=Packets;
+  Frame.buf[4]=0xff;
+  Frame.buf[5]=N2kMsg.PGN & 0xff;
+  Frame.buf[6]=(N2kMsg.PGN>>8) & 0xff;
+  Frame.buf[7]=(N2kMsg.PGN>>16) & 0xff;
+  Frames.push_back(Frame);
+
+  TPMsg.PGN=60160L; // TP.DT
+  Frame.id=BenchCanId(TPMsg);
+  for ( int p=0, cur=0; p<Packets; p++ ) {
+    Frame.buf[0]=p+1;
+    for ( int j=1; j<8; j++ ) Frame.buf[j]=(cur<N2kMsg.DataLen?N2kMsg.Data[cur++]:0xff);
+    Frames.push_back(Frame);
+  }
+}
+
+// *****************************************************************************
+// Interleave frame lists so that frame i of each list are next to each others.
+// This simulates several talkers sending their fast packets at same time.
+inline tBenchFrames BenchInterleave(const std::vector<tBenchFrames> &Lists) {
+  tBenchFrames Result;
+  for ( size_t i=0; ; i++ ) {
+    bool Added=false;
+    for ( size_t l=0; l<Lists.size(); l++ ) {
+      if ( i<Lists[l].size() ) { Result.push_back(Lists[l][i]); Added=true; }
+    }
+    if ( !Added ) break;
+  }
+  return Result;
+}
+
+// *****************************************************************************
+class tBenchNMEA2000 : public tNMEA2000 {
+protected:
+  const tBenchFrames *Frames;
+  size_t NextFrame;
+  uint64_t FramesRead;
+  bool BulkRead;
+  bool BulkSend;
+  uint64_t FramesSent;
+
+protected:
+  bool CANSendFrame(unsigned long, unsigned char, const unsigned char *, bool) override { FramesSent++; return true; }
+  uint16_t CANSendFrames(const tCANFrame *Buf, uint16_t Count, bool wait_sent) override {
+    if ( !BulkSend ) return tNMEA2000::CANSendFrames(Buf,Count,wait_sent);
+    FramesSent+=Count;
+    return Count;
+  }
+  bool CANOpen() override { return true; }
+  bool CANGetFrame(unsigned long &id, unsigned char &len, unsigned char *buf) override {
+    if ( Frames==0 || Frames->empty() ) return false;
+    const tBenchFrame &Frame=(*Frames)[NextFrame];
+    id=Frame.id; len=Frame.len;
+    for (int i=0; i<len; i++) buf[i]=Frame.buf[i];
+    NextFrame++; FramesRead++;
+    if ( NextFrame>=Frames->size() ) NextFrame=0;
+    return true;
+  }
+  // Bulk read simulates driver, which gets several frames with one system call.
+  uint16_t CANGetFrames(tCANFrame *Buf, uint16_t MaxFrames) override {
+    if ( !BulkRead ) return tNMEA2000::CANGetFrames(Buf,MaxFrames);
+    if ( Frames==0 || Frames->empty() ) return 0;
+    for ( uint16_t i=0; i<MaxFrames; i++ ) {
+      const tBenchFrame &Frame=(*Frames)[NextFrame];
+      Buf[i].id=Frame.id; Buf[i].len=Frame.len;
+      for (int j=0; j<Frame.len; j++) Buf[i].buf[j]=Frame.buf[j];
+      NextFrame++;
+      if ( NextFrame>=Frames->size() ) NextFrame=0;
+    }
+    FramesRead+=MaxFrames;
+    return MaxFrames;
+  }
+
+public:
+  tBenchNMEA2000(uint8_t MsgBufSize=5) : Frames(0), NextFrame(0), FramesRead(0), BulkRead(false), BulkSend(false), FramesSent(0) {
+    SetN2kCANMsgBufSize(MsgBufSize);
+    SetMode(N2km_ListenOnly);
+    EnableForward(false);
+  }
+
+  // Open takes some time, since library waits CAN controller to settle.
+  void OpenNow() {
+    while ( !IsOpen() ) {
+      ParseMessages();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  void SetFrames(const tBenchFrames *_Frames) { Frames=_Frames; NextFrame=0; }
+  void SetBulkRead(bool Bulk) { BulkRead=Bulk; }
+  void SetBulkSend(bool Bulk) { BulkSend=Bulk; }
+  uint64_t GetFramesSent() const { return FramesSent; }
+
+  // Parse given count of frames. ParseMessages reads limited count on each call.
+  uint64_t ParseFrames(uint64_t Count) {
+    uint64_t Start=FramesRead;
+    while ( FramesRead-Start<Count ) ParseMessages();
+    return FramesRead-Start;
+  }
+};
+
+#endif
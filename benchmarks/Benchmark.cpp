@@ -0,0 +1,119 @@
+/*
+ * Benchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include <stdio.h>
+#include <string.h>
+
+struct tBenchmarkEntry {
+  const char *Name;
+  tBenchmarkFunc Func;
+  tBenchmarkEntry *pNext;
+};
+
+static tBenchmarkEntry *Benchmarks=0;
+static const char *CurrentBenchmark="";
+static bool TextOutput=false;
+static int ResultCount=0;
+
+// *****************************************************************************
+tBenchmarkRegistrar::tBenchmarkRegistrar(const char *Name, tBenchmarkFunc Func) {
+  tBenchmarkEntry *Entry=new tBenchmarkEntry;
+  Entry->Name=Name;
+  Entry->Func=Func;
+  Entry->pNext=0;
+  // Keep registration order
+  tBenchmarkEntry **pLast=&Benchmarks;
+  for ( ; *pLast!=0; pLast=&(*pLast)->pNext );
+  *pLast=Entry;
+}
+
+// *****************************************************************************
+static void PrintJsonString(const char *Str) {
+  putchar('"');
+  for ( ; *Str!=0; Str++ ) {
+    if ( *Str=='"' || *Str=='\\' ) {
+      putchar('\\'); putchar(*Str);
+    } else if ( (unsigned char)*Str<0x20 ) {
+      printf("\\u%04x",(unsigned char)*Str);
+    } else {
+      putchar(*Str);
+    }
+  }
+  putchar('"');
+}
+
+// *****************************************************************************
+void BenchmarkReport(const char *Param, const char *Unit, uint64_t Items, double Seconds) {
+  double Rate=(Seconds>0?Items/Seconds:0);
+
+  if ( TextOutput ) {
+    printf("%-32s %-28s %14.0f %s/s\n",CurrentBenchmark,Param,Rate,Unit);
+  } else {
+    printf("%s\n    {\"name\": ",(ResultCount>0?",":""));
+    PrintJsonString(CurrentBenchmark);
+    printf(", \"param\": ");
+    PrintJsonString(Param);
+    printf(", \"unit\": ");
+    PrintJsonString(Unit);
+    printf(", \"items\": %llu, \"seconds\": %.6f, \"rate\": %.1f}",(unsigned long long)Items,Seconds,Rate);
+  }
+  ResultCount++;
+  fflush(stdout);
+}
+
+// *****************************************************************************
+// Usage: benchmarks [--text] [name filter]
+// Default output is JSON document with one entry per measurement.
+int main(int argc, char **argv) {
+  const char *Filter=0;
+
+  for ( int i=1; i<argc; i++ ) {
+    if ( strcmp(argv[i],"--text")==0 ) {
+      TextOutput=true;
+    } else {
+      Filter=argv[i];
+    }
+  }
+
+  if ( !TextOutput ) {
+    printf("{\n  \"context\": {\"library\": \"NMEA2000\", \"compiler\": ");
+    PrintJsonString(__VERSION__);
+#if defined(NDEBUG)
+    printf(", \"assertions\": false");
+#else
+    printf(", \"assertions\": true");
+#endif
+    printf("},\n  \"benchmarks\": [");
+  }
+
+  for ( tBenchmarkEntry *Entry=Benchmarks; Entry!=0; Entry=Entry->pNext ) {
+    if ( Filter!=0 && strstr(Entry->Name,Filter)==0 ) continue;
+    CurrentBenchmark=Entry->Name;
+    Entry->Func();
+  }
+
+  if ( !TextOutput ) printf("\n  ]\n}\n");
+
+  return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Benchmark.h
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+/*
+ * Minimal host side benchmark harness. Each benchmark is a function
+ * registered with N2K_BENCHMARK. It calls BenchmarkMeasure one or more
+ * times with a workload, which is repeated until minimum measuring time has
+ * elapsed. Result is reported as items per second. Results are printed as
+ * JSON document as default or as text table with --text option.
+ */
+
+#ifndef _N2K_BENCHMARK_H_
+#define _N2K_BENCHMARK_H_
+
+#include <stdint.h>
+#include <chrono>
+
+typedef void (*tBenchmarkFunc)();
+
+// *****************************************************************************
+class tBenchmarkRegistrar {
+public:
+  tBenchmarkRegistrar(const char *Name, tBenchmarkFunc Func);
+};
+
+#define N2K_BENCHMARK(name) \
+  static void name(); \
+  static tBenchmarkRegistrar name##_Registrar(#name,name); \
+  static void name()
+
+// *****************************************************************************
+// Report result of a measurement. Param is free text describing the variant,
+// e.g. "slots=32". Unit describes what items are, e.g. "frames".
+void BenchmarkReport(const char *Param, const char *Unit, uint64_t Items, double Seconds);
+
+// *****************************************************************************
+// Run Work repeatedly until at least MinSeconds has elapsed. Work must return
+// number of items it processed on single call.
+template <typename TWork>
+void BenchmarkMeasure(const char *Param, const char *Unit, TWork Work, double MinSeconds=0.3) {
+  typedef std::chrono::steady_clock tClock;
+  uint64_t Items=0;
+  tClock::time_point Start=tClock::now();
+  double Elapsed=0;
+
+  do {
+    Items+=Work();
+    Elapsed=std::chrono::duration<double>(tClock::now()-Start).count();
+  } while ( Elapsed<MinSeconds );
+
+  BenchmarkReport(Param,Unit,Items,Elapsed);
+}
+
+// *****************************************************************************
+// Prevent compiler to optimize away results
+template <typename T>
+inline void BenchmarkKeep(const T &v) {
+  asm volatile("" : : "g"(&v) : "memory");
+}
+
+#endif
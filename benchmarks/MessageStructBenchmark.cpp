@@ -0,0 +1,115 @@
+/*
+ * MessageStructBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include <N2kMessageStructs.h>
+
+// *****************************************************************************
+// Structure based Set/Parse overloads compared to argument list functions.
+// Cache cases store parsed values to ring of structures as application
+// typically does.
+#define N2K_STRUCT_LOOPS 1000
+#define N2K_STRUCT_CACHE_SIZE 16
+
+template <typename TWork>
+static void MeasureLoops(const char *Param, TWork Work) {
+  tN2kMsg N2kMsg;
+  BenchmarkMeasure(Param,"msgs",[&]() {
+      for ( int i=0; i<N2K_STRUCT_LOOPS; i++ ) {
+        BenchmarkKeep(Work(N2kMsg,i));
+      }
+      return N2K_STRUCT_LOOPS;
+    });
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(MessageStructParse) {
+  static tN2kMsg GNSS, Engine;
+  static tN2kPGN129029Data GNSSCache[N2K_STRUCT_CACHE_SIZE];
+  SetN2kPGN129029(GNSS,1,19000,3600.0,60.1234567,22.7654321,10.0,N2kGNSSt_GPS,N2kGNSSm_DGNSS,12,0.8,1.2,15.0,1,N2kGNSSt_GPS,100,2.5);
+  SetN2kPGN127489(Engine,1,300000,350,360,14.2,10.5,360000,N2kDoubleNA,N2kDoubleNA,50,-10,tN2kEngineDiscreteStatus1(3),tN2kEngineDiscreteStatus2(1));
+
+  MeasureLoops("pgn=129029,api=args",[](tN2kMsg &, int) {
+      unsigned char SID, nSatellites, nReferenceStations; uint16_t Days, StationID;
+      double Seconds, Latitude, Longitude, Altitude, HDOP, PDOP, Geoidal, Age;
+      tN2kGNSStype GNSStype, StationType; tN2kGNSSmethod Method;
+      ParseN2kPGN129029(GNSS,SID,Days,Seconds,Latitude,Longitude,Altitude,GNSStype,Method,
+                        nSatellites,HDOP,PDOP,Geoidal,nReferenceStations,StationType,StationID,Age);
+      return Latitude+Longitude+Age;
+    });
+  MeasureLoops("pgn=129029,api=struct",[](tN2kMsg &, int) {
+      tN2kPGN129029Data Data;
+      ParseN2kPGN129029(GNSS,Data);
+      return Data.Latitude+Data.Longitude+Data.AgeOfCorrection;
+    });
+  MeasureLoops("pgn=129029,api=args,cache=1",[](tN2kMsg &, int i) {
+      unsigned char SID, nSatellites, nReferenceStations; uint16_t Days, StationID;
+      double Seconds, Latitude, Longitude, Altitude, HDOP, PDOP, Geoidal, Age;
+      tN2kGNSStype GNSStype, StationType; tN2kGNSSmethod Method;
+      ParseN2kPGN129029(GNSS,SID,Days,Seconds,Latitude,Longitude,Altitude,GNSStype,Method,
+                        nSatellites,HDOP,PDOP,Geoidal,nReferenceStations,StationType,StationID,Age);
+      tN2kPGN129029Data &Cache=GNSSCache[i%N2K_STRUCT_CACHE_SIZE];
+      Cache.SID=SID; Cache.DaysSince1970=Days; Cache.SecondsSinceMidnight=Seconds;
+      Cache.Latitude=Latitude; Cache.Longitude=Longitude; Cache.Altitude=Altitude;
+      Cache.GNSStype=GNSStype; Cache.GNSSmethod=Method; Cache.nSatellites=nSatellites;
+      Cache.HDOP=HDOP; Cache.PDOP=PDOP; Cache.GeoidalSeparation=Geoidal;
+      Cache.nReferenceStations=nReferenceStations; Cache.ReferenceStationType=StationType;
+      Cache.ReferenceStationID=StationID; Cache.AgeOfCorrection=Age;
+      return Cache.Latitude;
+    });
+  MeasureLoops("pgn=129029,api=struct,cache=1",[](tN2kMsg &, int i) {
+      tN2kPGN129029Data &Cache=GNSSCache[i%N2K_STRUCT_CACHE_SIZE];
+      ParseN2kPGN129029(GNSS,Cache);
+      return Cache.Latitude;
+    });
+  MeasureLoops("pgn=127489,api=args",[](tN2kMsg &, int) {
+      unsigned char Instance; double OilPress, OilTemp, CoolantTemp, Voltage, FuelRate, Hours, CoolantPress, FuelPress;
+      int8_t Load, Torque; tN2kEngineDiscreteStatus1 Status1; tN2kEngineDiscreteStatus2 Status2;
+      ParseN2kPGN127489(Engine,Instance,OilPress,OilTemp,CoolantTemp,Voltage,FuelRate,Hours,CoolantPress,FuelPress,
+                        Load,Torque,Status1,Status2);
+      return OilPress+Hours+Status1.Status;
+    });
+  MeasureLoops("pgn=127489,api=struct",[](tN2kMsg &, int) {
+      tN2kPGN127489Data Data;
+      ParseN2kPGN127489(Engine,Data);
+      return Data.EngineOilPress+Data.EngineHours+Data.Status1.Status;
+    });
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(MessageStructSet) {
+  static tN2kPGN129029Data GNSS={1,19000,3600.0,60.1234567,22.7654321,10.0,N2kGNSSt_GPS,N2kGNSSm_DGNSS,12,0.8,1.2,15.0,1,N2kGNSSt_GPS,100,2.5};
+
+  MeasureLoops("pgn=129029,api=args",[](tN2kMsg &N2kMsg, int i) {
+      SetN2kPGN129029(N2kMsg,i,GNSS.DaysSince1970,GNSS.SecondsSinceMidnight,GNSS.Latitude,GNSS.Longitude,
+                      GNSS.Altitude,GNSS.GNSStype,GNSS.GNSSmethod,GNSS.nSatellites,GNSS.HDOP,GNSS.PDOP,
+                      GNSS.GeoidalSeparation,GNSS.nReferenceStations,GNSS.ReferenceStationType,
+                      GNSS.ReferenceStationID,GNSS.AgeOfCorrection);
+      return N2kMsg.Data[0];
+    });
+  MeasureLoops("pgn=129029,api=struct",[](tN2kMsg &N2kMsg, int i) {
+      GNSS.SID=i;
+      SetN2kPGN129029(N2kMsg,GNSS);
+      return N2kMsg.Data[0];
+    });
+}
@@ -0,0 +1,80 @@
+/*
+ * MessageViewBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include <N2kMessages.h>
+#include <N2kMessageViews.h>
+
+// *****************************************************************************
+// Handler needing one or two fields of message: full ParseN2kPGN* compared
+// to typed view, which decodes only requested fields.
+#define N2K_VIEW_LOOPS 1000
+
+template <typename TWork>
+static void MeasureLoops(const char *Param, TWork Work) {
+  BenchmarkMeasure(Param,"msgs",[&]() {
+      for ( int i=0; i<N2K_VIEW_LOOPS; i++ ) {
+        BenchmarkKeep(Work());
+      }
+      return N2K_VIEW_LOOPS;
+    });
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(MessageView) {
+  static tN2kMsg GNSS, COGSOG, Heading;
+  SetN2kPGN129029(GNSS,1,19000,3600.0,60.1234567,22.7654321,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,1.2,15.0);
+  SetN2kPGN129026(COGSOG,1,N2khr_true,3.1,5.25);
+  SetN2kPGN127250(Heading,1,1.234,N2kDoubleNA,0.1,N2khr_true);
+
+  MeasureLoops("pgn=129029,fields=latlon,decoder=parse",[]() {
+      unsigned char SID, nSatellites, nReferenceStations; uint16_t Days, StationID;
+      double Seconds, Latitude, Longitude, Altitude, HDOP, PDOP, Geoidal, Age;
+      tN2kGNSStype GNSStype, StationType; tN2kGNSSmethod Method;
+      ParseN2kPGN129029(GNSS,SID,Days,Seconds,Latitude,Longitude,Altitude,GNSStype,Method,
+                        nSatellites,HDOP,PDOP,Geoidal,nReferenceStations,StationType,StationID,Age);
+      return Latitude+Longitude;
+    });
+  MeasureLoops("pgn=129029,fields=latlon,decoder=view",[]() {
+      tN2kPGN129029View View(GNSS);
+      return ( View.IsValid() ? View.Latitude()+View.Longitude() : 0 );
+    });
+  MeasureLoops("pgn=129026,fields=sog,decoder=parse",[]() {
+      unsigned char SID; tN2kHeadingReference Ref; double COG, SOG;
+      ParseN2kPGN129026(COGSOG,SID,Ref,COG,SOG);
+      return SOG;
+    });
+  MeasureLoops("pgn=129026,fields=sog,decoder=view",[]() {
+      tN2kPGN129026View View(COGSOG);
+      return ( View.IsValid() ? View.SOG() : 0 );
+    });
+  MeasureLoops("pgn=127250,fields=heading,decoder=parse",[]() {
+      unsigned char SID; double Heading_, Deviation, Variation; tN2kHeadingReference Ref;
+      ParseN2kPGN127250(Heading,SID,Heading_,Deviation,Variation,Ref);
+      return Heading_;
+    });
+  MeasureLoops("pgn=127250,fields=heading,decoder=view",[]() {
+      tN2kPGN127250View View(Heading);
+      return ( View.IsValid() ? View.Heading() : 0 );
+    });
+}
@@ -0,0 +1,85 @@
+/*
+ * MsgHandlerBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include "BenchNMEA2000.h"
+#include <stdio.h>
+
+// *****************************************************************************
+class tBenchMsgHandler : public tNMEA2000::tMsgHandler {
+protected:
+  void HandleMsg(const tN2kMsg &N2kMsg) override { Handled+=N2kMsg.DataLen; }
+public:
+  uint64_t Handled;
+  tBenchMsgHandler(unsigned long _PGN, tNMEA2000 *_pNMEA2000) : tNMEA2000::tMsgHandler(_PGN,_pNMEA2000), Handled(0) {}
+};
+
+// *****************************************************************************
+class tDispatchNMEA2000 : public tBenchNMEA2000 {
+public:
+  uint64_t Dispatch(const tN2kMsg *Msgs, size_t Count) {
+    for ( size_t i=0; i<Count; i++ ) RunMessageHandlers(Msgs[i]);
+    return Count;
+  }
+};
+
+// Handlers typical application attaches: device list, NMEA0183 conversion,
+// logging and own state trackers.
+static const unsigned long HandlerPGNs[]={
+  59392L, 59904L, 60928L, 126208L, 126464L, 126992L, 126993L, 126996L,
+  126998L, 127245L, 127250L, 127251L, 127257L, 127258L, 127488L, 127489L,
+  127505L, 127508L, 128259L, 128267L, 128275L, 129025L, 129026L, 129029L,
+  129033L, 129283L, 129284L, 129539L, 129540L, 130306L
+};
+
+// Received traffic, rapid messages dominate.
+static const unsigned long TrafficPGNs[]={
+  127250L, 127251L, 129025L, 130306L, 127250L, 127251L, 129025L, 130306L,
+  129026L, 127257L, 129029L, 128267L, 60928L, 127488L, 130310L, 130312L
+};
+
+// *****************************************************************************
+N2K_BENCHMARK(MsgHandlerDispatch) {
+  const size_t HandlerCount=sizeof(HandlerPGNs)/sizeof(HandlerPGNs[0]);
+  const size_t Count=sizeof(TrafficPGNs)/sizeof(TrafficPGNs[0]);
+  tN2kMsg Msgs[Count];
+
+  for ( size_t i=0; i<Count; i++ ) {
+    Msgs[i].SetPGN(TrafficPGNs[i]);
+    Msgs[i].AddByte(0);
+  }
+
+  for ( size_t Wildcards=0; Wildcards<=2; Wildcards+=2 ) {
+    tDispatchNMEA2000 NMEA2000;
+    std::vector<tBenchMsgHandler *> Handlers;
+    char Param[40];
+
+    for ( size_t i=0; i<Wildcards; i++ ) Handlers.push_back(new tBenchMsgHandler(0,&NMEA2000));
+    for ( size_t i=0; i<HandlerCount; i++ ) Handlers.push_back(new tBenchMsgHandler(HandlerPGNs[i],&NMEA2000));
+
+    snprintf(Param,sizeof(Param),"handlers=%u wildcards=%u",(unsigned)HandlerCount,(unsigned)Wildcards);
+    BenchmarkMeasure(Param,"messages",[&]() { return NMEA2000.Dispatch(Msgs,Count); });
+
+    for ( size_t i=0; i<Handlers.size(); i++ ) delete Handlers[i];
+  }
+}
@@ -0,0 +1,89 @@
+/*
+ * PGNClassifyBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include "BenchNMEA2000.h"
+
+// *****************************************************************************
+class tClassifyNMEA2000 : public tBenchNMEA2000 {
+public:
+  // Classification done for every received frame
+  uint64_t ClassifyReceived(const unsigned long *PGNs, size_t Count) {
+    uint64_t Known=0;
+    bool SystemMessage, FastPacket;
+    for ( size_t i=0; i<Count; i++ ) {
+      Known+=CheckKnownMessage(PGNs[i],SystemMessage,FastPacket);
+      Known+=FastPacket;
+    }
+    BenchmarkKeep(Known);
+    return Count;
+  }
+  // Classification done for every sent message
+  uint64_t ClassifySent(const unsigned long *PGNs, size_t Count) {
+    uint64_t FastPackets=0;
+    for ( size_t i=0; i<Count; i++ ) {
+      FastPackets+=IsFastPacketPGN(PGNs[i]);
+    }
+    BenchmarkKeep(FastPackets);
+    return Count;
+  }
+};
+
+// Typical traffic: rapid PGNs, some fast packets, system messages, proprietary
+// and unknown PGNs.
+static const unsigned long TrafficPGNs[]={
+  127250L, 127251L, 129025L, 130306L, 127250L, 127251L, 129025L, 130306L,
+  129026L, 127257L, 129029L, 128267L, 60928L, 59904L, 126208L, 126996L,
+  130820L, 65280L, 127488L, 127489L, 129540L, 130312L, 65000L, 127258L
+};
+
+// Application specific lists, which are searched for PGNs not on default lists.
+static const unsigned long ExtSingleFrame[] PROGMEM={
+  127258L, 127502L, 128000L, 129027L, 129033L, 129291L, 129539L, 130310L,
+  130315L, 130317L, 130318L, 130319L, 130560L, 65000L, 65001L, 65002L,
+  65003L, 65004L, 65005L, 65006L, 0
+};
+static const unsigned long ExtFastPacket[] PROGMEM={
+  126720L, 127500L, 128520L, 129044L, 129045L, 129283L, 129284L, 129285L,
+  130060L, 130061L, 130064L, 130065L, 130066L, 130067L, 130068L, 130069L,
+  130070L, 130071L, 130072L, 130073L, 0
+};
+
+// *****************************************************************************
+N2K_BENCHMARK(PGNClassify) {
+  const size_t Count=sizeof(TrafficPGNs)/sizeof(TrafficPGNs[0]);
+  {
+    tClassifyNMEA2000 NMEA2000;
+    NMEA2000.OpenNow();
+    BenchmarkMeasure("receive, default lists","lookups",[&]() { return NMEA2000.ClassifyReceived(TrafficPGNs,Count); });
+    BenchmarkMeasure("send, default lists","lookups",[&]() { return NMEA2000.ClassifySent(TrafficPGNs,Count); });
+  }
+  {
+    tClassifyNMEA2000 NMEA2000;
+    NMEA2000.ExtendSingleFrameMessages(ExtSingleFrame);
+    NMEA2000.ExtendFastPacketMessages(ExtFastPacket);
+    NMEA2000.OpenNow();
+    BenchmarkMeasure("receive, extended lists","lookups",[&]() { return NMEA2000.ClassifyReceived(TrafficPGNs,Count); });
+    BenchmarkMeasure("send, extended lists","lookups",[&]() { return NMEA2000.ClassifySent(TrafficPGNs,Count); });
+  }
+}
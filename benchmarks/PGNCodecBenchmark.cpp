@@ -0,0 +1,108 @@
+/*
+ * PGNCodecBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include <N2kMessages.h>
+
+// *****************************************************************************
+// SetN2kPGN* / ParseN2kPGN* round trips for common PGNs. Each call of Work
+// sets message with varying values and parses it back.
+#define N2K_CODEC_LOOPS 1000
+
+template <typename TRoundTrip>
+static void MeasureRoundTrip(const char *Param, TRoundTrip RoundTrip) {
+  tN2kMsg N2kMsg;
+  BenchmarkMeasure(Param,"msgs",[&]() {
+      for ( int i=0; i<N2K_CODEC_LOOPS; i++ ) {
+        BenchmarkKeep(RoundTrip(N2kMsg,i));
+      }
+      return N2K_CODEC_LOOPS;
+    });
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(PGNRoundTrip) {
+  MeasureRoundTrip("pgn=126992",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char SID; uint16_t Date; double Time; tN2kTimeSource Source;
+      SetN2kPGN126992(N2kMsg,i,19000,3600.0+i);
+      return ParseN2kPGN126992(N2kMsg,SID,Date,Time,Source) && Time>0;
+    });
+  MeasureRoundTrip("pgn=127250",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char SID; double Heading, Deviation, Variation; tN2kHeadingReference Ref;
+      SetN2kPGN127250(N2kMsg,i,0.001*i,N2kDoubleNA,0.1,N2khr_true);
+      return ParseN2kPGN127250(N2kMsg,SID,Heading,Deviation,Variation,Ref) && Heading>=0;
+    });
+  MeasureRoundTrip("pgn=127257",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char SID; double Yaw, Pitch, Roll;
+      SetN2kPGN127257(N2kMsg,i,0.001*i,0.01,-0.02);
+      return ParseN2kPGN127257(N2kMsg,SID,Yaw,Pitch,Roll) && Yaw>=0;
+    });
+  MeasureRoundTrip("pgn=127488",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char Instance; double Speed, Boost; int8_t Trim;
+      SetN2kPGN127488(N2kMsg,0,1000+i,120000,5);
+      return ParseN2kPGN127488(N2kMsg,Instance,Speed,Boost,Trim) && Speed>0;
+    });
+  MeasureRoundTrip("pgn=127508",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char Instance, SID; double Voltage, Current, Temperature;
+      SetN2kPGN127508(N2kMsg,1,12.0+0.001*i,-3.5,300.0,i);
+      return ParseN2kPGN127508(N2kMsg,Instance,Voltage,Current,Temperature,SID) && Voltage>0;
+    });
+  MeasureRoundTrip("pgn=128259",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char SID; double Water, Ground; tN2kSpeedWaterReferenceType SWRT;
+      SetN2kPGN128259(N2kMsg,i,0.01*i,N2kDoubleNA);
+      return ParseN2kPGN128259(N2kMsg,SID,Water,Ground,SWRT) && Water>=0;
+    });
+  MeasureRoundTrip("pgn=128267",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char SID; double Depth, Offset, Range;
+      SetN2kPGN128267(N2kMsg,i,10.0+0.01*i,0.5,100);
+      return ParseN2kPGN128267(N2kMsg,SID,Depth,Offset,Range) && Depth>0;
+    });
+  MeasureRoundTrip("pgn=129025",[](tN2kMsg &N2kMsg, int i) {
+      double Latitude, Longitude;
+      SetN2kPGN129025(N2kMsg,60.1+1e-6*i,22.5);
+      return ParseN2kPGN129025(N2kMsg,Latitude,Longitude) && Latitude>0;
+    });
+  MeasureRoundTrip("pgn=129026",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char SID; tN2kHeadingReference Ref; double COG, SOG;
+      SetN2kPGN129026(N2kMsg,i,N2khr_true,0.001*i,5.2);
+      return ParseN2kPGN129026(N2kMsg,SID,Ref,COG,SOG) && SOG>0;
+    });
+  MeasureRoundTrip("pgn=129029",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char SID, nSatellites, nReferenceStations; uint16_t Days, StationID;
+      double Seconds, Latitude, Longitude, Altitude, HDOP, PDOP, Geoidal, Age;
+      tN2kGNSStype GNSStype, StationType; tN2kGNSSmethod Method;
+      SetN2kPGN129029(N2kMsg,i,19000,3600.0+i,60.1+1e-6*i,22.5,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,1.2,15.0);
+      return ParseN2kPGN129029(N2kMsg,SID,Days,Seconds,Latitude,Longitude,Altitude,GNSStype,Method,
+                               nSatellites,HDOP,PDOP,Geoidal,nReferenceStations,StationType,StationID,Age) && Latitude>0;
+    });
+  MeasureRoundTrip("pgn=130306",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char SID; double Speed, Angle; tN2kWindReference Ref;
+      SetN2kPGN130306(N2kMsg,i,5.0+0.01*i,0.5,N2kWind_Apparent);
+      return ParseN2kPGN130306(N2kMsg,SID,Speed,Angle,Ref) && Speed>0;
+    });
+  MeasureRoundTrip("pgn=130316",[](tN2kMsg &N2kMsg, int i) {
+      unsigned char SID, Instance; tN2kTempSource Source; double Actual, Set;
+      SetN2kPGN130316(N2kMsg,i,0,N2kts_SeaTemperature,290.0+0.01*i);
+      return ParseN2kPGN130316(N2kMsg,SID,Instance,Source,Actual,Set) && Actual>0;
+    });
+}
@@ -0,0 +1,114 @@
+/*
+ * PGNDescriptorBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include <N2kMessages.h>
+#include <N2kPGNDescriptors.h>
+
+// *****************************************************************************
+// Generic descriptor engine compared to hand written ParseN2kPGN* and
+// SetN2kPGN* functions for same messages.
+#define N2K_DESCRIPTOR_LOOPS 1000
+
+template <typename TWork>
+static void MeasureLoops(const char *Param, TWork Work) {
+  tN2kMsg N2kMsg;
+  BenchmarkMeasure(Param,"msgs",[&]() {
+      for ( int i=0; i<N2K_DESCRIPTOR_LOOPS; i++ ) {
+        BenchmarkKeep(Work(N2kMsg,i));
+      }
+      return N2K_DESCRIPTOR_LOOPS;
+    });
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(PGNDescriptorDecode) {
+  static tN2kMsg Heading, Wind, Position;
+  SetN2kPGN127250(Heading,1,1.234,N2kDoubleNA,0.1,N2khr_true);
+  SetN2kPGN130306(Wind,1,7.5,1.2,N2kWind_Apparent);
+  SetN2kPGN129025(Position,60.1234567,22.7654321);
+
+  MeasureLoops("pgn=127250,codec=handwritten",[](tN2kMsg &, int) {
+      unsigned char SID; double Heading_, Deviation, Variation; tN2kHeadingReference Ref;
+      ParseN2kPGN127250(Heading,SID,Heading_,Deviation,Variation,Ref);
+      return Heading_+Variation;
+    });
+  MeasureLoops("pgn=127250,codec=descriptor",[](tN2kMsg &, int) {
+      static const tN2kPGNDescriptor *Descriptor=N2kFindPGNDescriptor(127250L);
+      double Values[N2kMaxDescriptorFields];
+      N2kDecodeFields(Heading,*Descriptor,Values,N2kMaxDescriptorFields);
+      return Values[1]+Values[3];
+    });
+  MeasureLoops("pgn=130306,codec=handwritten",[](tN2kMsg &, int) {
+      unsigned char SID; double Speed, Angle; tN2kWindReference Ref;
+      ParseN2kPGN130306(Wind,SID,Speed,Angle,Ref);
+      return Speed+Angle;
+    });
+  MeasureLoops("pgn=130306,codec=descriptor",[](tN2kMsg &, int) {
+      static const tN2kPGNDescriptor *Descriptor=N2kFindPGNDescriptor(130306L);
+      double Values[N2kMaxDescriptorFields];
+      N2kDecodeFields(Wind,*Descriptor,Values,N2kMaxDescriptorFields);
+      return Values[1]+Values[2];
+    });
+  MeasureLoops("pgn=129025,codec=handwritten",[](tN2kMsg &, int) {
+      double Latitude, Longitude;
+      ParseN2kPGN129025(Position,Latitude,Longitude);
+      return Latitude+Longitude;
+    });
+  MeasureLoops("pgn=129025,codec=descriptor",[](tN2kMsg &, int) {
+      static const tN2kPGNDescriptor *Descriptor=N2kFindPGNDescriptor(129025L);
+      double Values[N2kMaxDescriptorFields];
+      N2kDecodeFields(Position,*Descriptor,Values,N2kMaxDescriptorFields);
+      return Values[0]+Values[1];
+    });
+  // Includes descriptor lookup as with generic logging
+  MeasureLoops("pgn=127250,codec=descriptor-lookup",[](tN2kMsg &, int) {
+      double Values[N2kMaxDescriptorFields];
+      N2kDecodeFields(Heading,*N2kFindPGNDescriptor(Heading.PGN),Values,N2kMaxDescriptorFields);
+      return Values[1];
+    });
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(PGNDescriptorEncode) {
+  MeasureLoops("pgn=127250,codec=handwritten",[](tN2kMsg &N2kMsg, int i) {
+      SetN2kPGN127250(N2kMsg,i,0.001*i,N2kDoubleNA,0.1,N2khr_true);
+      return N2kMsg.Data[1];
+    });
+  MeasureLoops("pgn=127250,codec=descriptor",[](tN2kMsg &N2kMsg, int i) {
+      static const tN2kPGNDescriptor *Descriptor=N2kFindPGNDescriptor(127250L);
+      double Values[]={ (double)(i&0xff), 0.001*i, N2kDoubleNA, 0.1, N2khr_true, 0 };
+      N2kEncodeFields(N2kMsg,*Descriptor,Values);
+      return N2kMsg.Data[1];
+    });
+  MeasureLoops("pgn=130306,codec=handwritten",[](tN2kMsg &N2kMsg, int i) {
+      SetN2kPGN130306(N2kMsg,i,5.0+0.01*i,0.5,N2kWind_Apparent);
+      return N2kMsg.Data[1];
+    });
+  MeasureLoops("pgn=130306,codec=descriptor",[](tN2kMsg &N2kMsg, int i) {
+      static const tN2kPGNDescriptor *Descriptor=N2kFindPGNDescriptor(130306L);
+      double Values[]={ (double)(i&0xff), 5.0+0.01*i, 0.5, N2kWind_Apparent, 0 };
+      N2kEncodeFields(N2kMsg,*Descriptor,Values);
+      return N2kMsg.Data[1];
+    });
+}
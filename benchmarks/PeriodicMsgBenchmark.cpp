@@ -0,0 +1,57 @@
+/*
+ * PeriodicMsgBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include "BenchNMEA2000.h"
+#include <N2kMessages.h>
+#include <stdio.h>
+
+// *****************************************************************************
+static bool FillRudder(tN2kMsg &N2kMsg, void *) {
+  SetN2kRudder(N2kMsg,0.1);
+  return true;
+}
+
+// *****************************************************************************
+// Cost of ParseMessages loop with many registered periodic messages. Periods
+// are 100 ms - 10 s, so on most calls nothing is due.
+N2K_BENCHMARK(PeriodicMsgIdle) {
+  static const int Counts[]={ 10, 100, 1000 };
+  static const uint32_t Periods[]={ 100, 250, 1000, 2500, 10000 };
+  tBenchFrames NoFrames;
+
+  for ( size_t i=0; i<sizeof(Counts)/sizeof(Counts[0]); i++ ) {
+    tBenchNMEA2000 NMEA2000;
+    NMEA2000.SetMode(tNMEA2000::N2km_SendOnly);
+    NMEA2000.SetFrames(&NoFrames);
+    for ( int n=0; n<Counts[i]; n++ ) NMEA2000.AddPeriodicMsg(127245L,Periods[n%5],FillRudder);
+    NMEA2000.OpenNow();
+
+    char Param[40];
+    snprintf(Param,sizeof(Param),"msgs=%d",Counts[i]);
+    BenchmarkMeasure(Param,"calls",[&]() {
+        for ( int n=0; n<1000; n++ ) NMEA2000.ParseMessages();
+        return 1000;
+      });
+  }
+}
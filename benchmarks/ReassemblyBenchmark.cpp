@@ -0,0 +1,114 @@
+/*
+ * ReassemblyBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include "BenchNMEA2000.h"
+#include <N2kMessages.h>
+#include <stdio.h>
+
+// *****************************************************************************
+// Each talker sends GNSS position (fast packet, 7 frames) and heading (single
+// frame). Talker frames are interleaved, so that there are as many fast
+// packets under reassembly as there are talkers.
+static tBenchFrames MakeTalkerFrames(int Talkers) {
+  std::vector<tBenchFrames> Lists(Talkers);
+  tN2kMsg N2kMsg;
+
+  for ( int t=0; t<Talkers; t++ ) {
+    SetN2kGNSS(N2kMsg,1,19000,3600.0+t,60.1+t*0.001,22.5,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,1.2,15.0);
+    N2kMsg.Source=t;
+    BenchAddFrames(Lists[t],N2kMsg,true,t);
+    SetN2kTrueHeading(N2kMsg,1,0.5);
+    N2kMsg.Source=t;
+    BenchAddFrames(Lists[t],N2kMsg,false);
+  }
+
+  return BenchInterleave(Lists);
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(ReassemblyBySlotCount) {
+  static const uint8_t SlotCounts[]={ 8, 16, 32, 64, 128, 250 };
+
+  for ( size_t i=0; i<sizeof(SlotCounts)/sizeof(SlotCounts[0]); i++ ) {
+    uint8_t Slots=SlotCounts[i];
+    int Talkers=Slots*3/4;
+    tBenchFrames Frames=MakeTalkerFrames(Talkers);
+    tBenchNMEA2000 NMEA2000(Slots);
+    NMEA2000.OpenNow();
+    NMEA2000.SetFrames(&Frames);
+
+    char Param[40];
+    snprintf(Param,sizeof(Param),"slots=%u talkers=%d",Slots,Talkers);
+    BenchmarkMeasure(Param,"frames",[&]() { return NMEA2000.ParseFrames(Frames.size()); });
+  }
+}
+
+// *****************************************************************************
+static uint64_t MixedMsgs=0;
+static void CountMixedMsg(const tN2kMsg &) { MixedMsgs++; }
+
+// *****************************************************************************
+// Mixed traffic: each talker sends heading and rudder (single frame), GNSS
+// position (fast packet) and 60 byte proprietary message as ISO TP broadcast.
+N2K_BENCHMARK(ReassemblyMixed) {
+  static const int TalkerCounts[]={ 1, 4, 16 };
+
+  for ( size_t i=0; i<sizeof(TalkerCounts)/sizeof(TalkerCounts[0]); i++ ) {
+    int Talkers=TalkerCounts[i];
+    std::vector<tBenchFrames> Lists(Talkers);
+    tN2kMsg N2kMsg;
+
+    for ( int t=0; t<Talkers; t++ ) {
+      SetN2kTrueHeading(N2kMsg,1,0.5);
+      N2kMsg.Source=t;
+      BenchAddFrames(Lists[t],N2kMsg,false);
+      SetN2kGNSS(N2kMsg,1,19000,3600.0+t,60.1,22.5,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,1.2,15.0);
+      N2kMsg.Source=t;
+      BenchAddFrames(Lists[t],N2kMsg,true,t);
+      SetN2kRudder(N2kMsg,0.1);
+      N2kMsg.Source=t;
+      BenchAddFrames(Lists[t],N2kMsg,false);
+      N2kMsg.Clear();
+      N2kMsg.SetPGN(65280L);
+      N2kMsg.Source=t;
+      for ( int b=0; b<60; b++ ) N2kMsg.AddByte(b);
+      BenchAddTPFrames(Lists[t],N2kMsg);
+    }
+    tBenchFrames Frames=BenchInterleave(Lists);
+
+    tBenchNMEA2000 NMEA2000(2*Talkers+2);
+    NMEA2000.SetMsgHandler(CountMixedMsg);
+    NMEA2000.OpenNow();
+    NMEA2000.SetFrames(&Frames);
+
+    // Check that all messages are received. ParseMessages may read over the list end.
+    MixedMsgs=0;
+    NMEA2000.ParseFrames(Frames.size());
+    if ( MixedMsgs<(uint64_t)(4*Talkers) ) fprintf(stderr,"ReassemblyMixed: received %llu of %d messages\n",(unsigned long long)MixedMsgs,4*Talkers);
+
+    char Param[40];
+    snprintf(Param,sizeof(Param),"talkers=%d",Talkers);
+    BenchmarkMeasure(Param,"frames",[&]() { return NMEA2000.ParseFrames(Frames.size()); });
+  }
+}
@@ -0,0 +1,146 @@
+/*
+ * RingBufferBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+// File is compiled with N2K_ATOMIC_RING_BUFFERS, see CMakeLists.txt.
+
+#include "Benchmark.h"
+#include <NMEA2000.h>
+#include <RingBuffer.h>
+#include <string.h>
+#include <thread>
+#include <mutex>
+
+// Frames passed through buffer on each measurement round.
+static const uint32_t RingBenchFrames=100000;
+static const uint16_t RingBenchSize=256;
+
+// *****************************************************************************
+static void FillFrame(tNMEA2000::tCANFrame &Frame, uint32_t i) {
+  Frame.id=i;
+  Frame.len=8;
+  memset(Frame.buf,(uint8_t)i,8);
+}
+
+// *****************************************************************************
+// Producer thread adds frames and caller thread reads them out. Both sides
+// spin with yield, when buffer is full or empty. Result is frames passed.
+template <typename TAdd, typename TRead>
+static uint64_t RunProducerConsumer(TAdd Add, TRead Read) {
+  std::thread Producer([&]() {
+      for ( uint32_t i=0; i<RingBenchFrames; ) {
+        if ( Add(i) ) { i++; } else { std::this_thread::yield(); }
+      }
+    });
+
+  uint64_t Sum=0;
+  for ( uint32_t i=0; i<RingBenchFrames; ) {
+    if ( Read(Sum) ) { i++; } else { std::this_thread::yield(); }
+  }
+  Producer.join();
+  BenchmarkKeep(Sum);
+
+  return RingBenchFrames;
+}
+
+// *****************************************************************************
+// tRingBuffer with mutex around add and read.
+N2K_BENCHMARK(RingBufferLocked) {
+  tRingBuffer<tNMEA2000::tCANFrame> Buffer(RingBenchSize);
+  std::mutex Lock;
+
+  BenchmarkMeasure("copy","frames",[&]() {
+      return RunProducerConsumer(
+        [&](uint32_t i) {
+          tNMEA2000::tCANFrame Frame;
+          FillFrame(Frame,i);
+          std::lock_guard<std::mutex> Guard(Lock);
+          return Buffer.add(Frame);
+        },
+        [&](uint64_t &Sum) {
+          tNMEA2000::tCANFrame Frame;
+          { std::lock_guard<std::mutex> Guard(Lock);
+            if ( !Buffer.read(Frame) ) return false;
+          }
+          Sum+=Frame.id;
+          return true;
+        });
+    });
+
+  // Zero copy requires lock to be held until value has been handled.
+  BenchmarkMeasure("ref","frames",[&]() {
+      return RunProducerConsumer(
+        [&](uint32_t i) {
+          std::lock_guard<std::mutex> Guard(Lock);
+          tNMEA2000::tCANFrame *Frame=Buffer.getAddRef();
+          if ( Frame==0 ) return false;
+          FillFrame(*Frame,i);
+          return true;
+        },
+        [&](uint64_t &Sum) {
+          std::lock_guard<std::mutex> Guard(Lock);
+          const tNMEA2000::tCANFrame *Frame=Buffer.getReadRef();
+          if ( Frame==0 ) return false;
+          Sum+=Frame->id;
+          return true;
+        });
+    });
+}
+
+// *****************************************************************************
+// tSPSCRingBuffer without any locking.
+N2K_BENCHMARK(RingBufferSPSC) {
+  tSPSCRingBuffer<tNMEA2000::tCANFrame> Buffer(RingBenchSize);
+
+  BenchmarkMeasure("copy","frames",[&]() {
+      return RunProducerConsumer(
+        [&](uint32_t i) {
+          tNMEA2000::tCANFrame Frame;
+          FillFrame(Frame,i);
+          return Buffer.add(Frame);
+        },
+        [&](uint64_t &Sum) {
+          tNMEA2000::tCANFrame Frame;
+          if ( !Buffer.read(Frame) ) return false;
+          Sum+=Frame.id;
+          return true;
+        });
+    });
+
+  BenchmarkMeasure("ref","frames",[&]() {
+      return RunProducerConsumer(
+        [&](uint32_t i) {
+          tNMEA2000::tCANFrame *Frame=Buffer.getAddRef();
+          if ( Frame==0 ) return false;
+          FillFrame(*Frame,i);
+          Buffer.commitAdd();
+          return true;
+        },
+        [&](uint64_t &Sum) {
+          const tNMEA2000::tCANFrame *Frame=Buffer.getReadRef();
+          if ( Frame==0 ) return false;
+          Sum+=Frame->id;
+          Buffer.commitRead();
+          return true;
+        });
+    });
+}
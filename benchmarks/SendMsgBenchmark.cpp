@@ -0,0 +1,59 @@
+/*
+ * SendMsgBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include "BenchNMEA2000.h"
+#include <N2kMessages.h>
+#include <stdio.h>
+
+// *****************************************************************************
+static void MakeSendMsgs(tN2kMsg *Msgs) {
+  SetN2kProductInformation(Msgs[0],2100,1234,"Benchmark model","1.0.0.0 (2026-10-17)","1.0.0.0","00000001",1,1);
+  SetN2kGNSS(Msgs[1],1,19000,3600.0,60.1,22.5,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,1.2,15.0);
+  SetN2kAISClassAStatic(Msgs[2],5,N2kaisr_Initial,230123456,9123456,"OH1234","BENCHMARK VESSEL",70,
+                        120.0,20.0,10.0,30.0,19000,36000.0,5.5,"HELSINKI",N2kaisv_ITU_R_M_1371_3,N2kGNSSt_GPS,
+                        N2kaisdte_Ready,N2kaischannel_A_VDL_reception,0xff);
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(SendMsgFastPacket) {
+  static const char *Names[]={ "126996", "129029", "129794" };
+  tN2kMsg Msgs[3];
+  MakeSendMsgs(Msgs);
+
+  for ( int Bulk=0; Bulk<=1; Bulk++ ) {
+    tBenchNMEA2000 NMEA2000;
+    NMEA2000.SetMode(tNMEA2000::N2km_SendOnly);
+    NMEA2000.SetBulkSend(Bulk!=0);
+    NMEA2000.OpenNow();
+
+    for ( int i=0; i<3; i++ ) {
+      char Param[40];
+      snprintf(Param,sizeof(Param),"pgn=%s send=%s len=%d",Names[i],(Bulk?"bulk":"single"),Msgs[i].DataLen);
+      BenchmarkMeasure(Param,"msgs",[&]() {
+          for ( int n=0; n<100; n++ ) NMEA2000.SendMsg(Msgs[i]);
+          return 100;
+        });
+    }
+  }
+}
@@ -0,0 +1,97 @@
+/*
+ * SingleFrameBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include "BenchNMEA2000.h"
+#include <N2kMessages.h>
+#include <stdio.h>
+
+// *****************************************************************************
+// Rapid single frame traffic: heading, rate of turn, position rapid update and
+// wind from several sources.
+static tBenchFrames MakeRapidFrames(int Sources) {
+  tBenchFrames Frames;
+  tN2kMsg N2kMsg;
+
+  for ( int s=0; s<Sources; s++ ) {
+    SetN2kTrueHeading(N2kMsg,1,0.5+s*0.01);
+    N2kMsg.Source=s;
+    BenchAddFrames(Frames,N2kMsg,false);
+    SetN2kRateOfTurn(N2kMsg,1,0.01);
+    N2kMsg.Source=s;
+    BenchAddFrames(Frames,N2kMsg,false);
+    SetN2kLatLonRapid(N2kMsg,60.1+s*0.001,22.5);
+    N2kMsg.Source=s;
+    BenchAddFrames(Frames,N2kMsg,false);
+    SetN2kWindSpeed(N2kMsg,1,5.2,0.7,N2kWind_Apparent);
+    N2kMsg.Source=s;
+    BenchAddFrames(Frames,N2kMsg,false);
+  }
+
+  return Frames;
+}
+
+static uint64_t RapidMsgCount=0;
+static void CountRapidMsg(const tN2kMsg &N2kMsg) { RapidMsgCount+=N2kMsg.DataLen; }
+
+// *****************************************************************************
+N2K_BENCHMARK(SingleFrameParse) {
+  static const int SourceCounts[]={ 1, 4, 16 };
+
+  for ( size_t i=0; i<sizeof(SourceCounts)/sizeof(SourceCounts[0]); i++ ) {
+    tBenchFrames Frames=MakeRapidFrames(SourceCounts[i]);
+    tBenchNMEA2000 NMEA2000(10);
+    NMEA2000.SetMsgHandler(CountRapidMsg);
+    NMEA2000.OpenNow();
+    NMEA2000.SetFrames(&Frames);
+
+    char Param[40];
+    snprintf(Param,sizeof(Param),"sources=%d",SourceCounts[i]);
+    BenchmarkMeasure(Param,"frames",[&]() { return NMEA2000.ParseFrames(Frames.size()); });
+  }
+  BenchmarkKeep(RapidMsgCount);
+}
+
+// *****************************************************************************
+// Frame reading with driver single frame and bulk read and different frame
+// budget per ParseMessages call.
+N2K_BENCHMARK(FrameRead) {
+  static const uint16_t Budgets[]={ 20, 200 };
+  tBenchFrames Frames=MakeRapidFrames(4);
+
+  for ( int Bulk=0; Bulk<=1; Bulk++ ) {
+    for ( size_t i=0; i<sizeof(Budgets)/sizeof(Budgets[0]); i++ ) {
+      tBenchNMEA2000 NMEA2000(10);
+      NMEA2000.SetMsgHandler(CountRapidMsg);
+      NMEA2000.OpenNow();
+      NMEA2000.SetFrames(&Frames);
+      NMEA2000.SetBulkRead(Bulk!=0);
+      NMEA2000.SetMaxReadFramesOnParse(Budgets[i]);
+
+      char Param[40];
+      snprintf(Param,sizeof(Param),"read=%s budget=%u",(Bulk?"bulk":"single"),Budgets[i]);
+      BenchmarkMeasure(Param,"frames",[&]() { return NMEA2000.ParseFrames(1000); });
+    }
+  }
+  BenchmarkKeep(RapidMsgCount);
+}
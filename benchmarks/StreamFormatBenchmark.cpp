@@ -0,0 +1,120 @@
+/*
+ * StreamFormatBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include <N2kMessages.h>
+#include <ActisenseReader.h>
+#include <Seasmart.h>
+#include <stdio.h>
+#include <vector>
+
+// *****************************************************************************
+// Memory stream. Writes are appended to buffer, reads return buffer endlessly.
+class tBenchStream : public N2kStream {
+protected:
+  std::vector<uint8_t> Data;
+  size_t ReadPos;
+
+public:
+  tBenchStream() : ReadPos(0) {}
+  int read() override {
+    if ( Data.empty() ) return -1;
+    int c=Data[ReadPos++];
+    if ( ReadPos>=Data.size() ) ReadPos=0;
+    return c;
+  }
+  int peek() override { return ( Data.empty()?-1:Data[ReadPos] ); }
+  size_t write(const uint8_t* data, size_t size) override {
+    Data.insert(Data.end(),data,data+size);
+    return size;
+  }
+  void Clear() { Data.clear(); ReadPos=0; }
+  size_t Size() const { return Data.size(); }
+};
+
+// *****************************************************************************
+// Typical mix: heading, rudder, position rapid and GNSS position.
+static std::vector<tN2kMsg> MakeStreamMsgs() {
+  std::vector<tN2kMsg> Msgs;
+  tN2kMsg N2kMsg;
+
+  SetN2kTrueHeading(N2kMsg,1,0.5); Msgs.push_back(N2kMsg);
+  SetN2kRudder(N2kMsg,0.1); Msgs.push_back(N2kMsg);
+  SetN2kLatLonRapid(N2kMsg,60.1,22.5); Msgs.push_back(N2kMsg);
+  SetN2kGNSS(N2kMsg,1,19000,3600,60.1,22.5,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,1.2,15.0); Msgs.push_back(N2kMsg);
+  for ( size_t i=0; i<Msgs.size(); i++ ) { Msgs[i].Source=22; Msgs[i].Destination=0xff; }
+
+  return Msgs;
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(ActisenseFormat) {
+  std::vector<tN2kMsg> Msgs=MakeStreamMsgs();
+  tBenchStream Stream;
+
+  BenchmarkMeasure("write","msgs",[&]() {
+      Stream.Clear();
+      for ( int n=0; n<100; n++ ) {
+        for ( size_t i=0; i<Msgs.size(); i++ ) Msgs[i].SendInActisenseFormat(&Stream);
+      }
+      return 100*Msgs.size();
+    });
+
+  tActisenseReader Reader;
+  tN2kMsg N2kMsg;
+  Reader.SetReadStream(&Stream);
+  BenchmarkMeasure("read","msgs",[&]() {
+      size_t Count=0;
+      for ( int n=0; n<100*(int)Msgs.size(); n++ ) {
+        if ( Reader.GetMessageFromStream(N2kMsg) ) Count++;
+      }
+      return Count;
+    });
+}
+
+// *****************************************************************************
+N2K_BENCHMARK(SeasmartFormat) {
+  std::vector<tN2kMsg> Msgs=MakeStreamMsgs();
+  std::vector<std::vector<char> > Lines(Msgs.size(),std::vector<char>(500));
+
+  BenchmarkMeasure("write","msgs",[&]() {
+      size_t Len=0;
+      for ( int n=0; n<100; n++ ) {
+        for ( size_t i=0; i<Msgs.size(); i++ ) Len+=N2kToSeasmart(Msgs[i],1000+n,Lines[i].data(),Lines[i].size());
+      }
+      BenchmarkKeep(Len);
+      return 100*Msgs.size();
+    });
+
+  tN2kMsg N2kMsg;
+  uint32_t Timestamp;
+  BenchmarkMeasure("read","msgs",[&]() {
+      size_t Count=0;
+      for ( int n=0; n<100; n++ ) {
+        for ( size_t i=0; i<Lines.size(); i++ ) {
+          if ( SeasmartToN2k(Lines[i].data(),Timestamp,N2kMsg) ) Count++;
+        }
+      }
+      return Count;
+    });
+}
@@ -0,0 +1,74 @@
+/*
+ * VirtualBusBenchmark.cpp
+ *
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include <NMEA2000_virtual.h>
+#include <N2kMessages.h>
+#include <stdio.h>
+#include <thread>
+#include <chrono>
+
+// *****************************************************************************
+static void OpenNodes(tNMEA2000_virtual **Nodes, int Count) {
+  for ( bool AllOpen=false; !AllOpen; ) {
+    AllOpen=true;
+    for ( int i=0; i<Count; i++ ) {
+      Nodes[i]->ParseMessages();
+      AllOpen&=Nodes[i]->IsOpen();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+// *****************************************************************************
+// One node sends fast packet GNSS position and all other nodes on virtual bus
+// parse it. Result is frames received by all nodes together.
+N2K_BENCHMARK(VirtualBusBroadcast) {
+  static const int Counts[]={ 10, 100, 300 };
+
+  for ( size_t c=0; c<sizeof(Counts)/sizeof(Counts[0]); c++ ) {
+    const int Count=Counts[c];
+    tN2kVirtualCANBus Bus;
+    tNMEA2000_virtual **Nodes=new tNMEA2000_virtual*[Count];
+
+    for ( int i=0; i<Count; i++ ) {
+      Nodes[i]=new tNMEA2000_virtual(Bus);
+      Nodes[i]->SetMode(i==0?tNMEA2000::N2km_SendOnly:tNMEA2000::N2km_ListenOnly);
+    }
+    OpenNodes(Nodes,Count);
+
+    tN2kMsg N2kMsg;
+    SetN2kGNSS(N2kMsg,1,19000,3600,60.1,22.5,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,0.5,15,1,N2kGNSSt_GPS,15,2);
+    char Param[40];
+    snprintf(Param,sizeof(Param),"nodes=%d",Count);
+    BenchmarkMeasure(Param,"frames",[&]() {
+        uint32_t Start=Bus.GetFramesTransmitted();
+        for ( int n=0; n<5; n++ ) Nodes[0]->SendMsg(N2kMsg);
+        for ( int i=1; i<Count; i++ ) Nodes[i]->ParseMessages();
+        return (uint64_t)(Bus.GetFramesTransmitted()-Start)*(Count-1);
+      });
+
+    for ( int i=0; i<Count; i++ ) delete Nodes[i];
+    delete[] Nodes;
+  }
+}
@@ -0,0 +1,212 @@
+/*
+ * N2kBatchDecoder.cpp
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+
+#include "N2kBatchDecoder.h"
+#include <string.h>
+
+//*****************************************************************************
+// Column loops. Each loop decodes one field over all payloads. Loops are
+// kept free of calls and branches, so compiler can vectorize them.
+// NA handling and scaling must match GetBuf*Double functions on N2kMsg.cpp.
+//
+// NA select is done with arithmetic instead of ?: . With default
+// -ftrapping-math compiler does not execute scale multiply for NA values
+// speculatively and leaves branch to loop, which prevents vectorizing.
+// Result is exact: Value*1+NA*0 == Value and Value*0+NA*1 == NA.
+static inline double SelectNA(double Value, int Valid) {
+  double v=Valid;
+  return Value*v+N2kDoubleNA*(1.0-v);
+}
+
+//*****************************************************************************
+static void DecodeByteColumn(const unsigned char *Payloads, size_t Stride, size_t Count, size_t Offset, unsigned char *Out) {
+  if ( Out==0 ) return;
+  const unsigned char *Data=Payloads+Offset;
+  for ( size_t i=0; i<Count; i++ ) {
+    Out[i]=Data[i*Stride];
+  }
+}
+
+//*****************************************************************************
+template <typename TEnum>
+static void DecodeLookupColumn(const unsigned char *Payloads, size_t Stride, size_t Count, size_t Offset, unsigned char Mask, TEnum *Out) {
+  if ( Out==0 ) return;
+  const unsigned char *Data=Payloads+Offset;
+  for ( size_t i=0; i<Count; i++ ) {
+    Out[i]=(TEnum)(int)(Data[i*Stride]&Mask);
+  }
+}
+
+//*****************************************************************************
+static void Decode2ByteUDoubleColumn(const unsigned char *Payloads, size_t Stride, size_t Count, size_t Offset, double Precision, double *Out) {
+  if ( Out==0 ) return;
+  const unsigned char *Data=Payloads+Offset;
+  for ( size_t i=0; i<Count; i++ ) {
+    const unsigned char *d=Data+i*Stride;
+    uint16_t Raw=(uint16_t)(d[0] | (d[1]<<8));
+    Out[i]=SelectNA(Raw*Precision,Raw!=0xffff);
+  }
+}
+
+//*****************************************************************************
+static void Decode2ByteDoubleColumn(const unsigned char *Payloads, size_t Stride, size_t Count, size_t Offset, double Precision, double *Out) {
+  if ( Out==0 ) return;
+  const unsigned char *Data=Payloads+Offset;
+  for ( size_t i=0; i<Count; i++ ) {
+    const unsigned char *d=Data+i*Stride;
+    int16_t Raw=(int16_t)(uint16_t)(d[0] | (d[1]<<8));
+    Out[i]=SelectNA(Raw*Precision,Raw!=0x7fff);
+  }
+}
+
+//*****************************************************************************
+static void Decode4ByteDoubleColumn(const unsigned char *Payloads, size_t Stride, size_t Count, size_t Offset, double Precision, double *Out) {
+  if ( Out==0 ) return;
+  const unsigned char *Data=Payloads+Offset;
+  for ( size_t i=0; i<Count; i++ ) {
+    const unsigned char *d=Data+i*Stride;
+    int32_t Raw=(int32_t)((uint32_t)d[0] | ((uint32_t)d[1]<<8) | ((uint32_t)d[2]<<16) | ((uint32_t)d[3]<<24));
+    Out[i]=SelectNA(Raw*Precision,Raw!=0x7fffffff);
+  }
+}
+
+//*****************************************************************************
+// Payloads are decoded in blocks, so that all columns of block are decoded
+// while its payloads are still in cache. Message array functions pack
+// block to stack buffer of N2kBatchBlockSize*8 bytes.
+#define N2kBatchBlockSize 64
+#define N2kBatchPackedStride 8
+
+template <typename T>
+static inline T *ColumnAt(T *Column, size_t First) {
+  return ( Column==0 ? 0 : Column+First );
+}
+
+//*****************************************************************************
+// Copies first 8 data bytes of leading messages, which have requested PGN
+// and enough data for batch decoding, to packed buffer. Returns number of
+// copied messages. Column loops run then on packed buffer with small
+// constant stride instead of stride of tN2kMsg. Latter is slow, since it
+// touches new cache line on every payload and some compilers generate poor
+// vector code for large constant stride.
+static size_t PackValid(const tN2kMsg *N2kMsgs, size_t Count, unsigned long PGN, int MinDataLen, unsigned char *Packed) {
+  size_t i=0;
+  for ( ; i<Count && N2kMsgs[i].PGN==PGN && N2kMsgs[i].DataLen>=MinDataLen; i++ ) {
+    memcpy(Packed+i*N2kBatchPackedStride,N2kMsgs[i].Data,N2kBatchPackedStride);
+  }
+  return i;
+}
+
+//*****************************************************************************
+static inline size_t BlockCount(size_t First, size_t Count) {
+  return ( Count-First<N2kBatchBlockSize ? Count-First : N2kBatchBlockSize );
+}
+
+//*****************************************************************************
+// Decodes Count payloads to columns starting from index First.
+static void DecodeBlock127250(const unsigned char *Payloads, size_t Stride, size_t Count, const tN2kPGN127250Columns &Columns, size_t First) {
+  DecodeByteColumn(Payloads,Stride,Count,0,ColumnAt(Columns.SID,First));
+  Decode2ByteUDoubleColumn(Payloads,Stride,Count,1,0.0001,ColumnAt(Columns.Heading,First));
+  Decode2ByteDoubleColumn(Payloads,Stride,Count,3,0.0001,ColumnAt(Columns.Deviation,First));
+  Decode2ByteDoubleColumn(Payloads,Stride,Count,5,0.0001,ColumnAt(Columns.Variation,First));
+  DecodeLookupColumn(Payloads,Stride,Count,7,0x03,ColumnAt(Columns.Reference,First));
+}
+
+//*****************************************************************************
+void N2kBatchDecodePGN127250(const unsigned char *Payloads, size_t Stride, size_t Count, const tN2kPGN127250Columns &Columns) {
+  for ( size_t First=0; First<Count; First+=N2kBatchBlockSize ) {
+    DecodeBlock127250(Payloads+First*Stride,Stride,BlockCount(First,Count),Columns,First);
+  }
+}
+
+//*****************************************************************************
+size_t N2kBatchDecodePGN127250(const tN2kMsg *N2kMsgs, size_t Count, const tN2kPGN127250Columns &Columns) {
+  unsigned char Packed[N2kBatchBlockSize*N2kBatchPackedStride];
+  size_t First=0;
+  while ( First<Count ) {
+    size_t BlockSize=BlockCount(First,Count);
+    size_t Valid=PackValid(N2kMsgs+First,BlockSize,127250L,8,Packed);
+    DecodeBlock127250(Packed,N2kBatchPackedStride,Valid,Columns,First);
+    First+=Valid;
+    if ( Valid<BlockSize ) break;
+  }
+  return First;
+}
+
+//*****************************************************************************
+// Decodes Count payloads to columns starting from index First.
+static void DecodeBlock129025(const unsigned char *Payloads, size_t Stride, size_t Count, const tN2kPGN129025Columns &Columns, size_t First) {
+  Decode4ByteDoubleColumn(Payloads,Stride,Count,0,1e-7,ColumnAt(Columns.Latitude,First));
+  Decode4ByteDoubleColumn(Payloads,Stride,Count,4,1e-7,ColumnAt(Columns.Longitude,First));
+}
+
+//*****************************************************************************
+void N2kBatchDecodePGN129025(const unsigned char *Payloads, size_t Stride, size_t Count, const tN2kPGN129025Columns &Columns) {
+  for ( size_t First=0; First<Count; First+=N2kBatchBlockSize ) {
+    DecodeBlock129025(Payloads+First*Stride,Stride,BlockCount(First,Count),Columns,First);
+  }
+}
+
+//*****************************************************************************
+size_t N2kBatchDecodePGN129025(const tN2kMsg *N2kMsgs, size_t Count, const tN2kPGN129025Columns &Columns) {
+  unsigned char Packed[N2kBatchBlockSize*N2kBatchPackedStride];
+  size_t First=0;
+  while ( First<Count ) {
+    size_t BlockSize=BlockCount(First,Count);
+    size_t Valid=PackValid(N2kMsgs+First,BlockSize,129025L,8,Packed);
+    DecodeBlock129025(Packed,N2kBatchPackedStride,Valid,Columns,First);
+    First+=Valid;
+    if ( Valid<BlockSize ) break;
+  }
+  return First;
+}
+
+//*****************************************************************************
+// Decodes Count payloads to columns starting from index First.
+static void DecodeBlock130306(const unsigned char *Payloads, size_t Stride, size_t Count, const tN2kPGN130306Columns &Columns, size_t First) {
+  DecodeByteColumn(Payloads,Stride,Count,0,ColumnAt(Columns.SID,First));
+  Decode2ByteUDoubleColumn(Payloads,Stride,Count,1,0.01,ColumnAt(Columns.WindSpeed,First));
+  Decode2ByteUDoubleColumn(Payloads,Stride,Count,3,0.0001,ColumnAt(Columns.WindAngle,First));
+  DecodeLookupColumn(Payloads,Stride,Count,5,0x07,ColumnAt(Columns.WindReference,First));
+}
+
+//*****************************************************************************
+void N2kBatchDecodePGN130306(const unsigned char *Payloads, size_t Stride, size_t Count, const tN2kPGN130306Columns &Columns) {
+  for ( size_t First=0; First<Count; First+=N2kBatchBlockSize ) {
+    DecodeBlock130306(Payloads+First*Stride,Stride,BlockCount(First,Count),Columns,First);
+  }
+}
+
+//*****************************************************************************
+size_t N2kBatchDecodePGN130306(const tN2kMsg *N2kMsgs, size_t Count, const tN2kPGN130306Columns &Columns) {
+  unsigned char Packed[N2kBatchBlockSize*N2kBatchPackedStride];
+  size_t First=0;
+  while ( First<Count ) {
+    size_t BlockSize=BlockCount(First,Count);
+    size_t Valid=PackValid(N2kMsgs+First,BlockSize,130306L,6,Packed);
+    DecodeBlock130306(Packed,N2kBatchPackedStride,Valid,Columns,First);
+    First+=Valid;
+    if ( Valid<BlockSize ) break;
+  }
+  return First;
+}
@@ -0,0 +1,157 @@
+/*
+ * N2kBatchDecoder.h
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+
+/*************************************************************************//**
+ * \file  N2kBatchDecoder.h
+ * \brief Columnar batch decoding for high rate single frame PGNs.
+ *
+ * For analysing recorded logs, decoding messages one at a time with
+ * ParseN2kPGN* functions spends most of its time on call overhead per
+ * field. Batch functions on this file decode array of messages of one PGN
+ * and write each field to its own output array (column). Inner loops
+ * handle one field over all messages, so compiler can vectorize little
+ * endian load, NA check and scaling.
+ *
+ * Decoded values are same as corresponding ParseN2kPGN* function gives.
+ * Output arrays are given with column structure. Column pointer may be
+ * null, if field is not needed. Each non null array must have room for
+ * all messages.
+ *
+ * Example:
+ * \code
+ * double Heading[N], Variation[N];
+ * tN2kPGN127250Columns Columns={0,Heading,0,Variation,0};
+ * size_t Decoded=N2kBatchDecodePGN127250(N2kMsgs,N,Columns);
+ * \endcode
+ *
+ * Functions taking tN2kMsg array stop at first message, which has other
+ * PGN or too short data, and return number of decoded messages. Functions
+ * taking raw payloads do not check anything. Payload i starts at
+ * Payloads+i*Stride, so payloads can be packed 8 byte arrays (Stride 8) or
+ * data field of application frame records (Stride sizeof record).
+ */
+
+#ifndef _N2kBatchDecoder_H_
+#define _N2kBatchDecoder_H_
+
+#include "N2kMsg.h"
+#include "N2kTypes.h"
+#include <stddef.h>
+
+/************************************************************************//**
+ * \brief Output columns for PGN 127250 "Vessel Heading"
+ * \sa ParseN2kPGN127250
+ */
+struct tN2kPGN127250Columns {
+  unsigned char *SID;                 ///< Sequence ID
+  double *Heading;                    ///< Heading in radians
+  double *Deviation;                  ///< Magnetic deviation in radians
+  double *Variation;                  ///< Magnetic variation in radians
+  tN2kHeadingReference *Reference;    ///< Heading reference
+};
+
+/************************************************************************//**
+ * \brief Output columns for PGN 129025 "Position, Rapid Update"
+ * \sa ParseN2kPGN129025
+ */
+struct tN2kPGN129025Columns {
+  double *Latitude;                   ///< Latitude in degrees
+  double *Longitude;                  ///< Longitude in degrees
+};
+
+/************************************************************************//**
+ * \brief Output columns for PGN 130306 "Wind Data"
+ * \sa ParseN2kPGN130306
+ */
+struct tN2kPGN130306Columns {
+  unsigned char *SID;                 ///< Sequence ID
+  double *WindSpeed;                  ///< Wind speed in m/s
+  double *WindAngle;                  ///< Wind angle in radians
+  tN2kWindReference *WindReference;   ///< Wind reference
+};
+
+/************************************************************************//**
+ * \brief Decode array of PGN 127250 messages to columns
+ *
+ * \param N2kMsgs   Array of messages
+ * \param Count     Number of messages on array
+ * \param Columns   Output columns, see \ref tN2kPGN127250Columns
+ * \return Number of decoded messages. Decoding stops at first message,
+ *         which is not PGN 127250 or has less than 8 bytes data.
+ */
+size_t N2kBatchDecodePGN127250(const tN2kMsg *N2kMsgs, size_t Count, const tN2kPGN127250Columns &Columns);
+
+/************************************************************************//**
+ * \brief Decode raw PGN 127250 payloads to columns
+ *
+ * \param Payloads  Pointer to first payload. Each payload must have 8 bytes.
+ * \param Stride    Distance between payloads in bytes
+ * \param Count     Number of payloads
+ * \param Columns   Output columns, see \ref tN2kPGN127250Columns
+ */
+void N2kBatchDecodePGN127250(const unsigned char *Payloads, size_t Stride, size_t Count, const tN2kPGN127250Columns &Columns);
+
+/************************************************************************//**
+ * \brief Decode array of PGN 129025 messages to columns
+ *
+ * \param N2kMsgs   Array of messages
+ * \param Count     Number of messages on array
+ * \param Columns   Output columns, see \ref tN2kPGN129025Columns
+ * \return Number of decoded messages. Decoding stops at first message,
+ *         which is not PGN 129025 or has less than 8 bytes data.
+ */
+size_t N2kBatchDecodePGN129025(const tN2kMsg *N2kMsgs, size_t Count, const tN2kPGN129025Columns &Columns);
+
+/************************************************************************//**
+ * \brief Decode raw PGN 129025 payloads to columns
+ *
+ * \param Payloads  Pointer to first payload. Each payload must have 8 bytes.
+ * \param Stride    Distance between payloads in bytes
+ * \param Count     Number of payloads
+ * \param Columns   Output columns, see \ref tN2kPGN129025Columns
+ */
+void N2kBatchDecodePGN129025(const unsigned char *Payloads, size_t Stride, size_t Count, const tN2kPGN129025Columns &Columns);
+
+/************************************************************************//**
+ * \brief Decode array of PGN 130306 messages to columns
+ *
+ * \param N2kMsgs   Array of messages
+ * \param Count     Number of messages on array
+ * \param Columns   Output columns, see \ref tN2kPGN130306Columns
+ * \return Number of decoded messages. Decoding stops at first message,
+ *         which is not PGN 130306 or has less than 6 bytes data.
+ */
+size_t N2kBatchDecodePGN130306(const tN2kMsg *N2kMsgs, size_t Count, const tN2kPGN130306Columns &Columns);
+
+/************************************************************************//**
+ * \brief Decode raw PGN 130306 payloads to columns
+ *
+ * \param Payloads  Pointer to first payload. Each payload must have at
+ *                  least 6 bytes.
+ * \param Stride    Distance between payloads in bytes
+ * \param Count     Number of payloads
+ * \param Columns   Output columns, see \ref tN2kPGN130306Columns
+ */
+void N2kBatchDecodePGN130306(const unsigned char *Payloads, size_t Stride, size_t Count, const tN2kPGN130306Columns &Columns);
+
+#endif
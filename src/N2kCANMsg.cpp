@@ -0,0 +1,200 @@
+/* 
+ * N2kCANMsg.cpp
+ * Copyright (c) 2015-2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "N2kCANMsg.h"
+
+//*****************************************************************************
+bool tN2kMsgBufPool::AddClass(uint16_t Size, uint8_t Count) {
+  if ( Memory!=0 || Size==0 || Count==0 ) return false;
+
+  uint8_t i;
+  for ( i=0; i<ClassCount && Classes[i].Size<Size; i++ );
+  if ( i<ClassCount && Classes[i].Size==Size ) {
+    if ( (uint16_t)Classes[i].Count+Count>0xff ) return false;
+    Classes[i].Count+=Count;
+    return true;
+  }
+  if ( ClassCount>=N2kMsgBufPoolMaxClasses ) return false;
+
+  // Keep classes sorted by size
+  for ( uint8_t j=ClassCount; j>i; j-- ) Classes[j]=Classes[j-1];
+  Classes[i].Size=Size;
+  Classes[i].Count=Count;
+  Classes[i].FreeCount=0;
+  Classes[i].Bufs=0;
+  Classes[i].FreeBufs=0;
+  ClassCount++;
+
+  return true;
+}
+
+//*****************************************************************************
+void tN2kMsgBufPool::Init() {
+  if ( Memory!=0 ) return;
+
+  size_t Total=0;
+  uint16_t TotalCount=0;
+  for ( uint8_t i=0; i<ClassCount; i++ ) {
+    Total+=(size_t)Classes[i].Size*Classes[i].Count;
+    TotalCount+=Classes[i].Count;
+  }
+  if ( Total==0 ) return;
+
+  Memory=new unsigned char[Total];
+  uint8_t *FreeBufs=new uint8_t[TotalCount];
+  unsigned char *Bufs=Memory;
+  for ( uint8_t i=0; i<ClassCount; i++ ) {
+    Classes[i].Bufs=Bufs;
+    Classes[i].FreeBufs=FreeBufs;
+    // Push in reverse order so that buffers will be used from beginning.
+    for ( Classes[i].FreeCount=0; Classes[i].FreeCount<Classes[i].Count; Classes[i].FreeCount++ ) {
+      FreeBufs[Classes[i].FreeCount]=Classes[i].Count-1-Classes[i].FreeCount;
+    }
+    Bufs+=(size_t)Classes[i].Size*Classes[i].Count;
+    FreeBufs+=Classes[i].Count;
+  }
+}
+
+//*****************************************************************************
+unsigned char *tN2kMsgBufPool::Alloc(uint16_t Size, uint16_t &BufSize) {
+  for ( uint8_t i=0; i<ClassCount; i++ ) {
+    tClass &Class=Classes[i];
+    if ( Class.Size<Size || Class.FreeCount==0 ) continue;
+    Class.FreeCount--;
+    BufSize=Class.Size;
+    return Class.Bufs+(size_t)Class.FreeBufs[Class.FreeCount]*Class.Size;
+  }
+
+  BufSize=0;
+  return 0;
+}
+
+//*****************************************************************************
+void tN2kMsgBufPool::Free(unsigned char *Buf) {
+  if ( Buf==0 ) return;
+
+  for ( uint8_t i=0; i<ClassCount; i++ ) {
+    tClass &Class=Classes[i];
+    if ( Buf<Class.Bufs || Buf>=Class.Bufs+(size_t)Class.Size*Class.Count ) continue;
+    if ( Class.FreeCount<Class.Count ) Class.FreeBufs[Class.FreeCount++]=(Buf-Class.Bufs)/Class.Size;
+    return;
+  }
+}
+
+//*****************************************************************************
+void tN2kCANMsgIndex::Init(uint8_t MaxSlots) {
+  uint16_t TableSize=4;
+  while ( TableSize<2*(uint16_t)MaxSlots ) TableSize<<=1; // Keep load factor <=0.5
+
+  if ( Table==0 ) {
+    Table=new uint8_t[TableSize];
+    FreeSlots=new uint8_t[MaxSlots>0?MaxSlots:1];
+  }
+  Mask=TableSize-1;
+  for ( uint16_t i=0; i<TableSize; i++ ) Table[i]=N2kCANMsgIndexEmpty;
+  // Push in reverse order so that slots will be used from beginning.
+  for ( FreeCount=0; FreeCount<MaxSlots; FreeCount++ ) FreeSlots[FreeCount]=MaxSlots-1-FreeCount;
+}
+
+//*****************************************************************************
+uint16_t tN2kCANMsgIndex::Hash(unsigned long PGN, unsigned char Source, unsigned char Destination, bool TPMsg) const {
+  uint32_t h=( (uint32_t)PGN ^ ((uint32_t)Source<<18) ^ ((uint32_t)Destination<<9) ^ (TPMsg?0x5a5a5a5aUL:0) ) * 2654435761UL;
+  return (h>>16) & Mask;
+}
+
+//*****************************************************************************
+uint16_t tN2kCANMsgIndex::Hash(const tN2kCANMsg &Msg) const {
+#if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
+  return Hash(Msg.N2kMsg.PGN,Msg.N2kMsg.Source,Msg.N2kMsg.Destination,Msg.IsTPMessage());
+#else
+  return Hash(Msg.N2kMsg.PGN,Msg.N2kMsg.Source,Msg.N2kMsg.Destination,false);
+#endif
+}
+
+//*****************************************************************************
+bool tN2kCANMsgIndex::IsSameKey(const tN2kCANMsg &Msg, unsigned long PGN, unsigned char Source, unsigned char Destination, bool TPMsg) {
+  return ( Msg.N2kMsg.PGN==PGN
+           && Msg.N2kMsg.Source==Source
+           && Msg.N2kMsg.Destination==Destination
+#if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
+           && Msg.IsTPMessage()==TPMsg
+#else
+           && !TPMsg
+#endif
+         );
+}
+
+//*****************************************************************************
+uint8_t tN2kCANMsgIndex::Find(const tN2kCANMsg *Buf, unsigned long PGN, unsigned char Source, unsigned char Destination, bool TPMsg) const {
+  if ( Table==0 ) return N2kCANMsgIndexEmpty;
+
+  for ( uint16_t i=Hash(PGN,Source,Destination,TPMsg); Table[i]!=N2kCANMsgIndexEmpty; i=(i+1)&Mask ) {
+    if ( IsSameKey(Buf[Table[i]],PGN,Source,Destination,TPMsg) ) return Table[i];
+  }
+
+  return N2kCANMsgIndexEmpty;
+}
+
+//*****************************************************************************
+void tN2kCANMsgIndex::Claim(const tN2kCANMsg *Buf, uint8_t Slot) {
+  if ( Table==0 ) return;
+
+  if ( FreeCount>0 && FreeSlots[FreeCount-1]==Slot ) FreeCount--;
+
+  uint16_t i=Hash(Buf[Slot]);
+  for ( ; Table[i]!=N2kCANMsgIndexEmpty; i=(i+1)&Mask ) {
+    if ( Table[i]==Slot ) return; // Already indexed
+  }
+  Table[i]=Slot;
+}
+
+//*****************************************************************************
+void tN2kCANMsgIndex::Release(const tN2kCANMsg *Buf, uint8_t Slot) {
+  if ( Table==0 || Buf[Slot].FreeMsg ) return;
+
+  uint16_t i=Hash(Buf[Slot]);
+  for ( ; Table[i]!=N2kCANMsgIndexEmpty && Table[i]!=Slot; i=(i+1)&Mask );
+  // Message handlers get const reference to the message, but source and
+  // destination are mutable (see tN2kMsg::ForceSource), so key may have been
+  // changed. In that case we have to search the whole table.
+  if ( Table[i]!=Slot ) {
+    for ( i=0; i<=Mask && Table[i]!=Slot; i++ );
+  }
+
+  if ( i<=Mask ) {
+    // Backward shift deletion keeps probe chains valid without tombstones.
+    uint16_t j=i;
+    for (;;) {
+      j=(j+1)&Mask;
+      if ( Table[j]==N2kCANMsgIndexEmpty ) break;
+      uint16_t k=Hash(Buf[Table[j]]);
+      // Move entry at j to hole at i, if its home position k is not cyclically within (i,j]
+      if ( ( i<=j ) ? ( (k<=i) || (k>j) ) : ( (k<=i) && (k>j) ) ) {
+        Table[i]=Table[j];
+        i=j;
+      }
+    }
+    Table[i]=N2kCANMsgIndexEmpty;
+  }
+
+  FreeSlots[FreeCount++]=Slot;
+}
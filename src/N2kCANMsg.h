@@ -25,11 +25,15 @@
  * \brief File declares tN2kCANMsg class used internally on tNMEA2000.
  * 
  * Class is used by the tNMEA2000 class to handle incoming NMEA2000 messages.
+ * File declares also tN2kCANMsgIndex class, which is used for fast lookup
+ * of messages under reassembly.
  */
 
 #ifndef _tN2kCANMsg_H_
 #define _tN2kCANMsg_H_
+#include "NMEA2000_CompilerDefns.h"
 #include "N2kMsg.h"
+#include <string.h>
 
 /************************************************************************//**
  * \class tN2kCANMsg
@@ -37,6 +41,8 @@
  * \brief Class used internally on tNMEA2000 to handle incoming NMEA2000 messages.
  * \ingroup group_core
  * 
+ * Slot keeps message header on its \ref N2kMsg, so slot takes only few
+ * bytes more than tN2kMsg.
  */
 class tN2kCANMsg
 {
@@ -46,24 +52,31 @@ public:
    *
    */
   tN2kCANMsg()
-    : Ready(false),FreeMsg(true),SystemMessage(false), KnownMessage(false) 
+    : DataLen(0), CopiedLen(0),
+      Ready(false),FreeMsg(true),SystemMessage(false), KnownMessage(false) 
 #if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
       ,TPRequireCTS(false), TPMaxPackets(0) 
 #endif
     {
 	  N2kMsg.Clear();
   }
-  /** \brief Reference to a N2kMsg Object, Output: NMEA2000 message ready 
-   * to be send.*/
+  /** \brief Message under reassembly. Header is kept on message and 
+   * messages up to tN2kMsg::MaxDataLen will be reassembled directly to 
+   * its data, so ready message can be handled without copying. For long
+   * messages data holds pointer to buffer taken from \ref tN2kMsgBufPool. */
   tN2kMsg N2kMsg;
+  /** \brief Payload length of the message */
+  uint16_t DataLen;
+  /** \brief  Length of copied bytes */
+  uint16_t CopiedLen;
   /** \brief Message ready for handling?   */
-  bool Ready;
+  bool Ready:1;
   /** \brief Message is free for fill up   */
-  bool FreeMsg; 
+  bool FreeMsg:1; 
   /** \brief Message is a system message*/
-  bool SystemMessage;
+  bool SystemMessage:1;
   /** \brief Message is already known   */
-  bool KnownMessage;
+  bool KnownMessage:1;
 #if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
   /** \brief =0 no, n=after each n frames   */
   unsigned char TPRequireCTS; 
@@ -73,23 +86,285 @@ public:
   /** \brief  Last received frame sequence number on fast 
    *          packets or multi packet  */
   unsigned char LastFrame; // 
-  /** \brief  Length of copied bytes */
-  unsigned char CopiedLen;
   
 public:
+  /************************************************************************//**
+   * \brief Initialize message header for reassembly
+   */
+  void Init(unsigned char Priority, unsigned long PGN, unsigned char Source, unsigned char Destination, bool TPMsg=false) {
+    N2kMsg.Init(Priority,PGN,Source,Destination);
+#if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
+    N2kMsg.SetIsTPMessage(TPMsg);
+#else
+    (void)TPMsg;
+#endif
+    DataLen=0; CopiedLen=0; LastFrame=0;
+  }
+
+  /************************************************************************//**
+   * \brief Is message received with ISO Transport Protocol
+   */
+  bool IsTPMessage() const {
+#if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
+    return N2kMsg.IsTPMessage();
+#else
+    return false;
+#endif
+  }
+
+  /************************************************************************//**
+   * \brief Is message too long to be delivered as \ref tN2kMsg
+   */
+  bool IsLongMessage() const { return DataLen>tN2kMsg::MaxDataLen; }
+
+  /************************************************************************//**
+   * \brief Payload buffer
+   *
+   * \return Buffer taken from \ref tN2kMsgBufPool for long message,
+   *         otherwise \ref N2kMsg data.
+   */
+  unsigned char *GetData() {
+    if ( !IsLongMessage() ) return N2kMsg.Data;
+    unsigned char *Buf;
+    memcpy(&Buf,N2kMsg.Data,sizeof(Buf));
+    return Buf;
+  }
+
+  /************************************************************************//**
+   * \brief Set buffer taken from \ref tN2kMsgBufPool for long message
+   *
+   * \param Buf      Buffer
+   * \param _DataLen Payload length. Must be over tN2kMsg::MaxDataLen.
+   */
+  void SetPoolData(unsigned char *Buf, uint16_t _DataLen) {
+    memcpy(N2kMsg.Data,&Buf,sizeof(Buf));
+    DataLen=_DataLen;
+  }
+
+  /************************************************************************//**
+   * \brief Set header of \ref N2kMsg for delivery
+   *
+   * Payload is already on \ref N2kMsg. For long messages N2kMsg.DataLen
+   * will be 0 and payload must be read from \ref GetData.
+   *
+   * \return Reference to \ref N2kMsg
+   */
+  const tN2kMsg &PrepareN2kMsg() {
+    N2kMsg.DataLen=( IsLongMessage() ? 0 : DataLen );
+    return N2kMsg;
+  }
+
   /************************************************************************//**
    * \brief Free the message
    * 
-   * This resets the whole message and clears all the content
+   * This resets the whole message and clears all the content. Note that
+   * pool buffer of long message must be returned to the pool before
+   * calling this.
    *
    */
   void FreeMessage() { 
     FreeMsg=true; Ready=false; SystemMessage=false; 
 #if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
-    TPMaxPackets=0; TPRequireCTS=false; 
+    TPMaxPackets=0; TPRequireCTS=false; N2kMsg.SetIsTPMessage(false);
 #endif
-    N2kMsg.Clear(); N2kMsg.Source=0; 
+    N2kMsg.Clear(); N2kMsg.Source=0; DataLen=0; CopiedLen=0;
   }  
 };
 
+/** \brief Maximum number of size classes on \ref tN2kMsgBufPool */
+#define N2kMsgBufPoolMaxClasses 4
+
+/************************************************************************//**
+ * \class tN2kMsgBufPool
+ * 
+ * \brief Size classed payload buffer pool for received messages.
+ * \ingroup group_core
+ * 
+ * Pool is used by tNMEA2000 for payload of messages under reassembly, so
+ * that single frames, fast packets and long ISO Transport Protocol messages
+ * take only memory they need. Pool has up to \ref N2kMsgBufPoolMaxClasses 
+ * size classes, each having fixed count of buffers. All buffers will be
+ * allocated at once on \ref Init. Buffer will be taken from smallest
+ * class having free buffer large enough.
+ */
+class tN2kMsgBufPool
+{
+protected:
+  /** \brief Pool size class */
+  struct tClass {
+    /** \brief Size of buffers on class */
+    uint16_t Size;
+    /** \brief Count of buffers on class */
+    uint8_t Count;
+    /** \brief Count of free buffers on \ref FreeBufs */
+    uint8_t FreeCount;
+    /** \brief First buffer of the class */
+    unsigned char *Bufs;
+    /** \brief Stack of free buffer indexes */
+    uint8_t *FreeBufs;
+  };
+  /** \brief Size classes sorted by size */
+  tClass Classes[N2kMsgBufPoolMaxClasses];
+  /** \brief Count of size classes */
+  uint8_t ClassCount;
+  /** \brief Memory for all buffers */
+  unsigned char *Memory;
+
+public:
+  /************************************************************************//**
+   * \brief Constructor of class \ref tN2kMsgBufPool
+   */
+  tN2kMsgBufPool() : ClassCount(0), Memory(0) {}
+
+  /************************************************************************//**
+   * \brief Add size class to the pool
+   * 
+   * Classes must be added before \ref Init. If class with same size exists,
+   * count will be added to it.
+   *
+   * \param Size    Size of buffers in bytes
+   * \param Count   Count of buffers
+   * \retval true   Class has been added
+   * \retval false  There is no room for new class or pool is initialized
+   */
+  bool AddClass(uint16_t Size, uint8_t Count);
+
+  /************************************************************************//**
+   * \brief Has any classes been added
+   */
+  bool HasClasses() const { return ClassCount>0; }
+
+  /************************************************************************//**
+   * \brief Allocate memory for all buffers
+   */
+  void Init();
+
+  /************************************************************************//**
+   * \brief Largest buffer size on pool
+   */
+  uint16_t MaxSize() const { return ( ClassCount>0 ? Classes[ClassCount-1].Size : 0 ); }
+
+  /************************************************************************//**
+   * \brief Take buffer from the pool
+   *
+   * \param Size      Required size
+   * \param BufSize   Returns size of the buffer
+   * \return Buffer or 0, if there is no free buffer large enough
+   */
+  unsigned char *Alloc(uint16_t Size, uint16_t &BufSize);
+
+  /************************************************************************//**
+   * \brief Return buffer to the pool
+   *
+   * \param Buf       Buffer got with \ref Alloc
+   */
+  void Free(unsigned char *Buf);
+};
+
+/** \brief Empty index value for \ref tN2kCANMsgIndex */
+#define N2kCANMsgIndexEmpty 0xff
+
+/************************************************************************//**
+ * \class tN2kCANMsgIndex
+ * 
+ * \brief Hash index for tN2kCANMsg buffer used internally on tNMEA2000.
+ * \ingroup group_core
+ * 
+ * Index provides constant time lookup for messages under reassembly
+ * on tNMEA2000 message buffer. Without index every fast packet frame
+ * requires linear search through whole message buffer.
+ * 
+ * Index is open addressed hash table with linear probing. It is keyed by
+ * PGN, source, destination and TP message flag. Table contains only 
+ * buffer slot indexes and key will be read from the slot itself, so
+ * memory requirement is 2 bytes per slot for table. Index also keeps
+ * list of free slots, which requires 1 byte per slot.
+ * 
+ * \note Slot key must be set before calling \ref Claim and must not
+ * be changed before calling \ref Release.
+ */
+class tN2kCANMsgIndex
+{
+protected:
+  /** \brief Hash table of slot indexes. N2kCANMsgIndexEmpty for empty */
+  uint8_t *Table;
+  /** \brief Table size - 1. Table size is power of 2 */
+  uint16_t Mask;
+  /** \brief Stack of free slot indexes */
+  uint8_t *FreeSlots;
+  /** \brief Count of free slots on stack */
+  uint8_t FreeCount;
+  
+protected:
+  /************************************************************************//**
+   * \brief Calculate hash table position for key
+   */
+  uint16_t Hash(unsigned long PGN, unsigned char Source, unsigned char Destination, bool TPMsg) const;
+  /************************************************************************//**
+   * \brief Calculate hash table position for slot key
+   */
+  uint16_t Hash(const tN2kCANMsg &Msg) const;
+  /************************************************************************//**
+   * \brief Test does slot key match to key.
+   */
+  static bool IsSameKey(const tN2kCANMsg &Msg, unsigned long PGN, unsigned char Source, unsigned char Destination, bool TPMsg);
+
+public:
+  /************************************************************************//**
+   * \brief Constructor of class \ref tN2kCANMsgIndex
+   */
+  tN2kCANMsgIndex() : Table(0), Mask(0), FreeSlots(0), FreeCount(0) {}
+  /************************************************************************//**
+   * \brief Initialize index for MaxSlots slots.
+   * 
+   * Index will be initialized empty and all slots free.
+   * 
+   * \param MaxSlots Size of message buffer
+   */
+  void Init(uint8_t MaxSlots);
+  /************************************************************************//**
+   * \brief Find slot under reassembly by key.
+   * 
+   * \param Buf          Message buffer
+   * \param PGN          PGN of the message
+   * \param Source       Source of the message
+   * \param Destination  Destination of the message
+   * \param TPMsg        Message is ISO Multi-Packet message
+   * 
+   * \return Slot index or N2kCANMsgIndexEmpty, if not found.
+   */
+  uint8_t Find(const tN2kCANMsg *Buf, unsigned long PGN, unsigned char Source, unsigned char Destination, bool TPMsg) const;
+  /************************************************************************//**
+   * \brief Get free slot without claiming it.
+   * 
+   * \return Slot index or N2kCANMsgIndexEmpty, if there is no free slots.
+   */
+  uint8_t PeekFree() const { return FreeCount>0?FreeSlots[FreeCount-1]:N2kCANMsgIndexEmpty; }
+  /************************************************************************//**
+   * \brief Get number of free slots
+   */
+  uint8_t GetFreeCount() const { return FreeCount; }
+  /************************************************************************//**
+   * \brief Claim slot for message reassembly.
+   * 
+   * Slot will be removed from free slots and added to the hash table with
+   * its current key. Claiming slot, which is already in use with same key,
+   * has no effect.
+   * 
+   * \param Buf   Message buffer
+   * \param Slot  Slot index
+   */
+  void Claim(const tN2kCANMsg *Buf, uint8_t Slot);
+  /************************************************************************//**
+   * \brief Release slot.
+   * 
+   * Slot will be removed from hash table and added to the free slots.
+   * Release must be called before slot key will be cleared.
+   * 
+   * \param Buf   Message buffer
+   * \param Slot  Slot index
+   */
+  void Release(const tN2kCANMsg *Buf, uint8_t Slot);
+};
+
 #endif
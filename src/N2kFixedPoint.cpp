@@ -0,0 +1,422 @@
+/*
+ * N2kFixedPoint.cpp
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+
+#include "N2kFixedPoint.h"
+
+// Layouts must match functions on N2kMessages.cpp. Functions here must not
+// use floating point.
+
+//*****************************************************************************
+// System time
+void SetN2kPGN126992(tN2kMsg &N2kMsg, unsigned char SID, uint16_t SystemDate,
+                     tN2kFixedTimeOfDay SystemTime, tN2kTimeSource TimeSource) {
+    N2kMsg.SetPGN(126992L);
+    N2kMsg.Priority=3;
+    N2kMsg.AddByte(SID);
+    N2kMsg.AddByte((TimeSource & 0x0f) | 0xf0);
+    N2kMsg.Add2ByteUInt(SystemDate);
+    N2kAddFixed(N2kMsg,SystemTime);
+}
+
+bool ParseN2kPGN126992(const tN2kMsg &N2kMsg, unsigned char &SID, uint16_t &SystemDate,
+                     tN2kFixedTimeOfDay &SystemTime, tN2kTimeSource &TimeSource) {
+  if (N2kMsg.PGN!=126992L) return false;
+
+  int Index=0;
+
+  SID=N2kMsg.GetByte(Index);
+  TimeSource=(tN2kTimeSource)(N2kMsg.GetByte(Index) & 0x0f);
+  SystemDate=N2kMsg.Get2ByteUInt(Index);
+  N2kGetFixed(N2kMsg,Index,SystemTime);
+
+  return true;
+}
+
+//*****************************************************************************
+// Vessel Heading
+void SetN2kPGN127250(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedAngle Heading, tN2kFixedSignedAngle Deviation,
+                     tN2kFixedSignedAngle Variation, tN2kHeadingReference ref) {
+    N2kMsg.SetPGN(127250L);
+    N2kMsg.Priority=2;
+    N2kMsg.AddByte(SID);
+    N2kAddFixed(N2kMsg,Heading);
+    N2kAddFixed(N2kMsg,Deviation);
+    N2kAddFixed(N2kMsg,Variation);
+    N2kMsg.AddByte(0xfc | ref);
+}
+
+bool ParseN2kPGN127250(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedAngle &Heading, tN2kFixedSignedAngle &Deviation,
+                     tN2kFixedSignedAngle &Variation, tN2kHeadingReference &ref) {
+  if (N2kMsg.PGN!=127250L) return false;
+
+  int Index=0;
+
+  SID=N2kMsg.GetByte(Index);
+  N2kGetFixed(N2kMsg,Index,Heading);
+  N2kGetFixed(N2kMsg,Index,Deviation);
+  N2kGetFixed(N2kMsg,Index,Variation);
+  ref=(tN2kHeadingReference)(N2kMsg.GetByte(Index)&0x03);
+
+  return true;
+}
+
+//*****************************************************************************
+// Rate of turn
+void SetN2kPGN127251(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedRateOfTurn RateOfTurn) {
+    N2kMsg.SetPGN(127251L);
+    N2kMsg.Priority=2;
+    N2kMsg.AddByte(SID);
+    N2kAddFixed(N2kMsg,RateOfTurn);
+    N2kMsg.AddByte(0xff);
+    N2kMsg.Add2ByteUInt(0xffff);
+}
+
+bool ParseN2kPGN127251(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedRateOfTurn &RateOfTurn) {
+  if (N2kMsg.PGN!=127251L) return false;
+
+  int Index=0;
+
+  SID=N2kMsg.GetByte(Index);
+  N2kGetFixed(N2kMsg,Index,RateOfTurn);
+
+  return true;
+}
+
+//*****************************************************************************
+// Attitude
+void SetN2kPGN127257(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedSignedAngle Yaw, tN2kFixedSignedAngle Pitch,
+                     tN2kFixedSignedAngle Roll) {
+    N2kMsg.SetPGN(127257L);
+    N2kMsg.Priority=3;
+    N2kMsg.AddByte(SID);
+    N2kAddFixed(N2kMsg,Yaw);
+    N2kAddFixed(N2kMsg,Pitch);
+    N2kAddFixed(N2kMsg,Roll);
+    N2kMsg.AddByte(0xff); // Reserved
+}
+
+bool ParseN2kPGN127257(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedSignedAngle &Yaw, tN2kFixedSignedAngle &Pitch,
+                     tN2kFixedSignedAngle &Roll) {
+  if (N2kMsg.PGN!=127257L) return false;
+
+  int Index=0;
+  SID=N2kMsg.GetByte(Index);
+  N2kGetFixed(N2kMsg,Index,Yaw);
+  N2kGetFixed(N2kMsg,Index,Pitch);
+  N2kGetFixed(N2kMsg,Index,Roll);
+
+  return true;
+}
+
+//*****************************************************************************
+// Battery Status
+void SetN2kPGN127508(tN2kMsg &N2kMsg, unsigned char BatteryInstance, tN2kFixedVoltage BatteryVoltage,
+                     tN2kFixedCurrent BatteryCurrent, tN2kFixedTemperature BatteryTemperature, unsigned char SID) {
+    N2kMsg.SetPGN(127508L);
+    N2kMsg.Priority=6;
+    N2kMsg.AddByte(BatteryInstance);
+    N2kAddFixed(N2kMsg,BatteryVoltage);
+    N2kAddFixed(N2kMsg,BatteryCurrent);
+    N2kAddFixed(N2kMsg,BatteryTemperature);
+    N2kMsg.AddByte(SID);
+}
+
+bool ParseN2kPGN127508(const tN2kMsg &N2kMsg, unsigned char &BatteryInstance, tN2kFixedVoltage &BatteryVoltage,
+                     tN2kFixedCurrent &BatteryCurrent, tN2kFixedTemperature &BatteryTemperature, unsigned char &SID) {
+  if (N2kMsg.PGN!=127508L) return false;
+  int Index=0;
+  BatteryInstance=N2kMsg.GetByte(Index);
+  N2kGetFixed(N2kMsg,Index,BatteryVoltage);
+  N2kGetFixed(N2kMsg,Index,BatteryCurrent);
+  N2kGetFixed(N2kMsg,Index,BatteryTemperature);
+  SID=N2kMsg.GetByte(Index);
+
+  return true;
+}
+
+//*****************************************************************************
+// Boat speed
+void SetN2kPGN128259(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedSpeed WaterReferenced,
+                     tN2kFixedSpeed GroundReferenced, tN2kSpeedWaterReferenceType SWRT) {
+    N2kMsg.SetPGN(128259L);
+    N2kMsg.Priority=2;
+    N2kMsg.AddByte(SID);
+    N2kAddFixed(N2kMsg,WaterReferenced);
+    N2kAddFixed(N2kMsg,GroundReferenced);
+    N2kMsg.AddByte(SWRT);
+    N2kMsg.AddByte(0xff); // Reserved
+    N2kMsg.AddByte(0xff); // Reserved
+}
+
+bool ParseN2kPGN128259(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedSpeed &WaterReferenced,
+                     tN2kFixedSpeed &GroundReferenced, tN2kSpeedWaterReferenceType &SWRT) {
+  if (N2kMsg.PGN!=128259L) return false;
+
+  int Index=0;
+
+  SID=N2kMsg.GetByte(Index);
+  N2kGetFixed(N2kMsg,Index,WaterReferenced);
+  N2kGetFixed(N2kMsg,Index,GroundReferenced);
+  SWRT=(tN2kSpeedWaterReferenceType)(N2kMsg.GetByte(Index)&0x0F);
+
+  return true;
+}
+
+//*****************************************************************************
+// Water depth
+void SetN2kPGN128267(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedDepth DepthBelowTransducer,
+                     tN2kFixedDepthOffset Offset, tN2kFixedDepthRange Range) {
+    N2kMsg.SetPGN(128267L);
+    N2kMsg.Priority=3;
+    N2kMsg.AddByte(SID);
+    N2kAddFixed(N2kMsg,DepthBelowTransducer);
+    N2kAddFixed(N2kMsg,Offset);
+    N2kAddFixed(N2kMsg,Range);
+}
+
+bool ParseN2kPGN128267(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedDepth &DepthBelowTransducer,
+                     tN2kFixedDepthOffset &Offset, tN2kFixedDepthRange &Range) {
+  if (N2kMsg.PGN!=128267L) return false;
+
+  int Index=0;
+  SID=N2kMsg.GetByte(Index);
+  N2kGetFixed(N2kMsg,Index,DepthBelowTransducer);
+  N2kGetFixed(N2kMsg,Index,Offset);
+  N2kGetFixed(N2kMsg,Index,Range);
+
+  return true;
+}
+
+//*****************************************************************************
+// Lat/lon rapid
+void SetN2kPGN129025(tN2kMsg &N2kMsg, tN2kFixedLatLon Latitude, tN2kFixedLatLon Longitude) {
+    N2kMsg.SetPGN(129025L);
+    N2kMsg.Priority=2;
+    N2kAddFixed(N2kMsg,Latitude);
+    N2kAddFixed(N2kMsg,Longitude);
+}
+
+bool ParseN2kPGN129025(const tN2kMsg &N2kMsg, tN2kFixedLatLon &Latitude, tN2kFixedLatLon &Longitude) {
+  if (N2kMsg.PGN!=129025L) return false;
+
+  int Index=0;
+  N2kGetFixed(N2kMsg,Index,Latitude);
+  N2kGetFixed(N2kMsg,Index,Longitude);
+
+  return true;
+}
+
+//*****************************************************************************
+// COG SOG rapid
+void SetN2kPGN129026(tN2kMsg &N2kMsg, unsigned char SID, tN2kHeadingReference ref, tN2kFixedAngle COG, tN2kFixedSpeed SOG) {
+    N2kMsg.SetPGN(129026L);
+    N2kMsg.Priority=2;
+    N2kMsg.AddByte(SID);
+    N2kMsg.AddByte( (((unsigned char)(ref)) & 0x03) | 0xfc );
+    N2kAddFixed(N2kMsg,COG);
+    N2kAddFixed(N2kMsg,SOG);
+    N2kMsg.AddByte(0xff); // Reserved
+    N2kMsg.AddByte(0xff); // Reserved
+}
+
+bool ParseN2kPGN129026(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kHeadingReference &ref, tN2kFixedAngle &COG, tN2kFixedSpeed &SOG) {
+  if (N2kMsg.PGN!=129026L) return false;
+
+  int Index=0;
+  SID=N2kMsg.GetByte(Index);
+  ref=(tN2kHeadingReference)( N2kMsg.GetByte(Index) & 0x03 );
+  N2kGetFixed(N2kMsg,Index,COG);
+  N2kGetFixed(N2kMsg,Index,SOG);
+
+  return true;
+}
+
+//*****************************************************************************
+// GNSS Position Data
+void SetN2kPGN129029(tN2kMsg &N2kMsg, unsigned char SID, uint16_t DaysSince1970, tN2kFixedTimeOfDay SecondsSinceMidnight,
+                     tN2kFixedLatLonHighRes Latitude, tN2kFixedLatLonHighRes Longitude, tN2kFixedAltitude Altitude,
+                     tN2kGNSStype GNSStype, tN2kGNSSmethod GNSSmethod,
+                     unsigned char nSatellites, tN2kFixedDOP HDOP, tN2kFixedDOP PDOP, tN2kFixedSignedDistance GeoidalSeparation,
+                     unsigned char nReferenceStations, tN2kGNSStype ReferenceStationType, uint16_t ReferenceSationID,
+                     tN2kFixedDuration AgeOfCorrection) {
+    N2kMsg.SetPGN(129029L);
+    N2kMsg.Priority=3;
+    N2kMsg.AddByte(SID);
+    N2kMsg.Add2ByteUInt(DaysSince1970);
+    N2kAddFixed(N2kMsg,SecondsSinceMidnight);
+    N2kAddFixed(N2kMsg,Latitude);
+    N2kAddFixed(N2kMsg,Longitude);
+    N2kAddFixed(N2kMsg,Altitude);
+    N2kMsg.AddByte( (((unsigned char) GNSStype) & 0x0f) | (((unsigned char) GNSSmethod) & 0x0f)<<4 );
+    N2kMsg.AddByte(1 | 0xfc);  // Integrity 2 bit, reserved 6 bits
+    N2kMsg.AddByte(nSatellites);
+    N2kAddFixed(N2kMsg,HDOP);
+    N2kAddFixed(N2kMsg,PDOP);
+    N2kAddFixed(N2kMsg,GeoidalSeparation);
+    if (nReferenceStations!=0xff && nReferenceStations>0) {
+      N2kMsg.AddByte(1); // Note that we have values for only one reference station, so pass only one values.
+      N2kMsg.Add2ByteInt( (((int)ReferenceStationType) & 0x0f) | ReferenceSationID<<4 );
+      N2kAddFixed(N2kMsg,AgeOfCorrection);
+    } else N2kMsg.AddByte(nReferenceStations);
+}
+
+bool ParseN2kPGN129029(const tN2kMsg &N2kMsg, unsigned char &SID, uint16_t &DaysSince1970, tN2kFixedTimeOfDay &SecondsSinceMidnight,
+                     tN2kFixedLatLonHighRes &Latitude, tN2kFixedLatLonHighRes &Longitude, tN2kFixedAltitude &Altitude,
+                     tN2kGNSStype &GNSStype, tN2kGNSSmethod &GNSSmethod,
+                     unsigned char &nSatellites, tN2kFixedDOP &HDOP, tN2kFixedDOP &PDOP, tN2kFixedSignedDistance &GeoidalSeparation,
+                     unsigned char &nReferenceStations, tN2kGNSStype &ReferenceStationType, uint16_t &ReferenceSationID,
+                     tN2kFixedDuration &AgeOfCorrection) {
+  if (N2kMsg.PGN!=129029L) return false;
+  int Index=0;
+  unsigned char vb;
+  uint16_t vi;
+
+  SID=N2kMsg.GetByte(Index);
+  DaysSince1970=N2kMsg.Get2ByteUInt(Index);
+  N2kGetFixed(N2kMsg,Index,SecondsSinceMidnight);
+  N2kGetFixed(N2kMsg,Index,Latitude);
+  N2kGetFixed(N2kMsg,Index,Longitude);
+  N2kGetFixed(N2kMsg,Index,Altitude);
+  vb=N2kMsg.GetByte(Index); GNSStype=(tN2kGNSStype)(vb & 0x0f); GNSSmethod=(tN2kGNSSmethod)((vb>>4) & 0x0f);
+  N2kMsg.GetByte(Index);  // Integrity 2 bit, reserved 6 bits
+  nSatellites=N2kMsg.GetByte(Index);
+  N2kGetFixed(N2kMsg,Index,HDOP);
+  N2kGetFixed(N2kMsg,Index,PDOP);
+  N2kGetFixed(N2kMsg,Index,GeoidalSeparation);
+  nReferenceStations=N2kMsg.GetByte(Index);
+  if (nReferenceStations!=N2kUInt8NA && nReferenceStations>0) {
+    // Note that we return real number of stations, but we only have variabes for one.
+    vi=N2kMsg.Get2ByteUInt(Index); ReferenceStationType=(tN2kGNSStype)(vi & 0x0f); ReferenceSationID=(vi>>4);
+    N2kGetFixed(N2kMsg,Index,AgeOfCorrection);
+  } else {
+    ReferenceStationType = N2kGNSSt_GPS;
+    ReferenceSationID = N2kInt16NA;
+    AgeOfCorrection = tN2kFixedDuration::NA();
+  }
+
+  return true;
+}
+
+//*****************************************************************************
+// Wind Speed
+void SetN2kPGN130306(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedSpeed WindSpeed, tN2kFixedAngle WindAngle,
+                     tN2kWindReference WindReference) {
+    N2kMsg.SetPGN(130306L);
+    N2kMsg.Priority=2;
+    N2kMsg.AddByte(SID);
+    N2kAddFixed(N2kMsg,WindSpeed);
+    N2kAddFixed(N2kMsg,WindAngle);
+    N2kMsg.AddByte((unsigned char)WindReference);
+    N2kMsg.AddByte(0xff); // Reserved
+    N2kMsg.AddByte(0xff); // Reserved
+}
+
+bool ParseN2kPGN130306(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedSpeed &WindSpeed, tN2kFixedAngle &WindAngle,
+                     tN2kWindReference &WindReference) {
+  if (N2kMsg.PGN!=130306L) return false;
+  int Index=0;
+  SID=N2kMsg.GetByte(Index);
+  N2kGetFixed(N2kMsg,Index,WindSpeed);
+  N2kGetFixed(N2kMsg,Index,WindAngle);
+  WindReference=(tN2kWindReference)(N2kMsg.GetByte(Index)&0x07);
+
+  return true;
+}
+
+//*****************************************************************************
+// Outside Environmental parameters
+void SetN2kPGN130310(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedTemperature WaterTemperature,
+                     tN2kFixedTemperature OutsideAmbientAirTemperature, tN2kFixedPressure AtmosphericPressure) {
+    N2kMsg.SetPGN(130310L);
+    N2kMsg.Priority=5;
+    N2kMsg.AddByte(SID);
+    N2kAddFixed(N2kMsg,WaterTemperature);
+    N2kAddFixed(N2kMsg,OutsideAmbientAirTemperature);
+    N2kAddFixed(N2kMsg,AtmosphericPressure);
+    N2kMsg.AddByte(0xff);  // reserved
+}
+
+bool ParseN2kPGN130310(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedTemperature &WaterTemperature,
+                     tN2kFixedTemperature &OutsideAmbientAirTemperature, tN2kFixedPressure &AtmosphericPressure) {
+  if (N2kMsg.PGN!=130310L) return false;
+  int Index=0;
+  SID=N2kMsg.GetByte(Index);
+  N2kGetFixed(N2kMsg,Index,WaterTemperature);
+  N2kGetFixed(N2kMsg,Index,OutsideAmbientAirTemperature);
+  N2kGetFixed(N2kMsg,Index,AtmosphericPressure);
+
+  return true;
+}
+
+//*****************************************************************************
+// Temperature
+void SetN2kPGN130312(tN2kMsg &N2kMsg, unsigned char SID, unsigned char TempInstance, tN2kTempSource TempSource,
+                     tN2kFixedTemperature ActualTemperature, tN2kFixedTemperature SetTemperature) {
+    N2kMsg.SetPGN(130312L);
+    N2kMsg.Priority=5;
+    N2kMsg.AddByte(SID);
+    N2kMsg.AddByte((unsigned char)TempInstance);
+    N2kMsg.AddByte((unsigned char)TempSource);
+    N2kAddFixed(N2kMsg,ActualTemperature);
+    N2kAddFixed(N2kMsg,SetTemperature);
+    N2kMsg.AddByte(0xff); // Reserved
+}
+
+bool ParseN2kPGN130312(const tN2kMsg &N2kMsg, unsigned char &SID, unsigned char &TempInstance, tN2kTempSource &TempSource,
+                     tN2kFixedTemperature &ActualTemperature, tN2kFixedTemperature &SetTemperature) {
+  if (N2kMsg.PGN!=130312L) return false;
+  int Index=0;
+  SID=N2kMsg.GetByte(Index);
+  TempInstance=N2kMsg.GetByte(Index);
+  TempSource=(tN2kTempSource)(N2kMsg.GetByte(Index));
+  N2kGetFixed(N2kMsg,Index,ActualTemperature);
+  N2kGetFixed(N2kMsg,Index,SetTemperature);
+
+  return true;
+}
+
+//*****************************************************************************
+// Temperature, extended range
+void SetN2kPGN130316(tN2kMsg &N2kMsg, unsigned char SID, unsigned char TempInstance, tN2kTempSource TempSource,
+                     tN2kFixedTemperatureHighRes ActualTemperature, tN2kFixedTemperatureLowRes SetTemperature) {
+    N2kMsg.SetPGN(130316L);
+    N2kMsg.Priority=5;
+    N2kMsg.AddByte(SID);
+    N2kMsg.AddByte((unsigned char)TempInstance);
+    N2kMsg.AddByte((unsigned char)TempSource);
+    N2kAddFixed(N2kMsg,ActualTemperature);
+    N2kAddFixed(N2kMsg,SetTemperature);
+}
+
+bool ParseN2kPGN130316(const tN2kMsg &N2kMsg, unsigned char &SID, unsigned char &TempInstance, tN2kTempSource &TempSource,
+                     tN2kFixedTemperatureHighRes &ActualTemperature, tN2kFixedTemperatureLowRes &SetTemperature) {
+  if (N2kMsg.PGN!=130316L) return false;
+  int Index=0;
+  SID=N2kMsg.GetByte(Index);
+  TempInstance=N2kMsg.GetByte(Index);
+  TempSource=(tN2kTempSource)(N2kMsg.GetByte(Index));
+  N2kGetFixed(N2kMsg,Index,ActualTemperature);
+  N2kGetFixed(N2kMsg,Index,SetTemperature);
+
+  return true;
+}
@@ -0,0 +1,390 @@
+/*
+ * N2kFixedPoint.h
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+/*************************************************************************//**
+ * \file  N2kFixedPoint.h
+ * \brief Fixed point integer API for common PGNs.
+ *
+ * Functions on \ref N2kMessages.h convert every field through double, which
+ * is software floating point on FPU-less targets like AVR or Cortex-M0. This
+ * file defines \ref tN2kFixed types, which carry field raw value as it is
+ * on the bus with unit and resolution encoded in the type, and
+ * ParseN2kPGN* / SetN2kPGN* overloads for common PGNs built on them. Those
+ * overloads do not use floating point at all.
+ *
+ * Example:
+ * \code
+ * tN2kFixedSpeed WindSpeed(1250);  // 12.50 m/s
+ * tN2kFixedAngle WindAngle(7854);  // 0.7854 rad
+ * SetN2kPGN130306(N2kMsg,0xff,WindSpeed,WindAngle,N2kWind_Apparent);
+ * \endcode
+ *
+ * Raw value N2k NA ("data not available") and OR ("out of range")
+ * sentinels are same as on the bus: for unsigned fields NA is all ones and
+ * for signed fields max positive value. OR is NA-1.
+ */
+
+#ifndef _N2kFixedPoint_H_
+#define _N2kFixedPoint_H_
+
+#include "N2kMsg.h"
+#include "N2kTypes.h"
+#include <stdint.h>
+#include <math.h>
+
+/************************************************************************//**
+ * \brief Units of \ref tN2kFixed types
+ *
+ * Unit is part of the type, so values with different units can not be
+ * mixed by mistake.
+ */
+typedef enum {
+  N2kfu_None=0,             ///< Unitless value
+  N2kfu_Radian=1,           ///< rad
+  N2kfu_RadianPerSecond=2,  ///< rad/s
+  N2kfu_Degree=3,           ///< deg
+  N2kfu_Meter=4,            ///< m
+  N2kfu_MeterPerSecond=5,   ///< m/s
+  N2kfu_Second=6,           ///< s
+  N2kfu_Kelvin=7,           ///< K
+  N2kfu_Pascal=8,           ///< Pa
+  N2kfu_Volt=9,             ///< V
+  N2kfu_Ampere=10           ///< A
+} tN2kFixedUnit;
+
+/************************************************************************//**
+ * \class tN2kFixed
+ * \brief Raw scaled integer field value
+ * \ingroup group_msgTypes
+ *
+ * Physical value is Raw * Mult * 10^Exp Unit. E.g. wind speed on 0.01 m/s
+ * resolution is tN2kFixed<N2kfu_MeterPerSecond,uint16_t,2,1,-2>.
+ *
+ * \tparam Unit   Unit of physical value
+ * \tparam T      Integer type for raw value
+ * \tparam Bytes  Field size on message. Can be less than sizeof(T) e.g. for
+ *                3 byte fields.
+ * \tparam Mult   Resolution multiplier
+ * \tparam Exp    Resolution exponent of 10
+ */
+template <tN2kFixedUnit Unit, typename T, uint8_t Bytes, int32_t Mult, int8_t Exp>
+class tN2kFixed {
+public:
+  /** \brief Raw value type */
+  typedef T tRaw;
+
+  /** \brief Raw value as on message */
+  T Raw;
+
+  /** \brief Default value is NA */
+  tN2kFixed() : Raw(NARaw()) {}
+  /** \brief Construct from raw value */
+  explicit tN2kFixed(T _Raw) : Raw(_Raw) {}
+
+  /** \brief Is raw type signed */
+  static bool IsSigned() { return (T)(-1)<(T)0; }
+  /** \brief Raw NA value for the field */
+  static T NARaw() {
+    return ( IsSigned() ? (T)(((uint64_t)1<<(8*Bytes-1))-1)
+                        : (T)( Bytes>=8 ? ~(uint64_t)0 : ((uint64_t)1<<((8*Bytes)&63))-1 ) );
+  }
+  /** \brief Raw OR value for the field */
+  static T ORRaw() { return NARaw()-1; }
+  /** \brief NA value */
+  static tN2kFixed NA() { return tN2kFixed(NARaw()); }
+
+  /** \brief Is value not available */
+  bool IsNA() const { return Raw==NARaw(); }
+  /** \brief Is value out of range */
+  bool IsOR() const { return Raw==ORRaw(); }
+  /** \brief Does raw value fit to field */
+  bool Fits() const {
+    if ( Bytes>=sizeof(T) ) return true;
+    if ( IsSigned() ) return (int64_t)Raw<=(int64_t)NARaw() && (int64_t)Raw>=-(int64_t)NARaw()-1;
+    return (uint64_t)Raw<=(uint64_t)NARaw();
+  }
+
+  bool operator==(const tN2kFixed &v) const { return Raw==v.Raw; }
+  bool operator!=(const tN2kFixed &v) const { return Raw!=v.Raw; }
+
+  // Conversions below use floating point. They are provided for targets,
+  // where it is available, and will not be linked if not used.
+
+  /** \brief Resolution of one raw step in Unit */
+  static double Resolution() {
+    double d=1;
+    for ( int8_t i=0; i<(Exp<0?-Exp:Exp); i++ ) d*=10;
+    return ( Exp<0 ? Mult/d : Mult*d );
+  }
+  /** \brief Physical value or N2kDoubleNA */
+  double ToDouble() const { return ( IsNA() ? N2kDoubleNA : (double)Raw*Resolution() ); }
+  /** \brief Convert from physical value. Rounding and range check are same
+   *         as with tN2kMsg::Add*Double functions. */
+  static tN2kFixed FromDouble(double v) {
+    if ( v==N2kDoubleNA ) return NA();
+    double vd=round(v/Resolution());
+    double Min=( IsSigned() ? -(double)NARaw()-1 : 0 );
+    return tN2kFixed( vd>=Min && vd<(double)ORRaw() ? (T)vd : ORRaw() );
+  }
+};
+
+/************************************************************************//**
+ * \brief Verify that the specified value is equal to "Not available".
+ */
+template <tN2kFixedUnit Unit, typename T, uint8_t Bytes, int32_t Mult, int8_t Exp>
+inline bool N2kIsNA(const tN2kFixed<Unit,T,Bytes,Mult,Exp> &v) { return v.IsNA(); }
+
+/************************************************************************//**
+ * \brief Read fixed value from message
+ *
+ * \param N2kMsg  Message
+ * \param Index   Position of the field. Will be increased by field size.
+ * \param v       Value or NA, if message is too short.
+ */
+template <tN2kFixedUnit Unit, typename T, uint8_t Bytes, int32_t Mult, int8_t Exp>
+inline void N2kGetFixed(const tN2kMsg &N2kMsg, int &Index, tN2kFixed<Unit,T,Bytes,Mult,Exp> &v) {
+  if ( Index+Bytes>N2kMsg.DataLen ) {
+    v.Raw=v.NARaw();
+    Index+=Bytes;
+    return;
+  }
+
+  const unsigned char *p=N2kMsg.Data+Index;
+  Index+=Bytes;
+  // Bytes is constant, so only one branch will be compiled. Use 32 bit
+  // arithmetic whenever possible, since 64 bit is expensive on 8 bit MCUs.
+  if ( Bytes<=4 ) {
+    uint32_t Raw=0;
+    for ( uint8_t i=0; i<Bytes; i++ ) Raw|=(uint32_t)p[i]<<(8*i);
+    // Sign extend fields shorter than raw type
+    if ( Bytes<4 && v.IsSigned() && (Raw & ((uint32_t)1<<(8*Bytes-1)))!=0 ) Raw|=~(uint32_t)0<<((8*Bytes)&31);
+    v.Raw=( v.IsSigned() ? (T)(int32_t)Raw : (T)Raw );
+  } else {
+    uint64_t Raw=0;
+    for ( uint8_t i=0; i<Bytes; i++ ) Raw|=(uint64_t)p[i]<<(8*i);
+    if ( Bytes<8 && v.IsSigned() && (Raw & ((uint64_t)1<<(8*Bytes-1)))!=0 ) Raw|=~(uint64_t)0<<((8*Bytes)&63);
+    v.Raw=(T)Raw;
+  }
+}
+
+/************************************************************************//**
+ * \brief Add fixed value to the end of message
+ *
+ * Values, which do not fit to field, will be set to OR.
+ *
+ * \param N2kMsg  Message
+ * \param v       Value
+ */
+template <tN2kFixedUnit Unit, typename T, uint8_t Bytes, int32_t Mult, int8_t Exp>
+inline void N2kAddFixed(tN2kMsg &N2kMsg, const tN2kFixed<Unit,T,Bytes,Mult,Exp> &v) {
+  T Value=( v.Fits() ? v.Raw : v.ORRaw() );
+  if ( Bytes<=4 ) {
+    uint32_t Raw=(uint32_t)Value;
+    for ( uint8_t i=0; i<Bytes; i++, Raw>>=8 ) N2kMsg.AddByte((unsigned char)Raw);
+  } else {
+    uint64_t Raw=(uint64_t)Value;
+    for ( uint8_t i=0; i<Bytes; i++, Raw>>=8 ) N2kMsg.AddByte((unsigned char)Raw);
+  }
+}
+
+/** \brief Angle 0.0001 rad, 0 - 6.5534 (heading, COG, wind angle) */
+typedef tN2kFixed<N2kfu_Radian,uint16_t,2,1,-4> tN2kFixedAngle;
+/** \brief Signed angle 0.0001 rad (deviation, variation, attitude) */
+typedef tN2kFixed<N2kfu_Radian,int16_t,2,1,-4> tN2kFixedSignedAngle;
+/** \brief Rate of turn 3.125e-8 rad/s */
+typedef tN2kFixed<N2kfu_RadianPerSecond,int32_t,4,3125,-11> tN2kFixedRateOfTurn;
+/** \brief Speed 0.01 m/s (SOG, STW, wind speed) */
+typedef tN2kFixed<N2kfu_MeterPerSecond,uint16_t,2,1,-2> tN2kFixedSpeed;
+/** \brief Latitude or longitude 1e-7 deg */
+typedef tN2kFixed<N2kfu_Degree,int32_t,4,1,-7> tN2kFixedLatLon;
+/** \brief Latitude or longitude 1e-16 deg */
+typedef tN2kFixed<N2kfu_Degree,int64_t,8,1,-16> tN2kFixedLatLonHighRes;
+/** \brief Altitude 1e-6 m */
+typedef tN2kFixed<N2kfu_Meter,int64_t,8,1,-6> tN2kFixedAltitude;
+/** \brief Signed distance 0.01 m (geoidal separation) */
+typedef tN2kFixed<N2kfu_Meter,int32_t,4,1,-2> tN2kFixedSignedDistance;
+/** \brief Depth 0.01 m */
+typedef tN2kFixed<N2kfu_Meter,uint32_t,4,1,-2> tN2kFixedDepth;
+/** \brief Transducer offset 0.001 m */
+typedef tN2kFixed<N2kfu_Meter,int16_t,2,1,-3> tN2kFixedDepthOffset;
+/** \brief Depth range 10 m */
+typedef tN2kFixed<N2kfu_Meter,uint8_t,1,1,1> tN2kFixedDepthRange;
+/** \brief Dilution of precision 0.01 */
+typedef tN2kFixed<N2kfu_None,int16_t,2,1,-2> tN2kFixedDOP;
+/** \brief Time since midnight 0.0001 s */
+typedef tN2kFixed<N2kfu_Second,uint32_t,4,1,-4> tN2kFixedTimeOfDay;
+/** \brief Short duration 0.01 s (age of correction) */
+typedef tN2kFixed<N2kfu_Second,uint16_t,2,1,-2> tN2kFixedDuration;
+/** \brief Temperature 0.01 K */
+typedef tN2kFixed<N2kfu_Kelvin,uint16_t,2,1,-2> tN2kFixedTemperature;
+/** \brief Temperature 0.1 K */
+typedef tN2kFixed<N2kfu_Kelvin,uint16_t,2,1,-1> tN2kFixedTemperatureLowRes;
+/** \brief Temperature 0.001 K, 3 byte field */
+typedef tN2kFixed<N2kfu_Kelvin,uint32_t,3,1,-3> tN2kFixedTemperatureHighRes;
+/** \brief Pressure 100 Pa */
+typedef tN2kFixed<N2kfu_Pascal,uint16_t,2,1,2> tN2kFixedPressure;
+/** \brief Voltage 0.01 V */
+typedef tN2kFixed<N2kfu_Volt,int16_t,2,1,-2> tN2kFixedVoltage;
+/** \brief Current 0.1 A */
+typedef tN2kFixed<N2kfu_Ampere,int16_t,2,1,-1> tN2kFixedCurrent;
+
+/************************************************************************//**
+ * \brief Setting up PGN 126992 "System time" with fixed point values
+ * See \ref SetN2kPGN126992 for parameter details.
+ */
+void SetN2kPGN126992(tN2kMsg &N2kMsg, unsigned char SID, uint16_t SystemDate,
+                     tN2kFixedTimeOfDay SystemTime, tN2kTimeSource TimeSource=N2ktimes_GPS);
+/** \brief Parsing PGN 126992 "System time" to fixed point values */
+bool ParseN2kPGN126992(const tN2kMsg &N2kMsg, unsigned char &SID, uint16_t &SystemDate,
+                     tN2kFixedTimeOfDay &SystemTime, tN2kTimeSource &TimeSource);
+
+/************************************************************************//**
+ * \brief Setting up PGN 127250 "Vessel Heading" with fixed point values
+ */
+void SetN2kPGN127250(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedAngle Heading, tN2kFixedSignedAngle Deviation,
+                     tN2kFixedSignedAngle Variation, tN2kHeadingReference ref);
+/** \brief Parsing PGN 127250 "Vessel Heading" to fixed point values */
+bool ParseN2kPGN127250(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedAngle &Heading, tN2kFixedSignedAngle &Deviation,
+                     tN2kFixedSignedAngle &Variation, tN2kHeadingReference &ref);
+
+/************************************************************************//**
+ * \brief Setting up PGN 127251 "Rate of Turn" with fixed point values
+ */
+void SetN2kPGN127251(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedRateOfTurn RateOfTurn);
+/** \brief Parsing PGN 127251 "Rate of Turn" to fixed point values */
+bool ParseN2kPGN127251(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedRateOfTurn &RateOfTurn);
+
+/************************************************************************//**
+ * \brief Setting up PGN 127257 "Attitude" with fixed point values
+ */
+void SetN2kPGN127257(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedSignedAngle Yaw, tN2kFixedSignedAngle Pitch,
+                     tN2kFixedSignedAngle Roll);
+/** \brief Parsing PGN 127257 "Attitude" to fixed point values */
+bool ParseN2kPGN127257(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedSignedAngle &Yaw, tN2kFixedSignedAngle &Pitch,
+                     tN2kFixedSignedAngle &Roll);
+
+/************************************************************************//**
+ * \brief Setting up PGN 127508 "Battery Status" with fixed point values
+ */
+void SetN2kPGN127508(tN2kMsg &N2kMsg, unsigned char BatteryInstance, tN2kFixedVoltage BatteryVoltage,
+                     tN2kFixedCurrent BatteryCurrent=tN2kFixedCurrent(),
+                     tN2kFixedTemperature BatteryTemperature=tN2kFixedTemperature(), unsigned char SID=0xff);
+/** \brief Parsing PGN 127508 "Battery Status" to fixed point values */
+bool ParseN2kPGN127508(const tN2kMsg &N2kMsg, unsigned char &BatteryInstance, tN2kFixedVoltage &BatteryVoltage,
+                     tN2kFixedCurrent &BatteryCurrent, tN2kFixedTemperature &BatteryTemperature, unsigned char &SID);
+
+/************************************************************************//**
+ * \brief Setting up PGN 128259 "Boat speed" with fixed point values
+ */
+void SetN2kPGN128259(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedSpeed WaterReferenced,
+                     tN2kFixedSpeed GroundReferenced=tN2kFixedSpeed(), tN2kSpeedWaterReferenceType SWRT=N2kSWRT_Paddle_wheel);
+/** \brief Parsing PGN 128259 "Boat speed" to fixed point values */
+bool ParseN2kPGN128259(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedSpeed &WaterReferenced,
+                     tN2kFixedSpeed &GroundReferenced, tN2kSpeedWaterReferenceType &SWRT);
+
+/************************************************************************//**
+ * \brief Setting up PGN 128267 "Water depth" with fixed point values
+ */
+void SetN2kPGN128267(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedDepth DepthBelowTransducer,
+                     tN2kFixedDepthOffset Offset, tN2kFixedDepthRange Range=tN2kFixedDepthRange());
+/** \brief Parsing PGN 128267 "Water depth" to fixed point values */
+bool ParseN2kPGN128267(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedDepth &DepthBelowTransducer,
+                     tN2kFixedDepthOffset &Offset, tN2kFixedDepthRange &Range);
+
+/************************************************************************//**
+ * \brief Setting up PGN 129025 "Position, rapid update" with fixed point values
+ */
+void SetN2kPGN129025(tN2kMsg &N2kMsg, tN2kFixedLatLon Latitude, tN2kFixedLatLon Longitude);
+/** \brief Parsing PGN 129025 "Position, rapid update" to fixed point values */
+bool ParseN2kPGN129025(const tN2kMsg &N2kMsg, tN2kFixedLatLon &Latitude, tN2kFixedLatLon &Longitude);
+
+/************************************************************************//**
+ * \brief Setting up PGN 129026 "COG SOG rapid update" with fixed point values
+ */
+void SetN2kPGN129026(tN2kMsg &N2kMsg, unsigned char SID, tN2kHeadingReference ref, tN2kFixedAngle COG, tN2kFixedSpeed SOG);
+/** \brief Parsing PGN 129026 "COG SOG rapid update" to fixed point values */
+bool ParseN2kPGN129026(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kHeadingReference &ref, tN2kFixedAngle &COG, tN2kFixedSpeed &SOG);
+
+/************************************************************************//**
+ * \brief Setting up PGN 129029 "GNSS Position Data" with fixed point values
+ *
+ * Latitude and longitude are 8 byte integers on 1e-16 deg resolution, so
+ * there is no precision loss on targets, where double is 4 bytes.
+ */
+void SetN2kPGN129029(tN2kMsg &N2kMsg, unsigned char SID, uint16_t DaysSince1970, tN2kFixedTimeOfDay SecondsSinceMidnight,
+                     tN2kFixedLatLonHighRes Latitude, tN2kFixedLatLonHighRes Longitude, tN2kFixedAltitude Altitude,
+                     tN2kGNSStype GNSStype, tN2kGNSSmethod GNSSmethod,
+                     unsigned char nSatellites, tN2kFixedDOP HDOP, tN2kFixedDOP PDOP=tN2kFixedDOP(0),
+                     tN2kFixedSignedDistance GeoidalSeparation=tN2kFixedSignedDistance(0),
+                     unsigned char nReferenceStations=0, tN2kGNSStype ReferenceStationType=N2kGNSSt_GPS, uint16_t ReferenceSationID=0,
+                     tN2kFixedDuration AgeOfCorrection=tN2kFixedDuration(0));
+/** \brief Parsing PGN 129029 "GNSS Position Data" to fixed point values */
+bool ParseN2kPGN129029(const tN2kMsg &N2kMsg, unsigned char &SID, uint16_t &DaysSince1970, tN2kFixedTimeOfDay &SecondsSinceMidnight,
+                     tN2kFixedLatLonHighRes &Latitude, tN2kFixedLatLonHighRes &Longitude, tN2kFixedAltitude &Altitude,
+                     tN2kGNSStype &GNSStype, tN2kGNSSmethod &GNSSmethod,
+                     unsigned char &nSatellites, tN2kFixedDOP &HDOP, tN2kFixedDOP &PDOP, tN2kFixedSignedDistance &GeoidalSeparation,
+                     unsigned char &nReferenceStations, tN2kGNSStype &ReferenceStationType, uint16_t &ReferenceSationID,
+                     tN2kFixedDuration &AgeOfCorrection);
+
+/************************************************************************//**
+ * \brief Setting up PGN 130306 "Wind Data" with fixed point values
+ */
+void SetN2kPGN130306(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedSpeed WindSpeed, tN2kFixedAngle WindAngle,
+                     tN2kWindReference WindReference);
+/** \brief Parsing PGN 130306 "Wind Data" to fixed point values */
+bool ParseN2kPGN130306(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedSpeed &WindSpeed, tN2kFixedAngle &WindAngle,
+                     tN2kWindReference &WindReference);
+
+/************************************************************************//**
+ * \brief Setting up PGN 130310 "Outside Environmental parameters" with
+ *        fixed point values
+ */
+void SetN2kPGN130310(tN2kMsg &N2kMsg, unsigned char SID, tN2kFixedTemperature WaterTemperature,
+                     tN2kFixedTemperature OutsideAmbientAirTemperature=tN2kFixedTemperature(),
+                     tN2kFixedPressure AtmosphericPressure=tN2kFixedPressure());
+/** \brief Parsing PGN 130310 "Outside Environmental parameters" to fixed
+ *         point values */
+bool ParseN2kPGN130310(const tN2kMsg &N2kMsg, unsigned char &SID, tN2kFixedTemperature &WaterTemperature,
+                     tN2kFixedTemperature &OutsideAmbientAirTemperature, tN2kFixedPressure &AtmosphericPressure);
+
+/************************************************************************//**
+ * \brief Setting up PGN 130312 "Temperature" with fixed point values
+ */
+void SetN2kPGN130312(tN2kMsg &N2kMsg, unsigned char SID, unsigned char TempInstance, tN2kTempSource TempSource,
+                     tN2kFixedTemperature ActualTemperature, tN2kFixedTemperature SetTemperature=tN2kFixedTemperature());
+/** \brief Parsing PGN 130312 "Temperature" to fixed point values */
+bool ParseN2kPGN130312(const tN2kMsg &N2kMsg, unsigned char &SID, unsigned char &TempInstance, tN2kTempSource &TempSource,
+                     tN2kFixedTemperature &ActualTemperature, tN2kFixedTemperature &SetTemperature);
+
+/************************************************************************//**
+ * \brief Setting up PGN 130316 "Temperature, extended range" with fixed
+ *        point values
+ */
+void SetN2kPGN130316(tN2kMsg &N2kMsg, unsigned char SID, unsigned char TempInstance, tN2kTempSource TempSource,
+                     tN2kFixedTemperatureHighRes ActualTemperature,
+                     tN2kFixedTemperatureLowRes SetTemperature=tN2kFixedTemperatureLowRes());
+/** \brief Parsing PGN 130316 "Temperature, extended range" to fixed point
+ *         values */
+bool ParseN2kPGN130316(const tN2kMsg &N2kMsg, unsigned char &SID, unsigned char &TempInstance, tN2kTempSource &TempSource,
+                     tN2kFixedTemperatureHighRes &ActualTemperature, tN2kFixedTemperatureLowRes &SetTemperature);
+
+#endif
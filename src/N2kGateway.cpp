@@ -0,0 +1,354 @@
+/*
+ * N2kGateway.cpp
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "N2kGateway.h"
+#include <string.h>
+
+#if defined(N2K_THREADED_GATEWAY)
+#include <chrono>
+#if defined(__linux__)
+#include <poll.h>
+#endif
+#endif
+
+/** \brief PGN for ISO Commanded Address message */
+#define N2kPGNIsoCommandedAddress 65240L
+
+//*****************************************************************************
+tN2kGateway::tBus::tBus() : Gateway(0), NMEA2000(0), Index(0), EchoNext(0) {
+  memset(Echo,0,sizeof(Echo));
+  Stats.Clear();
+#if defined(N2K_THREADED_GATEWAY)
+  Queue=0;
+#endif
+}
+
+//*****************************************************************************
+tN2kGateway::tBus::~tBus() {
+#if defined(N2K_THREADED_GATEWAY)
+  delete Queue;
+#endif
+}
+
+//*****************************************************************************
+tN2kGateway::tN2kGateway(uint8_t _MaxBuses, uint8_t _MaxRules, uint8_t _MaxAddressMaps) {
+  MaxBuses=_MaxBuses;
+  BusCount=0;
+  Buses=new tBus[MaxBuses];
+  MaxRules=_MaxRules;
+  RuleCount=0;
+  Rules=( MaxRules>0 ? new tRule[MaxRules] : 0 );
+  MaxAddressMaps=_MaxAddressMaps;
+  AddressMapCount=0;
+  AddressMaps=( MaxAddressMaps>0 ? new tAddressMap[MaxAddressMaps] : 0 );
+  DefaultAction=ga_Forward;
+#if defined(N2K_THREADED_GATEWAY)
+  ThreadsRun.store(false);
+  IdleTime=1000;
+#endif
+}
+
+//*****************************************************************************
+tN2kGateway::~tN2kGateway() {
+#if defined(N2K_THREADED_GATEWAY)
+  StopThreads();
+#endif
+  for ( uint8_t i=0; i<BusCount; i++ ) Buses[i].NMEA2000->SetFrameHandler(0);
+  delete[] Buses;
+  delete[] Rules;
+  delete[] AddressMaps;
+}
+
+//*****************************************************************************
+int tN2kGateway::AddBus(tNMEA2000 *NMEA2000) {
+  if ( NMEA2000==0 || BusCount>=MaxBuses ) return -1;
+#if defined(N2K_THREADED_GATEWAY)
+  if ( IsRunning() ) return -1;
+#endif
+
+  tBus &Bus=Buses[BusCount];
+  Bus.Gateway=this;
+  Bus.NMEA2000=NMEA2000;
+  Bus.Index=BusCount;
+  NMEA2000->SetFrameHandler(&Bus);
+
+  return BusCount++;
+}
+
+//*****************************************************************************
+bool tN2kGateway::AddRule(tAction Action, unsigned long PGN, uint16_t FromBus, uint16_t ToBus, uint16_t Source, uint16_t Destination) {
+  if ( RuleCount>=MaxRules ) return false;
+
+  tRule &Rule=Rules[RuleCount];
+  Rule.PGN=PGN;
+  Rule.FromBus=FromBus;
+  Rule.ToBus=ToBus;
+  Rule.Source=Source;
+  Rule.Destination=Destination;
+  Rule.Action=Action;
+  RuleCount++;
+
+  return true;
+}
+
+//*****************************************************************************
+bool tN2kGateway::AddAddressMap(uint8_t FromBus, uint8_t FromAddress, uint8_t ToBus, uint8_t ToAddress) {
+  if ( AddressMapCount>=MaxAddressMaps || FromBus==ToBus ) return false;
+  if ( FromAddress>N2kMaxCanBusAddress || ToAddress>N2kMaxCanBusAddress ) return false;
+
+  for ( uint8_t i=0; i<AddressMapCount; i++ ) {
+    const tAddressMap &Map=AddressMaps[i];
+    if ( Map.ToBus==ToBus && Map.ToAddress==ToAddress ) return false;
+    if ( Map.FromBus==FromBus && Map.FromAddress==FromAddress && Map.ToBus==ToBus ) return false;
+  }
+
+  tAddressMap &Map=AddressMaps[AddressMapCount];
+  Map.FromBus=FromBus;
+  Map.FromAddress=FromAddress;
+  Map.ToBus=ToBus;
+  Map.ToAddress=ToAddress;
+  AddressMapCount++;
+
+  return true;
+}
+
+//*****************************************************************************
+bool tN2kGateway::IsBusLocalPGN(unsigned long PGN) {
+  switch ( PGN ) {
+    case 59392L: // ISO Acknowledgement
+    case 59904L: // ISO Request
+    case 60160L: // TP.DT
+    case 60416L: // TP.CM
+    case N2kPGNIsoAddressClaim:
+    case N2kPGNIsoCommandedAddress:
+      return true;
+  }
+
+  return false;
+}
+
+//*****************************************************************************
+static inline bool N2kGatewayMatch(uint16_t RuleValue, uint16_t Value) {
+  return ( RuleValue==N2kGatewayAny || RuleValue==Value );
+}
+
+//*****************************************************************************
+tN2kGateway::tAction tN2kGateway::GetAction(unsigned long PGN, uint8_t FromBus, uint8_t ToBus, uint8_t Source, uint8_t Destination) const {
+  // Address claiming is separate on each bus
+  if ( PGN==N2kPGNIsoAddressClaim || PGN==N2kPGNIsoCommandedAddress ) return ga_Block;
+
+  for ( uint8_t i=0; i<RuleCount; i++ ) {
+    const tRule &Rule=Rules[i];
+    if ( Rule.PGN!=0 && Rule.PGN!=PGN ) continue;
+    if ( !N2kGatewayMatch(Rule.FromBus,FromBus) || !N2kGatewayMatch(Rule.ToBus,ToBus) ) continue;
+    if ( !N2kGatewayMatch(Rule.Source,Source) || !N2kGatewayMatch(Rule.Destination,Destination) ) continue;
+    if ( Rule.PGN==0 && IsBusLocalPGN(PGN) ) return ga_Block;
+    return Rule.Action;
+  }
+
+  return ( IsBusLocalPGN(PGN) ? ga_Block : DefaultAction );
+}
+
+//*****************************************************************************
+bool tN2kGateway::TranslateDestination(uint8_t FromBus, uint8_t ToBus, uint8_t &Destination) const {
+  if ( Destination==0xff ) return true;
+
+  for ( uint8_t i=0; i<AddressMapCount; i++ ) {
+    const tAddressMap &Map=AddressMaps[i];
+    if ( Map.ToBus==FromBus && Map.ToAddress==Destination ) {
+      if ( Map.FromBus!=ToBus ) return false;
+      Destination=Map.FromAddress;
+      return true;
+    }
+  }
+
+  return true;
+}
+
+//*****************************************************************************
+uint8_t tN2kGateway::TranslateSource(uint8_t FromBus, uint8_t ToBus, uint8_t Source) const {
+  for ( uint8_t i=0; i<AddressMapCount; i++ ) {
+    const tAddressMap &Map=AddressMaps[i];
+    if ( Map.FromBus==FromBus && Map.FromAddress==Source && Map.ToBus==ToBus ) return Map.ToAddress;
+  }
+
+  return Source;
+}
+
+//*****************************************************************************
+bool tN2kGateway::IsLoop(tBus &From, const tNMEA2000::tCANFrame &Frame, uint8_t Source) {
+  // Mapped address belongs to gateway on this bus, so frame must be our own.
+  for ( uint8_t i=0; i<AddressMapCount; i++ ) {
+    if ( AddressMaps[i].ToBus==From.Index && AddressMaps[i].ToAddress==Source ) return true;
+  }
+
+  unsigned long Now=N2kMillis();
+  for ( uint8_t i=0; i<N2kGatewayEchoSize; i++ ) {
+    tEcho &Echo=From.Echo[i];
+    if ( Echo.id!=Frame.id || Echo.len!=Frame.len || Now-Echo.Time>N2kGatewayEchoTime ) continue;
+    if ( memcmp(Echo.buf,Frame.buf,Frame.len)!=0 ) continue;
+    Echo.id=0; // Each forwarded frame can echo only once
+    return true;
+  }
+
+  return false;
+}
+
+//*****************************************************************************
+void tN2kGateway::SendFrame(tBus &To, const tNMEA2000::tCANFrame &Frame) {
+  if ( !To.NMEA2000->SendRawFrame(Frame) ) {
+    To.Stats.SendFailures++;
+    return;
+  }
+
+  To.Stats.FramesForwarded++;
+  tEcho &Echo=To.Echo[To.EchoNext];
+  Echo.id=Frame.id;
+  Echo.len=( Frame.len<8 ? Frame.len : 8 );
+  Echo.Time=N2kMillis();
+  memcpy(Echo.buf,Frame.buf,Echo.len);
+  To.EchoNext=(To.EchoNext+1)%N2kGatewayEchoSize;
+}
+
+//*****************************************************************************
+void tN2kGateway::HandleFrame(tBus &From, const tNMEA2000::tCANFrame &Frame) {
+  unsigned char Priority, Source, Destination;
+  unsigned long PGN;
+  bool Forwarded=false;
+
+  From.Stats.FramesReceived++;
+  CanIdToN2k(Frame.id,Priority,PGN,Source,Destination);
+  if ( IsLoop(From,Frame,Source) ) {
+    From.Stats.FramesLooped++;
+    return;
+  }
+
+  for ( uint8_t i=0; i<BusCount; i++ ) {
+    if ( i==From.Index ) continue;
+    uint8_t ToDestination=Destination;
+    if ( !TranslateDestination(From.Index,i,ToDestination) ) continue;
+    if ( GetAction(PGN,From.Index,i,Source,Destination)!=ga_Forward ) continue;
+
+    tNMEA2000::tCANFrame Out=Frame;
+    Out.id=N2ktoCanID(Priority,PGN,TranslateSource(From.Index,i,Source),ToDestination);
+    Forwarded=true;
+#if defined(N2K_THREADED_GATEWAY)
+    if ( Buses[i].Queue!=0 ) {
+      if ( !Buses[i].Queue->add(Out) ) From.Stats.QueueOverflows++;
+      continue;
+    }
+#endif
+    SendFrame(Buses[i],Out);
+  }
+
+  if ( !Forwarded ) From.Stats.FramesFiltered++;
+}
+
+//*****************************************************************************
+void tN2kGateway::ParseMessages() {
+  for ( uint8_t i=0; i<BusCount; i++ ) ParseMessages(i);
+}
+
+//*****************************************************************************
+void tN2kGateway::ParseMessages(uint8_t Bus) {
+  if ( Bus>=BusCount ) return;
+
+#if defined(N2K_THREADED_GATEWAY)
+  SendQueuedFrames(Buses[Bus]);
+#endif
+  Buses[Bus].NMEA2000->ParseMessages();
+}
+
+//*****************************************************************************
+void tN2kGateway::ResetBusStats() {
+  for ( uint8_t i=0; i<BusCount; i++ ) Buses[i].Stats.Clear();
+}
+
+#if defined(N2K_THREADED_GATEWAY)
+//*****************************************************************************
+void tN2kGateway::SetForwardQueueSize(uint16_t QueueSize) {
+  for ( uint8_t i=0; i<BusCount; i++ ) {
+    delete Buses[i].Queue;
+    Buses[i].Queue=new tMPSCRingBuffer<tNMEA2000::tCANFrame>(QueueSize);
+  }
+}
+
+//*****************************************************************************
+void tN2kGateway::SendQueuedFrames(tBus &To) {
+  tNMEA2000::tCANFrame *Frame;
+
+  if ( To.Queue==0 ) return;
+  for ( uint16_t i=To.Queue->getSize(); i>0 && (Frame=To.Queue->peek())!=0; i-- ) {
+    SendFrame(To,*Frame);
+    To.Queue->pop();
+  }
+}
+
+//*****************************************************************************
+bool tN2kGateway::StartThreads(uint16_t QueueSize, uint32_t _IdleTime) {
+  if ( BusCount==0 || IsRunning() ) return false;
+  // Open modifies shared scheduler sync time, so it must be done before threads.
+  for ( uint8_t i=0; i<BusCount; i++ ) {
+    if ( !Buses[i].NMEA2000->IsOpen() ) return false;
+  }
+
+  SetForwardQueueSize(QueueSize);
+  IdleTime=_IdleTime;
+  ThreadsRun.store(true,std::memory_order_release);
+  for ( uint8_t i=0; i<BusCount; i++ ) {
+    Buses[i].Thread=std::thread(&tN2kGateway::BusThreadLoop,this,i);
+  }
+
+  return true;
+}
+
+//*****************************************************************************
+void tN2kGateway::StopThreads() {
+  ThreadsRun.store(false,std::memory_order_release);
+  for ( uint8_t i=0; i<BusCount; i++ ) {
+    if ( Buses[i].Thread.joinable() ) Buses[i].Thread.join();
+  }
+  for ( uint8_t i=0; i<BusCount; i++ ) SendQueuedFrames(Buses[i]);
+}
+
+//*****************************************************************************
+void tN2kGateway::BusThreadLoop(uint8_t Bus) {
+  tBus &Own=Buses[Bus];
+#if defined(__linux__)
+  int Fd=Own.NMEA2000->GetPollFd();
+#endif
+
+  while ( IsRunning() ) {
+    ParseMessages(Bus);
+    if ( !Own.Queue->isEmpty() || Own.NMEA2000->GetWakeupTimeout(1)==0 ) continue;
+
+#if defined(__linux__)
+    if ( Fd>=0 ) {
+      struct pollfd PollFd={ Fd, POLLIN, 0 };
+      poll(&PollFd,1,(IdleTime+999)/1000);
+      continue;
+    }
+#endif
+    std::this_thread::sleep_for(std::chrono::microseconds(IdleTime));
+  }
+}
+#endif
@@ -0,0 +1,464 @@
+/*
+ * N2kGateway.h
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+/*************************************************************************//**
+ * \file  N2kGateway.h
+ * \brief File declares tN2kGateway class for bridging several NMEA2000 buses.
+ *
+ * Threaded gateway is optional and it will be compiled only, if
+ * N2K_THREADED_GATEWAY has been defined. See \ref NMEA2000_CompilerDefns.h.
+ */
+
+#ifndef _tN2kGateway_H_
+#define _tN2kGateway_H_
+
+#include "NMEA2000.h"
+#include "RingBuffer.h"
+
+#if defined(N2K_THREADED_GATEWAY)
+#include <atomic>
+#include <thread>
+#endif
+
+/** \brief Rule field matches any value */
+#define N2kGatewayAny 0xffff
+/** \brief Default max number of buses */
+#define N2kGatewayDefaultMaxBuses 4
+/** \brief Default max number of forwarding rules */
+#define N2kGatewayDefaultMaxRules 16
+/** \brief Default max number of address maps */
+#define N2kGatewayDefaultMaxAddressMaps 16
+/** \brief Number of frames remembered per bus for echo detection */
+#if !defined(N2kGatewayEchoSize)
+#define N2kGatewayEchoSize 16
+#endif
+/** \brief Time in ms forwarded frame will be remembered for echo detection */
+#if !defined(N2kGatewayEchoTime)
+#define N2kGatewayEchoTime 100
+#endif
+/** \brief Default size of per bus forward queue on threaded gateway */
+#if !defined(N2kGatewayDefaultQueueSize)
+#define N2kGatewayDefaultQueueSize 256
+#endif
+
+/************************************************************************//**
+ * \class tN2kGateway
+ * \brief Gateway forwarding frames between several tNMEA2000 instances
+ * \ingroup group_helperClass
+ *
+ * Gateway attaches to each bus as \ref tNMEA2000::tFrameHandler and
+ * forwards raw frames to other buses with \ref tNMEA2000::SendRawFrame.
+ * Messages are not decoded or re-encoded, so original source addresses
+ * are kept and fast packet frames are forwarded one by one without
+ * reassembly. Since frames of each bus are forwarded in order, receivers
+ * on other buses can reassemble fast packets as sent by original device.
+ *
+ * Forwarding is controlled by:
+ *  - Rules. First rule matching PGN, source and destination address and
+ *    buses will be used. If no rule matches, default action set with 
+ *    \ref SetDefaultAction will be used.
+ *  - Bus local PGNs. ISO acknowledgement, request and transport protocol
+ *    messages will be forwarded only by rule with matching PGN. Address
+ *    claim and commanded address are never forwarded, since address
+ *    claiming is separate on each bus.
+ *  - Address maps. Device on one bus can be given different address on
+ *    other bus with \ref AddAddressMap. Source address will be changed on
+ *    forwarded frames and messages addressed to mapped address will be
+ *    forwarded only to device bus with original address. Gateway does not
+ *    claim mapped addresses, so they must be reserved on target bus.
+ *  - Loop avoidance. Frames are never forwarded back to receiving bus.
+ *    Frames received with mapped source address or identical to frame
+ *    just forwarded to same bus will be dropped. This protects against
+ *    drivers receiving their own frames and against parallel gateways.
+ *
+ * tNMEA2000 instances for gateway should normally use mode 
+ * \ref tNMEA2000::N2km_ListenAndSend, so gateway itself does not take
+ * address on buses. Own messages sent by instances will not be forwarded.
+ *
+ * Without threads call \ref ParseMessages on loop instead of
+ * tNMEA2000::ParseMessages for each bus. All buses must then be used 
+ * from same thread.
+ *
+ * \code
+ *  tNMEA2000_socketCAN Engine("can0"), Nav("can1");
+ *  tN2kGateway Gateway;
+ *  ...
+ *  Engine.SetMode(tNMEA2000::N2km_ListenAndSend);
+ *  Nav.SetMode(tNMEA2000::N2km_ListenAndSend);
+ *  uint8_t EngineBus=Gateway.AddBus(&Engine);
+ *  uint8_t NavBus=Gateway.AddBus(&Nav);
+ *  // Do not flood engine bus with AIS
+ *  Gateway.AddRule(tN2kGateway::ga_Block,129038L,NavBus,EngineBus);
+ *  Gateway.AddRule(tN2kGateway::ga_Block,129039L,NavBus,EngineBus);
+ *  // Engine controller has address 10 also on nav bus. Show it as 100.
+ *  Gateway.AddAddressMap(EngineBus,10,NavBus,100);
+ *  ...
+ *  void loop() {
+ *    Gateway.ParseMessages();
+ *  }
+ * \endcode
+ *
+ * With N2K_THREADED_GATEWAY each bus can be run on its own thread. Frames
+ * to other buses are then passed through lock free queues and sent by
+ * target bus thread. Start threads with \ref StartThreads or call 
+ * \ref ParseMessages(uint8_t) for each bus from own threads after
+ * \ref SetForwardQueueSize. Message handlers of each tNMEA2000 instance
+ * will then be called on thread of that bus. Open buses before starting
+ * threads, since tNMEA2000::Open is not thread safe.
+ */
+class tN2kGateway
+{
+public:
+  /** \brief Rule action */
+  typedef enum {
+    ga_Forward=0,     ///< Forward frame
+    ga_Block=1        ///< Do not forward frame
+  } tAction;
+
+  /** \brief Forwarding rule */
+  struct tRule {
+    /** \brief PGN or 0 for any PGN */
+    unsigned long PGN;
+    /** \brief Receiving bus index or \ref N2kGatewayAny */
+    uint16_t FromBus;
+    /** \brief Target bus index or \ref N2kGatewayAny */
+    uint16_t ToBus;
+    /** \brief Source address on receiving bus or \ref N2kGatewayAny */
+    uint16_t Source;
+    /** \brief Destination address on receiving bus or \ref N2kGatewayAny.
+     *         Broadcast messages have destination 0xff. */
+    uint16_t Destination;
+    /** \brief Action for matching frames */
+    tAction Action;
+  };
+
+  /** \brief Address of device on one bus mapped to address on other bus */
+  struct tAddressMap {
+    /** \brief Bus of the device */
+    uint8_t FromBus;
+    /** \brief Address of the device on its own bus */
+    uint8_t FromAddress;
+    /** \brief Bus, where device is seen with mapped address */
+    uint8_t ToBus;
+    /** \brief Address of the device on ToBus */
+    uint8_t ToAddress;
+  };
+
+  /** \brief Bus counter. With bus threads counters are updated by bus
+   * threads, so they are atomic and can be read any time. */
+#if defined(N2K_THREADED_GATEWAY)
+  typedef std::atomic<uint32_t> tBusCounter;
+#else
+  typedef uint32_t tBusCounter;
+#endif
+
+  /** \brief Counters for one bus */
+  struct tBusStats {
+    /** \brief Frames received from the bus */
+    tBusCounter FramesReceived;
+    /** \brief Received frames, which were not forwarded to any bus by rules */
+    tBusCounter FramesFiltered;
+    /** \brief Received frames dropped by loop avoidance */
+    tBusCounter FramesLooped;
+    /** \brief Received frames lost, because target bus queue was full */
+    tBusCounter QueueOverflows;
+    /** \brief Frames forwarded from other buses to the bus */
+    tBusCounter FramesForwarded;
+    /** \brief Frames from other buses, which could not be sent to the bus */
+    tBusCounter SendFailures;
+
+    /** \brief Clear all counters */
+    void Clear() {
+      FramesReceived=0; FramesFiltered=0; FramesLooped=0;
+      QueueOverflows=0; FramesForwarded=0; SendFailures=0;
+    }
+  };
+
+protected:
+  /** \brief Frame forwarded to bus, remembered for echo detection */
+  struct tEcho {
+    unsigned long id;
+    unsigned long Time;
+    unsigned char len;
+    unsigned char buf[8];
+  };
+
+  /** \brief Gateway data for one bus */
+  class tBus : public tNMEA2000::tFrameHandler {
+    public:
+      /** \brief Owner gateway */
+      tN2kGateway *Gateway;
+      /** \brief Bus instance */
+      tNMEA2000 *NMEA2000;
+      /** \brief Index of the bus on gateway */
+      uint8_t Index;
+      /** \brief Frames recently forwarded to the bus */
+      tEcho Echo[N2kGatewayEchoSize];
+      /** \brief Next position to write on \ref Echo */
+      uint8_t EchoNext;
+      /** \brief Counters */
+      tBusStats Stats;
+#if defined(N2K_THREADED_GATEWAY)
+      /** \brief Frames from other buses waiting to be sent by bus thread */
+      tMPSCRingBuffer<tNMEA2000::tCANFrame> *Queue;
+      /** \brief Bus thread started by \ref StartThreads */
+      std::thread Thread;
+#endif
+      tBus();
+      ~tBus();
+      void HandleFrame(const tNMEA2000::tCANFrame &Frame) { Gateway->HandleFrame(*this,Frame); }
+  };
+
+  /** \brief Buses allocated on constructor */
+  tBus *Buses;
+  /** \brief Max number of buses */
+  uint8_t MaxBuses;
+  /** \brief Number of buses added */
+  uint8_t BusCount;
+  /** \brief Rules in order of addition */
+  tRule *Rules;
+  /** \brief Max number of rules */
+  uint8_t MaxRules;
+  /** \brief Number of rules */
+  uint8_t RuleCount;
+  /** \brief Address maps */
+  tAddressMap *AddressMaps;
+  /** \brief Max number of address maps */
+  uint8_t MaxAddressMaps;
+  /** \brief Number of address maps */
+  uint8_t AddressMapCount;
+  /** \brief Action, when no rule matches */
+  tAction DefaultAction;
+#if defined(N2K_THREADED_GATEWAY)
+  /** \brief Bus threads should run */
+  std::atomic<bool> ThreadsRun;
+  /** \brief Max time in microseconds bus thread sleeps */
+  uint32_t IdleTime;
+#endif
+
+protected:
+  /************************************************************************//**
+   * \brief Forward frame received from bus to other buses
+   */
+  void HandleFrame(tBus &From, const tNMEA2000::tCANFrame &Frame);
+  /************************************************************************//**
+   * \brief Check loop avoidance conditions for received frame
+   */
+  bool IsLoop(tBus &From, const tNMEA2000::tCANFrame &Frame, uint8_t Source);
+  /************************************************************************//**
+   * \brief Get action for frame by rules and bus local PGNs
+   */
+  tAction GetAction(unsigned long PGN, uint8_t FromBus, uint8_t ToBus, uint8_t Source, uint8_t Destination) const;
+  /************************************************************************//**
+   * \brief Translate destination address to target bus
+   *
+   * \retval false  Destination is mapped address of device on some other bus
+   */
+  bool TranslateDestination(uint8_t FromBus, uint8_t ToBus, uint8_t &Destination) const;
+  /************************************************************************//**
+   * \brief Translate source address to target bus
+   */
+  uint8_t TranslateSource(uint8_t FromBus, uint8_t ToBus, uint8_t Source) const;
+  /************************************************************************//**
+   * \brief Send frame to bus and remember it for echo detection
+   */
+  void SendFrame(tBus &To, const tNMEA2000::tCANFrame &Frame);
+#if defined(N2K_THREADED_GATEWAY)
+  /************************************************************************//**
+   * \brief Send frames on bus queue
+   */
+  void SendQueuedFrames(tBus &To);
+  /************************************************************************//**
+   * \brief Bus thread function
+   */
+  void BusThreadLoop(uint8_t Bus);
+#endif
+
+public:
+  /************************************************************************//**
+   * \brief Constructor of class \ref tN2kGateway
+   *
+   * \param _MaxBuses        Max number of buses
+   * \param _MaxRules        Max number of forwarding rules
+   * \param _MaxAddressMaps  Max number of address maps
+   */
+  tN2kGateway(uint8_t _MaxBuses=N2kGatewayDefaultMaxBuses, uint8_t _MaxRules=N2kGatewayDefaultMaxRules, uint8_t _MaxAddressMaps=N2kGatewayDefaultMaxAddressMaps);
+  /************************************************************************//**
+   * \brief Destructor of class \ref tN2kGateway
+   *
+   * Stops bus threads and detaches from buses.
+   */
+  ~tN2kGateway();
+
+  /************************************************************************//**
+   * \brief Add bus to gateway
+   *
+   * Gateway will be set as frame handler for bus, so there can not be other
+   * frame handler.
+   *
+   * \param NMEA2000  Bus instance
+   * \return Bus index or -1, if there is no room for bus.
+   */
+  int AddBus(tNMEA2000 *NMEA2000);
+
+  /************************************************************************//**
+   * \brief Number of buses on gateway
+   */
+  uint8_t GetBusCount() const { return BusCount; }
+
+  /************************************************************************//**
+   * \brief Add forwarding rule
+   *
+   * Rules will be tested in order they have been added and first
+   * matching rule will be used.
+   *
+   * \param Action       Action for matching frames
+   * \param PGN          PGN or 0 for any
+   * \param FromBus      Receiving bus or \ref N2kGatewayAny
+   * \param ToBus        Target bus or \ref N2kGatewayAny
+   * \param Source       Source address on receiving bus or \ref N2kGatewayAny
+   * \param Destination  Destination address on receiving bus or \ref N2kGatewayAny
+   * \retval true        Rule added
+   * \retval false       Rule table is full
+   */
+  bool AddRule(tAction Action, unsigned long PGN=0, uint16_t FromBus=N2kGatewayAny, uint16_t ToBus=N2kGatewayAny,
+               uint16_t Source=N2kGatewayAny, uint16_t Destination=N2kGatewayAny);
+
+  /************************************************************************//**
+   * \brief Remove all rules
+   */
+  void ClearRules() { RuleCount=0; }
+
+  /************************************************************************//**
+   * \brief Set action for frames not matching any rule. Default is 
+   *        \ref ga_Forward.
+   */
+  void SetDefaultAction(tAction Action) { DefaultAction=Action; }
+
+  /************************************************************************//**
+   * \brief Map device address on one bus to other address on other bus
+   *
+   * \param FromBus      Bus of the device
+   * \param FromAddress  Address of the device on FromBus
+   * \param ToBus        Bus, where device will be seen with ToAddress
+   * \param ToAddress    Address used for device on ToBus
+   * \retval true        Map added
+   * \retval false       Map table is full, invalid bus or address, or
+   *                     address has been already mapped.
+   */
+  bool AddAddressMap(uint8_t FromBus, uint8_t FromAddress, uint8_t ToBus, uint8_t ToAddress);
+
+  /************************************************************************//**
+   * \brief Remove all address maps
+   */
+  void ClearAddressMaps() { AddressMapCount=0; }
+
+  /************************************************************************//**
+   * \brief Is PGN handled only locally on each bus
+   *
+   * \param PGN   PGN to test
+   * \retval true PGN is forwarded only by rule with matching PGN.
+   */
+  static bool IsBusLocalPGN(unsigned long PGN);
+
+  /************************************************************************//**
+   * \brief Handle all buses on calling thread
+   *
+   * Calls \ref ParseMessages(uint8_t) for each bus.
+   */
+  void ParseMessages();
+
+  /************************************************************************//**
+   * \brief Handle one bus
+   *
+   * Sends frames queued for the bus from other bus threads and calls
+   * tNMEA2000::ParseMessages for the bus, which then forwards received
+   * frames to other buses.
+   *
+   * \param Bus   Bus index
+   */
+  void ParseMessages(uint8_t Bus);
+
+  /************************************************************************//**
+   * \brief Get counters of bus
+   *
+   * With bus threads counters can be read while threads are running.
+   * Each counter is read atomically, but counters are not a consistent
+   * snapshot, since they may change between reads.
+   *
+   * \param Bus   Bus index
+   * \return Counters or 0 for invalid bus index
+   */
+  const tBusStats *GetBusStats(uint8_t Bus) const { return ( Bus<BusCount ? &Buses[Bus].Stats : 0 ); }
+
+  /************************************************************************//**
+   * \brief Clear counters of all buses
+   *
+   * With bus threads running, frames handled at same time may be counted
+   * before or after clearing.
+   */
+  void ResetBusStats();
+
+#if defined(N2K_THREADED_GATEWAY)
+  /************************************************************************//**
+   * \brief Use queues for forwarding between bus threads
+   *
+   * After this \ref ParseMessages(uint8_t) can be called for each bus
+   * from own thread. Call before any thread has been started.
+   *
+   * \param QueueSize  Number of frames each bus queue can hold
+   */
+  void SetForwardQueueSize(uint16_t QueueSize=N2kGatewayDefaultQueueSize);
+
+  /************************************************************************//**
+   * \brief Start one thread for each bus
+   *
+   * Each thread calls \ref ParseMessages(uint8_t) for its bus. When there
+   * is nothing to do, thread waits driver poll descriptor (see 
+   * tNMEA2000::GetPollFd) or sleeps max IdleTime.
+   * All buses must have been opened before, e.g., by calling 
+   * \ref ParseMessages until tNMEA2000::IsOpen returns true for all buses.
+   *
+   * \param QueueSize  Number of frames each bus queue can hold
+   * \param _IdleTime  Max sleep time in microseconds. This is also max
+   *                   delay for frames queued from other buses.
+   * \retval true      Threads started
+   * \retval false     Threads are already running, there are no buses or
+   *                   some bus has not been opened.
+   */
+  bool StartThreads(uint16_t QueueSize=N2kGatewayDefaultQueueSize, uint32_t _IdleTime=1000);
+
+  /************************************************************************//**
+   * \brief Stop bus threads
+   *
+   * Frames left on queues will be sent on calling thread.
+   */
+  void StopThreads();
+
+  /************************************************************************//**
+   * \brief Are bus threads running
+   */
+  bool IsRunning() const { return ThreadsRun.load(std::memory_order_acquire); }
+#endif
+};
+
+#endif
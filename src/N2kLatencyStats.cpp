@@ -0,0 +1,136 @@
+/*
+ * N2kLatencyStats.cpp
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "N2kLatencyStats.h"
+
+#if defined(N2K_LATENCY_STATS)
+#include <string.h>
+
+//*****************************************************************************
+void tN2kLatencyStats::Init(uint8_t _MaxPGNs) {
+  if ( Entries!=0 ) { delete[] Entries; Entries=0; }
+  MaxPGNs=_MaxPGNs;
+  if ( MaxPGNs==0 ) return;
+
+  Entries=new tEntry[MaxPGNs+1];
+  Reset();
+}
+
+//*****************************************************************************
+void tN2kLatencyStats::Reset() {
+  Count=0;
+  Last=0;
+  if ( Entries!=0 ) memset(Entries,0,sizeof(tEntry)*(MaxPGNs+1));
+}
+
+//*****************************************************************************
+tN2kLatencyStats::tEntry *tN2kLatencyStats::Find(unsigned long PGN) {
+  if ( Entries==0 ) return 0;
+  // Messages of same PGN often come in bursts, so test last one first.
+  if ( Last<Count && Entries[Last].PGN==PGN ) return &Entries[Last];
+
+  for ( uint8_t i=0; i<Count; i++ ) {
+    if ( Entries[i].PGN==PGN ) { Last=i; return &Entries[i]; }
+  }
+
+  if ( Count>=MaxPGNs ) return &Entries[MaxPGNs];
+
+  Last=Count;
+  Entries[Count].PGN=PGN;
+  Count++;
+  return &Entries[Last];
+}
+
+//*****************************************************************************
+const tN2kLatencyStats::tEntry *tN2kLatencyStats::Get(unsigned long PGN) const {
+  for ( uint8_t i=0; i<Count; i++ ) {
+    if ( Entries[i].PGN==PGN ) return &Entries[i];
+  }
+  return 0;
+}
+
+//*****************************************************************************
+uint8_t tN2kLatencyStats::Bucket(uint32_t Latency) {
+  uint8_t Bucket=0;
+  for ( ; Latency!=0 && Bucket<N2kLatencyBuckets-1; Latency>>=1, Bucket++ );
+  return Bucket;
+}
+
+//*****************************************************************************
+uint32_t tN2kLatencyStats::BucketLimit(uint8_t Bucket) {
+  return ( Bucket<N2kLatencyBuckets-1 ? 1UL<<Bucket : 0xffffffffUL );
+}
+
+//*****************************************************************************
+void tN2kLatencyStats::Add(tEntry *Entry, tStage Stage, uint32_t Latency) {
+  if ( Entry==0 ) return;
+
+  tHistogram &Histogram=Entry->Stages[Stage];
+  Histogram.Buckets[Bucket(Latency)]++;
+  Histogram.Samples++;
+  Histogram.Total+=Latency;
+  if ( Latency>Histogram.Max ) Histogram.Max=Latency;
+}
+
+//*****************************************************************************
+static void PrintHistogram(N2kStream *Stream, unsigned long PGN, const char *StageName, const tN2kLatencyStats::tHistogram &Histogram) {
+  if ( Histogram.Samples==0 ) return;
+
+  uint8_t LastBucket=N2kLatencyBuckets-1;
+  for ( ; LastBucket>0 && Histogram.Buckets[LastBucket]==0; LastBucket-- );
+
+  if ( PGN!=0 ) {
+    Stream->print(F("PGN ")); Stream->print(PGN);
+  } else {
+    Stream->print(F("PGN other"));
+  }
+  Stream->print(F(" ")); Stream->print(StageName);
+  Stream->print(F(" n:")); Stream->print(Histogram.Samples);
+  Stream->print(F(" avg:")); Stream->print((uint32_t)(Histogram.Total/Histogram.Samples));
+  Stream->print(F(" max:")); Stream->print(Histogram.Max);
+  for ( uint8_t i=0; i<=LastBucket; i++ ) {
+    if ( i<N2kLatencyBuckets-1 ) {
+      Stream->print(F(" <")); Stream->print(tN2kLatencyStats::BucketLimit(i));
+    } else {
+      Stream->print(F(" >=")); Stream->print(tN2kLatencyStats::BucketLimit(i-1));
+    }
+    Stream->print(F(":")); Stream->print(Histogram.Buckets[i]);
+  }
+  Stream->println();
+}
+
+//*****************************************************************************
+static void PrintEntry(N2kStream *Stream, const tN2kLatencyStats::tEntry &Entry) {
+  PrintHistogram(Stream,Entry.PGN,"arrival-ready",Entry.Stages[tN2kLatencyStats::ls_ArrivalToReady]);
+  PrintHistogram(Stream,Entry.PGN,"ready-handler",Entry.Stages[tN2kLatencyStats::ls_ReadyToHandler]);
+  PrintHistogram(Stream,Entry.PGN,"handler",Entry.Stages[tN2kLatencyStats::ls_HandlerDuration]);
+}
+
+//*****************************************************************************
+void tN2kLatencyStats::Dump(N2kStream *Stream) const {
+  if ( Stream==0 || Entries==0 ) return;
+
+  for ( uint8_t i=0; i<Count; i++ ) PrintEntry(Stream,Entries[i]);
+  PrintEntry(Stream,Entries[MaxPGNs]);
+}
+
+#endif
@@ -0,0 +1,216 @@
+/*
+ * N2kLatencyStats.h
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+/*************************************************************************//**
+ * \file  N2kLatencyStats.h
+ * \brief File declares tN2kLatencyStats class for receive latency
+ *        instrumentation.
+ *
+ * Instrumentation is optional and it will be compiled only, if
+ * N2K_LATENCY_STATS has been defined. See \ref NMEA2000_CompilerDefns.h.
+ */
+
+#ifndef _tN2kLatencyStats_H_
+#define _tN2kLatencyStats_H_
+
+#include "NMEA2000_CompilerDefns.h"
+
+#if defined(N2K_LATENCY_STATS)
+#include "N2kStream.h"
+#include <stdint.h>
+
+/** \brief Number of histogram buckets. Bucket 0 counts 0 us, bucket i
+ *         counts [2^(i-1),2^i) us and last bucket all longer. */
+#define N2kLatencyBuckets 24
+/** \brief Number of measured stages, see \ref tN2kLatencyStats::tStage */
+#define N2kLatencyStages 3
+/** \brief Default max number of separately tracked PGNs */
+#define N2kLatencyDefaultMaxPGNs 16
+
+/************************************************************************//**
+ * \class tN2kLatencyStats
+ *
+ * \brief Per PGN log bucketed latency histograms of received messages.
+ * \ingroup group_core
+ *
+ * tNMEA2000 records for each received message:
+ *  - time from arrival of first frame to message ready for handling,
+ *  - time from message ready to start of each message handler and
+ *  - duration of each message handler call.
+ *
+ * Memory is allocated once on \ref Init. When table is full, samples for
+ * new PGNs will be collected to single "other" entry, so memory use is
+ * bounded.
+ */
+class tN2kLatencyStats
+{
+public:
+  /** \brief Measured stages */
+  typedef enum {
+    ls_ArrivalToReady=0,    ///< First frame receive time to message ready
+    ls_ReadyToHandler=1,    ///< Message ready to handler call start
+    ls_HandlerDuration=2    ///< Handler call duration
+  } tStage;
+
+  /** \brief Latency histogram */
+  struct tHistogram {
+    /** \brief Sample counts for buckets, see \ref N2kLatencyBuckets */
+    uint32_t Buckets[N2kLatencyBuckets];
+    /** \brief Total sample count */
+    uint32_t Samples;
+    /** \brief Max latency in microseconds */
+    uint32_t Max;
+    /** \brief Sum of latencies in microseconds */
+    uint64_t Total;
+  };
+
+  /** \brief Histograms for one PGN */
+  struct tEntry {
+    /** \brief PGN of the entry. 0 for "other" entry */
+    unsigned long PGN;
+    /** \brief Histogram for each \ref tStage */
+    tHistogram Stages[N2kLatencyStages];
+  };
+
+protected:
+  /** \brief Entries for PGNs. Entry on index MaxPGNs is "other" entry */
+  tEntry *Entries;
+  /** \brief Max number of separately tracked PGNs */
+  uint8_t MaxPGNs;
+  /** \brief Number of PGNs in use on \ref Entries */
+  uint8_t Count;
+  /** \brief Index of last found entry */
+  uint8_t Last;
+
+public:
+  /************************************************************************//**
+   * \brief Constructor of class \ref tN2kLatencyStats
+   *
+   * Statistics will not be collected before \ref Init.
+   */
+  tN2kLatencyStats() : Entries(0), MaxPGNs(0), Count(0), Last(0) {}
+  /************************************************************************//**
+   * \brief Destructor of class \ref tN2kLatencyStats
+   */
+  ~tN2kLatencyStats() { if ( Entries!=0 ) delete[] Entries; }
+
+  /************************************************************************//**
+   * \brief Allocate memory and enable statistics
+   *
+   * Memory needed is appr. (_MaxPGNs+1)*350 bytes. Calling Init again
+   * will reallocate and clear all statistics.
+   *
+   * \param _MaxPGNs  Max number of separately tracked PGNs. 0 disables
+   *                  statistics.
+   */
+  void Init(uint8_t _MaxPGNs=N2kLatencyDefaultMaxPGNs);
+
+  /************************************************************************//**
+   * \brief Are statistics enabled with \ref Init
+   */
+  bool IsEnabled() const { return Entries!=0; }
+
+  /************************************************************************//**
+   * \brief Find or add entry for recording
+   *
+   * \param PGN   PGN of the message
+   * \return Entry for the PGN or "other" entry, if table is full. 0, if
+   *         statistics has not been enabled.
+   */
+  tEntry *Find(unsigned long PGN);
+
+  /************************************************************************//**
+   * \brief Record one sample
+   *
+   * \param Entry     Entry got with \ref Find
+   * \param Stage     Measured stage
+   * \param Latency   Latency in microseconds
+   */
+  static void Add(tEntry *Entry, tStage Stage, uint32_t Latency);
+
+  /************************************************************************//**
+   * \brief Get bucket for latency
+   *
+   * \param Latency   Latency in microseconds
+   * \return Bucket index 0 - (N2kLatencyBuckets-1)
+   */
+  static uint8_t Bucket(uint32_t Latency);
+
+  /************************************************************************//**
+   * \brief Get exclusive upper limit of bucket in microseconds
+   *
+   * \param Bucket    Bucket index
+   * \return Limit or 0xffffffff for last bucket
+   */
+  static uint32_t BucketLimit(uint8_t Bucket);
+
+  /************************************************************************//**
+   * \brief Number of separately tracked PGNs
+   */
+  uint8_t GetCount() const { return Count; }
+
+  /************************************************************************//**
+   * \brief Get entry by index
+   *
+   * \param Index   Index 0 - (GetCount()-1)
+   * \return Entry or 0 for invalid index
+   */
+  const tEntry *GetEntry(uint8_t Index) const { return ( Index<Count ? &Entries[Index] : 0 ); }
+
+  /************************************************************************//**
+   * \brief Get entry by PGN
+   *
+   * \param PGN   PGN
+   * \return Entry or 0 if PGN has not been recorded separately
+   */
+  const tEntry *Get(unsigned long PGN) const;
+
+  /************************************************************************//**
+   * \brief Get entry for PGNs, which did not fit to table
+   *
+   * \return Entry or 0, if statistics has not been enabled.
+   */
+  const tEntry *GetOther() const { return ( Entries!=0 ? &Entries[MaxPGNs] : 0 ); }
+
+  /************************************************************************//**
+   * \brief Clear all statistics
+   *
+   * PGN table will be cleared too, so PGNs will be tracked in order of
+   * reception after reset.
+   */
+  void Reset();
+
+  /************************************************************************//**
+   * \brief Print statistics as text
+   *
+   * Prints one line for each PGN and stage having samples, e.g.,
+   * "PGN 127250 ready-handler n:10 avg:3 max:7 <1:0 <2:2 <4:5 <8:3".
+   * Only buckets up to last nonempty one are printed.
+   *
+   * \param Stream  Stream to print to
+   */
+  void Dump(N2kStream *Stream) const;
+};
+
+#endif
+
+#endif
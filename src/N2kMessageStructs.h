@@ -0,0 +1,1356 @@
+/*
+ * N2kMessageStructs.h
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+
+/*************************************************************************//**
+ * \file  N2kMessageStructs.h
+ * \brief Structure based Set/Parse overloads for PGNs on N2kMessages.h and
+ *        N2kMaretron.h
+ *
+ * Most SetN2kPGN* and ParseN2kPGN* functions take every field as own
+ * argument. This file defines plain data structure tN2kPGN<PGN>Data for
+ * each of them and SetN2kPGN<PGN>(N2kMsg,Data) / ParseN2kPGN<PGN>(N2kMsg,Data)
+ * overloads.
+ *
+ * Structure members are in same order as fields on message, so parser
+ * writes structure sequentially. Structures are trivially copyable, so
+ * they can be copied as such to caches and queues.
+ *
+ * Overloads are inline and call argument list functions with structure
+ * members, so they do not add code or run time compared to argument
+ * list call.
+ *
+ * Example:
+ * \code
+ * tN2kPGN127250Data Heading;
+ * if ( ParseN2kPGN127250(N2kMsg,Heading) ) {
+ *   HeadingCache=Heading;
+ * }
+ * \endcode
+ *
+ * PGNs, which already have structure API (129041, 129540 and 130323), are
+ * not repeated here. Structures do not initialize their members, so fill
+ * all fields before calling Set function.
+ */
+
+#ifndef _N2kMessageStructs_H_
+#define _N2kMessageStructs_H_
+
+#include "N2kMessages.h"
+#include "N2kMaretron.h"
+
+/** \brief Max length of AIS safety related text on \ref tN2kPGN129802Data */
+#define N2kMaxAISSafetyRelatedTextLength 162
+/** \brief Max length of AIS name on structures */
+#define N2kMaxAISNameLength 20
+/** \brief Max length of AIS callsign and vendor id on structures */
+#define N2kMaxAISCallsignLength 7
+/** \brief Max length of AIS destination on structures */
+#define N2kMaxAISDestinationLength 20
+
+/************************************************************************//**
+ * \brief Data of PGN 126992 "System Time"
+ * \sa SetN2kPGN126992 and ParseN2kPGN126992
+ */
+struct tN2kPGN126992Data {
+  unsigned char SID;                  ///< Sequence ID
+  tN2kTimeSource TimeSource;          ///< Time source
+  uint16_t SystemDate;                ///< Days since 1970-01-01
+  double SystemTime;                  ///< Seconds since midnight
+};
+
+inline void SetN2kPGN126992(tN2kMsg &N2kMsg, const tN2kPGN126992Data &Data) {
+  SetN2kPGN126992(N2kMsg,Data.SID,Data.SystemDate,Data.SystemTime,Data.TimeSource);
+}
+
+inline bool ParseN2kPGN126992(const tN2kMsg &N2kMsg, tN2kPGN126992Data &Data) {
+  return ParseN2kPGN126992(N2kMsg,Data.SID,Data.SystemDate,Data.SystemTime,Data.TimeSource);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129802 "AIS Safety Related Broadcast Message"
+ * \sa SetN2kPGN129802 and ParseN2kPGN129802
+ */
+struct tN2kPGN129802Data {
+  uint8_t MessageID;                                          ///< AIS message type
+  tN2kAISRepeat Repeat;                                       ///< Repeat indicator
+  uint32_t SourceID;                                          ///< MMSI of source
+  tN2kAISTransceiverInformation AISTransceiverInformation;    ///< AIS transceiver information
+  char SafetyRelatedText[N2kMaxAISSafetyRelatedTextLength+1]; ///< Safety related text
+};
+
+inline void SetN2kPGN129802(tN2kMsg &N2kMsg, const tN2kPGN129802Data &Data) {
+  SetN2kPGN129802(N2kMsg,Data.MessageID,Data.Repeat,Data.SourceID,Data.AISTransceiverInformation,Data.SafetyRelatedText);
+}
+
+inline bool ParseN2kPGN129802(const tN2kMsg &N2kMsg, tN2kPGN129802Data &Data) {
+  size_t TextSize=sizeof(Data.SafetyRelatedText);
+  return ParseN2kPGN129802(N2kMsg,Data.MessageID,Data.Repeat,Data.SourceID,Data.AISTransceiverInformation,
+                           Data.SafetyRelatedText,TextSize);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127233 "Man Overboard Notification"
+ * \sa SetN2kPGN127233 and ParseN2kPGN127233
+ */
+struct tN2kPGN127233Data {
+  unsigned char SID;                                    ///< Sequence ID
+  uint32_t MobEmitterId;                                ///< Identifier for each MOB emitter
+  tN2kMOBStatus MOBStatus;                              ///< MOB status
+  double ActivationTime;                                ///< Seconds since midnight
+  tN2kMOBPositionSource PositionSource;                 ///< Position source
+  uint16_t PositionDate;                                ///< Days since 1970-01-01
+  double PositionTime;                                  ///< Seconds since midnight
+  double Latitude;                                      ///< Latitude in degrees
+  double Longitude;                                     ///< Longitude in degrees
+  tN2kHeadingReference COGReference;                    ///< COG reference
+  double COG;                                           ///< Course over ground in radians
+  double SOG;                                           ///< Speed over ground in m/s
+  uint32_t MMSI;                                        ///< MMSI of vessel of origin
+  tN2kMOBEmitterBatteryStatus MOBEmitterBatteryStatus;  ///< Emitter battery status
+};
+
+inline void SetN2kPGN127233(tN2kMsg &N2kMsg, const tN2kPGN127233Data &Data) {
+  SetN2kPGN127233(N2kMsg,Data.SID,Data.MobEmitterId,Data.MOBStatus,Data.ActivationTime,Data.PositionSource,
+                  Data.PositionDate,Data.PositionTime,Data.Latitude,Data.Longitude,Data.COGReference,
+                  Data.COG,Data.SOG,Data.MMSI,Data.MOBEmitterBatteryStatus);
+}
+
+inline bool ParseN2kPGN127233(const tN2kMsg &N2kMsg, tN2kPGN127233Data &Data) {
+  return ParseN2kPGN127233(N2kMsg,Data.SID,Data.MobEmitterId,Data.MOBStatus,Data.ActivationTime,Data.PositionSource,
+                           Data.PositionDate,Data.PositionTime,Data.Latitude,Data.Longitude,Data.COGReference,
+                           Data.COG,Data.SOG,Data.MMSI,Data.MOBEmitterBatteryStatus);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127237 "Heading/Track control"
+ * \sa SetN2kPGN127237 and ParseN2kPGN127237
+ */
+struct tN2kPGN127237Data {
+  tN2kOnOff RudderLimitExceeded;                      ///< Rudder limit exceeded
+  tN2kOnOff OffHeadingLimitExceeded;                  ///< Off heading limit exceeded
+  tN2kOnOff OffTrackLimitExceeded;                    ///< Off track limit exceeded
+  tN2kOnOff Override;                                 ///< Override
+  tN2kSteeringMode SteeringMode;                      ///< Steering mode
+  tN2kTurnMode TurnMode;                              ///< Turn mode
+  tN2kHeadingReference HeadingReference;              ///< Heading reference
+  tN2kRudderDirectionOrder CommandedRudderDirection;  ///< Commanded rudder direction
+  double CommandedRudderAngle;                        ///< Commanded rudder angle in radians
+  double HeadingToSteerCourse;                        ///< Heading to steer in radians
+  double Track;                                       ///< Track in radians
+  double RudderLimit;                                 ///< Rudder limit in radians
+  double OffHeadingLimit;                             ///< Off heading limit in radians
+  double RadiusOfTurnOrder;                           ///< Radius of turn order in meters
+  double RateOfTurnOrder;                             ///< Rate of turn order in radians/s
+  double OffTrackLimit;                               ///< Off track limit in meters
+  double VesselHeading;                               ///< Vessel heading in radians
+};
+
+inline void SetN2kPGN127237(tN2kMsg &N2kMsg, const tN2kPGN127237Data &Data) {
+  SetN2kPGN127237(N2kMsg,Data.RudderLimitExceeded,Data.OffHeadingLimitExceeded,Data.OffTrackLimitExceeded,Data.Override,
+                  Data.SteeringMode,Data.TurnMode,Data.HeadingReference,Data.CommandedRudderDirection,
+                  Data.CommandedRudderAngle,Data.HeadingToSteerCourse,Data.Track,Data.RudderLimit,
+                  Data.OffHeadingLimit,Data.RadiusOfTurnOrder,Data.RateOfTurnOrder,Data.OffTrackLimit,Data.VesselHeading);
+}
+
+inline bool ParseN2kPGN127237(const tN2kMsg &N2kMsg, tN2kPGN127237Data &Data) {
+  return ParseN2kPGN127237(N2kMsg,Data.RudderLimitExceeded,Data.OffHeadingLimitExceeded,Data.OffTrackLimitExceeded,Data.Override,
+                           Data.SteeringMode,Data.TurnMode,Data.HeadingReference,Data.CommandedRudderDirection,
+                           Data.CommandedRudderAngle,Data.HeadingToSteerCourse,Data.Track,Data.RudderLimit,
+                           Data.OffHeadingLimit,Data.RadiusOfTurnOrder,Data.RateOfTurnOrder,Data.OffTrackLimit,Data.VesselHeading);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127245 "Rudder"
+ * \sa SetN2kPGN127245 and ParseN2kPGN127245
+ */
+struct tN2kPGN127245Data {
+  unsigned char Instance;                         ///< Rudder instance
+  tN2kRudderDirectionOrder RudderDirectionOrder;  ///< Direction order
+  double AngleOrder;                              ///< Angle order in radians
+  double RudderPosition;                          ///< Current rudder position in radians
+};
+
+inline void SetN2kPGN127245(tN2kMsg &N2kMsg, const tN2kPGN127245Data &Data) {
+  SetN2kPGN127245(N2kMsg,Data.RudderPosition,Data.Instance,Data.RudderDirectionOrder,Data.AngleOrder);
+}
+
+inline bool ParseN2kPGN127245(const tN2kMsg &N2kMsg, tN2kPGN127245Data &Data) {
+  return ParseN2kPGN127245(N2kMsg,Data.RudderPosition,Data.Instance,Data.RudderDirectionOrder,Data.AngleOrder);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127250 "Vessel Heading"
+ * \sa SetN2kPGN127250 and ParseN2kPGN127250
+ */
+struct tN2kPGN127250Data {
+  unsigned char SID;                  ///< Sequence ID
+  double Heading;                     ///< Heading in radians
+  double Deviation;                   ///< Magnetic deviation in radians
+  double Variation;                   ///< Magnetic variation in radians
+  tN2kHeadingReference Reference;     ///< Heading reference
+};
+
+inline void SetN2kPGN127250(tN2kMsg &N2kMsg, const tN2kPGN127250Data &Data) {
+  SetN2kPGN127250(N2kMsg,Data.SID,Data.Heading,Data.Deviation,Data.Variation,Data.Reference);
+}
+
+inline bool ParseN2kPGN127250(const tN2kMsg &N2kMsg, tN2kPGN127250Data &Data) {
+  return ParseN2kPGN127250(N2kMsg,Data.SID,Data.Heading,Data.Deviation,Data.Variation,Data.Reference);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127251 "Rate of Turn"
+ * \sa SetN2kPGN127251 and ParseN2kPGN127251
+ */
+struct tN2kPGN127251Data {
+  unsigned char SID;                  ///< Sequence ID
+  double RateOfTurn;                  ///< Rate of turn in radians/s
+};
+
+inline void SetN2kPGN127251(tN2kMsg &N2kMsg, const tN2kPGN127251Data &Data) {
+  SetN2kPGN127251(N2kMsg,Data.SID,Data.RateOfTurn);
+}
+
+inline bool ParseN2kPGN127251(const tN2kMsg &N2kMsg, tN2kPGN127251Data &Data) {
+  return ParseN2kPGN127251(N2kMsg,Data.SID,Data.RateOfTurn);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127252 "Heave"
+ * \sa SetN2kPGN127252 and ParseN2kPGN127252
+ */
+struct tN2kPGN127252Data {
+  unsigned char SID;                  ///< Sequence ID
+  double Heave;                       ///< Vertical displacement in meters
+  double Delay;                       ///< Delay added by calculations in seconds
+  tN2kDelaySource DelaySource;        ///< Delay source
+};
+
+inline void SetN2kPGN127252(tN2kMsg &N2kMsg, const tN2kPGN127252Data &Data) {
+  SetN2kPGN127252(N2kMsg,Data.SID,Data.Heave,Data.Delay,Data.DelaySource);
+}
+
+inline bool ParseN2kPGN127252(const tN2kMsg &N2kMsg, tN2kPGN127252Data &Data) {
+  return ParseN2kPGN127252(N2kMsg,Data.SID,Data.Heave,Data.Delay,Data.DelaySource);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127257 "Attitude"
+ * \sa SetN2kPGN127257 and ParseN2kPGN127257
+ */
+struct tN2kPGN127257Data {
+  unsigned char SID;                  ///< Sequence ID
+  double Yaw;                         ///< Yaw in radians
+  double Pitch;                       ///< Pitch in radians
+  double Roll;                        ///< Roll in radians
+};
+
+inline void SetN2kPGN127257(tN2kMsg &N2kMsg, const tN2kPGN127257Data &Data) {
+  SetN2kPGN127257(N2kMsg,Data.SID,Data.Yaw,Data.Pitch,Data.Roll);
+}
+
+inline bool ParseN2kPGN127257(const tN2kMsg &N2kMsg, tN2kPGN127257Data &Data) {
+  return ParseN2kPGN127257(N2kMsg,Data.SID,Data.Yaw,Data.Pitch,Data.Roll);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127258 "Magnetic Variation"
+ * \sa SetN2kPGN127258 and ParseN2kPGN127258
+ */
+struct tN2kPGN127258Data {
+  unsigned char SID;                  ///< Sequence ID
+  tN2kMagneticVariation Source;       ///< Source of variation
+  uint16_t DaysSince1970;             ///< Age of service, days since 1970-01-01
+  double Variation;                   ///< Magnetic variation in radians
+};
+
+inline void SetN2kPGN127258(tN2kMsg &N2kMsg, const tN2kPGN127258Data &Data) {
+  SetN2kPGN127258(N2kMsg,Data.SID,Data.Source,Data.DaysSince1970,Data.Variation);
+}
+
+inline bool ParseN2kPGN127258(const tN2kMsg &N2kMsg, tN2kPGN127258Data &Data) {
+  return ParseN2kPGN127258(N2kMsg,Data.SID,Data.Source,Data.DaysSince1970,Data.Variation);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127488 "Engine parameters rapid"
+ * \sa SetN2kPGN127488 and ParseN2kPGN127488
+ */
+struct tN2kPGN127488Data {
+  unsigned char EngineInstance;       ///< Engine instance
+  double EngineSpeed;                 ///< Engine speed in rpm
+  double EngineBoostPressure;         ///< Boost pressure in Pa
+  int8_t EngineTiltTrim;              ///< Tilt/trim in %
+};
+
+inline void SetN2kPGN127488(tN2kMsg &N2kMsg, const tN2kPGN127488Data &Data) {
+  SetN2kPGN127488(N2kMsg,Data.EngineInstance,Data.EngineSpeed,Data.EngineBoostPressure,Data.EngineTiltTrim);
+}
+
+inline bool ParseN2kPGN127488(const tN2kMsg &N2kMsg, tN2kPGN127488Data &Data) {
+  return ParseN2kPGN127488(N2kMsg,Data.EngineInstance,Data.EngineSpeed,Data.EngineBoostPressure,Data.EngineTiltTrim);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127489 "Engine parameters dynamic"
+ * \sa SetN2kPGN127489 and ParseN2kPGN127489
+ */
+struct tN2kPGN127489Data {
+  unsigned char EngineInstance;       ///< Engine instance
+  double EngineOilPress;              ///< Oil pressure in Pa
+  double EngineOilTemp;               ///< Oil temperature in K
+  double EngineCoolantTemp;           ///< Coolant temperature in K
+  double AltenatorVoltage;            ///< Alternator voltage in V
+  double FuelRate;                    ///< Fuel rate in l/h
+  double EngineHours;                 ///< Engine hours in seconds
+  double EngineCoolantPress;          ///< Coolant pressure in Pa
+  double EngineFuelPress;             ///< Fuel pressure in Pa
+  tN2kEngineDiscreteStatus1 Status1;  ///< Engine discrete status 1
+  tN2kEngineDiscreteStatus2 Status2;  ///< Engine discrete status 2
+  int8_t EngineLoad;                  ///< Engine load in %
+  int8_t EngineTorque;                ///< Engine torque in %
+};
+
+inline void SetN2kPGN127489(tN2kMsg &N2kMsg, const tN2kPGN127489Data &Data) {
+  SetN2kPGN127489(N2kMsg,Data.EngineInstance,Data.EngineOilPress,Data.EngineOilTemp,Data.EngineCoolantTemp,
+                  Data.AltenatorVoltage,Data.FuelRate,Data.EngineHours,Data.EngineCoolantPress,Data.EngineFuelPress,
+                  Data.EngineLoad,Data.EngineTorque,Data.Status1,Data.Status2);
+}
+
+inline bool ParseN2kPGN127489(const tN2kMsg &N2kMsg, tN2kPGN127489Data &Data) {
+  return ParseN2kPGN127489(N2kMsg,Data.EngineInstance,Data.EngineOilPress,Data.EngineOilTemp,Data.EngineCoolantTemp,
+                           Data.AltenatorVoltage,Data.FuelRate,Data.EngineHours,Data.EngineCoolantPress,Data.EngineFuelPress,
+                           Data.EngineLoad,Data.EngineTorque,Data.Status1,Data.Status2);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127493 "Transmission parameters, dynamic"
+ * \sa SetN2kPGN127493 and ParseN2kPGN127493
+ */
+struct tN2kPGN127493Data {
+  unsigned char EngineInstance;           ///< Engine instance
+  tN2kTransmissionGear TransmissionGear;  ///< Selected gear
+  double OilPressure;                     ///< Oil pressure in Pa
+  double OilTemperature;                  ///< Oil temperature in K
+  unsigned char DiscreteStatus1;          ///< Discrete status bits
+};
+
+inline void SetN2kPGN127493(tN2kMsg &N2kMsg, const tN2kPGN127493Data &Data) {
+  SetN2kPGN127493(N2kMsg,Data.EngineInstance,Data.TransmissionGear,Data.OilPressure,Data.OilTemperature,Data.DiscreteStatus1);
+}
+
+inline bool ParseN2kPGN127493(const tN2kMsg &N2kMsg, tN2kPGN127493Data &Data) {
+  return ParseN2kPGN127493(N2kMsg,Data.EngineInstance,Data.TransmissionGear,Data.OilPressure,Data.OilTemperature,Data.DiscreteStatus1);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127497 "Trip Parameters, Engine"
+ * \sa SetN2kPGN127497 and ParseN2kPGN127497
+ */
+struct tN2kPGN127497Data {
+  unsigned char EngineInstance;       ///< Engine instance
+  double TripFuelUsed;                ///< Fuel used on trip in litres
+  double FuelRateAverage;             ///< Average fuel rate in l/h
+  double FuelRateEconomy;             ///< Economy fuel rate in l/h
+  double InstantaneousFuelEconomy;    ///< Instantaneous fuel economy in l/h
+};
+
+inline void SetN2kPGN127497(tN2kMsg &N2kMsg, const tN2kPGN127497Data &Data) {
+  SetN2kPGN127497(N2kMsg,Data.EngineInstance,Data.TripFuelUsed,Data.FuelRateAverage,Data.FuelRateEconomy,Data.InstantaneousFuelEconomy);
+}
+
+inline bool ParseN2kPGN127497(const tN2kMsg &N2kMsg, tN2kPGN127497Data &Data) {
+  return ParseN2kPGN127497(N2kMsg,Data.EngineInstance,Data.TripFuelUsed,Data.FuelRateAverage,Data.FuelRateEconomy,Data.InstantaneousFuelEconomy);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127501 "Binary status report"
+ * \sa SetN2kPGN127501 and ParseN2kPGN127501
+ */
+struct tN2kPGN127501Data {
+  unsigned char DeviceBankInstance;   ///< Device or bank instance
+  tN2kBinaryStatus BankStatus;        ///< Status of all items, see \ref N2kGetStatusOnBinaryStatus
+};
+
+inline void SetN2kPGN127501(tN2kMsg &N2kMsg, const tN2kPGN127501Data &Data) {
+  SetN2kPGN127501(N2kMsg,Data.DeviceBankInstance,Data.BankStatus);
+}
+
+inline bool ParseN2kPGN127501(const tN2kMsg &N2kMsg, tN2kPGN127501Data &Data) {
+  return ParseN2kPGN127501(N2kMsg,Data.DeviceBankInstance,Data.BankStatus);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127502 "Switch Bank Control"
+ * \sa SetN2kPGN127502 and ParseN2kPGN127502
+ */
+struct tN2kPGN127502Data {
+  unsigned char TargetBankInstance;   ///< Target bank instance
+  tN2kBinaryStatus BankStatus;        ///< Status of all items, see \ref N2kGetStatusOnBinaryStatus
+};
+
+inline void SetN2kPGN127502(tN2kMsg &N2kMsg, const tN2kPGN127502Data &Data) {
+  SetN2kPGN127502(N2kMsg,Data.TargetBankInstance,Data.BankStatus);
+}
+
+inline bool ParseN2kPGN127502(const tN2kMsg &N2kMsg, tN2kPGN127502Data &Data) {
+  return ParseN2kPGN127502(N2kMsg,Data.TargetBankInstance,Data.BankStatus);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127505 "Fluid level"
+ * \sa SetN2kPGN127505 and ParseN2kPGN127505
+ */
+struct tN2kPGN127505Data {
+  unsigned char Instance;             ///< Tank instance
+  tN2kFluidType FluidType;            ///< Fluid type
+  double Level;                       ///< Tank level in % of full tank
+  double Capacity;                    ///< Tank capacity in litres
+};
+
+inline void SetN2kPGN127505(tN2kMsg &N2kMsg, const tN2kPGN127505Data &Data) {
+  SetN2kPGN127505(N2kMsg,Data.Instance,Data.FluidType,Data.Level,Data.Capacity);
+}
+
+inline bool ParseN2kPGN127505(const tN2kMsg &N2kMsg, tN2kPGN127505Data &Data) {
+  return ParseN2kPGN127505(N2kMsg,Data.Instance,Data.FluidType,Data.Level,Data.Capacity);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127506 "DC Detailed Status"
+ * \sa SetN2kPGN127506 and ParseN2kPGN127506
+ */
+struct tN2kPGN127506Data {
+  unsigned char SID;                  ///< Sequence ID
+  unsigned char DCInstance;           ///< DC instance
+  tN2kDCType DCType;                  ///< DC type
+  unsigned char StateOfCharge;        ///< State of charge in %
+  unsigned char StateOfHealth;        ///< State of health in %
+  double TimeRemaining;               ///< Time remaining in seconds
+  double RippleVoltage;               ///< DC output voltage ripple in V
+  double Capacity;                    ///< Battery capacity in coulombs
+};
+
+inline void SetN2kPGN127506(tN2kMsg &N2kMsg, const tN2kPGN127506Data &Data) {
+  SetN2kPGN127506(N2kMsg,Data.SID,Data.DCInstance,Data.DCType,Data.StateOfCharge,Data.StateOfHealth,
+                  Data.TimeRemaining,Data.RippleVoltage,Data.Capacity);
+}
+
+inline bool ParseN2kPGN127506(const tN2kMsg &N2kMsg, tN2kPGN127506Data &Data) {
+  return ParseN2kPGN127506(N2kMsg,Data.SID,Data.DCInstance,Data.DCType,Data.StateOfCharge,Data.StateOfHealth,
+                           Data.TimeRemaining,Data.RippleVoltage,Data.Capacity);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127507 "Charger Status"
+ * \sa SetN2kPGN127507 and ParseN2kPGN127507
+ */
+struct tN2kPGN127507Data {
+  unsigned char Instance;             ///< Charger instance
+  unsigned char BatteryInstance;      ///< Battery instance
+  tN2kChargeState ChargeState;        ///< Operating state
+  tN2kChargerMode ChargerMode;        ///< Charger mode
+  tN2kOnOff Enabled;                  ///< Charger enabled
+  tN2kOnOff EqualizationPending;      ///< Equalization pending
+  double EqualizationTimeRemaining;   ///< Equalization time remaining in seconds
+};
+
+inline void SetN2kPGN127507(tN2kMsg &N2kMsg, const tN2kPGN127507Data &Data) {
+  SetN2kPGN127507(N2kMsg,Data.Instance,Data.BatteryInstance,Data.ChargeState,Data.ChargerMode,Data.Enabled,
+                  Data.EqualizationPending,Data.EqualizationTimeRemaining);
+}
+
+inline bool ParseN2kPGN127507(const tN2kMsg &N2kMsg, tN2kPGN127507Data &Data) {
+  return ParseN2kPGN127507(N2kMsg,Data.Instance,Data.BatteryInstance,Data.ChargeState,Data.ChargerMode,Data.Enabled,
+                           Data.EqualizationPending,Data.EqualizationTimeRemaining);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127508 "Battery Status"
+ * \sa SetN2kPGN127508 and ParseN2kPGN127508
+ */
+struct tN2kPGN127508Data {
+  unsigned char BatteryInstance;      ///< Battery instance
+  double BatteryVoltage;              ///< Battery voltage in V
+  double BatteryCurrent;              ///< Battery current in A
+  double BatteryTemperature;          ///< Battery temperature in K
+  unsigned char SID;                  ///< Sequence ID
+};
+
+inline void SetN2kPGN127508(tN2kMsg &N2kMsg, const tN2kPGN127508Data &Data) {
+  SetN2kPGN127508(N2kMsg,Data.BatteryInstance,Data.BatteryVoltage,Data.BatteryCurrent,Data.BatteryTemperature,Data.SID);
+}
+
+inline bool ParseN2kPGN127508(const tN2kMsg &N2kMsg, tN2kPGN127508Data &Data) {
+  return ParseN2kPGN127508(N2kMsg,Data.BatteryInstance,Data.BatteryVoltage,Data.BatteryCurrent,Data.BatteryTemperature,Data.SID);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127510 "Charger Configuration Status"
+ * \sa SetN2kPGN127510 and ParseN2kPGN127510
+ */
+struct tN2kPGN127510Data {
+  unsigned char ChargerInstance;            ///< Charger instance
+  unsigned char BatteryInstance;            ///< Battery instance
+  tN2kOnOff Enable;                         ///< Charger enabled
+  unsigned char ChargeCurrentLimit;         ///< Charge current limit in %
+  tN2kChargingAlgorithm ChargingAlgorithm;  ///< Charging algorithm
+  tN2kChargerMode ChargerMode;              ///< Charger mode
+  tN2kOnOff OverChargeEnable;               ///< Over charge enabled
+  tN2kOnOff EqualizationEnabled;            ///< Equalization enabled
+  tBattTempNoSensor BatteryTemperature;     ///< Battery temperature when no sensor
+  uint16_t EqualizationTimeRemaining;       ///< Equalization time remaining in seconds
+};
+
+inline void SetN2kPGN127510(tN2kMsg &N2kMsg, const tN2kPGN127510Data &Data) {
+  SetN2kPGN127510(N2kMsg,Data.ChargerInstance,Data.BatteryInstance,Data.Enable,Data.ChargeCurrentLimit,
+                  Data.ChargingAlgorithm,Data.ChargerMode,Data.BatteryTemperature,Data.EqualizationEnabled,
+                  Data.OverChargeEnable,Data.EqualizationTimeRemaining);
+}
+
+inline bool ParseN2kPGN127510(const tN2kMsg &N2kMsg, tN2kPGN127510Data &Data) {
+  return ParseN2kPGN127510(N2kMsg,Data.ChargerInstance,Data.BatteryInstance,Data.Enable,Data.ChargeCurrentLimit,
+                           Data.ChargingAlgorithm,Data.ChargerMode,Data.BatteryTemperature,Data.EqualizationEnabled,
+                           Data.OverChargeEnable,Data.EqualizationTimeRemaining);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127513 "Battery Configuration Status"
+ * \sa SetN2kPGN127513 and ParseN2kPGN127513
+ */
+struct tN2kPGN127513Data {
+  unsigned char BatInstance;          ///< Battery instance
+  tN2kBatType BatType;                ///< Battery type
+  tN2kBatEqSupport SupportsEqual;     ///< Supports equalization
+  tN2kBatNomVolt BatNominalVoltage;   ///< Nominal voltage
+  tN2kBatChem BatChemistry;           ///< Battery chemistry
+  double BatCapacity;                 ///< Battery capacity in coulombs
+  int8_t BatTemperatureCoefficient;   ///< Temperature coefficient in %
+  double PeukertExponent;             ///< Peukert exponent
+  int8_t ChargeEfficiencyFactor;      ///< Charge efficiency factor in %
+};
+
+inline void SetN2kPGN127513(tN2kMsg &N2kMsg, const tN2kPGN127513Data &Data) {
+  SetN2kPGN127513(N2kMsg,Data.BatInstance,Data.BatType,Data.SupportsEqual,Data.BatNominalVoltage,Data.BatChemistry,
+                  Data.BatCapacity,Data.BatTemperatureCoefficient,Data.PeukertExponent,Data.ChargeEfficiencyFactor);
+}
+
+inline bool ParseN2kPGN127513(const tN2kMsg &N2kMsg, tN2kPGN127513Data &Data) {
+  return ParseN2kPGN127513(N2kMsg,Data.BatInstance,Data.BatType,Data.SupportsEqual,Data.BatNominalVoltage,Data.BatChemistry,
+                           Data.BatCapacity,Data.BatTemperatureCoefficient,Data.PeukertExponent,Data.ChargeEfficiencyFactor);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127750 "Converter Status"
+ * \sa SetN2kPGN127750 and ParseN2kPGN127750
+ */
+struct tN2kPGN127750Data {
+  unsigned char SID;                      ///< Sequence ID
+  unsigned char ConnectionNumber;         ///< Connection number
+  tN2kConvMode OperatingState;            ///< Operating state
+  tN2kRippleState RippleState;            ///< Ripple state
+  tN2kDCVolgateState LowDcVoltageState;   ///< Low DC voltage state
+  tN2kOverloadState OverloadState;        ///< Overload state
+  tN2kTemperatureState TemperatureState;  ///< Temperature state
+};
+
+inline void SetN2kPGN127750(tN2kMsg &N2kMsg, const tN2kPGN127750Data &Data) {
+  SetN2kPGN127750(N2kMsg,Data.SID,Data.ConnectionNumber,Data.OperatingState,Data.TemperatureState,Data.OverloadState,
+                  Data.LowDcVoltageState,Data.RippleState);
+}
+
+inline bool ParseN2kPGN127750(const tN2kMsg &N2kMsg, tN2kPGN127750Data &Data) {
+  return ParseN2kPGN127750(N2kMsg,Data.SID,Data.ConnectionNumber,Data.OperatingState,Data.TemperatureState,Data.OverloadState,
+                           Data.LowDcVoltageState,Data.RippleState);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 127751 "DC Voltage/Current"
+ * \sa SetN2kPGN127751 and ParseN2kPGN127751
+ */
+struct tN2kPGN127751Data {
+  unsigned char SID;                  ///< Sequence ID
+  unsigned char Instance;             ///< Connection number
+  double Voltage;                     ///< DC voltage in V
+  double Current;                     ///< DC current in A
+};
+
+inline void SetN2kPGN127751(tN2kMsg &N2kMsg, const tN2kPGN127751Data &Data) {
+  SetN2kPGN127751(N2kMsg,Data.Instance,Data.Voltage,Data.Current,Data.SID);
+}
+
+inline bool ParseN2kPGN127751(const tN2kMsg &N2kMsg, tN2kPGN127751Data &Data) {
+  return ParseN2kPGN127751(N2kMsg,Data.Instance,Data.Voltage,Data.Current,Data.SID);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 128000 "Leeway Angle"
+ * \sa SetN2kPGN128000 and ParseN2kPGN128000
+ */
+struct tN2kPGN128000Data {
+  unsigned char SID;                  ///< Sequence ID
+  double Leeway;                      ///< Leeway angle in radians
+};
+
+inline void SetN2kPGN128000(tN2kMsg &N2kMsg, const tN2kPGN128000Data &Data) {
+  SetN2kPGN128000(N2kMsg,Data.SID,Data.Leeway);
+}
+
+inline bool ParseN2kPGN128000(const tN2kMsg &N2kMsg, tN2kPGN128000Data &Data) {
+  return ParseN2kPGN128000(N2kMsg,Data.SID,Data.Leeway);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 128259 "Boat speed"
+ * \sa SetN2kPGN128259 and ParseN2kPGN128259
+ */
+struct tN2kPGN128259Data {
+  unsigned char SID;                  ///< Sequence ID
+  double WaterReferenced;             ///< Speed through water in m/s
+  double GroundReferenced;            ///< Speed over ground in m/s
+  tN2kSpeedWaterReferenceType SWRT;   ///< Speed water reference type
+};
+
+inline void SetN2kPGN128259(tN2kMsg &N2kMsg, const tN2kPGN128259Data &Data) {
+  SetN2kPGN128259(N2kMsg,Data.SID,Data.WaterReferenced,Data.GroundReferenced,Data.SWRT);
+}
+
+inline bool ParseN2kPGN128259(const tN2kMsg &N2kMsg, tN2kPGN128259Data &Data) {
+  return ParseN2kPGN128259(N2kMsg,Data.SID,Data.WaterReferenced,Data.GroundReferenced,Data.SWRT);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 128267 "Water depth"
+ * \sa SetN2kPGN128267 and ParseN2kPGN128267
+ */
+struct tN2kPGN128267Data {
+  unsigned char SID;                  ///< Sequence ID
+  double DepthBelowTransducer;        ///< Depth below transducer in meters
+  double Offset;                      ///< Transducer offset in meters
+  double Range;                       ///< Depth range in meters
+};
+
+inline void SetN2kPGN128267(tN2kMsg &N2kMsg, const tN2kPGN128267Data &Data) {
+  SetN2kPGN128267(N2kMsg,Data.SID,Data.DepthBelowTransducer,Data.Offset,Data.Range);
+}
+
+inline bool ParseN2kPGN128267(const tN2kMsg &N2kMsg, tN2kPGN128267Data &Data) {
+  return ParseN2kPGN128267(N2kMsg,Data.SID,Data.DepthBelowTransducer,Data.Offset,Data.Range);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 128275 "Distance log"
+ * \sa SetN2kPGN128275 and ParseN2kPGN128275
+ */
+struct tN2kPGN128275Data {
+  uint16_t DaysSince1970;             ///< Days since 1970-01-01
+  double SecondsSinceMidnight;        ///< Seconds since midnight
+  uint32_t Log;                       ///< Total distance in meters
+  uint32_t TripLog;                   ///< Trip distance in meters
+};
+
+inline void SetN2kPGN128275(tN2kMsg &N2kMsg, const tN2kPGN128275Data &Data) {
+  SetN2kPGN128275(N2kMsg,Data.DaysSince1970,Data.SecondsSinceMidnight,Data.Log,Data.TripLog);
+}
+
+inline bool ParseN2kPGN128275(const tN2kMsg &N2kMsg, tN2kPGN128275Data &Data) {
+  return ParseN2kPGN128275(N2kMsg,Data.DaysSince1970,Data.SecondsSinceMidnight,Data.Log,Data.TripLog);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 128776 "Anchor Windlass Control Status"
+ * \sa SetN2kPGN128776 and ParseN2kPGN128776
+ */
+struct tN2kPGN128776Data {
+  unsigned char SID;                                      ///< Sequence ID
+  unsigned char WindlassIdentifier;                       ///< Windlass identifier
+  tN2kWindlassDirectionControl WindlassDirectionControl;  ///< Direction control
+  tN2kGenericStatusPair AnchorDockingControl;             ///< Anchor docking control
+  tN2kSpeedType SpeedControlType;                         ///< Speed control type
+  unsigned char SpeedControl;                             ///< Speed control in %
+  tN2kGenericStatusPair PowerEnable;                      ///< Power enable
+  tN2kGenericStatusPair MechanicalLock;                   ///< Mechanical lock
+  tN2kGenericStatusPair DeckAndAnchorWash;                ///< Deck and anchor wash
+  tN2kGenericStatusPair AnchorLight;                      ///< Anchor light
+  double CommandTimeout;                                  ///< Command timeout in seconds
+  tN2kWindlassControlEvents WindlassControlEvents;        ///< Control events
+};
+
+inline void SetN2kPGN128776(tN2kMsg &N2kMsg, const tN2kPGN128776Data &Data) {
+  SetN2kPGN128776(N2kMsg,Data.SID,Data.WindlassIdentifier,Data.WindlassDirectionControl,Data.SpeedControl,
+                  Data.SpeedControlType,Data.AnchorDockingControl,Data.PowerEnable,Data.MechanicalLock,
+                  Data.DeckAndAnchorWash,Data.AnchorLight,Data.CommandTimeout,Data.WindlassControlEvents);
+}
+
+inline bool ParseN2kPGN128776(const tN2kMsg &N2kMsg, tN2kPGN128776Data &Data) {
+  return ParseN2kPGN128776(N2kMsg,Data.SID,Data.WindlassIdentifier,Data.WindlassDirectionControl,Data.SpeedControl,
+                           Data.SpeedControlType,Data.AnchorDockingControl,Data.PowerEnable,Data.MechanicalLock,
+                           Data.DeckAndAnchorWash,Data.AnchorLight,Data.CommandTimeout,Data.WindlassControlEvents);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 128777 "Anchor Windlass Operating Status"
+ * \sa SetN2kPGN128777 and ParseN2kPGN128777
+ */
+struct tN2kPGN128777Data {
+  unsigned char SID;                                    ///< Sequence ID
+  unsigned char WindlassIdentifier;                     ///< Windlass identifier
+  tN2kWindlassMotionStates WindlassMotionStatus;        ///< Motion status
+  tN2kRodeTypeStates RodeTypeStatus;                    ///< Rode type status
+  double RodeCounterValue;                              ///< Rode counter in meters
+  double WindlassLineSpeed;                             ///< Line speed in m/s
+  tN2kAnchorDockingStates AnchorDockingStatus;          ///< Anchor docking status
+  tN2kWindlassOperatingEvents WindlassOperatingEvents;  ///< Operating events
+};
+
+inline void SetN2kPGN128777(tN2kMsg &N2kMsg, const tN2kPGN128777Data &Data) {
+  SetN2kPGN128777(N2kMsg,Data.SID,Data.WindlassIdentifier,Data.RodeCounterValue,Data.WindlassLineSpeed,
+                  Data.WindlassMotionStatus,Data.RodeTypeStatus,Data.AnchorDockingStatus,Data.WindlassOperatingEvents);
+}
+
+inline bool ParseN2kPGN128777(const tN2kMsg &N2kMsg, tN2kPGN128777Data &Data) {
+  return ParseN2kPGN128777(N2kMsg,Data.SID,Data.WindlassIdentifier,Data.RodeCounterValue,Data.WindlassLineSpeed,
+                           Data.WindlassMotionStatus,Data.RodeTypeStatus,Data.AnchorDockingStatus,Data.WindlassOperatingEvents);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 128778 "Anchor Windlass Monitoring Status"
+ * \sa SetN2kPGN128778 and ParseN2kPGN128778
+ */
+struct tN2kPGN128778Data {
+  unsigned char SID;                                      ///< Sequence ID
+  unsigned char WindlassIdentifier;                       ///< Windlass identifier
+  tN2kWindlassMonitoringEvents WindlassMonitoringEvents;  ///< Monitoring events
+  double ControllerVoltage;                               ///< Controller voltage in V
+  double MotorCurrent;                                    ///< Motor current in A
+  double TotalMotorTime;                                  ///< Total motor time in seconds
+};
+
+inline void SetN2kPGN128778(tN2kMsg &N2kMsg, const tN2kPGN128778Data &Data) {
+  SetN2kPGN128778(N2kMsg,Data.SID,Data.WindlassIdentifier,Data.TotalMotorTime,Data.ControllerVoltage,
+                  Data.MotorCurrent,Data.WindlassMonitoringEvents);
+}
+
+inline bool ParseN2kPGN128778(const tN2kMsg &N2kMsg, tN2kPGN128778Data &Data) {
+  return ParseN2kPGN128778(N2kMsg,Data.SID,Data.WindlassIdentifier,Data.TotalMotorTime,Data.ControllerVoltage,
+                           Data.MotorCurrent,Data.WindlassMonitoringEvents);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129025 "Position, Rapid Update"
+ * \sa SetN2kPGN129025 and ParseN2kPGN129025
+ */
+struct tN2kPGN129025Data {
+  double Latitude;                    ///< Latitude in degrees
+  double Longitude;                   ///< Longitude in degrees
+};
+
+inline void SetN2kPGN129025(tN2kMsg &N2kMsg, const tN2kPGN129025Data &Data) {
+  SetN2kPGN129025(N2kMsg,Data.Latitude,Data.Longitude);
+}
+
+inline bool ParseN2kPGN129025(const tN2kMsg &N2kMsg, tN2kPGN129025Data &Data) {
+  return ParseN2kPGN129025(N2kMsg,Data.Latitude,Data.Longitude);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129026 "COG SOG rapid"
+ * \sa SetN2kPGN129026 and ParseN2kPGN129026
+ */
+struct tN2kPGN129026Data {
+  unsigned char SID;                  ///< Sequence ID
+  tN2kHeadingReference Reference;     ///< COG reference
+  double COG;                         ///< Course over ground in radians
+  double SOG;                         ///< Speed over ground in m/s
+};
+
+inline void SetN2kPGN129026(tN2kMsg &N2kMsg, const tN2kPGN129026Data &Data) {
+  SetN2kPGN129026(N2kMsg,Data.SID,Data.Reference,Data.COG,Data.SOG);
+}
+
+inline bool ParseN2kPGN129026(const tN2kMsg &N2kMsg, tN2kPGN129026Data &Data) {
+  return ParseN2kPGN129026(N2kMsg,Data.SID,Data.Reference,Data.COG,Data.SOG);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129029 "GNSS Position Data"
+ *
+ * Structure holds only one reference station, which is same as
+ * argument list functions support.
+ *
+ * \sa SetN2kPGN129029 and ParseN2kPGN129029
+ */
+struct tN2kPGN129029Data {
+  unsigned char SID;                  ///< Sequence ID
+  uint16_t DaysSince1970;             ///< Days since 1970-01-01
+  double SecondsSinceMidnight;        ///< Seconds since midnight
+  double Latitude;                    ///< Latitude in degrees
+  double Longitude;                   ///< Longitude in degrees
+  double Altitude;                    ///< Altitude in meters
+  tN2kGNSStype GNSStype;              ///< GNSS type
+  tN2kGNSSmethod GNSSmethod;          ///< GNSS method
+  unsigned char nSatellites;          ///< Number of satellites used
+  double HDOP;                        ///< Horizontal dilution of precision
+  double PDOP;                        ///< Positional dilution of precision
+  double GeoidalSeparation;           ///< Geoidal separation in meters
+  unsigned char nReferenceStations;   ///< Number of reference stations
+  tN2kGNSStype ReferenceStationType;  ///< Reference station type
+  uint16_t ReferenceStationID;        ///< Reference station ID
+  double AgeOfCorrection;             ///< Age of DGNSS corrections in seconds
+};
+
+inline void SetN2kPGN129029(tN2kMsg &N2kMsg, const tN2kPGN129029Data &Data) {
+  SetN2kPGN129029(N2kMsg,Data.SID,Data.DaysSince1970,Data.SecondsSinceMidnight,Data.Latitude,Data.Longitude,
+                  Data.Altitude,Data.GNSStype,Data.GNSSmethod,Data.nSatellites,Data.HDOP,Data.PDOP,
+                  Data.GeoidalSeparation,Data.nReferenceStations,Data.ReferenceStationType,
+                  Data.ReferenceStationID,Data.AgeOfCorrection);
+}
+
+inline bool ParseN2kPGN129029(const tN2kMsg &N2kMsg, tN2kPGN129029Data &Data) {
+  return ParseN2kPGN129029(N2kMsg,Data.SID,Data.DaysSince1970,Data.SecondsSinceMidnight,Data.Latitude,Data.Longitude,
+                           Data.Altitude,Data.GNSStype,Data.GNSSmethod,Data.nSatellites,Data.HDOP,Data.PDOP,
+                           Data.GeoidalSeparation,Data.nReferenceStations,Data.ReferenceStationType,
+                           Data.ReferenceStationID,Data.AgeOfCorrection);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129033 "Date,Time & Local offset"
+ * \sa SetN2kPGN129033 and ParseN2kPGN129033
+ */
+struct tN2kPGN129033Data {
+  uint16_t DaysSince1970;             ///< Days since 1970-01-01
+  double SecondsSinceMidnight;        ///< Seconds since midnight
+  int16_t LocalOffset;                ///< Local offset in minutes
+};
+
+inline void SetN2kPGN129033(tN2kMsg &N2kMsg, const tN2kPGN129033Data &Data) {
+  SetN2kPGN129033(N2kMsg,Data.DaysSince1970,Data.SecondsSinceMidnight,Data.LocalOffset);
+}
+
+inline bool ParseN2kPGN129033(const tN2kMsg &N2kMsg, tN2kPGN129033Data &Data) {
+  return ParseN2kPGN129033(N2kMsg,Data.DaysSince1970,Data.SecondsSinceMidnight,Data.LocalOffset);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129038 "AIS Class A Position Report"
+ * \sa SetN2kPGN129038 and ParseN2kPGN129038
+ */
+struct tN2kPGN129038Data {
+  uint8_t MessageID;                                        ///< AIS message type
+  tN2kAISRepeat Repeat;                                     ///< Repeat indicator
+  uint32_t UserID;                                          ///< MMSI
+  double Longitude;                                         ///< Longitude in degrees
+  double Latitude;                                          ///< Latitude in degrees
+  bool Accuracy;                                            ///< Position accuracy
+  bool RAIM;                                                ///< RAIM flag
+  uint8_t Seconds;                                          ///< UTC second when report was generated
+  double COG;                                               ///< Course over ground in radians
+  double SOG;                                               ///< Speed over ground in m/s
+  tN2kAISTransceiverInformation AISTransceiverInformation;  ///< AIS transceiver information
+  double Heading;                                           ///< True heading in radians
+  double ROT;                                               ///< Rate of turn in radians/s
+  tN2kAISNavStatus NavStatus;                               ///< Navigational status
+  uint8_t SID;                                              ///< Sequence ID
+};
+
+inline void SetN2kPGN129038(tN2kMsg &N2kMsg, const tN2kPGN129038Data &Data) {
+  SetN2kPGN129038(N2kMsg,Data.MessageID,Data.Repeat,Data.UserID,Data.Latitude,Data.Longitude,Data.Accuracy,
+                  Data.RAIM,Data.Seconds,Data.COG,Data.SOG,Data.AISTransceiverInformation,Data.Heading,
+                  Data.ROT,Data.NavStatus,Data.SID);
+}
+
+inline bool ParseN2kPGN129038(const tN2kMsg &N2kMsg, tN2kPGN129038Data &Data) {
+  return ParseN2kPGN129038(N2kMsg,Data.MessageID,Data.Repeat,Data.UserID,Data.Latitude,Data.Longitude,Data.Accuracy,
+                           Data.RAIM,Data.Seconds,Data.COG,Data.SOG,Data.Heading,Data.ROT,Data.NavStatus,
+                           Data.AISTransceiverInformation,Data.SID);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129039 "AIS Class B Position Report"
+ * \sa SetN2kPGN129039 and ParseN2kPGN129039
+ */
+struct tN2kPGN129039Data {
+  uint8_t MessageID;                                        ///< AIS message type
+  tN2kAISRepeat Repeat;                                     ///< Repeat indicator
+  uint32_t UserID;                                          ///< MMSI
+  double Longitude;                                         ///< Longitude in degrees
+  double Latitude;                                          ///< Latitude in degrees
+  bool Accuracy;                                            ///< Position accuracy
+  bool RAIM;                                                ///< RAIM flag
+  uint8_t Seconds;                                          ///< UTC second when report was generated
+  double COG;                                               ///< Course over ground in radians
+  double SOG;                                               ///< Speed over ground in m/s
+  tN2kAISTransceiverInformation AISTransceiverInformation;  ///< AIS transceiver information
+  double Heading;                                           ///< True heading in radians
+  tN2kAISUnit Unit;                                         ///< Class B unit type
+  bool Display;                                             ///< Integrated display flag
+  bool DSC;                                                 ///< DSC flag
+  bool Band;                                                ///< Band flag
+  bool Msg22;                                               ///< Message 22 flag
+  tN2kAISMode Mode;                                         ///< AIS mode
+  bool State;                                               ///< Communication state selector
+  uint8_t SID;                                              ///< Sequence ID
+};
+
+inline void SetN2kPGN129039(tN2kMsg &N2kMsg, const tN2kPGN129039Data &Data) {
+  SetN2kPGN129039(N2kMsg,Data.MessageID,Data.Repeat,Data.UserID,Data.Latitude,Data.Longitude,Data.Accuracy,
+                  Data.RAIM,Data.Seconds,Data.COG,Data.SOG,Data.AISTransceiverInformation,Data.Heading,
+                  Data.Unit,Data.Display,Data.DSC,Data.Band,Data.Msg22,Data.Mode,Data.State,Data.SID);
+}
+
+inline bool ParseN2kPGN129039(const tN2kMsg &N2kMsg, tN2kPGN129039Data &Data) {
+  return ParseN2kPGN129039(N2kMsg,Data.MessageID,Data.Repeat,Data.UserID,Data.Latitude,Data.Longitude,Data.Accuracy,
+                           Data.RAIM,Data.Seconds,Data.COG,Data.SOG,Data.AISTransceiverInformation,Data.Heading,
+                           Data.Unit,Data.Display,Data.DSC,Data.Band,Data.Msg22,Data.Mode,Data.State,Data.SID);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129283 "Cross Track Error"
+ * \sa SetN2kPGN129283 and ParseN2kPGN129283
+ */
+struct tN2kPGN129283Data {
+  unsigned char SID;                  ///< Sequence ID
+  tN2kXTEMode XTEMode;                ///< XTE mode
+  bool NavigationTerminated;          ///< Navigation has been terminated
+  double XTE;                         ///< Cross track error in meters
+};
+
+inline void SetN2kPGN129283(tN2kMsg &N2kMsg, const tN2kPGN129283Data &Data) {
+  SetN2kPGN129283(N2kMsg,Data.SID,Data.XTEMode,Data.NavigationTerminated,Data.XTE);
+}
+
+inline bool ParseN2kPGN129283(const tN2kMsg &N2kMsg, tN2kPGN129283Data &Data) {
+  return ParseN2kPGN129283(N2kMsg,Data.SID,Data.XTEMode,Data.NavigationTerminated,Data.XTE);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129284 "Navigation info"
+ * \sa SetN2kPGN129284 and ParseN2kPGN129284
+ */
+struct tN2kPGN129284Data {
+  unsigned char SID;                                  ///< Sequence ID
+  double DistanceToWaypoint;                          ///< Distance to waypoint in meters
+  tN2kHeadingReference BearingReference;              ///< Bearing reference
+  bool PerpendicularCrossed;                          ///< Perpendicular crossed
+  bool ArrivalCircleEntered;                          ///< Arrival circle entered
+  tN2kDistanceCalculationType CalculationType;        ///< Calculation type
+  double ETATime;                                     ///< ETA seconds since midnight
+  int16_t ETADate;                                    ///< ETA days since 1970-01-01
+  double BearingOriginToDestinationWaypoint;          ///< Bearing origin to destination in radians
+  double BearingPositionToDestinationWaypoint;        ///< Bearing position to destination in radians
+  uint32_t OriginWaypointNumber;                      ///< Origin waypoint number
+  uint32_t DestinationWaypointNumber;                 ///< Destination waypoint number
+  double DestinationLatitude;                         ///< Destination latitude in degrees
+  double DestinationLongitude;                        ///< Destination longitude in degrees
+  double WaypointClosingVelocity;                     ///< Waypoint closing velocity in m/s
+};
+
+inline void SetN2kPGN129284(tN2kMsg &N2kMsg, const tN2kPGN129284Data &Data) {
+  SetN2kPGN129284(N2kMsg,Data.SID,Data.DistanceToWaypoint,Data.BearingReference,Data.PerpendicularCrossed,
+                  Data.ArrivalCircleEntered,Data.CalculationType,Data.ETATime,Data.ETADate,
+                  Data.BearingOriginToDestinationWaypoint,Data.BearingPositionToDestinationWaypoint,
+                  Data.OriginWaypointNumber,Data.DestinationWaypointNumber,Data.DestinationLatitude,
+                  Data.DestinationLongitude,Data.WaypointClosingVelocity);
+}
+
+inline bool ParseN2kPGN129284(const tN2kMsg &N2kMsg, tN2kPGN129284Data &Data) {
+  return ParseN2kPGN129284(N2kMsg,Data.SID,Data.DistanceToWaypoint,Data.BearingReference,Data.PerpendicularCrossed,
+                           Data.ArrivalCircleEntered,Data.CalculationType,Data.ETATime,Data.ETADate,
+                           Data.BearingOriginToDestinationWaypoint,Data.BearingPositionToDestinationWaypoint,
+                           Data.OriginWaypointNumber,Data.DestinationWaypointNumber,Data.DestinationLatitude,
+                           Data.DestinationLongitude,Data.WaypointClosingVelocity);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129539 "GNSS DOP data"
+ * \sa SetN2kPGN129539 and ParseN2kPgn129539
+ */
+struct tN2kPGN129539Data {
+  unsigned char SID;                  ///< Sequence ID
+  tN2kGNSSDOPmode DesiredMode;        ///< Desired DOP mode
+  tN2kGNSSDOPmode ActualMode;         ///< Actual DOP mode
+  double HDOP;                        ///< Horizontal dilution of precision
+  double VDOP;                        ///< Vertical dilution of precision
+  double TDOP;                        ///< Time dilution of precision
+};
+
+inline void SetN2kPGN129539(tN2kMsg &N2kMsg, const tN2kPGN129539Data &Data) {
+  SetN2kPGN129539(N2kMsg,Data.SID,Data.DesiredMode,Data.ActualMode,Data.HDOP,Data.VDOP,Data.TDOP);
+}
+
+inline bool ParseN2kPgn129539(const tN2kMsg &N2kMsg, tN2kPGN129539Data &Data) {
+  return ParseN2kPgn129539(N2kMsg,Data.SID,Data.DesiredMode,Data.ActualMode,Data.HDOP,Data.VDOP,Data.TDOP);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129794 "AIS Class A Static and Voyage Related Data"
+ * \sa SetN2kPGN129794 and ParseN2kPGN129794
+ */
+struct tN2kPGN129794Data {
+  uint8_t MessageID;                                ///< AIS message type
+  tN2kAISRepeat Repeat;                             ///< Repeat indicator
+  uint32_t UserID;                                  ///< MMSI
+  uint32_t IMOnumber;                               ///< Ship identification number by IMO
+  char Callsign[N2kMaxAISCallsignLength+1];         ///< Call sign
+  char Name[N2kMaxAISNameLength+1];                 ///< Vessel name
+  uint8_t VesselType;                               ///< Vessel type
+  double Length;                                    ///< Length in meters
+  double Beam;                                      ///< Beam in meters
+  double PosRefStbd;                                ///< Position reference from starboard in meters
+  double PosRefBow;                                 ///< Position reference from bow in meters
+  uint16_t ETAdate;                                 ///< ETA days since 1970-01-01
+  double ETAtime;                                   ///< ETA seconds since midnight
+  double Draught;                                   ///< Maximum present static draught in meters
+  char Destination[N2kMaxAISDestinationLength+1];   ///< Destination
+  tN2kAISVersion AISversion;                        ///< AIS version
+  tN2kGNSStype GNSStype;                            ///< Type of positioning device
+  tN2kAISDTE DTE;                                   ///< Data terminal equipment
+  tN2kAISTransceiverInformation AISinfo;            ///< AIS transceiver information
+  uint8_t SID;                                      ///< Sequence ID
+};
+
+inline void SetN2kPGN129794(tN2kMsg &N2kMsg, const tN2kPGN129794Data &Data) {
+  SetN2kPGN129794(N2kMsg,Data.MessageID,Data.Repeat,Data.UserID,Data.IMOnumber,Data.Callsign,Data.Name,
+                  Data.VesselType,Data.Length,Data.Beam,Data.PosRefStbd,Data.PosRefBow,Data.ETAdate,
+                  Data.ETAtime,Data.Draught,Data.Destination,Data.AISversion,Data.GNSStype,Data.DTE,
+                  Data.AISinfo,Data.SID);
+}
+
+inline bool ParseN2kPGN129794(const tN2kMsg &N2kMsg, tN2kPGN129794Data &Data) {
+  return ParseN2kPGN129794(N2kMsg,Data.MessageID,Data.Repeat,Data.UserID,Data.IMOnumber,
+                           Data.Callsign,sizeof(Data.Callsign),Data.Name,sizeof(Data.Name),
+                           Data.VesselType,Data.Length,Data.Beam,Data.PosRefStbd,Data.PosRefBow,Data.ETAdate,
+                           Data.ETAtime,Data.Draught,Data.Destination,sizeof(Data.Destination),
+                           Data.AISversion,Data.GNSStype,Data.DTE,Data.AISinfo,Data.SID);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129809 "AIS Class B Static Data, Part A"
+ * \sa SetN2kPGN129809 and ParseN2kPGN129809
+ */
+struct tN2kPGN129809Data {
+  uint8_t MessageID;                        ///< AIS message type
+  tN2kAISRepeat Repeat;                     ///< Repeat indicator
+  uint32_t UserID;                          ///< MMSI
+  char Name[N2kMaxAISNameLength+1];         ///< Vessel name
+  tN2kAISTransceiverInformation AISInfo;    ///< AIS transceiver information
+  uint8_t SID;                              ///< Sequence ID
+};
+
+inline void SetN2kPGN129809(tN2kMsg &N2kMsg, const tN2kPGN129809Data &Data) {
+  SetN2kPGN129809(N2kMsg,Data.MessageID,Data.Repeat,Data.UserID,Data.Name,Data.AISInfo,Data.SID);
+}
+
+inline bool ParseN2kPGN129809(const tN2kMsg &N2kMsg, tN2kPGN129809Data &Data) {
+  return ParseN2kPGN129809(N2kMsg,Data.MessageID,Data.Repeat,Data.UserID,Data.Name,sizeof(Data.Name),Data.AISInfo,Data.SID);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 129810 "AIS Class B Static Data, Part B"
+ * \sa SetN2kPGN129810 and ParseN2kPGN129810
+ */
+struct tN2kPGN129810Data {
+  uint8_t MessageID;                          ///< AIS message type
+  tN2kAISRepeat Repeat;                       ///< Repeat indicator
+  uint32_t UserID;                            ///< MMSI
+  uint8_t VesselType;                         ///< Vessel type
+  char Vendor[N2kMaxAISCallsignLength+1];     ///< Vendor ID
+  char Callsign[N2kMaxAISCallsignLength+1];   ///< Call sign
+  double Length;                              ///< Length in meters
+  double Beam;                                ///< Beam in meters
+  double PosRefStbd;                          ///< Position reference from starboard in meters
+  double PosRefBow;                           ///< Position reference from bow in meters
+  uint32_t MothershipID;                      ///< MMSI of mother ship
+  tN2kAISTransceiverInformation AISInfo;      ///< AIS transceiver information
+  uint8_t SID;                                ///< Sequence ID
+};
+
+inline void SetN2kPGN129810(tN2kMsg &N2kMsg, const tN2kPGN129810Data &Data) {
+  SetN2kPGN129810(N2kMsg,Data.MessageID,Data.Repeat,Data.UserID,Data.VesselType,Data.Vendor,Data.Callsign,
+                  Data.Length,Data.Beam,Data.PosRefStbd,Data.PosRefBow,Data.MothershipID,Data.AISInfo,Data.SID);
+}
+
+inline bool ParseN2kPGN129810(const tN2kMsg &N2kMsg, tN2kPGN129810Data &Data) {
+  return ParseN2kPGN129810(N2kMsg,Data.MessageID,Data.Repeat,Data.UserID,Data.VesselType,
+                           Data.Vendor,sizeof(Data.Vendor),Data.Callsign,sizeof(Data.Callsign),
+                           Data.Length,Data.Beam,Data.PosRefStbd,Data.PosRefBow,Data.MothershipID,Data.AISInfo,Data.SID);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 130306 "Wind Data"
+ * \sa SetN2kPGN130306 and ParseN2kPGN130306
+ */
+struct tN2kPGN130306Data {
+  unsigned char SID;                  ///< Sequence ID
+  double WindSpeed;                   ///< Wind speed in m/s
+  double WindAngle;                   ///< Wind angle in radians
+  tN2kWindReference WindReference;    ///< Wind reference
+};
+
+inline void SetN2kPGN130306(tN2kMsg &N2kMsg, const tN2kPGN130306Data &Data) {
+  SetN2kPGN130306(N2kMsg,Data.SID,Data.WindSpeed,Data.WindAngle,Data.WindReference);
+}
+
+inline bool ParseN2kPGN130306(const tN2kMsg &N2kMsg, tN2kPGN130306Data &Data) {
+  return ParseN2kPGN130306(N2kMsg,Data.SID,Data.WindSpeed,Data.WindAngle,Data.WindReference);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 130310 "Environmental Parameters (Outside)"
+ * \sa SetN2kPGN130310 and ParseN2kPGN130310
+ */
+struct tN2kPGN130310Data {
+  unsigned char SID;                      ///< Sequence ID
+  double WaterTemperature;                ///< Water temperature in K
+  double OutsideAmbientAirTemperature;    ///< Outside air temperature in K
+  double AtmosphericPressure;             ///< Atmospheric pressure in Pa
+};
+
+inline void SetN2kPGN130310(tN2kMsg &N2kMsg, const tN2kPGN130310Data &Data) {
+  SetN2kPGN130310(N2kMsg,Data.SID,Data.WaterTemperature,Data.OutsideAmbientAirTemperature,Data.AtmosphericPressure);
+}
+
+inline bool ParseN2kPGN130310(const tN2kMsg &N2kMsg, tN2kPGN130310Data &Data) {
+  return ParseN2kPGN130310(N2kMsg,Data.SID,Data.WaterTemperature,Data.OutsideAmbientAirTemperature,Data.AtmosphericPressure);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 130311 "Environmental Parameters"
+ * \sa SetN2kPGN130311 and ParseN2kPGN130311
+ */
+struct tN2kPGN130311Data {
+  unsigned char SID;                  ///< Sequence ID
+  tN2kTempSource TempSource;          ///< Temperature source
+  tN2kHumiditySource HumiditySource;  ///< Humidity source
+  double Temperature;                 ///< Temperature in K
+  double Humidity;                    ///< Humidity in %
+  double AtmosphericPressure;         ///< Atmospheric pressure in Pa
+};
+
+inline void SetN2kPGN130311(tN2kMsg &N2kMsg, const tN2kPGN130311Data &Data) {
+  SetN2kPGN130311(N2kMsg,Data.SID,Data.TempSource,Data.Temperature,Data.HumiditySource,Data.Humidity,Data.AtmosphericPressure);
+}
+
+inline bool ParseN2kPGN130311(const tN2kMsg &N2kMsg, tN2kPGN130311Data &Data) {
+  return ParseN2kPGN130311(N2kMsg,Data.SID,Data.TempSource,Data.Temperature,Data.HumiditySource,Data.Humidity,Data.AtmosphericPressure);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 130312 "Temperature"
+ * \sa SetN2kPGN130312 and ParseN2kPGN130312
+ */
+struct tN2kPGN130312Data {
+  unsigned char SID;                  ///< Sequence ID
+  unsigned char TempInstance;         ///< Temperature instance
+  tN2kTempSource TempSource;          ///< Temperature source
+  double ActualTemperature;           ///< Actual temperature in K
+  double SetTemperature;              ///< Set temperature in K
+};
+
+inline void SetN2kPGN130312(tN2kMsg &N2kMsg, const tN2kPGN130312Data &Data) {
+  SetN2kPGN130312(N2kMsg,Data.SID,Data.TempInstance,Data.TempSource,Data.ActualTemperature,Data.SetTemperature);
+}
+
+inline bool ParseN2kPGN130312(const tN2kMsg &N2kMsg, tN2kPGN130312Data &Data) {
+  return ParseN2kPGN130312(N2kMsg,Data.SID,Data.TempInstance,Data.TempSource,Data.ActualTemperature,Data.SetTemperature);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 130313 "Humidity"
+ * \sa SetN2kPGN130313 and ParseN2kPGN130313
+ */
+struct tN2kPGN130313Data {
+  unsigned char SID;                  ///< Sequence ID
+  unsigned char HumidityInstance;     ///< Humidity instance
+  tN2kHumiditySource HumiditySource;  ///< Humidity source
+  double ActualHumidity;              ///< Actual humidity in %
+  double SetHumidity;                 ///< Set humidity in %
+};
+
+inline void SetN2kPGN130313(tN2kMsg &N2kMsg, const tN2kPGN130313Data &Data) {
+  SetN2kPGN130313(N2kMsg,Data.SID,Data.HumidityInstance,Data.HumiditySource,Data.ActualHumidity,Data.SetHumidity);
+}
+
+inline bool ParseN2kPGN130313(const tN2kMsg &N2kMsg, tN2kPGN130313Data &Data) {
+  return ParseN2kPGN130313(N2kMsg,Data.SID,Data.HumidityInstance,Data.HumiditySource,Data.ActualHumidity,Data.SetHumidity);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 130314 "Actual Pressure"
+ * \sa SetN2kPGN130314 and ParseN2kPGN130314
+ */
+struct tN2kPGN130314Data {
+  unsigned char SID;                  ///< Sequence ID
+  unsigned char PressureInstance;     ///< Pressure instance
+  tN2kPressureSource PressureSource;  ///< Pressure source
+  double Pressure;                    ///< Pressure in Pa
+};
+
+inline void SetN2kPGN130314(tN2kMsg &N2kMsg, const tN2kPGN130314Data &Data) {
+  SetN2kPGN130314(N2kMsg,Data.SID,Data.PressureInstance,Data.PressureSource,Data.Pressure);
+}
+
+inline bool ParseN2kPGN130314(const tN2kMsg &N2kMsg, tN2kPGN130314Data &Data) {
+  return ParseN2kPGN130314(N2kMsg,Data.SID,Data.PressureInstance,Data.PressureSource,Data.Pressure);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 130315 "Set Pressure"
+ *
+ * There is no parser for this PGN.
+ *
+ * \sa SetN2kPGN130315
+ */
+struct tN2kPGN130315Data {
+  unsigned char SID;                  ///< Sequence ID
+  unsigned char PressureInstance;     ///< Pressure instance
+  tN2kPressureSource PressureSource;  ///< Pressure source
+  double SetPressure;                 ///< Set pressure in Pa
+};
+
+inline void SetN2kPGN130315(tN2kMsg &N2kMsg, const tN2kPGN130315Data &Data) {
+  SetN2kPGN130315(N2kMsg,Data.SID,Data.PressureInstance,Data.PressureSource,Data.SetPressure);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 130316 "Temperature, Extended Range"
+ * \sa SetN2kPGN130316 and ParseN2kPGN130316
+ */
+struct tN2kPGN130316Data {
+  unsigned char SID;                  ///< Sequence ID
+  unsigned char TempInstance;         ///< Temperature instance
+  tN2kTempSource TempSource;          ///< Temperature source
+  double ActualTemperature;           ///< Actual temperature in K
+  double SetTemperature;              ///< Set temperature in K
+};
+
+inline void SetN2kPGN130316(tN2kMsg &N2kMsg, const tN2kPGN130316Data &Data) {
+  SetN2kPGN130316(N2kMsg,Data.SID,Data.TempInstance,Data.TempSource,Data.ActualTemperature,Data.SetTemperature);
+}
+
+inline bool ParseN2kPGN130316(const tN2kMsg &N2kMsg, tN2kPGN130316Data &Data) {
+  return ParseN2kPGN130316(N2kMsg,Data.SID,Data.TempInstance,Data.TempSource,Data.ActualTemperature,Data.SetTemperature);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 130576 "Small Craft Status"
+ * \sa SetN2kPGN130576 and ParseN2kPGN130576
+ */
+struct tN2kPGN130576Data {
+  int8_t PortTrimTab;                 ///< Port trim tab position in %
+  int8_t StbdTrimTab;                 ///< Starboard trim tab position in %
+};
+
+inline void SetN2kPGN130576(tN2kMsg &N2kMsg, const tN2kPGN130576Data &Data) {
+  SetN2kPGN130576(N2kMsg,Data.PortTrimTab,Data.StbdTrimTab);
+}
+
+inline bool ParseN2kPGN130576(const tN2kMsg &N2kMsg, tN2kPGN130576Data &Data) {
+  return ParseN2kPGN130576(N2kMsg,Data.PortTrimTab,Data.StbdTrimTab);
+}
+
+/************************************************************************//**
+ * \brief Data of PGN 130577 "Direction Data"
+ * \sa SetN2kPGN130577 and ParseN2kPGN130577
+ */
+struct tN2kPGN130577Data {
+  tN2kDataMode DataMode;              ///< Data mode
+  tN2kHeadingReference CogReference;  ///< COG reference
+  unsigned char SID;                  ///< Sequence ID
+  double COG;                         ///< Course over ground in radians
+  double SOG;                         ///< Speed over ground in m/s
+  double Heading;                     ///< Heading in radians
+  double SpeedThroughWater;           ///< Speed through water in m/s
+  double Set;                         ///< Set in radians
+  double Drift;                       ///< Drift in m/s
+};
+
+inline void SetN2kPGN130577(tN2kMsg &N2kMsg, const tN2kPGN130577Data &Data) {
+  SetN2kPGN130577(N2kMsg,Data.DataMode,Data.CogReference,Data.SID,Data.COG,Data.SOG,Data.Heading,
+                  Data.SpeedThroughWater,Data.Set,Data.Drift);
+}
+
+inline bool ParseN2kPGN130577(const tN2kMsg &N2kMsg, tN2kPGN130577Data &Data) {
+  return ParseN2kPGN130577(N2kMsg,Data.DataMode,Data.CogReference,Data.SID,Data.COG,Data.SOG,Data.Heading,
+                           Data.SpeedThroughWater,Data.Set,Data.Drift);
+}
+
+/************************************************************************//**
+ * \brief Data of Maretron PGN 130823 "Temperature High Range"
+ * \sa SetN2kMaretronPGN130823 and ParseN2kMaretronPGN130823
+ */
+struct tN2kMaretronPGN130823Data {
+  unsigned char SID;                  ///< Sequence ID
+  unsigned char TempInstance;         ///< Temperature instance
+  tN2kTempSource TempSource;          ///< Temperature source
+  double ActualTemperature;           ///< Actual temperature in K
+  double SetTemperature;              ///< Set temperature in K
+};
+
+inline void SetN2kMaretronPGN130823(tN2kMsg &N2kMsg, const tN2kMaretronPGN130823Data &Data) {
+  SetN2kMaretronPGN130823(N2kMsg,Data.SID,Data.TempInstance,Data.TempSource,Data.ActualTemperature,Data.SetTemperature);
+}
+
+inline bool ParseN2kMaretronPGN130823(const tN2kMsg &N2kMsg, tN2kMaretronPGN130823Data &Data) {
+  return ParseN2kMaretronPGN130823(N2kMsg,Data.SID,Data.TempInstance,Data.TempSource,Data.ActualTemperature,Data.SetTemperature);
+}
+
+/************************************************************************//**
+ * \brief Data of Maretron PGN 65286 "Fluid Flow Rate"
+ * \sa SetN2kMaretronPGN65286 and ParseN2kMaretronPGN65286
+ */
+struct tN2kMaretronPGN65286Data {
+  unsigned char SID;                  ///< Sequence ID
+  unsigned char FlowRateInstance;     ///< Flow rate instance
+  tN2kFluidType FluidType;            ///< Fluid type
+  double FluidFlowRate;               ///< Flow rate in l/h
+};
+
+inline void SetN2kMaretronPGN65286(tN2kMsg &N2kMsg, const tN2kMaretronPGN65286Data &Data) {
+  SetN2kMaretronPGN65286(N2kMsg,Data.SID,Data.FlowRateInstance,Data.FluidType,Data.FluidFlowRate);
+}
+
+inline bool ParseN2kMaretronPGN65286(const tN2kMsg &N2kMsg, tN2kMaretronPGN65286Data &Data) {
+  return ParseN2kMaretronPGN65286(N2kMsg,Data.SID,Data.FlowRateInstance,Data.FluidType,Data.FluidFlowRate);
+}
+
+/************************************************************************//**
+ * \brief Data of Maretron PGN 65287 "Trip Volume"
+ * \sa SetN2kMaretronPGN65287 and ParseN2kMaretronPGN65287
+ */
+struct tN2kMaretronPGN65287Data {
+  unsigned char SID;                  ///< Sequence ID
+  unsigned char VolumeInstance;       ///< Volume instance
+  tN2kFluidType FluidType;            ///< Fluid type
+  double TripVolume;                  ///< Trip volume in litres
+};
+
+inline void SetN2kMaretronPGN65287(tN2kMsg &N2kMsg, const tN2kMaretronPGN65287Data &Data) {
+  SetN2kMaretronPGN65287(N2kMsg,Data.SID,Data.VolumeInstance,Data.FluidType,Data.TripVolume);
+}
+
+inline bool ParseN2kMaretronPGN65287(const tN2kMsg &N2kMsg, tN2kMaretronPGN65287Data &Data) {
+  return ParseN2kMaretronPGN65287(N2kMsg,Data.SID,Data.VolumeInstance,Data.FluidType,Data.TripVolume);
+}
+
+#endif
@@ -0,0 +1,299 @@
+/*
+ * N2kMessageViews.h
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+/*************************************************************************//**
+ * \file  N2kMessageViews.h
+ * \brief Lightweight typed views for field on demand decoding.
+ *
+ * ParseN2kPGN* functions decode all fields of message, even if handler
+ * needs only one of them. View classes on this file wrap const tN2kMsg
+ * reference and decode only requested field from its fixed offset.
+ * Message PGN and length are checked once on construction.
+ *
+ * Example:
+ * \code
+ * void HandleGNSS(const tN2kMsg &N2kMsg) {
+ *   tN2kPGN129029View GNSS(N2kMsg);
+ *   if ( !GNSS.IsValid() ) return;
+ *   double Latitude=GNSS.Latitude();
+ * }
+ * \endcode
+ *
+ * Accessors return same values as corresponding ParseN2kPGN* function.
+ * View keeps reference to message, so message must not be changed or
+ * destroyed while view is used. Accessors must not be called, if
+ * \ref tN2kMsgView::IsValid returns false.
+ */
+
+#ifndef _N2kMessageViews_H_
+#define _N2kMessageViews_H_
+
+#include "N2kMsg.h"
+#include "N2kTypes.h"
+
+/************************************************************************//**
+ * \class tN2kMsgView
+ * \brief Base class for typed message views
+ * \ingroup group_msgTypes
+ */
+class tN2kMsgView {
+protected:
+  /** \brief Viewed message */
+  const tN2kMsg &N2kMsg;
+  /** \brief Result of PGN and length check on construction */
+  bool Valid;
+
+  /************************************************************************//**
+   * \brief Constructor for derived views
+   *
+   * \param _N2kMsg   Viewed message
+   * \param PGN       Expected PGN
+   * \param MinLen    Data length needed for mandatory fields
+   */
+  tN2kMsgView(const tN2kMsg &_N2kMsg, unsigned long PGN, int MinLen) :
+    N2kMsg(_N2kMsg), Valid(_N2kMsg.PGN==PGN && _N2kMsg.DataLen>=MinLen) {}
+
+  unsigned char Byte(int Index) const { return N2kMsg.Data[Index]; }
+  uint16_t UInt16(int Index) const { return GetBuf2ByteUInt(Index,N2kMsg.Data); }
+  double Double1U(int Index, double Precision) const { return GetBuf1ByteUDouble(Precision,Index,N2kMsg.Data,N2kDoubleNA); }
+  double Double2(int Index, double Precision) const { return GetBuf2ByteDouble(Precision,Index,N2kMsg.Data,N2kDoubleNA); }
+  double Double2U(int Index, double Precision) const { return GetBuf2ByteUDouble(Precision,Index,N2kMsg.Data,N2kDoubleNA); }
+  double Double3U(int Index, double Precision) const { return GetBuf3ByteUDouble(Precision,Index,N2kMsg.Data,N2kDoubleNA); }
+  double Double4(int Index, double Precision) const { return GetBuf4ByteDouble(Precision,Index,N2kMsg.Data,N2kDoubleNA); }
+  double Double4U(int Index, double Precision) const { return GetBuf4ByteUDouble(Precision,Index,N2kMsg.Data,N2kDoubleNA); }
+  double Double8(int Index, double Precision) const { return GetBuf8ByteDouble(Precision,Index,N2kMsg.Data,N2kDoubleNA); }
+
+public:
+  /** \brief Is message of right PGN and long enough for the view */
+  bool IsValid() const { return Valid; }
+  /** \brief Viewed message */
+  const tN2kMsg &GetMsg() const { return N2kMsg; }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 126992 "System time", see \ref ParseN2kPGN126992
+ */
+class tN2kPGN126992View : public tN2kMsgView {
+public:
+  explicit tN2kPGN126992View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,126992L,8) {}
+  unsigned char SID() const { return Byte(0); }
+  tN2kTimeSource TimeSource() const { return (tN2kTimeSource)(Byte(1) & 0x0f); }
+  uint16_t SystemDate() const { return UInt16(2); }
+  double SystemTime() const { return Double4U(4,0.0001); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 127250 "Vessel Heading", see \ref ParseN2kPGN127250
+ */
+class tN2kPGN127250View : public tN2kMsgView {
+public:
+  explicit tN2kPGN127250View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,127250L,8) {}
+  unsigned char SID() const { return Byte(0); }
+  double Heading() const { return Double2U(1,0.0001); }
+  double Deviation() const { return Double2(3,0.0001); }
+  double Variation() const { return Double2(5,0.0001); }
+  tN2kHeadingReference Reference() const { return (tN2kHeadingReference)(Byte(7) & 0x03); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 127251 "Rate of Turn", see \ref ParseN2kPGN127251
+ */
+class tN2kPGN127251View : public tN2kMsgView {
+public:
+  explicit tN2kPGN127251View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,127251L,5) {}
+  unsigned char SID() const { return Byte(0); }
+  double RateOfTurn() const { return Double4(1,3.125E-08); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 127257 "Attitude", see \ref ParseN2kPGN127257
+ */
+class tN2kPGN127257View : public tN2kMsgView {
+public:
+  explicit tN2kPGN127257View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,127257L,7) {}
+  unsigned char SID() const { return Byte(0); }
+  double Yaw() const { return Double2(1,0.0001); }
+  double Pitch() const { return Double2(3,0.0001); }
+  double Roll() const { return Double2(5,0.0001); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 127488 "Engine parameters rapid", see
+ *        \ref ParseN2kPGN127488
+ */
+class tN2kPGN127488View : public tN2kMsgView {
+public:
+  explicit tN2kPGN127488View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,127488L,6) {}
+  unsigned char EngineInstance() const { return Byte(0); }
+  double EngineSpeed() const { return Double2U(1,0.25); }
+  double EngineBoostPressure() const { return Double2U(3,100); }
+  int8_t EngineTiltTrim() const { return (int8_t)Byte(5); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 127508 "Battery Status", see \ref ParseN2kPGN127508
+ */
+class tN2kPGN127508View : public tN2kMsgView {
+public:
+  explicit tN2kPGN127508View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,127508L,8) {}
+  unsigned char BatteryInstance() const { return Byte(0); }
+  double BatteryVoltage() const { return Double2(1,0.01); }
+  double BatteryCurrent() const { return Double2(3,0.1); }
+  double BatteryTemperature() const { return Double2U(5,0.01); }
+  unsigned char SID() const { return Byte(7); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 128259 "Boat speed", see \ref ParseN2kPGN128259
+ */
+class tN2kPGN128259View : public tN2kMsgView {
+public:
+  explicit tN2kPGN128259View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,128259L,6) {}
+  unsigned char SID() const { return Byte(0); }
+  double WaterReferenced() const { return Double2U(1,0.01); }
+  double GroundReferenced() const { return Double2U(3,0.01); }
+  tN2kSpeedWaterReferenceType SWRT() const { return (tN2kSpeedWaterReferenceType)(Byte(5) & 0x0f); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 128267 "Water depth", see \ref ParseN2kPGN128267
+ *
+ * Range is optional field. It is N2kDoubleNA, if message does not have it.
+ */
+class tN2kPGN128267View : public tN2kMsgView {
+public:
+  explicit tN2kPGN128267View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,128267L,7) {}
+  unsigned char SID() const { return Byte(0); }
+  double DepthBelowTransducer() const { return Double4U(1,0.01); }
+  double Offset() const { return Double2(5,0.001); }
+  double Range() const { return ( N2kMsg.DataLen>=8 ? Double1U(7,10) : N2kDoubleNA ); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 129025 "Position, rapid update", see
+ *        \ref ParseN2kPGN129025
+ */
+class tN2kPGN129025View : public tN2kMsgView {
+public:
+  explicit tN2kPGN129025View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,129025L,8) {}
+  double Latitude() const { return Double4(0,1e-7); }
+  double Longitude() const { return Double4(4,1e-7); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 129026 "COG SOG rapid update", see
+ *        \ref ParseN2kPGN129026
+ */
+class tN2kPGN129026View : public tN2kMsgView {
+public:
+  explicit tN2kPGN129026View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,129026L,6) {}
+  unsigned char SID() const { return Byte(0); }
+  tN2kHeadingReference Reference() const { return (tN2kHeadingReference)(Byte(1) & 0x03); }
+  double COG() const { return Double2U(2,0.0001); }
+  double SOG() const { return Double2U(4,0.01); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 129029 "GNSS Position Data", see
+ *        \ref ParseN2kPGN129029
+ *
+ * Reference station accessors return values of first reference station.
+ * They return same defaults as \ref ParseN2kPGN129029, if message does not
+ * have reference stations.
+ */
+class tN2kPGN129029View : public tN2kMsgView {
+protected:
+  bool HasReferenceStation() const { return nReferenceStations()!=N2kUInt8NA && nReferenceStations()>0 && N2kMsg.DataLen>=47; }
+
+public:
+  explicit tN2kPGN129029View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,129029L,43) {}
+  unsigned char SID() const { return Byte(0); }
+  uint16_t DaysSince1970() const { return UInt16(1); }
+  double SecondsSinceMidnight() const { return Double4U(3,0.0001); }
+  double Latitude() const { return Double8(7,1e-16); }
+  double Longitude() const { return Double8(15,1e-16); }
+  double Altitude() const { return Double8(23,1e-6); }
+  tN2kGNSStype GNSStype() const { return (tN2kGNSStype)(Byte(31) & 0x0f); }
+  tN2kGNSSmethod GNSSmethod() const { return (tN2kGNSSmethod)((Byte(31)>>4) & 0x0f); }
+  unsigned char nSatellites() const { return Byte(33); }
+  double HDOP() const { return Double2(34,0.01); }
+  double PDOP() const { return Double2(36,0.01); }
+  double GeoidalSeparation() const { return Double4(38,0.01); }
+  unsigned char nReferenceStations() const { return Byte(42); }
+  tN2kGNSStype ReferenceStationType() const { return ( HasReferenceStation() ? (tN2kGNSStype)(UInt16(43) & 0x0f) : N2kGNSSt_GPS ); }
+  uint16_t ReferenceStationID() const { return ( HasReferenceStation() ? (uint16_t)(UInt16(43)>>4) : (uint16_t)N2kInt16NA ); }
+  double AgeOfCorrection() const { return ( HasReferenceStation() ? Double2U(45,0.01) : N2kDoubleNA ); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 130306 "Wind Data", see \ref ParseN2kPGN130306
+ */
+class tN2kPGN130306View : public tN2kMsgView {
+public:
+  explicit tN2kPGN130306View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,130306L,6) {}
+  unsigned char SID() const { return Byte(0); }
+  double WindSpeed() const { return Double2U(1,0.01); }
+  double WindAngle() const { return Double2U(3,0.0001); }
+  tN2kWindReference WindReference() const { return (tN2kWindReference)(Byte(5) & 0x07); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 130310 "Outside Environmental parameters", see
+ *        \ref ParseN2kPGN130310
+ */
+class tN2kPGN130310View : public tN2kMsgView {
+public:
+  explicit tN2kPGN130310View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,130310L,7) {}
+  unsigned char SID() const { return Byte(0); }
+  double WaterTemperature() const { return Double2U(1,0.01); }
+  double OutsideAmbientAirTemperature() const { return Double2U(3,0.01); }
+  double AtmosphericPressure() const { return Double2U(5,100); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 130312 "Temperature", see \ref ParseN2kPGN130312
+ */
+class tN2kPGN130312View : public tN2kMsgView {
+public:
+  explicit tN2kPGN130312View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,130312L,7) {}
+  unsigned char SID() const { return Byte(0); }
+  unsigned char TempInstance() const { return Byte(1); }
+  tN2kTempSource TempSource() const { return (tN2kTempSource)Byte(2); }
+  double ActualTemperature() const { return Double2U(3,0.01); }
+  double SetTemperature() const { return Double2U(5,0.01); }
+};
+
+/************************************************************************//**
+ * \brief View for PGN 130316 "Temperature, extended range", see
+ *        \ref ParseN2kPGN130316
+ */
+class tN2kPGN130316View : public tN2kMsgView {
+public:
+  explicit tN2kPGN130316View(const tN2kMsg &N2kMsg) : tN2kMsgView(N2kMsg,130316L,8) {}
+  unsigned char SID() const { return Byte(0); }
+  unsigned char TempInstance() const { return Byte(1); }
+  tN2kTempSource TempSource() const { return (tN2kTempSource)Byte(2); }
+  double ActualTemperature() const { return Double3U(3,0.001); }
+  double SetTemperature() const { return Double2U(6,0.1); }
+};
+
+#endif
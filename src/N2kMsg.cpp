@@ -269,6 +269,10 @@ void tN2kMsg::Clear() {
   PGN=0;
   DataLen=0;
   MsgTime=0;
+#if !defined(N2K_NO_RX_TIMESTAMP)
+  RxStartTime=0;
+  RxTime=0;
+#endif
 }
 
 //*****************************************************************************
@@ -1127,9 +1131,9 @@ void AddByteEscapedToBuf(unsigned char byteToAdd, uint8_t &idx, unsigned char *b
 //*****************************************************************************
 // Actisense Format:
 // <10><02><93><length (1)><priority (1)><PGN (3)><destination (1)><source (1)><time (4)><len (1)><data (len)><CRC (1)><10><03>
-void tN2kMsg::SendInActisenseFormat(N2kStream *port) const {
+void tN2kMsg::SendInActisenseFormat(N2kStream *port, bool UseRxTime) const {
   unsigned long _PGN=PGN;
-  unsigned long _MsgTime=MsgTime;
+  unsigned long _MsgTime=( UseRxTime?GetMsgTimeMs():MsgTime );
   uint8_t msgIdx=0;
   int byteSum = 0;
   uint8_t CheckSum;
@@ -43,6 +43,7 @@
 
 #include "N2kStream.h"
 #include "N2kDef.h"
+#include "NMEA2000_CompilerDefns.h"
 #include <stdint.h>
 
 /** \brief  Constant "Not Available" for a double value*/
@@ -728,6 +729,15 @@ public:
   unsigned char Data[MaxDataLen];
   /** \brief timestamp (ms since start [max 49days]) of the NMEA2000 message*/
   unsigned long MsgTime;
+#if !defined(N2K_NO_RX_TIMESTAMP)
+  /** \brief Receive time (N2kMicros64) of the first frame of received message.
+   * 0 for messages not received from bus. */
+  uint64_t RxStartTime;
+  /** \brief Receive time (N2kMicros64) of the last frame of received message.
+   * For single frame message this is same as \ref RxStartTime. 0 for messages
+   * not received from bus. */
+  uint64_t RxTime;
+#endif
 protected:
   /** \brief Fills the whole data buffer with 0xff*/
   void ResetData();
@@ -800,7 +810,8 @@ public:
 
   /************************************************************************//**
    * \brief Clears the content of the N2kMsg object
-   * The method sets the \ref PGN, \ref DataLen and \ref MsgTime to zero.
+   * The method sets the \ref PGN, \ref DataLen, \ref MsgTime and receive
+   * times to zero.
    */
   virtual void Clear();
 
@@ -812,6 +823,19 @@ public:
    */
   bool IsValid() const { return (PGN!=0 && DataLen>0); }
 
+  /************************************************************************//**
+   * \brief Get message time in milliseconds for stream formats
+   * 
+   * Returns receive time of the last frame in milliseconds, if message has
+   * been received from bus. Otherwise returns \ref MsgTime.
+   */
+  unsigned long GetMsgTimeMs() const {
+#if !defined(N2K_NO_RX_TIMESTAMP)
+    if ( RxTime!=0 ) return (unsigned long)(RxTime/1000);
+#endif
+    return MsgTime;
+  }
+
   /************************************************************************//**
    * \brief Get the Remaining Data Length 
    * 
@@ -1366,9 +1390,14 @@ public:
    * \brief Print out the whole content of the N2kMsg Object
    * using the Actisense Format
    * 
+   * As default \ref MsgTime will be written as message time.
+   * 
    * \param port      port where to stream, see \ref N2kStream
+   * \param UseRxTime if true, message time will be written with 
+   *                  \ref GetMsgTimeMs, so received messages have frame
+   *                  receive time.
    */
-  void SendInActisenseFormat(N2kStream *port) const;
+  void SendInActisenseFormat(N2kStream *port, bool UseRxTime=false) const;
 };
 
 /************************************************************************//**
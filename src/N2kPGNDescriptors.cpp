@@ -0,0 +1,518 @@
+/*
+ * N2kPGNDescriptors.cpp
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "N2kPGNDescriptors.h"
+#include <math.h>
+#include <string.h>
+
+#define N2kArrayCount(a) (sizeof(a)/sizeof(a[0]))
+
+//*****************************************************************************
+// Tables and names are on PROGMEM, so they must be read with pgm_read_*.
+#define N2kFieldName(Name) static const char FieldName##Name[] PROGMEM=#Name;
+N2kFieldName(Actual) N2kFieldName(AirTemperature) N2kFieldName(AngleOrder) N2kFieldName(BoostPressure)
+N2kFieldName(Capacity) N2kFieldName(COG) N2kFieldName(Current) N2kFieldName(Date)
+N2kFieldName(Delay) N2kFieldName(DelaySource) N2kFieldName(Depth) N2kFieldName(Deviation)
+N2kFieldName(DirectionOrder) N2kFieldName(FluidType) N2kFieldName(GroundReferenced) N2kFieldName(Heading)
+N2kFieldName(Heave) N2kFieldName(Humidity) N2kFieldName(HumiditySource) N2kFieldName(Instance)
+N2kFieldName(Latitude) N2kFieldName(Level) N2kFieldName(LocalOffset) N2kFieldName(Longitude)
+N2kFieldName(Offset) N2kFieldName(Pitch) N2kFieldName(Position) N2kFieldName(Pressure)
+N2kFieldName(Range) N2kFieldName(Rate) N2kFieldName(Reference) N2kFieldName(Reserved)
+N2kFieldName(Roll) N2kFieldName(Set) N2kFieldName(SID) N2kFieldName(SOG)
+N2kFieldName(Source) N2kFieldName(Speed) N2kFieldName(Temperature) N2kFieldName(TemperatureSource)
+N2kFieldName(TiltTrim) N2kFieldName(Time) N2kFieldName(Variation) N2kFieldName(Voltage)
+N2kFieldName(WaterReferenced) N2kFieldName(WaterTemperature) N2kFieldName(WindAngle) N2kFieldName(WindSpeed)
+N2kFieldName(Yaw)
+
+//*****************************************************************************
+// Field tables. Layouts must match SetN2kPGN* functions on N2kMessages.cpp.
+static const tN2kFieldDescriptor Fields126992[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameSource,1,8,4,N2kfdt_Lookup},
+  {FieldNameReserved,1,12,4,N2kfdt_Reserved},
+  {FieldNameDate,1,16,16,N2kfdt_Unsigned},
+  {FieldNameTime,0.0001,32,32,N2kfdt_Unsigned}
+};
+
+static const tN2kFieldDescriptor Fields127245[] PROGMEM={
+  {FieldNameInstance,1,0,8,N2kfdt_Unsigned},
+  {FieldNameDirectionOrder,1,8,3,N2kfdt_Lookup},
+  {FieldNameReserved,1,11,5,N2kfdt_Reserved},
+  {FieldNameAngleOrder,0.0001,16,16,N2kfdt_Signed},
+  {FieldNamePosition,0.0001,32,16,N2kfdt_Signed},
+  {FieldNameReserved,1,48,16,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields127250[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameHeading,0.0001,8,16,N2kfdt_Unsigned},
+  {FieldNameDeviation,0.0001,24,16,N2kfdt_Signed},
+  {FieldNameVariation,0.0001,40,16,N2kfdt_Signed},
+  {FieldNameReference,1,56,2,N2kfdt_Lookup},
+  {FieldNameReserved,1,58,6,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields127251[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameRate,3.125E-08,8,32,N2kfdt_Signed},
+  {FieldNameReserved,1,40,24,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields127252[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameHeave,0.01,8,16,N2kfdt_Signed},
+  {FieldNameDelay,0.01,24,16,N2kfdt_Unsigned},
+  {FieldNameDelaySource,1,40,4,N2kfdt_Lookup},
+  {FieldNameReserved,1,44,20,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields127257[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameYaw,0.0001,8,16,N2kfdt_Signed},
+  {FieldNamePitch,0.0001,24,16,N2kfdt_Signed},
+  {FieldNameRoll,0.0001,40,16,N2kfdt_Signed},
+  {FieldNameReserved,1,56,8,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields127488[] PROGMEM={
+  {FieldNameInstance,1,0,8,N2kfdt_Unsigned},
+  {FieldNameSpeed,0.25,8,16,N2kfdt_Unsigned},
+  {FieldNameBoostPressure,100,24,16,N2kfdt_Unsigned},
+  {FieldNameTiltTrim,1,40,8,N2kfdt_Signed},
+  {FieldNameReserved,1,48,16,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields127505[] PROGMEM={
+  {FieldNameInstance,1,0,4,N2kfdt_Unsigned},
+  {FieldNameFluidType,1,4,4,N2kfdt_Lookup},
+  {FieldNameLevel,0.004,8,16,N2kfdt_Signed},
+  {FieldNameCapacity,0.1,24,32,N2kfdt_Unsigned},
+  {FieldNameReserved,1,56,8,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields127508[] PROGMEM={
+  {FieldNameInstance,1,0,8,N2kfdt_Unsigned},
+  {FieldNameVoltage,0.01,8,16,N2kfdt_Signed},
+  {FieldNameCurrent,0.1,24,16,N2kfdt_Signed},
+  {FieldNameTemperature,0.01,40,16,N2kfdt_Unsigned},
+  {FieldNameSID,1,56,8,N2kfdt_Unsigned}
+};
+
+static const tN2kFieldDescriptor Fields128259[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameWaterReferenced,0.01,8,16,N2kfdt_Unsigned},
+  {FieldNameGroundReferenced,0.01,24,16,N2kfdt_Unsigned},
+  {FieldNameReference,1,40,8,N2kfdt_Lookup},
+  {FieldNameReserved,1,48,16,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields128267[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameDepth,0.01,8,32,N2kfdt_Unsigned},
+  {FieldNameOffset,0.001,40,16,N2kfdt_Signed},
+  {FieldNameRange,10,56,8,N2kfdt_Unsigned}
+};
+
+static const tN2kFieldDescriptor Fields129025[] PROGMEM={
+  {FieldNameLatitude,1e-7,0,32,N2kfdt_Signed},
+  {FieldNameLongitude,1e-7,32,32,N2kfdt_Signed}
+};
+
+static const tN2kFieldDescriptor Fields129026[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameReference,1,8,2,N2kfdt_Lookup},
+  {FieldNameReserved,1,10,6,N2kfdt_Reserved},
+  {FieldNameCOG,0.0001,16,16,N2kfdt_Unsigned},
+  {FieldNameSOG,0.01,32,16,N2kfdt_Unsigned},
+  {FieldNameReserved,1,48,16,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields129033[] PROGMEM={
+  {FieldNameDate,1,0,16,N2kfdt_Unsigned},
+  {FieldNameTime,0.0001,16,32,N2kfdt_Unsigned},
+  {FieldNameLocalOffset,1,48,16,N2kfdt_Signed}
+};
+
+static const tN2kFieldDescriptor Fields130306[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameWindSpeed,0.01,8,16,N2kfdt_Unsigned},
+  {FieldNameWindAngle,0.0001,24,16,N2kfdt_Unsigned},
+  {FieldNameReference,1,40,8,N2kfdt_Lookup},
+  {FieldNameReserved,1,48,16,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields130310[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameWaterTemperature,0.01,8,16,N2kfdt_Unsigned},
+  {FieldNameAirTemperature,0.01,24,16,N2kfdt_Unsigned},
+  {FieldNamePressure,100,40,16,N2kfdt_Unsigned},
+  {FieldNameReserved,1,56,8,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields130311[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameTemperatureSource,1,8,6,N2kfdt_Lookup},
+  {FieldNameHumiditySource,1,14,2,N2kfdt_Lookup},
+  {FieldNameTemperature,0.01,16,16,N2kfdt_Unsigned},
+  {FieldNameHumidity,0.004,32,16,N2kfdt_Signed},
+  {FieldNamePressure,100,48,16,N2kfdt_Unsigned}
+};
+
+static const tN2kFieldDescriptor Fields130312[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameInstance,1,8,8,N2kfdt_Unsigned},
+  {FieldNameSource,1,16,8,N2kfdt_Lookup},
+  {FieldNameActual,0.01,24,16,N2kfdt_Unsigned},
+  {FieldNameSet,0.01,40,16,N2kfdt_Unsigned},
+  {FieldNameReserved,1,56,8,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields130313[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameInstance,1,8,8,N2kfdt_Unsigned},
+  {FieldNameSource,1,16,8,N2kfdt_Lookup},
+  {FieldNameActual,0.004,24,16,N2kfdt_Signed},
+  {FieldNameSet,0.004,40,16,N2kfdt_Signed},
+  {FieldNameReserved,1,56,8,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields130314[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameInstance,1,8,8,N2kfdt_Unsigned},
+  {FieldNameSource,1,16,8,N2kfdt_Lookup},
+  {FieldNamePressure,0.1,24,32,N2kfdt_Signed},
+  {FieldNameReserved,1,56,8,N2kfdt_Reserved}
+};
+
+static const tN2kFieldDescriptor Fields130316[] PROGMEM={
+  {FieldNameSID,1,0,8,N2kfdt_Unsigned},
+  {FieldNameInstance,1,8,8,N2kfdt_Unsigned},
+  {FieldNameSource,1,16,8,N2kfdt_Lookup},
+  {FieldNameActual,0.001,24,24,N2kfdt_Unsigned},
+  {FieldNameSet,0.1,48,16,N2kfdt_Unsigned}
+};
+
+//*****************************************************************************
+// PGN names
+#define N2kPGNName(PGN,Name) static const char PGNName##PGN[] PROGMEM=Name;
+N2kPGNName(126992,"System Time")
+N2kPGNName(127245,"Rudder")
+N2kPGNName(127250,"Vessel Heading")
+N2kPGNName(127251,"Rate of Turn")
+N2kPGNName(127252,"Heave")
+N2kPGNName(127257,"Attitude")
+N2kPGNName(127488,"Engine Parameters, Rapid Update")
+N2kPGNName(127505,"Fluid Level")
+N2kPGNName(127508,"Battery Status")
+N2kPGNName(128259,"Speed")
+N2kPGNName(128267,"Water Depth")
+N2kPGNName(129025,"Position, Rapid Update")
+N2kPGNName(129026,"COG & SOG, Rapid Update")
+N2kPGNName(129033,"Time & Date")
+N2kPGNName(130306,"Wind Data")
+N2kPGNName(130310,"Environmental Parameters")
+N2kPGNName(130311,"Environmental Parameters")
+N2kPGNName(130312,"Temperature")
+N2kPGNName(130313,"Humidity")
+N2kPGNName(130314,"Actual Pressure")
+N2kPGNName(130316,"Temperature, Extended Range")
+
+//*****************************************************************************
+#define N2kPGNDescriptor(PGN,Priority,DataLen) { PGN##L, PGNName##PGN, Priority, DataLen, N2kArrayCount(Fields##PGN), Fields##PGN }
+
+// Must be ordered by PGN for N2kFindPGNDescriptor
+static const tN2kPGNDescriptor PGNDescriptors[] PROGMEM={
+  N2kPGNDescriptor(126992,3,8),
+  N2kPGNDescriptor(127245,2,8),
+  N2kPGNDescriptor(127250,2,8),
+  N2kPGNDescriptor(127251,2,8),
+  N2kPGNDescriptor(127252,3,8),
+  N2kPGNDescriptor(127257,3,8),
+  N2kPGNDescriptor(127488,2,8),
+  N2kPGNDescriptor(127505,6,8),
+  N2kPGNDescriptor(127508,6,8),
+  N2kPGNDescriptor(128259,2,8),
+  N2kPGNDescriptor(128267,3,8),
+  N2kPGNDescriptor(129025,2,8),
+  N2kPGNDescriptor(129026,2,8),
+  N2kPGNDescriptor(129033,3,8),
+  N2kPGNDescriptor(130306,2,8),
+  N2kPGNDescriptor(130310,5,8),
+  N2kPGNDescriptor(130311,5,8),
+  N2kPGNDescriptor(130312,5,8),
+  N2kPGNDescriptor(130313,5,8),
+  N2kPGNDescriptor(130314,5,8),
+  N2kPGNDescriptor(130316,5,8)
+};
+
+//*****************************************************************************
+const tN2kPGNDescriptor *N2kFindPGNDescriptor(unsigned long PGN) {
+  uint8_t Low=0;
+  uint8_t High=N2kArrayCount(PGNDescriptors);
+
+  while ( Low<High ) {
+    uint8_t Mid=(Low+High)/2;
+    unsigned long MidPGN=pgm_read_dword(&PGNDescriptors[Mid].PGN);
+    if ( MidPGN==PGN ) return &PGNDescriptors[Mid];
+    if ( MidPGN<PGN ) { Low=Mid+1; } else { High=Mid; }
+  }
+
+  return 0;
+}
+
+//*****************************************************************************
+uint8_t N2kGetPGNDescriptorCount() {
+  return N2kArrayCount(PGNDescriptors);
+}
+
+//*****************************************************************************
+const tN2kPGNDescriptor *N2kGetPGNDescriptor(uint8_t Index) {
+  return ( Index<N2kArrayCount(PGNDescriptors) ? &PGNDescriptors[Index] : 0 );
+}
+
+//*****************************************************************************
+static void CopyProgmem(void *Dst, const void *Src, size_t Size) {
+  for ( size_t i=0; i<Size; i++ ) ((uint8_t *)Dst)[i]=pgm_read_byte(&((const uint8_t *)Src)[i]);
+}
+
+//*****************************************************************************
+void N2kReadPGNDescriptor(const tN2kPGNDescriptor &Src, tN2kPGNDescriptor &Descriptor) {
+  CopyProgmem(&Descriptor,&Src,sizeof(tN2kPGNDescriptor));
+}
+
+//*****************************************************************************
+void N2kReadFieldDescriptor(const tN2kFieldDescriptor &Src, tN2kFieldDescriptor &Field) {
+  CopyProgmem(&Field,&Src,sizeof(tN2kFieldDescriptor));
+}
+
+//*****************************************************************************
+static inline uint64_t BitMask(uint8_t BitLength) {
+  return ( BitLength>=64 ? ~(uint64_t)0 : ((uint64_t)1<<BitLength)-1 );
+}
+
+//*****************************************************************************
+uint64_t N2kGetBits(const unsigned char *Data, uint16_t BitOffset, uint8_t BitLength) {
+  const unsigned char *p=Data+(BitOffset>>3);
+  uint8_t Shift=BitOffset&0x07;
+  uint8_t Bytes=(Shift+BitLength+7)>>3;
+  uint64_t Value=0;
+
+  for ( uint8_t i=0; i<Bytes && i<8; i++ ) Value|=(uint64_t)p[i]<<(8*i);
+  Value>>=Shift;
+  // Unaligned 57-64 bit field spans 9 bytes. Shift is then always >0.
+  if ( Bytes>8 ) Value|=(uint64_t)p[8]<<(64-Shift);
+
+  return Value & BitMask(BitLength);
+}
+
+//*****************************************************************************
+void N2kSetBits(unsigned char *Data, uint16_t BitOffset, uint8_t BitLength, uint64_t Value) {
+  unsigned char *p=Data+(BitOffset>>3);
+  uint8_t Shift=BitOffset&0x07;
+  uint8_t Bytes=(Shift+BitLength+7)>>3;
+  uint64_t Mask=BitMask(BitLength);
+  Value&=Mask;
+
+  for ( uint8_t i=0; i<Bytes; i++ ) {
+    uint8_t ByteMask, ByteValue;
+    if ( i==0 ) {
+      ByteMask=(uint8_t)(Mask<<Shift);
+      ByteValue=(uint8_t)(Value<<Shift);
+    } else {
+      uint8_t s=8*i-Shift;
+      ByteMask=(uint8_t)(Mask>>s);
+      ByteValue=(uint8_t)(Value>>s);
+    }
+    p[i]=(p[i] & ~ByteMask) | ByteValue;
+  }
+}
+
+//*****************************************************************************
+// Field has been read to RAM.
+static double DecodeField(const tN2kMsg &N2kMsg, const tN2kFieldDescriptor &Field) {
+  if ( Field.Type==N2kfdt_Reserved || Field.BitOffset+Field.BitLength>N2kMsg.DataLen*8 ) return N2kDoubleNA;
+
+  uint64_t Raw=N2kGetBits(N2kMsg.Data,Field.BitOffset,Field.BitLength);
+
+  switch ( Field.Type ) {
+    case N2kfdt_Unsigned:
+      if ( Raw==BitMask(Field.BitLength) ) return N2kDoubleNA;
+      return (double)Raw*Field.Resolution;
+    case N2kfdt_Signed: {
+        uint64_t Max=BitMask(Field.BitLength-1);
+        if ( Raw==Max ) return N2kDoubleNA;
+        int64_t Value=( Raw>Max ? (int64_t)(Raw | ~BitMask(Field.BitLength)) : (int64_t)Raw );
+        return (double)Value*Field.Resolution;
+      }
+    default:
+      return (double)Raw;
+  }
+}
+
+//*****************************************************************************
+double N2kDecodeField(const tN2kMsg &N2kMsg, const tN2kFieldDescriptor &Field) {
+  tN2kFieldDescriptor RamField;
+  N2kReadFieldDescriptor(Field,RamField);
+  return DecodeField(N2kMsg,RamField);
+}
+
+//*****************************************************************************
+uint8_t N2kDecodeFields(const tN2kMsg &N2kMsg, const tN2kPGNDescriptor &Descriptor, double *Values, uint8_t MaxValues) {
+  tN2kPGNDescriptor RamDescriptor;
+  N2kReadPGNDescriptor(Descriptor,RamDescriptor);
+  if ( N2kMsg.PGN!=RamDescriptor.PGN || Values==0 ) return 0;
+
+  uint8_t Count=( RamDescriptor.FieldCount<MaxValues ? RamDescriptor.FieldCount : MaxValues );
+  for ( uint8_t i=0; i<Count; i++ ) Values[i]=N2kDecodeField(N2kMsg,RamDescriptor.Fields[i]);
+
+  return Count;
+}
+
+//*****************************************************************************
+// Conversion must match SetBuf*Double functions on N2kMsg.cpp, so that
+// encoded data is identical with SetN2kPGN* functions.
+static uint64_t EncodeValue(const tN2kFieldDescriptor &Field, double v) {
+  uint64_t Mask=BitMask(Field.BitLength);
+
+  if ( v==N2kDoubleNA ) {
+    return ( Field.Type==N2kfdt_Signed ? BitMask(Field.BitLength-1) : Mask );
+  }
+
+  switch ( Field.Type ) {
+    case N2kfdt_Unsigned: {
+        double vd=round(v/Field.Resolution);
+        uint64_t OR=Mask-1;
+        return ( vd>=0 && vd<(double)OR ? (uint64_t)vd : OR );
+      }
+    case N2kfdt_Signed: {
+        double vd=round(v/Field.Resolution);
+        int64_t OR=(int64_t)BitMask(Field.BitLength-1)-1;
+        int64_t Min=-OR-2;
+        int64_t Value=( vd>=(double)Min && vd<(double)OR ? (int64_t)vd : OR );
+        return (uint64_t)Value & Mask;
+      }
+    case N2kfdt_Lookup:
+      return (uint64_t)(int64_t)v & Mask;
+    default:
+      return Mask;
+  }
+}
+
+//*****************************************************************************
+void N2kEncodeFields(tN2kMsg &N2kMsg, const tN2kPGNDescriptor &Descriptor, const double *Values) {
+  tN2kPGNDescriptor RamDescriptor;
+  N2kReadPGNDescriptor(Descriptor,RamDescriptor);
+  N2kMsg.SetPGN(RamDescriptor.PGN);
+  N2kMsg.Priority=RamDescriptor.Priority;
+  N2kMsg.DataLen=RamDescriptor.DataLen;
+  memset(N2kMsg.Data,0xff,RamDescriptor.DataLen);
+
+  for ( uint8_t i=0; i<RamDescriptor.FieldCount; i++ ) {
+    tN2kFieldDescriptor Field;
+    N2kReadFieldDescriptor(RamDescriptor.Fields[i],Field);
+    if ( Field.Type==N2kfdt_Reserved ) continue;
+    N2kSetBits(N2kMsg.Data,Field.BitOffset,Field.BitLength,EncodeValue(Field,Values[i]));
+  }
+}
+
+//*****************************************************************************
+static void PrintUInt64(N2kStream *Stream, uint64_t Value, uint8_t MinDigits=1) {
+  char Buf[21];
+  uint8_t Pos=sizeof(Buf)-1;
+
+  Buf[Pos]=0;
+  do {
+    Buf[--Pos]='0'+(Value%10);
+    Value/=10;
+    if ( MinDigits>0 ) MinDigits--;
+  } while ( Value!=0 || MinDigits>0 );
+
+  Stream->print(Buf+Pos);
+}
+
+//*****************************************************************************
+// Number of decimals needed to show full resolution, max 9.
+static uint8_t ResolutionDecimals(double Resolution) {
+  uint8_t Decimals=0;
+  double Scaled=Resolution;
+
+  for ( ; Decimals<9 && fabs(Scaled-round(Scaled))>1e-6*Scaled; Decimals++, Scaled*=10 );
+
+  return Decimals;
+}
+
+//*****************************************************************************
+static void PrintValue(N2kStream *Stream, double Value, uint8_t Decimals) {
+  uint64_t Pow10=1;
+  for ( uint8_t i=0; i<Decimals; i++ ) Pow10*=10;
+
+  if ( Value<0 ) { Stream->print(F("-")); Value=-Value; }
+  uint64_t Scaled=(uint64_t)round(Value*Pow10);
+  PrintUInt64(Stream,Scaled/Pow10);
+  if ( Decimals>0 ) {
+    Stream->print(F("."));
+    PrintUInt64(Stream,Scaled%Pow10,Decimals);
+  }
+}
+
+//*****************************************************************************
+// Names are short, so they fit to buffer.
+static void PrintProgmemString(N2kStream *Stream, const char *str) {
+  char Buf[32];
+  uint8_t i=0;
+  char c;
+
+  for ( ; i<sizeof(Buf)-1 && (c=pgm_read_byte(&str[i]))!=0; i++ ) Buf[i]=c;
+  Buf[i]=0;
+  Stream->print(Buf);
+}
+
+//*****************************************************************************
+bool N2kPrintFields(const tN2kMsg &N2kMsg, N2kStream *Stream) {
+  const tN2kPGNDescriptor *pDescriptor=N2kFindPGNDescriptor(N2kMsg.PGN);
+  if ( pDescriptor==0 || Stream==0 ) return false;
+
+  tN2kPGNDescriptor Descriptor;
+  N2kReadPGNDescriptor(*pDescriptor,Descriptor);
+  PrintUInt64(Stream,Descriptor.PGN);
+  Stream->print(F(" "));
+  PrintProgmemString(Stream,Descriptor.Name);
+  Stream->print(F(":"));
+  for ( uint8_t i=0; i<Descriptor.FieldCount; i++ ) {
+    tN2kFieldDescriptor Field;
+    N2kReadFieldDescriptor(Descriptor.Fields[i],Field);
+    if ( Field.Type==N2kfdt_Reserved ) continue;
+
+    Stream->print(F(" "));
+    PrintProgmemString(Stream,Field.Name);
+    Stream->print(F("="));
+    double Value=DecodeField(N2kMsg,Field);
+    if ( Value==N2kDoubleNA ) {
+      Stream->print(F("NA"));
+    } else {
+      PrintValue(Stream,Value,( Field.Type==N2kfdt_Lookup ? 0 : ResolutionDecimals(Field.Resolution) ));
+    }
+  }
+  Stream->println();
+
+  return true;
+}
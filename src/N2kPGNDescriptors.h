@@ -0,0 +1,223 @@
+/*
+ * N2kPGNDescriptors.h
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+/*************************************************************************//**
+ * \file  N2kPGNDescriptors.h
+ * \brief Table driven field descriptors for fixed layout PGNs and generic
+ *        decode/encode engine over them.
+ *
+ * Each described PGN has a compact schema, which lists for each field bit
+ * offset, bit width, signedness and resolution. "Data not available" (NA)
+ * and "out of range" (OR) sentinels are derived from width and signedness
+ * same way as with \ref tN2kMsg Get/Add functions: for unsigned fields NA is
+ * all ones and for signed fields max positive value. OR is NA-1.
+ *
+ * Engine can be used e.g. for logging any known PGN without message specific
+ * code. Hand written SetN2kPGN* / ParseN2kPGN* functions on
+ * \ref N2kMessages.h are still faster and should be used on normal message
+ * handling. Engine produces same data and values as them for the described
+ * PGNs.
+ *
+ * Only PGNs with fixed single frame layout are described. Variable length
+ * and repeating field PGNs (e.g. 129029) are not supported.
+ *
+ * Descriptor tables and names are on PROGMEM. Engine functions expect
+ * descriptors on PROGMEM and on AVR descriptor members can not be accessed
+ * directly. Use \ref N2kReadPGNDescriptor and \ref N2kReadFieldDescriptor
+ * to read them to RAM.
+ */
+
+#ifndef _N2kPGNDescriptors_H_
+#define _N2kPGNDescriptors_H_
+
+#include "N2kMsg.h"
+#include "N2kStream.h"
+#include <stdint.h>
+
+/** \brief Max number of fields on single descriptor. */
+#define N2kMaxDescriptorFields 16
+
+/************************************************************************//**
+ * \brief Field types on \ref tN2kFieldDescriptor
+ */
+typedef enum {
+  N2kfdt_Unsigned=0,   ///< Unsigned value scaled with resolution. NA is all ones.
+  N2kfdt_Signed=1,     ///< Signed value scaled with resolution. NA is max positive.
+  N2kfdt_Lookup=2,     ///< Unsigned enumeration or bit field. No NA handling.
+  N2kfdt_Reserved=3    ///< Reserved bits. Encoded as all ones and not decoded.
+} tN2kFieldType;
+
+/************************************************************************//**
+ * \brief Descriptor of single field on PGN data
+ *
+ * Fields are little endian as all NMEA 2000 fields. Field can start from
+ * any bit and be 1 - 64 bits wide.
+ */
+struct tN2kFieldDescriptor {
+  /** \brief Field name for logging on PROGMEM */
+  const char *Name;
+  /** \brief Resolution of one raw bit. Use 1 for integers and lookups. */
+  double Resolution;
+  /** \brief Bit offset of the field from start of data */
+  uint16_t BitOffset;
+  /** \brief Field width in bits */
+  uint8_t BitLength;
+  /** \brief Field type, see \ref tN2kFieldType */
+  uint8_t Type;
+};
+
+/************************************************************************//**
+ * \brief Descriptor of fixed layout PGN
+ */
+struct tN2kPGNDescriptor {
+  /** \brief PGN */
+  unsigned long PGN;
+  /** \brief PGN name for logging on PROGMEM */
+  const char *Name;
+  /** \brief Default priority used on encoding */
+  uint8_t Priority;
+  /** \brief Data length in bytes used on encoding */
+  uint8_t DataLen;
+  /** \brief Number of fields on \ref Fields */
+  uint8_t FieldCount;
+  /** \brief Fields in order of bit offset */
+  const tN2kFieldDescriptor *Fields;
+};
+
+/************************************************************************//**
+ * \brief Find descriptor for PGN
+ *
+ * \param PGN   PGN to look for
+ * \return Pointer to descriptor or 0, if PGN has not been described.
+ */
+const tN2kPGNDescriptor *N2kFindPGNDescriptor(unsigned long PGN);
+
+/************************************************************************//**
+ * \brief Get number of built in descriptors
+ */
+uint8_t N2kGetPGNDescriptorCount();
+
+/************************************************************************//**
+ * \brief Get built in descriptor by index
+ *
+ * Descriptors are ordered by PGN.
+ *
+ * \param Index   Index 0 - (N2kGetPGNDescriptorCount()-1)
+ * \return Pointer to descriptor or 0 for invalid index
+ */
+const tN2kPGNDescriptor *N2kGetPGNDescriptor(uint8_t Index);
+
+/************************************************************************//**
+ * \brief Read descriptor from PROGMEM to RAM
+ *
+ * Name and Fields of read descriptor still point to PROGMEM.
+ *
+ * \param Src         Descriptor on PROGMEM
+ * \param Descriptor  Descriptor to read to
+ */
+void N2kReadPGNDescriptor(const tN2kPGNDescriptor &Src, tN2kPGNDescriptor &Descriptor);
+
+/************************************************************************//**
+ * \brief Read field descriptor from PROGMEM to RAM
+ *
+ * Name of read field still points to PROGMEM.
+ *
+ * \param Src    Field descriptor on PROGMEM, e.g. Descriptor.Fields[i]
+ * \param Field  Field descriptor to read to
+ */
+void N2kReadFieldDescriptor(const tN2kFieldDescriptor &Src, tN2kFieldDescriptor &Field);
+
+/************************************************************************//**
+ * \brief Read raw little endian bit field from buffer
+ *
+ * \param Data        Data buffer
+ * \param BitOffset   Bit offset of the field
+ * \param BitLength   Field width 1 - 64 bits
+ * \return Field raw value
+ */
+uint64_t N2kGetBits(const unsigned char *Data, uint16_t BitOffset, uint8_t BitLength);
+
+/************************************************************************//**
+ * \brief Write raw little endian bit field to buffer
+ *
+ * Bits outside of the field will be kept unchanged.
+ *
+ * \param Data        Data buffer
+ * \param BitOffset   Bit offset of the field
+ * \param BitLength   Field width 1 - 64 bits
+ * \param Value       Raw value. Bits above BitLength will be ignored.
+ */
+void N2kSetBits(unsigned char *Data, uint16_t BitOffset, uint8_t BitLength, uint64_t Value);
+
+/************************************************************************//**
+ * \brief Decode single field of message
+ *
+ * \param N2kMsg    Message to decode
+ * \param Field     Field descriptor on PROGMEM
+ * \return Scaled value. N2kDoubleNA, if value is not available, field is
+ *         reserved or message is too short for the field.
+ */
+double N2kDecodeField(const tN2kMsg &N2kMsg, const tN2kFieldDescriptor &Field);
+
+/************************************************************************//**
+ * \brief Decode all fields of message
+ *
+ * Value of field i will be stored to Values[i], so values can be accessed
+ * by field index. Reserved fields will be set to N2kDoubleNA.
+ *
+ * \param N2kMsg      Message to decode
+ * \param Descriptor  Descriptor for message PGN on PROGMEM
+ * \param Values      Buffer for decoded values
+ * \param MaxValues   Size of Values buffer
+ * \return Number of decoded values. 0, if message PGN does not match
+ *         descriptor.
+ */
+uint8_t N2kDecodeFields(const tN2kMsg &N2kMsg, const tN2kPGNDescriptor &Descriptor, double *Values, uint8_t MaxValues);
+
+/************************************************************************//**
+ * \brief Encode message from field values
+ *
+ * Message will be initialized with descriptor PGN, priority and data length.
+ * Values must contain value for each field on descriptor. Use N2kDoubleNA
+ * for unavailable values. Values, which can not be presented with field, will
+ * be set to OR. Values for reserved fields will be ignored.
+ *
+ * \param N2kMsg      Message to encode
+ * \param Descriptor  Descriptor for message PGN on PROGMEM
+ * \param Values      Field values in order of descriptor fields
+ */
+void N2kEncodeFields(tN2kMsg &N2kMsg, const tN2kPGNDescriptor &Descriptor, const double *Values);
+
+/************************************************************************//**
+ * \brief Print described message as single text line
+ *
+ * Line will be like "127250 Vessel Heading: SID=1 Heading=1.2340
+ * Deviation=NA Variation=0.0120 Reference=0". Reserved fields will not be
+ * printed.
+ *
+ * \param N2kMsg    Message to print
+ * \param Stream    Output stream
+ * \return true, if message PGN has been described and message was printed.
+ */
+bool N2kPrintFields(const tN2kMsg &N2kMsg, N2kStream *Stream);
+
+#endif
@@ -33,6 +33,8 @@ uint64_t tN2kSyncScheduler::SyncOffset=0;
   uint64_t N2kMillis64() { return time_us_64() / 1000; }
   // Mask the 64-bit value to get the lower 32 bits
   uint32_t N2kMillis() { return (N2kMillis64() & 0xFFFFFFFF); }
+  uint32_t N2kMicros() { return time_us_64(); }
+  uint64_t N2kMicros64() { return time_us_64(); }
 #elif defined(__linux__) || defined(__linux) || defined(linux)
   #include <time.h>
   uint64_t N2kMillis64() {
@@ -42,6 +44,15 @@ uint64_t tN2kSyncScheduler::SyncOffset=0;
     return (((uint64_t)ticker.tv_sec * 1000) + (ticker.tv_nsec / 1000000));
   }
 uint32_t N2kMillis() { return N2kMillis64(); }
+  uint32_t N2kMicros() {
+    return N2kMicros64();
+  }
+  uint64_t N2kMicros64() {
+    struct timespec ticker;
+
+    clock_gettime(CLOCK_MONOTONIC, &ticker);
+    return (((uint64_t)ticker.tv_sec * 1000000) + (ticker.tv_nsec / 1000));
+  }
 #else 
   #if defined(ARDUINO)
     // N2kMillis() as inline on header
@@ -51,6 +62,7 @@ uint32_t N2kMillis() { return N2kMillis64(); }
     extern uint32_t millis();
     }
     uint32_t N2kMillis() { return millis(); }
+    uint32_t N2kMicros() { return millis()*1000; }
   #endif
 
   uint64_t N2kMillis64() {
@@ -61,6 +73,19 @@ uint32_t N2kMillis() { return N2kMillis64(); }
     LastRead=Now;
     return ((uint64_t)RollCount)<<32 | Now;
   }
+
+  #if defined(ARDUINO)
+  uint64_t N2kMicros64() {
+    // micros() wraps every ~71.6 minutes, so wrap could be missed between
+    // calls. Upper bits are taken from N2kMillis64() and micros() gives
+    // exact offset from that.
+    uint32_t Now=micros();
+    uint64_t Base=N2kMillis64()*1000;
+    return Base+(int32_t)(Now-(uint32_t)Base);
+  }
+  #else
+  uint64_t N2kMicros64() { return N2kMillis64()*1000; }
+  #endif
 #endif
 
 #if !defined(N2kUse64bitSchedulerTime)
@@ -33,6 +33,12 @@
  * 
  * N2kMillis64() is 64 bit millisecond timer, which practically never
  * roll over.
+ * 
+ * N2kMicros() is 32 bit microsecond timer for short time measurements. 
+ * It rolls over in about 71 minutes.
+ * 
+ * N2kMicros64() is 64 bit microsecond timer used e.g., for frame receive
+ * timestamps. It has same time base as N2kMillis64().
  *  
  * tN2kSyncScheduler uses 64 bit timer for message scheduling. It has offset
  * as defined by NMEA2000. It uses global offset for synchronizing messages
@@ -71,13 +77,20 @@
     return esp_timer_get_time()/1000ULL;
   }
   inline uint32_t N2kMillis() { return N2kMillis64(); }
+  inline uint32_t N2kMicros() { return esp_timer_get_time(); }
+  inline uint64_t N2kMicros64() { return esp_timer_get_time(); }
 #elif defined(ARDUINO)
   #include <Arduino.h>
   uint64_t N2kMillis64();
   inline uint32_t N2kMillis() { return millis(); }
+  inline uint32_t N2kMicros() { return micros(); }
+  uint64_t N2kMicros64();
 #else
   uint64_t N2kMillis64();
   uint32_t N2kMillis();
+  // On platforms without microsecond timer these have millisecond resolution.
+  uint32_t N2kMicros();
+  uint64_t N2kMicros64();
 #endif
 
 #define N2kScheduler64Disabled 0xffffffffffffffffULL
@@ -337,6 +350,25 @@ public:
     #endif
   }
 
+  /************************************************************************//**
+   * \brief Time remaining to next event
+   *
+   * \return Milliseconds until \ref IsTime will return true. 0 when it is
+   *         already time and 0xffffffff when scheduler is disabled.
+   */
+  uint32_t Remaining() const {
+    if ( IsDisabled() ) return 0xffffffffUL;
+    #if defined(N2kUse64bitSchedulerTime)
+    uint64_t now=N2kMillis64();
+    if ( now>NextTime ) return 0;
+    return ( NextTime-now<0xfffffffeULL ? (uint32_t)(NextTime-now)+1 : 0xfffffffeUL );
+    #else
+    uint32_t now=N2kMillis();
+    if ( now-NextTime<INT32_MAX ) return 0;
+    return NextTime-now;
+    #endif
+  }
+
   /************************************************************************//**
    * \brief Set Timestamp for next event relative to now
    *
@@ -23,11 +23,26 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "NMEA2000.h"
 #include "N2kDef.h"
+#include "RingBuffer.h"
 #if !defined(N2K_NO_GROUP_FUNCTION_SUPPORT)
 #include "N2kGroupFunctionDefaultHandlers.h"
 #endif
 #include <string.h>
 #include <stdlib.h>
+// Allocation, which returns 0 on failure. AVR new does that as default
+// and it does not have <new>.
+#if defined(__AVR__)
+#define N2kNewNoThrow new
+#else
+#include <new>
+#define N2kNewNoThrow new (std::nothrow)
+#endif
+#if defined(N2K_THREADED_RECEIVE)
+#include <chrono>
+#if defined(__linux__)
+#include <poll.h>
+#endif
+#endif
 
 // #define DebugStream Serial   // outputs debug messages to the serial console (only for Arduino)
 #define DebugStream (*ForwardStream) // outputs debug messages to same destination as ForwardStream
@@ -104,6 +119,22 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 # define N2kDbgln(fmt, args...)
 #endif
 
+#if !defined(N2K_NO_STATISTICS)
+# define N2kStatsAdd(field, n) Statistics.field+=(n)
+#else
+# define N2kStatsAdd(field, n)
+#endif
+
+#if defined(N2K_LATENCY_STATS)
+# define N2kLatencyReady(N2kMsg) LatencyReady(N2kMsg)
+# define N2kLatencyDone() LatencyEntry=0
+# define N2kTimedHandlerCall(...) do { uint64_t HandlerStart=LatencyHandlerStart(); __VA_ARGS__; LatencyHandlerEnd(HandlerStart); } while (0)
+#else
+# define N2kLatencyReady(N2kMsg)
+# define N2kLatencyDone()
+# define N2kTimedHandlerCall(...) __VA_ARGS__
+#endif
+
 // #define NMEA2000_MEMORY_TEST 1
 
 #if defined(NMEA2000_MEMORY_TEST)
@@ -217,6 +248,264 @@ const unsigned long DefReceiveMessages[] PROGMEM = {
 #endif
                                        0};
 
+/************************************************************************//**
+ * \brief Class of the PGN on \ref DefaultPGNClasses table
+ */
+enum tN2kPGNClass {
+            N2kpgnc_None=0,               ///< PGN is not on default lists
+            N2kpgnc_SingleFrameSystem,    ///< Single frame system message
+            N2kpgnc_FastPacketSystem,     ///< Fast packet system message
+            N2kpgnc_MandatoryFastPacket,  ///< Mandatory fast packet message
+            N2kpgnc_DefaultSingleFrame,   ///< Default single frame message
+            N2kpgnc_DefaultFastPacket     ///< Default fast packet message
+          };
+
+/** \brief Pack PGN and its class to single table entry. PGN takes 17 bits
+ *  and class 3 lowest bits, so table sorted by entries is sorted by PGN. */
+#define N2kPGNClassEntry(PGN,Class) ((((uint32_t)(PGN))<<3) | (Class))
+
+/************************************************************************//**
+ * \brief Default PGN classification table
+ * 
+ * Table contains all system, mandatory and default messages library knows.
+ * It is used for classifying received and sent messages, so it must be kept
+ * sorted by PGN. Direct class map \ref DefaultPGNClassMap will be calculated
+ * from it on compile time.
+ * 
+ * \sa \ref FindDefaultPGNClass
+ */
+constexpr uint32_t DefaultPGNClasses[] PROGMEM = {
+  N2kPGNClassEntry( 59392L,N2kpgnc_SingleFrameSystem),   // ISO Acknowledgement
+  N2kPGNClassEntry( 59904L,N2kpgnc_SingleFrameSystem),   // ISO Request
+  N2kPGNClassEntry(  TP_DT,N2kpgnc_SingleFrameSystem),   // Multi packet data transfer, TP.DT
+  N2kPGNClassEntry(  TP_CM,N2kpgnc_SingleFrameSystem),   // Multi packet connection management, TP.CM
+  N2kPGNClassEntry( 60928L,N2kpgnc_SingleFrameSystem),   // ISO Address Claim
+  N2kPGNClassEntry( 65240L,N2kpgnc_FastPacketSystem),    // Commanded Address
+  N2kPGNClassEntry(126208L,N2kpgnc_FastPacketSystem),    // NMEA Request/Command/Acknowledge group function
+  N2kPGNClassEntry(126464L,N2kpgnc_MandatoryFastPacket), // PGN List (Transmit and Receive), pri=6, period=NA
+  N2kPGNClassEntry(126983L,N2kpgnc_DefaultFastPacket),   // Alert, pri=2, period=1000
+  N2kPGNClassEntry(126984L,N2kpgnc_DefaultFastPacket),   // Alert Response, pri=2, period=NA
+  N2kPGNClassEntry(126985L,N2kpgnc_DefaultFastPacket),   // Alert Text, pri=2, period=10000
+  N2kPGNClassEntry(126986L,N2kpgnc_DefaultFastPacket),   // Alert Configuration, pri=2, period=NA
+  N2kPGNClassEntry(126987L,N2kpgnc_DefaultFastPacket),   // Alert Threshold, pri=2, period=NA
+  N2kPGNClassEntry(126988L,N2kpgnc_DefaultFastPacket),   // Alert Value, pri=2, period=10000
+  N2kPGNClassEntry(126992L,N2kpgnc_DefaultSingleFrame),  // System date/time, pri=3, period=1000
+  N2kPGNClassEntry(126993L,N2kpgnc_DefaultSingleFrame),  // Heartbeat, pri=7, period=60000
+  N2kPGNClassEntry(126996L,N2kpgnc_MandatoryFastPacket), // Product information, pri=6, period=NA
+  N2kPGNClassEntry(126998L,N2kpgnc_MandatoryFastPacket), // Configuration information, pri=6, period=NA
+  N2kPGNClassEntry(127233L,N2kpgnc_DefaultFastPacket),   // Man Overboard Notification(MOB), pri=3, period=NA
+  N2kPGNClassEntry(127237L,N2kpgnc_DefaultFastPacket),   // Heading/Track control, pri=2, period=250
+  N2kPGNClassEntry(127245L,N2kpgnc_DefaultSingleFrame),  // Rudder, pri=2, period=100
+  N2kPGNClassEntry(127250L,N2kpgnc_DefaultSingleFrame),  // Vessel Heading, pri=2, period=100
+  N2kPGNClassEntry(127251L,N2kpgnc_DefaultSingleFrame),  // Rate of Turn, pri=2, period=100
+  N2kPGNClassEntry(127252L,N2kpgnc_DefaultSingleFrame),  // Heave, pri=3, period=100
+  N2kPGNClassEntry(127257L,N2kpgnc_DefaultSingleFrame),  // Attitude, pri=3, period=1000
+  N2kPGNClassEntry(127488L,N2kpgnc_DefaultSingleFrame),  // Engine parameters rapid, rapid Update, pri=2, period=100
+  N2kPGNClassEntry(127489L,N2kpgnc_DefaultFastPacket),   // Engine parameters dynamic, pri=2, period=500
+  N2kPGNClassEntry(127490L,N2kpgnc_DefaultFastPacket),   // Electric Drive Status (Dynamic), pri=1, period=1500
+  N2kPGNClassEntry(127491L,N2kpgnc_DefaultFastPacket),   // Electric Energy Storage Status (Dynamic), pri=7, period=1500
+  N2kPGNClassEntry(127493L,N2kpgnc_DefaultSingleFrame),  // Transmission parameters: dynamic, pri=2, period=100
+  N2kPGNClassEntry(127494L,N2kpgnc_DefaultFastPacket),   // Electric Drive Information, pri=4, period=NA
+  N2kPGNClassEntry(127495L,N2kpgnc_DefaultFastPacket),   // Electric Energy Storage Information, pri=6, period=NA
+  N2kPGNClassEntry(127496L,N2kpgnc_DefaultFastPacket),   // Trip fuel consumption, vessel, pri=5, period=1000
+  N2kPGNClassEntry(127497L,N2kpgnc_DefaultFastPacket),   // Trip fuel consumption, engine, pri=5, period=1000
+  N2kPGNClassEntry(127498L,N2kpgnc_DefaultFastPacket),   // Engine parameters static, pri=5, period=NA
+  N2kPGNClassEntry(127501L,N2kpgnc_DefaultSingleFrame),  // Binary status report, pri=3, period=NA
+  N2kPGNClassEntry(127503L,N2kpgnc_DefaultFastPacket),   // AC Input Status, pri=6, period=1500
+  N2kPGNClassEntry(127504L,N2kpgnc_DefaultFastPacket),   // AC Output Status, pri=6, period=1500
+  N2kPGNClassEntry(127505L,N2kpgnc_DefaultSingleFrame),  // Fluid level, pri=6, period=2500
+  N2kPGNClassEntry(127506L,N2kpgnc_DefaultFastPacket),   // DC Detailed status, pri=6, period=1500
+  N2kPGNClassEntry(127507L,N2kpgnc_DefaultFastPacket),   // Charger status, pri=6, period=1500
+  N2kPGNClassEntry(127508L,N2kpgnc_DefaultSingleFrame),  // Battery Status, pri=6, period=1500
+  N2kPGNClassEntry(127509L,N2kpgnc_DefaultFastPacket),   // Inverter status, pri=6, period=1500
+  N2kPGNClassEntry(127510L,N2kpgnc_DefaultFastPacket),   // Charger configuration status, pri=6, period=NA
+  N2kPGNClassEntry(127511L,N2kpgnc_DefaultFastPacket),   // Inverter Configuration Status, pri=6, period=NA
+  N2kPGNClassEntry(127512L,N2kpgnc_DefaultFastPacket),   // AGS configuration status, pri=6, period=NA
+  N2kPGNClassEntry(127513L,N2kpgnc_DefaultFastPacket),   // Battery configuration status, pri=6, period=NA
+  N2kPGNClassEntry(127514L,N2kpgnc_DefaultFastPacket),   // AGS Status, pri=6, period=1500
+  N2kPGNClassEntry(127750L,N2kpgnc_DefaultSingleFrame),  // Charger status new, pri=6, period=1500
+  N2kPGNClassEntry(128259L,N2kpgnc_DefaultSingleFrame),  // Boat speed, pri=2, period=1000
+  N2kPGNClassEntry(128267L,N2kpgnc_DefaultSingleFrame),  // Water depth, pri=3, period=1000
+  N2kPGNClassEntry(128275L,N2kpgnc_DefaultFastPacket),   // Distance log, pri=6, period=1000
+  N2kPGNClassEntry(128520L,N2kpgnc_DefaultFastPacket),   // Tracked Target Data, pri=2, period=1000
+  N2kPGNClassEntry(128538L,N2kpgnc_DefaultFastPacket),   // Elevator car status, pri=6, period=100
+  N2kPGNClassEntry(129025L,N2kpgnc_DefaultSingleFrame),  // Lat/lon rapid, pri=2, period=100
+  N2kPGNClassEntry(129026L,N2kpgnc_DefaultSingleFrame),  // COG SOG rapid, pri=2, period=250
+  N2kPGNClassEntry(129029L,N2kpgnc_DefaultFastPacket),   // GNSS Position Data, pri=3, period=1000
+  N2kPGNClassEntry(129038L,N2kpgnc_DefaultFastPacket),   // AIS Class A Position Report, pri=4, period=NA
+  N2kPGNClassEntry(129039L,N2kpgnc_DefaultFastPacket),   // AIS Class B Position Report, pri=4, period=NA
+  N2kPGNClassEntry(129040L,N2kpgnc_DefaultFastPacket),   // AIS Class B Extended Position Report, pri=4, period=NA
+  N2kPGNClassEntry(129041L,N2kpgnc_DefaultFastPacket),   // AIS Aids to Navigation (AtoN) Report, pri=4, period=NA
+  N2kPGNClassEntry(129044L,N2kpgnc_DefaultFastPacket),   // Datum, pri=6, period=10000
+  N2kPGNClassEntry(129045L,N2kpgnc_DefaultFastPacket),   // User Datum Settings, pri=6, period=NA
+  N2kPGNClassEntry(129283L,N2kpgnc_DefaultSingleFrame),  // Cross Track Error, pri=3, period=1000
+  N2kPGNClassEntry(129284L,N2kpgnc_DefaultFastPacket),   // Navigation info, pri=3, period=1000
+  N2kPGNClassEntry(129285L,N2kpgnc_DefaultFastPacket),   // Waypoint list, pri=3, period=NA
+  N2kPGNClassEntry(129301L,N2kpgnc_DefaultFastPacket),   // Time to/from Mark, pri=3, period=1000
+  N2kPGNClassEntry(129302L,N2kpgnc_DefaultFastPacket),   // Bearing and Distance between two Marks, pri=6, period=NA
+  N2kPGNClassEntry(129538L,N2kpgnc_DefaultFastPacket),   // GNSS Control Status, pri=6, period=NA
+  N2kPGNClassEntry(129540L,N2kpgnc_DefaultFastPacket),   // GNSS Sats in View, pri=6, period=1000
+  N2kPGNClassEntry(129541L,N2kpgnc_DefaultFastPacket),   // GPS Almanac Data, pri=6, period=NA
+  N2kPGNClassEntry(129542L,N2kpgnc_DefaultFastPacket),   // GNSS Pseudorange Noise Statistics, pri=6, period=1000
+  N2kPGNClassEntry(129545L,N2kpgnc_DefaultFastPacket),   // GNSS RAIM Output, pri=6, period=NA
+  N2kPGNClassEntry(129547L,N2kpgnc_DefaultFastPacket),   // GNSS Pseudorange Error Statistics, pri=6, period=NA
+  N2kPGNClassEntry(129549L,N2kpgnc_DefaultFastPacket),   // DGNSS Corrections, pri=6, period=NA
+  N2kPGNClassEntry(129551L,N2kpgnc_DefaultFastPacket),   // GNSS Differential Correction Receiver Signal, pri=6, period=NA
+  N2kPGNClassEntry(129556L,N2kpgnc_DefaultFastPacket),   // GLONASS Almanac Data, pri=6, period=NA
+  N2kPGNClassEntry(129792L,N2kpgnc_DefaultFastPacket),   // AIS DGNSS Broadcast Binary Message, pri=6, period=NA
+  N2kPGNClassEntry(129793L,N2kpgnc_DefaultFastPacket),   // AIS UTC and Date Report, pri=7, period=NA
+  N2kPGNClassEntry(129794L,N2kpgnc_DefaultFastPacket),   // AIS Class A Static data, pri=6, period=NA
+  N2kPGNClassEntry(129795L,N2kpgnc_DefaultFastPacket),   // AIS Addressed Binary Message, pri=5, period=NA
+  N2kPGNClassEntry(129796L,N2kpgnc_DefaultFastPacket),   // AIS Acknowledge, pri=7, period=NA
+  N2kPGNClassEntry(129797L,N2kpgnc_DefaultFastPacket),   // AIS Binary Broadcast Message, pri=5, period=NA
+  N2kPGNClassEntry(129798L,N2kpgnc_DefaultFastPacket),   // AIS SAR Aircraft Position Report, pri=4, period=NA
+  N2kPGNClassEntry(129799L,N2kpgnc_DefaultFastPacket),   // Radio Frequency/Mode/Power, pri=3, period=NA
+  N2kPGNClassEntry(129800L,N2kpgnc_DefaultFastPacket),   // AIS UTC/Date Inquiry, pri=7, period=NA
+  N2kPGNClassEntry(129801L,N2kpgnc_DefaultFastPacket),   // AIS Addressed Safety Related Message, pri=5, period=NA
+  N2kPGNClassEntry(129802L,N2kpgnc_DefaultFastPacket),   // AIS Safety Related Broadcast Message, pri=5, period=NA
+  N2kPGNClassEntry(129803L,N2kpgnc_DefaultFastPacket),   // AIS Interrogation PGN, pri=7, period=NA
+  N2kPGNClassEntry(129804L,N2kpgnc_DefaultFastPacket),   // AIS Assignment Mode Command, pri=7, period=NA
+  N2kPGNClassEntry(129805L,N2kpgnc_DefaultFastPacket),   // AIS Data Link Management Message, pri=7, period=NA
+  N2kPGNClassEntry(129806L,N2kpgnc_DefaultFastPacket),   // AIS Channel Management, pri=7, period=NA
+  N2kPGNClassEntry(129807L,N2kpgnc_DefaultFastPacket),   // AIS Group Assignment, pri=7, period=NA
+  N2kPGNClassEntry(129808L,N2kpgnc_DefaultFastPacket),   // DSC Call Information, pri=8, period=NA
+  N2kPGNClassEntry(129809L,N2kpgnc_DefaultFastPacket),   // AIS Class B Static Data: Part A, pri=6, period=NA
+  N2kPGNClassEntry(129810L,N2kpgnc_DefaultFastPacket),   // AIS Class B Static Data Part B, pri=6, period=NA
+  N2kPGNClassEntry(129811L,N2kpgnc_DefaultFastPacket),   // AIS Single Slot Binary Message, pri=5, period=NA
+  N2kPGNClassEntry(129812L,N2kpgnc_DefaultFastPacket),   // AIS Multi Slot Binary Message, pri=5, period=NA
+  N2kPGNClassEntry(129813L,N2kpgnc_DefaultFastPacket),   // AIS Long-Range Broadcast Message, pri=5, period=NA
+  N2kPGNClassEntry(129814L,N2kpgnc_DefaultFastPacket),   // AIS single slot binary message, pri=5, period=NA
+  N2kPGNClassEntry(129815L,N2kpgnc_DefaultFastPacket),   // AIS multi slot binary message, pri=5, period=NA
+  N2kPGNClassEntry(129816L,N2kpgnc_DefaultFastPacket),   // AIS acknowledge, pri=7, period=NA
+  N2kPGNClassEntry(130052L,N2kpgnc_DefaultFastPacket),   // Loran-C TD Data, pri=3, period=1000
+  N2kPGNClassEntry(130053L,N2kpgnc_DefaultFastPacket),   // Loran-C Range Data, pri=3, period=1000
+  N2kPGNClassEntry(130054L,N2kpgnc_DefaultFastPacket),   // Loran-C Signal Data, pri=3, period=1000
+  N2kPGNClassEntry(130060L,N2kpgnc_DefaultFastPacket),   // Label, pri=7, period=NA
+  N2kPGNClassEntry(130061L,N2kpgnc_DefaultFastPacket),   // Channel Source Configuration, pri=7, period=NA
+  N2kPGNClassEntry(130064L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - Database List, pri=7, period=NA
+  N2kPGNClassEntry(130065L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - Route List, pri=7, period=NA
+  N2kPGNClassEntry(130066L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - Route/WP-List Attributes, pri=7, period=NA
+  N2kPGNClassEntry(130067L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - Route - WP Name & Position, pri=7, period=NA
+  N2kPGNClassEntry(130068L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - Route - WP Name, pri=7, period=NA
+  N2kPGNClassEntry(130069L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - XTE Limit & Navigation Method, pri=7, period=NA
+  N2kPGNClassEntry(130070L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - WP Comment, pri=7, period=NA
+  N2kPGNClassEntry(130071L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - Route Comment, pri=7, period=NA
+  N2kPGNClassEntry(130072L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - Database Comment, pri=7, period=NA
+  N2kPGNClassEntry(130073L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - Radius of Turn, pri=7, period=NA
+  N2kPGNClassEntry(130074L,N2kpgnc_DefaultFastPacket),   // Route and WP Service - WP List - WP Name & Position, pri=7, period=NA
+  N2kPGNClassEntry(130306L,N2kpgnc_DefaultSingleFrame),  // Wind Speed, pri=2, period=100
+  N2kPGNClassEntry(130310L,N2kpgnc_DefaultSingleFrame),  // Outside Environmental parameters, pri=5, period=500
+  N2kPGNClassEntry(130311L,N2kpgnc_DefaultSingleFrame),  // Environmental parameters, pri=5, period=500
+  N2kPGNClassEntry(130312L,N2kpgnc_DefaultSingleFrame),  // Temperature, pri=5, period=2000
+  N2kPGNClassEntry(130313L,N2kpgnc_DefaultSingleFrame),  // Humidity, pri=5, period=2000
+  N2kPGNClassEntry(130314L,N2kpgnc_DefaultSingleFrame),  // Pressure, pri=5, period=2000
+  N2kPGNClassEntry(130316L,N2kpgnc_DefaultSingleFrame),  // Temperature extended range, pri=5, period=2000
+  N2kPGNClassEntry(130320L,N2kpgnc_DefaultFastPacket),   // Tide Station Data, pri=6, period=1000
+  N2kPGNClassEntry(130321L,N2kpgnc_DefaultFastPacket),   // Salinity Station Data, pri=6, period=1000
+  N2kPGNClassEntry(130322L,N2kpgnc_DefaultFastPacket),   // Current Station Data, pri=6, period=1000
+  N2kPGNClassEntry(130323L,N2kpgnc_DefaultFastPacket),   // Meteorological Station Data, pri=6, period=1000
+  N2kPGNClassEntry(130324L,N2kpgnc_DefaultFastPacket),   // Moored Buoy Station Data, pri=6, period=1000
+  N2kPGNClassEntry(130330L,N2kpgnc_DefaultFastPacket),   // Lighting system settings, pri=7, period=NA
+  N2kPGNClassEntry(130561L,N2kpgnc_DefaultFastPacket),   // Lighting zone, pri=7, period=NA
+  N2kPGNClassEntry(130562L,N2kpgnc_DefaultFastPacket),   // Lighting scene, pri=7, period=NA
+  N2kPGNClassEntry(130563L,N2kpgnc_DefaultFastPacket),   // Lighting device, pri=7, period=NA
+  N2kPGNClassEntry(130564L,N2kpgnc_DefaultFastPacket),   // Lighting device enumeration, pri=7, period=NA
+  N2kPGNClassEntry(130565L,N2kpgnc_DefaultFastPacket),   // Lighting color sequence, pri=7, period=NA
+  N2kPGNClassEntry(130566L,N2kpgnc_DefaultFastPacket),   // Lighting program, pri=7, period=NA
+  N2kPGNClassEntry(130567L,N2kpgnc_DefaultFastPacket),   // Watermaker Input Setting and Status, pri=6, period=2500
+  N2kPGNClassEntry(130568L,N2kpgnc_DefaultFastPacket),   // Diagnostic status, pri=6, period=1000
+  N2kPGNClassEntry(130569L,N2kpgnc_DefaultFastPacket),   // Current File and Status, pri=6, period=500
+  N2kPGNClassEntry(130570L,N2kpgnc_DefaultFastPacket),   // Library Data File, pri=6, period=NA
+  N2kPGNClassEntry(130571L,N2kpgnc_DefaultFastPacket),   // Library Data Group, pri=6, period=NA
+  N2kPGNClassEntry(130572L,N2kpgnc_DefaultFastPacket),   // Library Data Search, pri=6, period=NA
+  N2kPGNClassEntry(130573L,N2kpgnc_DefaultFastPacket),   // Supported Source Data, pri=6, period=NA
+  N2kPGNClassEntry(130574L,N2kpgnc_DefaultFastPacket),   // Supported Zone Data, pri=6, period=NA
+  N2kPGNClassEntry(130575L,N2kpgnc_DefaultFastPacket),   // Parental control status, pri=6, period=NA
+  N2kPGNClassEntry(130576L,N2kpgnc_DefaultSingleFrame),  // Small Craft Status (Trim Tab position), pri=2, period=200
+  N2kPGNClassEntry(130577L,N2kpgnc_DefaultFastPacket),   // Direction Data PGN, pri=3, period=1000
+  N2kPGNClassEntry(130578L,N2kpgnc_DefaultFastPacket),   // Vessel Speed Components, pri=2, period=250
+  N2kPGNClassEntry(130580L,N2kpgnc_DefaultFastPacket),   // System Configuration Status, pri=6, period=NA
+  N2kPGNClassEntry(130581L,N2kpgnc_DefaultFastPacket),   // Zone Configuration Status, pri=6, period=NA
+  N2kPGNClassEntry(130583L,N2kpgnc_DefaultFastPacket),   // Available Audio EQ Presets, pri=6, period=NA
+  N2kPGNClassEntry(130584L,N2kpgnc_DefaultFastPacket),   // Bluetooth Devices, pri=6, period=NA
+  N2kPGNClassEntry(130586L,N2kpgnc_DefaultFastPacket),   // Zone Configuration Status, pri=6, period=NA
+                                       };
+
+/** \brief Number of entries on \ref DefaultPGNClasses */
+#define DefaultPGNClassCount (sizeof(DefaultPGNClasses)/sizeof(DefaultPGNClasses[0]))
+/************************************************************************//**
+ * \brief Check on compile time that \ref DefaultPGNClasses is sorted by PGN
+ *        and has no duplicates. Lookups below rely on that.
+ */
+constexpr bool DefaultPGNClassesSorted(size_t i=1) {
+  return ( i>=DefaultPGNClassCount ? true :
+           (DefaultPGNClasses[i-1]>>3)<(DefaultPGNClasses[i]>>3) && DefaultPGNClassesSorted(i+1) );
+}
+
+static_assert(DefaultPGNClassesSorted(),"DefaultPGNClasses must be sorted by PGN");
+
+/** \brief First PGN on directly mapped area. Below it there are only few system messages. */
+#define N2kPGNClassMapBase 0x1f000UL
+
+/************************************************************************//**
+ * \brief Find class for PGN from \ref DefaultPGNClasses on compile time
+ */
+constexpr uint8_t DefaultPGNClassOf(unsigned long PGN, size_t Low=0, size_t High=DefaultPGNClassCount) {
+  return ( Low>=High ? (uint8_t)N2kpgnc_None :
+           (DefaultPGNClasses[(Low+High)/2]>>3)==PGN ? (uint8_t)(DefaultPGNClasses[(Low+High)/2] & 7) :
+           (DefaultPGNClasses[(Low+High)/2]>>3)<PGN ? DefaultPGNClassOf(PGN,(Low+High)/2+1,High) :
+                                                     DefaultPGNClassOf(PGN,Low,(Low+High)/2) );
+}
+
+/************************************************************************//**
+ * \brief Count entries on \ref DefaultPGNClasses below PGN on compile time
+ */
+constexpr uint8_t DefaultPGNClassesBelow(unsigned long PGN, size_t i=0) {
+  return ( i>=DefaultPGNClassCount || (DefaultPGNClasses[i]>>3)>=PGN ? i : DefaultPGNClassesBelow(PGN,i+1) );
+}
+
+#define N2kPGNClassMap1(i) (DefaultPGNClassOf(N2kPGNClassMapBase+2*(i)) | (DefaultPGNClassOf(N2kPGNClassMapBase+2*(i)+1)<<4))
+#define N2kPGNClassMap4(i) N2kPGNClassMap1(i),N2kPGNClassMap1(i+1),N2kPGNClassMap1(i+2),N2kPGNClassMap1(i+3)
+#define N2kPGNClassMap16(i) N2kPGNClassMap4(i),N2kPGNClassMap4(i+4),N2kPGNClassMap4(i+8),N2kPGNClassMap4(i+12)
+#define N2kPGNClassMap64(i) N2kPGNClassMap16(i),N2kPGNClassMap16(i+16),N2kPGNClassMap16(i+32),N2kPGNClassMap16(i+48)
+#define N2kPGNClassMap256(i) N2kPGNClassMap64(i),N2kPGNClassMap64(i+64),N2kPGNClassMap64(i+128),N2kPGNClassMap64(i+192)
+
+/************************************************************************//**
+ * \brief Direct class map for PGNs 126976-131071
+ *
+ * Each byte holds class for two PGNs as 4 bit values, so classifying PGN is
+ * just one table read. Map is calculated by the compiler from 
+ * \ref DefaultPGNClasses, so only that table must be updated for new PGNs.
+ */
+const uint8_t DefaultPGNClassMap[] PROGMEM = {
+  N2kPGNClassMap256(0),N2kPGNClassMap256(256),N2kPGNClassMap256(512),N2kPGNClassMap256(768),
+  N2kPGNClassMap256(1024),N2kPGNClassMap256(1280),N2kPGNClassMap256(1536),N2kPGNClassMap256(1792)
+};
+
+/** \brief Number of \ref DefaultPGNClasses entries below directly mapped area */
+#define DefaultPGNClassesBelowMap DefaultPGNClassesBelow(N2kPGNClassMapBase)
+
+/************************************************************************//**
+ * \brief Find class for PGN from \ref DefaultPGNClasses table
+ *
+ * \param PGN      PGN to be tested
+ * \return Class of the PGN or N2kpgnc_None, if it is not on the table.
+ */
+uint8_t FindDefaultPGNClass(unsigned long PGN) {
+  if ( PGN>=N2kPGNClassMapBase ) {
+    if ( PGN>0x1ffffUL ) return N2kpgnc_None;
+    uint8_t Classes=pgm_read_byte(&DefaultPGNClassMap[(PGN-N2kPGNClassMapBase)>>1]);
+    return ( (PGN & 1) ? Classes>>4 : Classes & 0x0f );
+  }
+
+  for ( size_t i=0; i<DefaultPGNClassesBelowMap; i++ ) {
+    uint32_t Entry=pgm_read_dword(&DefaultPGNClasses[i]);
+    if ( (Entry>>3)>=PGN ) return ( (Entry>>3)==PGN ? (uint8_t)(Entry & 7) : (uint8_t)N2kpgnc_None );
+  }
+
+  return N2kpgnc_None;
+}
+
 /************************************************************************//**
  * \brief Checks if the given PGN is a Single Frame System Message
  *
@@ -225,15 +514,7 @@ const unsigned long DefReceiveMessages[] PROGMEM = {
  * \return false 
  */
 bool IsSingleFrameSystemMessage(unsigned long PGN) {
-                                  switch (PGN) {
-                                      case  59392L: /* ISO Acknowledgement */
-                                      case   TP_DT: /* Multi packet data transfer, TP.DT */
-                                      case   TP_CM: /* Multi packet connection management, TP.CM */
-                                      case  59904L: /* ISO Request */
-                                      case  60928L: /* ISO Address Claim */
-                                      return true;
-                                  }
-                                  return false;
+  return FindDefaultPGNClass(PGN)==N2kpgnc_SingleFrameSystem;
 }
 
 /************************************************************************//**
@@ -244,12 +525,7 @@ bool IsSingleFrameSystemMessage(unsigned long PGN) {
  * \return false 
  */
 bool IsFastPacketSystemMessage(unsigned long PGN) {
-                                  switch (PGN) {
-                                      case  65240L: /* Commanded Address*/
-                                      case 126208L: /* NMEA Request/Command/Acknowledge group function */
-                                      return true;
-                                  }
-                                  return false;
+  return FindDefaultPGNClass(PGN)==N2kpgnc_FastPacketSystem;
 }
 
 /************************************************************************//**
@@ -288,36 +564,7 @@ bool IsFastPacketSystemMessage(unsigned long PGN) {
  * \return false 
  */
 bool IsDefaultSingleFrameMessage(unsigned long PGN) {
-                                  switch (PGN) {
-                                      case 126992L: // System date/time, pri=3, period=1000
-                                      case 126993L: // Heartbeat, pri=7, period=60000
-                                      case 127245L: // Rudder, pri=2, period=100
-                                      case 127250L: // Vessel Heading, pri=2, period=100
-                                      case 127251L: // Rate of Turn, pri=2, period=100
-                                      case 127252L: // Heave, pri=3, period=100
-                                      case 127257L: // Attitude, pri=3, period=1000
-                                      case 127488L: // Engine parameters rapid, rapid Update, pri=2, period=100
-                                      case 127493L: // Transmission parameters: dynamic, pri=2, period=100
-                                      case 127501L: // Binary status report, pri=3, period=NA
-                                      case 127505L: // Fluid level, pri=6, period=2500
-                                      case 127508L: // Battery Status, pri=6, period=1500
-                                      case 127750L: // Charger status new, pri=6, period=1500
-                                      case 128259L: // Boat speed, pri=2, period=1000
-                                      case 128267L: // Water depth, pri=3, period=1000
-                                      case 129025L: // Lat/lon rapid, pri=2, period=100
-                                      case 129026L: // COG SOG rapid, pri=2, period=250
-                                      case 129283L: // Cross Track Error, pri=3, period=1000
-                                      case 130306L: // Wind Speed, pri=2, period=100
-                                      case 130310L: // Outside Environmental parameters, pri=5, period=500
-                                      case 130311L: // Environmental parameters, pri=5, period=500
-                                      case 130312L: // Temperature, pri=5, period=2000
-                                      case 130313L: // Humidity, pri=5, period=2000
-                                      case 130314L: // Pressure, pri=5, period=2000
-                                      case 130316L: // Temperature extended range, pri=5, period=2000
-                                      case 130576L: // Small Craft Status (Trim Tab position), pri=2, period=200
-                                      return true;
-                                  }
-                                  return false;
+  return FindDefaultPGNClass(PGN)==N2kpgnc_DefaultSingleFrame;
 }
 
 /************************************************************************//**
@@ -332,13 +579,7 @@ bool IsDefaultSingleFrameMessage(unsigned long PGN) {
  * \return false 
  */
 bool IsMandatoryFastPacketMessage(unsigned long PGN) {
-                                  switch (PGN) {
-                                      case 126464L: // PGN List (Transmit and Receive), pri=6, period=NA
-                                      case 126996L: // Product information, pri=6, period=NA
-                                      case 126998L: // Configuration information, pri=6, period=NA
-                                      return true;
-                                  }
-                                  return false;
+  return FindDefaultPGNClass(PGN)==N2kpgnc_MandatoryFastPacket;
 }
 
 /************************************************************************//**
@@ -467,129 +708,7 @@ bool IsMandatoryFastPacketMessage(unsigned long PGN) {
  * \return false 
  */
 bool IsDefaultFastPacketMessage(unsigned long PGN) {
-                                  switch (PGN) {
-                                      case 126983L: // Alert, pri=2, period=1000
-                                      case 126984L: // Alert Response, pri=2, period=NA
-                                      case 126985L: // Alert Text, pri=2, period=10000
-                                      case 126986L: // Alert Configuration, pri=2, period=NA
-                                      case 126987L: // Alert Threshold, pri=2, period=NA
-                                      case 126988L: // Alert Value, pri=2, period=10000
-                                      case 127233L: // Man Overboard Notification(MOB), pri=3, period=NA
-                                      case 127237L: // Heading/Track control, pri=2, period=250
-                                      case 127489L: // Engine parameters dynamic, pri=2, period=500
-                                      case 127490L: // Electric Drive Status (Dynamic), pri=1, period=1500 
-                                      case 127491L: // Electric Energy Storage Status (Dynamic), pri=7, period=1500
-                                      case 127494L: // Electric Drive Information, pri=4, period=NA
-                                      case 127495L: // Electric Energy Storage Information, pri=6, period=NA
-                                      case 127496L: // Trip fuel consumption, vessel, pri=5, period=1000
-                                      case 127497L: // Trip fuel consumption, engine, pri=5, period=1000
-                                      case 127498L: // Engine parameters static, pri=5, period=NA
-                                      case 127503L: // AC Input Status, pri=6, period=1500
-                                      case 127504L: // AC Output Status, pri=6, period=1500
-                                      case 127506L: // DC Detailed status, pri=6, period=1500
-                                      case 127507L: // Charger status, pri=6, period=1500
-                                      case 127509L: // Inverter status, pri=6, period=1500
-                                      case 127510L: // Charger configuration status, pri=6, period=NA
-                                      case 127511L: // Inverter Configuration Status, pri=6, period=NA
-                                      case 127512L: // AGS configuration status, pri=6, period=NA
-                                      case 127513L: // Battery configuration status, pri=6, period=NA
-                                      case 127514L: // AGS Status, pri=6, period=1500
-                                      case 128275L: // Distance log, pri=6, period=1000
-                                      case 128520L: // Tracked Target Data, pri=2, period=1000
-                                      case 128538L: // Elevator car status, pri=6, period=100
-                                      case 129029L: // GNSS Position Data, pri=3, period=1000
-                                      case 129038L: // AIS Class A Position Report, pri=4, period=NA
-                                      case 129039L: // AIS Class B Position Report, pri=4, period=NA
-                                      case 129040L: // AIS Class B Extended Position Report, pri=4, period=NA
-                                      case 129041L: // AIS Aids to Navigation (AtoN) Report, pri=4, period=NA
-                                      case 129044L: // Datum, pri=6, period=10000
-                                      case 129045L: // User Datum Settings, pri=6, period=NA
-                                      case 129284L: // Navigation info, pri=3, period=1000
-                                      case 129285L: // Waypoint list, pri=3, period=NA
-                                      case 129301L: // Time to/from Mark, pri=3, period=1000
-                                      case 129302L: // Bearing and Distance between two Marks, pri=6, period=NA
-                                      case 129538L: // GNSS Control Status, pri=6, period=NA
-                                      case 129540L: // GNSS Sats in View, pri=6, period=1000
-                                      case 129541L: // GPS Almanac Data, pri=6, period=NA
-                                      case 129542L: // GNSS Pseudorange Noise Statistics, pri=6, period=1000
-                                      case 129545L: // GNSS RAIM Output, pri=6, period=NA
-                                      case 129547L: // GNSS Pseudorange Error Statistics, pri=6, period=NA
-                                      case 129549L: // DGNSS Corrections, pri=6, period=NA
-                                      case 129551L: // GNSS Differential Correction Receiver Signal, pri=6, period=NA
-                                      case 129556L: // GLONASS Almanac Data, pri=6, period=NA
-                                      case 129792L: // AIS DGNSS Broadcast Binary Message, pri=6, period=NA
-                                      case 129793L: // AIS UTC and Date Report, pri=7, period=NA
-                                      case 129794L: // AIS Class A Static data, pri=6, period=NA
-                                      case 129795L: // AIS Addressed Binary Message, pri=5, period=NA
-                                      case 129796L: // AIS Acknowledge, pri=7, period=NA
-                                      case 129797L: // AIS Binary Broadcast Message, pri=5, period=NA
-                                      case 129798L: // AIS SAR Aircraft Position Report, pri=4, period=NA
-                                      case 129799L: // Radio Frequency/Mode/Power, pri=3, period=NA
-                                      case 129800L: // AIS UTC/Date Inquiry, pri=7, period=NA
-                                      case 129801L: // AIS Addressed Safety Related Message, pri=5, period=NA
-                                      case 129802L: // AIS Safety Related Broadcast Message, pri=5, period=NA
-                                      case 129803L: // AIS Interrogation PGN, pri=7, period=NA
-                                      case 129804L: // AIS Assignment Mode Command, pri=7, period=NA
-                                      case 129805L: // AIS Data Link Management Message, pri=7, period=NA
-                                      case 129806L: // AIS Channel Management, pri=7, period=NA
-                                      case 129807L: // AIS Group Assignment, pri=7, period=NA
-                                      case 129808L: // DSC Call Information, pri=8, period=NA
-                                      case 129809L: // AIS Class B Static Data: Part A, pri=6, period=NA
-                                      case 129810L: // AIS Class B Static Data Part B, pri=6, period=NA
-                                      case 129811L: // AIS Single Slot Binary Message, pri=5, period=NA
-                                      case 129812L: // AIS Multi Slot Binary Message, pri=5, period=NA
-                                      case 129813L: // AIS Long-Range Broadcast Message, pri=5, period=NA
-                                      case 129814L: // AIS single slot binary message, pri=5, period=NA
-                                      case 129815L: // AIS multi slot binary message, pri=5, period=NA
-                                      case 129816L: // AIS acknowledge, pri=7, period=NA
-                                      case 130052L: // Loran-C TD Data, pri=3, period=1000
-                                      case 130053L: // Loran-C Range Data, pri=3, period=1000
-                                      case 130054L: // Loran-C Signal Data, pri=3, period=1000
-                                      case 130060L: // Label, pri=7, period=NA
-                                      case 130061L: // Channel Source Configuration, pri=7, period=NA
-                                      case 130064L: // Route and WP Service - Database List, pri=7, period=NA
-                                      case 130065L: // Route and WP Service - Route List, pri=7, period=NA
-                                      case 130066L: // Route and WP Service - Route/WP-List Attributes, pri=7, period=NA
-                                      case 130067L: // Route and WP Service - Route - WP Name & Position, pri=7, period=NA
-                                      case 130068L: // Route and WP Service - Route - WP Name, pri=7, period=NA
-                                      case 130069L: // Route and WP Service - XTE Limit & Navigation Method, pri=7, period=NA
-                                      case 130070L: // Route and WP Service - WP Comment, pri=7, period=NA
-                                      case 130071L: // Route and WP Service - Route Comment, pri=7, period=NA
-                                      case 130072L: // Route and WP Service - Database Comment, pri=7, period=NA
-                                      case 130073L: // Route and WP Service - Radius of Turn, pri=7, period=NA
-                                      case 130074L: // Route and WP Service - WP List - WP Name & Position, pri=7, period=NA
-                                      case 130320L: // Tide Station Data, pri=6, period=1000
-                                      case 130321L: // Salinity Station Data, pri=6, period=1000
-                                      case 130322L: // Current Station Data, pri=6, period=1000
-                                      case 130323L: // Meteorological Station Data, pri=6, period=1000
-                                      case 130324L: // Moored Buoy Station Data, pri=6, period=1000
-                                      case 130330L: // Lighting system settings, pri=7, period=NA
-                                      case 130561L: // Lighting zone, pri=7, period=NA
-                                      case 130562L: // Lighting scene, pri=7, period=NA
-                                      case 130563L: // Lighting device, pri=7, period=NA
-                                      case 130564L: // Lighting device enumeration, pri=7, period=NA
-                                      case 130565L: // Lighting color sequence, pri=7, period=NA
-                                      case 130566L: // Lighting program, pri=7, period=NA
-                                      case 130567L: // Watermaker Input Setting and Status, pri=6, period=2500
-                                      case 130577L: // Direction Data PGN, pri=3, period=1000
-                                      case 130578L: // Vessel Speed Components, pri=2, period=250
-                                      // Entertainment PGNs
-                                      case 130568L: // Diagnostic status, pri=6, period=1000
-                                      case 130569L: // Current File and Status, pri=6, period=500
-                                      case 130570L: // Library Data File, pri=6, period=NA
-                                      case 130571L: // Library Data Group, pri=6, period=NA
-                                      case 130572L: // Library Data Search, pri=6, period=NA
-                                      case 130573L: // Supported Source Data, pri=6, period=NA
-                                      case 130574L: // Supported Zone Data, pri=6, period=NA
-                                      case 130575L: // Parental control status, pri=6, period=NA
-                                      case 130580L: // System Configuration Status, pri=6, period=NA
-                                      case 130581L: // Zone Configuration Status, pri=6, period=NA
-                                      case 130583L: // Available Audio EQ Presets, pri=6, period=NA
-                                      case 130584L: // Bluetooth Devices, pri=6, period=NA
-                                      case 130586L: // Zone Configuration Status, pri=6, period=NA
-                                      return true;
-                                  }
-                                  return false;
+  return FindDefaultPGNClass(PGN)==N2kpgnc_DefaultFastPacket;
 }
 
 /************************************************************************//**
@@ -712,17 +831,64 @@ tNMEA2000::tNMEA2000() {
   ForwardStream=0;
 
   for (int i=0; i<N2kMessageGroups; i++) {SingleFrameMessages[i]=0; FastPacketMessages[i]=0;}
+  UserPGNClasses=0;
+  UserPGNClassCount=0;
+  UserPGNClassesChanged=false;
 
   N2kCANMsgBuf=0;
   MaxN2kCANMsgs=0;
 
   MaxCANSendFrames=40;
   MaxCANReceiveFrames=0; // Use driver default
+#if !defined(N2K_NO_SEND_QUEUE_STATS)
+  ResetSendQueueStats();
+#endif
+#if !defined(N2K_NO_STATISTICS)
+  memset(&Statistics,0,sizeof(Statistics));
+#endif
+  SendCoalesceMsgs=0;
+#if !defined(N2K_NO_PERIODIC_MSG_SUPPORT)
+  PeriodicMsgs=0;
+  PeriodicMsgHeap=0;
+  PeriodicMsgCount=0;
+  PeriodicMsgSize=0;
+#endif
+  CoalescePending=0;
+  MaxCoalescePending=0;
+  CoalescePendingCount=0;
+  MaxReadFramesOnParse=20;
+  MaxParseTime=0;
+  ReadLimitReached=false;
+#if defined(N2K_THREAD_SAFE_SEND)
+  PostMsgBuf=new tMPSCRingBuffer<tPostedMsg>(N2kDefaultPostMsgBufSize);
+  PostMsgOverflows.store(0);
+#endif
+#if defined(N2K_THREADED_RECEIVE)
+  RxFrameRing=0;
+  RxRingOverflows.store(0);
+  ReceiveThreadRun.store(false);
+  ReceiveIdleTime=1000;
+  ReceiveNotify=0;
+  ReceiveNotifyContext=0;
+#endif
+#if !defined(N2K_NO_RX_TIMESTAMP)
+  FrameRxTime=0;
+#endif
+#if defined(N2K_LATENCY_STATS)
+  LatencyEntry=0;
+  LatencyReadyTime=0;
+#endif
   CANSendFrameBuf=0;
 
   OnOpen=0;
   MsgHandler=0;
+  LongMsgHandler=0;
+  FrameHandler=0;
   MsgHandlers=0;
+  MsgHandlerIndex=0;
+  MsgHandlerIndexSize=0;
+  MsgHandlerIndexCount=0;
+  MsgHandlerIndexChanged=false;
   ISORqstHandler=0;
 
   OpenScheduler.FromNow(0);
@@ -1186,21 +1352,25 @@ void tNMEA2000::SetDeviceInformationInstances(
 //*****************************************************************************
 void tNMEA2000::SetSingleFrameMessages(const unsigned long *_SingleFrameMessages) {
   SingleFrameMessages[0]=_SingleFrameMessages;
+  UserPGNClassesChanged=true;
 }
 
 //*****************************************************************************
 void tNMEA2000::SetFastPacketMessages(const unsigned long *_FastPacketMessages) {
   FastPacketMessages[0]=_FastPacketMessages;
+  UserPGNClassesChanged=true;
 }
 
 //*****************************************************************************
 void tNMEA2000::ExtendSingleFrameMessages(const unsigned long *_SingleFrameMessages) {
   SingleFrameMessages[1]=_SingleFrameMessages;
+  UserPGNClassesChanged=true;
 }
 
 //*****************************************************************************
 void tNMEA2000::ExtendFastPacketMessages(const unsigned long *_FastPacketMessages) {
   FastPacketMessages[1]=_FastPacketMessages;
+  UserPGNClassesChanged=true;
 }
 
 //*****************************************************************************
@@ -1231,10 +1401,8 @@ void tNMEA2000::SetMode(tN2kMode _N2kMode, uint8_t _N2kSource) {
 //*****************************************************************************
 void tNMEA2000::InitCANFrameBuffers() {
     if ( CANSendFrameBuf==0 && !IsInitialized() ) {
-      if ( MaxCANSendFrames>0 ) CANSendFrameBuf = new tCANSendFrame[MaxCANSendFrames];
+      if ( MaxCANSendFrames>0 ) CANSendFrameBuf = new tPriorityRingBuffer<tCANSendFrame>(MaxCANSendFrames,8);
       N2kDbg("Initialize frame buffer. Size: "); N2kDbg(MaxCANSendFrames); N2kDbg(", address:"); N2kDbgln((uint32_t)CANSendFrameBuf);
-      CANSendFrameBufferWrite=0;
-      CANSendFrameBufferRead=0;
     }
 
     // Receive buffer has sense only with interrupt handling. So it must be handled on inherited class.
@@ -1252,6 +1420,8 @@ bool tNMEA2000::Open() {
       if ( MaxN2kCANMsgs==0 ) MaxN2kCANMsgs=5;
       N2kCANMsgBuf = new tN2kCANMsg[MaxN2kCANMsgs];
       for (int i=0; i<MaxN2kCANMsgs; i++) N2kCANMsgBuf[i].FreeMessage();
+      N2kCANMsgIndex.Init(MaxN2kCANMsgs);
+      N2kMsgBufPool.Init();
 
       #if !defined(N2K_NO_GROUP_FUNCTION_SUPPORT)
       // On first open try add also default group function handlers
@@ -1291,6 +1461,9 @@ bool tNMEA2000::Open() {
     #if !defined(N2K_NO_HEARTBEAT_SUPPORT)
     SetHeartbeatIntervalAndOffset(DefaultHeartbeatInterval,10000); // Init default hearbeat interval and offset.
     #endif
+    #if !defined(N2K_NO_PERIODIC_MSG_SUPPORT)
+    RestartPeriodicMsgs();
+    #endif
     if ( OnOpen!=0 ) OnOpen();
   } else {
     // Read rubbish out from CAN controller
@@ -1358,28 +1531,81 @@ unsigned long N2ktoCanID(unsigned char priority, unsigned long PGN, unsigned lon
   }
 }
 
+//*****************************************************************************
+#if !defined(N2K_NO_SEND_QUEUE_STATS)
+#define N2kCANIdPriority(id) (uint8_t)(((id)>>26) & 0x7)
+#define N2kCountSentFrames(id,n) do { SendQueueStats[N2kCANIdPriority(id)].Frames+=(n); N2kStatsAdd(FramesSent,n); } while (0)
+#else
+#define N2kCountSentFrames(id,n) N2kStatsAdd(FramesSent,n)
+#endif
+
 //*****************************************************************************
 bool tNMEA2000::SendFrames()
-{ uint16_t temp;
+{ tCANSendFrame *Frame;
+  uint8_t Priority;
 
   if ( CANSendFrameBuf==0 ) return true; // This can be in case, where inherited class defines own buffering.
 
-  while (CANSendFrameBufferRead!=CANSendFrameBufferWrite) {
-    temp = (CANSendFrameBufferRead + 1) % MaxCANSendFrames;
-    if ( CANSendFrame(CANSendFrameBuf[temp].id, CANSendFrameBuf[temp].len, CANSendFrameBuf[temp].buf, CANSendFrameBuf[temp].wait_sent) ) {
-      CANSendFrameBufferRead=temp;
-      N2kFrameOutDbgStart("Frame unbuffered "); N2kFrameOutDbgln(CANSendFrameBuf[temp].id);
-    } else return false;
+  // Highest priority first. Frames with same priority are in order they were buffered.
+  while ( (Frame=CANSendFrameBuf->peek(&Priority))!=0 ) {
+    if ( !CANSendFrame(Frame->id, Frame->len, Frame->buf, Frame->wait_sent) ) return false;
+    N2kFrameOutDbgStart("Frame unbuffered "); N2kFrameOutDbgln(Frame->id);
+    if ( CoalescePendingCount>0 ) ReleaseCoalescePending(Frame);
+#if !defined(N2K_NO_SEND_QUEUE_STATS)
+    tCANSendQueueStats &Stats=SendQueueStats[Priority];
+    uint32_t Latency=N2kMicros()-Frame->QueueTime;
+    Stats.Frames++;
+    Stats.BufferedFrames++;
+    Stats.TotalLatency+=Latency;
+    if ( Latency>Stats.MaxLatency ) Stats.MaxLatency=Latency;
+#endif
+#if !defined(N2K_NO_STATISTICS)
+    Statistics.FramesSent++;
+    Statistics.SendBufFrames--;
+#endif
+    CANSendFrameBuf->getReadRef(Priority);
   }
 
   return true;
 }
 
+#if !defined(N2K_NO_SEND_QUEUE_STATS)
+//*****************************************************************************
+bool tNMEA2000::GetSendQueueStats(uint8_t Priority, tCANSendQueueStats &Stats) const {
+  if ( Priority>7 ) return false;
+  Stats=SendQueueStats[Priority];
+  return true;
+}
+
+//*****************************************************************************
+void tNMEA2000::ResetSendQueueStats() {
+  memset(SendQueueStats,0,sizeof(SendQueueStats));
+}
+#endif
+
+#if !defined(N2K_NO_STATISTICS)
+//*****************************************************************************
+void tNMEA2000::GetStatistics(tStatistics &Stats) const {
+  Stats=Statistics;
+  Stats.SlotsInUse=( N2kCANMsgBuf!=0?MaxN2kCANMsgs-N2kCANMsgIndex.GetFreeCount():0 );
+}
+
+//*****************************************************************************
+void tNMEA2000::ResetStatistics() {
+  uint16_t SendBufFrames=Statistics.SendBufFrames;
+
+  memset(&Statistics,0,sizeof(Statistics));
+  Statistics.SendBufFrames=SendBufFrames;
+  Statistics.SendBufHighWater=SendBufFrames;
+  Statistics.SlotsHighWater=( N2kCANMsgBuf!=0?MaxN2kCANMsgs-N2kCANMsgIndex.GetFreeCount():0 );
+}
+#endif
+
 //*****************************************************************************
 bool tNMEA2000::SendFrame(unsigned long id, unsigned char len, const unsigned char *buf, bool wait_sent) {
 
   if ( !SendFrames() || !CANSendFrame(id,len,buf,wait_sent) ) { // If we can not sent frame immediately, add it to buffer
-    tCANSendFrame *Frame=GetNextFreeCANSendFrame();
+    tCANSendFrame *Frame=GetNextFreeCANSendFrame((id>>26) & 0x7);
     if ( Frame==0 ) {
       N2kFrameOutDbgStart("Frame failed "); N2kFrameOutDbgln(id);
       return false;
@@ -1390,6 +1616,126 @@ bool tNMEA2000::SendFrame(unsigned long id, unsigned char len, const unsigned ch
     Frame->wait_sent=wait_sent;
     for (int i=0; i<len; i++) Frame->buf[i]=buf[i];
     N2kFrameOutDbgStart("Frame buffered "); N2kFrameOutDbgln(id);
+  } else {
+    N2kCountSentFrames(id,1);
+  }
+
+  return true;
+}
+
+//*****************************************************************************
+bool tNMEA2000::SendRawFrame(const tCANFrame &Frame) {
+  if ( OpenState!=os_Open || N2kMode==N2km_ListenOnly ) return false;
+
+  return SendFrame(Frame.id,Frame.len,Frame.buf,true);
+}
+
+//*****************************************************************************
+void tNMEA2000::SetSendCoalescing(const tSendCoalesceMsg *_Messages, uint8_t MaxPending) {
+  if ( CoalescePending==0 && _Messages!=0 && MaxPending>0 ) {
+    CoalescePending=new tCoalescePending[MaxPending];
+    MaxCoalescePending=MaxPending;
+  }
+  SendCoalesceMsgs=_Messages;
+}
+
+//*****************************************************************************
+bool tNMEA2000::IsSendCoalesceMsg(const tN2kMsg &N2kMsg, uint8_t &Instance) const {
+  if ( SendCoalesceMsgs==0 || CoalescePending==0 ) return false;
+
+  for ( const tSendCoalesceMsg *Msg=SendCoalesceMsgs; Msg->PGN!=0; Msg++ ) {
+    if ( Msg->PGN!=N2kMsg.PGN ) continue;
+    if ( Msg->InstanceByte==N2kNoInstanceByte ) {
+      Instance=N2kNoInstanceByte;
+    } else {
+      if ( Msg->InstanceByte>=N2kMsg.DataLen ) return false;
+      Instance=N2kMsg.Data[Msg->InstanceByte];
+    }
+    return true;
+  }
+
+  return false;
+}
+
+//*****************************************************************************
+bool tNMEA2000::SendCoalescedFrame(unsigned long id, uint8_t Instance, unsigned char len, const unsigned char *buf) {
+  len=N2kMin<unsigned char>(len,8);
+
+  for ( uint8_t i=0; i<CoalescePendingCount; i++ ) {
+    if ( CoalescePending[i].id==id && CoalescePending[i].Instance==Instance ) { // Replace old value
+      tCANSendFrame *Frame=CoalescePending[i].Frame;
+      Frame->len=len;
+      for (int j=0; j<len; j++) Frame->buf[j]=buf[j];
+#if !defined(N2K_NO_SEND_QUEUE_STATS)
+      SendQueueStats[(id>>26) & 0x7].CoalescedFrames++;
+#endif
+      N2kFrameOutDbgStart("Frame coalesced "); N2kFrameOutDbgln(id);
+      return true;
+    }
+  }
+
+  if ( !SendFrames() || !CANSendFrame(id,len,buf,false) ) {
+    tCANSendFrame *Frame=GetNextFreeCANSendFrame((id>>26) & 0x7);
+    if ( Frame==0 ) {
+      N2kFrameOutDbgStart("Frame failed "); N2kFrameOutDbgln(id);
+      return false;
+    }
+    Frame->id=id;
+    Frame->len=len;
+    Frame->wait_sent=false;
+    for (int j=0; j<len; j++) Frame->buf[j]=buf[j];
+    if ( CoalescePendingCount<MaxCoalescePending ) {
+      CoalescePending[CoalescePendingCount].id=id;
+      CoalescePending[CoalescePendingCount].Instance=Instance;
+      CoalescePending[CoalescePendingCount].Frame=Frame;
+      CoalescePendingCount++;
+    }
+    N2kFrameOutDbgStart("Frame buffered "); N2kFrameOutDbgln(id);
+  } else {
+    N2kCountSentFrames(id,1);
+  }
+
+  return true;
+}
+
+//*****************************************************************************
+void tNMEA2000::ReleaseCoalescePending(const tCANSendFrame *Frame) {
+  for ( uint8_t i=0; i<CoalescePendingCount; i++ ) {
+    if ( CoalescePending[i].Frame==Frame ) {
+      CoalescePendingCount--;
+      CoalescePending[i]=CoalescePending[CoalescePendingCount];
+      return;
+    }
+  }
+}
+
+//*****************************************************************************
+uint16_t tNMEA2000::CANSendFrames(const tCANFrame *Frames, uint16_t Count, bool wait_sent) {
+  uint16_t Sent=0;
+
+  for ( ; Sent<Count && CANSendFrame(Frames[Sent].id,Frames[Sent].len,Frames[Sent].buf,wait_sent); Sent++ );
+
+  return Sent;
+}
+
+//*****************************************************************************
+bool tNMEA2000::SendFrameBatch(const tCANFrame *Frames, uint16_t Count, bool wait_sent) {
+  uint16_t Sent=0;
+
+  if ( SendFrames() ) Sent=CANSendFrames(Frames,Count,wait_sent);
+  if ( Sent>0 ) N2kCountSentFrames(Frames[0].id,Sent);
+
+  for ( ; Sent<Count; Sent++ ) { // Buffer frames, which could not be sent immediately
+    tCANSendFrame *Frame=GetNextFreeCANSendFrame((Frames[Sent].id>>26) & 0x7);
+    if ( Frame==0 ) {
+      N2kFrameOutDbgStart("Frame failed "); N2kFrameOutDbgln(Frames[Sent].id);
+      return false;
+    }
+    Frame->id=Frames[Sent].id;
+    Frame->len=N2kMin<unsigned char>(Frames[Sent].len,8);
+    Frame->wait_sent=wait_sent;
+    for (int i=0; i<Frame->len; i++) Frame->buf[i]=Frames[Sent].buf[i];
+    N2kFrameOutDbgStart("Frame buffered "); N2kFrameOutDbgln(Frame->id);
   }
 
   return true;
@@ -1457,18 +1803,179 @@ void tNMEA2000::SendHeartbeat(bool force) {
 }
 #endif
 
+#if !defined(N2K_NO_PERIODIC_MSG_SUPPORT)
 //*****************************************************************************
-tNMEA2000::tCANSendFrame *tNMEA2000::GetNextFreeCANSendFrame() {
-  if (CANSendFrameBuf==0) return 0;
+int tNMEA2000::AddPeriodicMsg(unsigned long PGN, uint32_t Period, tPeriodicMsgFill Fill, void *Context, int DeviceIndex, uint32_t Offset) {
+  if ( Fill==0 ) return -1;
+
+  if ( PeriodicMsgCount>=PeriodicMsgSize ) { // Grow buffers
+    if ( PeriodicMsgSize>=0x8000 ) return -1;
+    uint16_t NewSize=(PeriodicMsgSize>0?2*PeriodicMsgSize:8);
+    tPeriodicMsg *NewMsgs=N2kNewNoThrow tPeriodicMsg[NewSize];
+    if ( NewMsgs==0 ) return -1;
+    uint16_t *NewHeap=N2kNewNoThrow uint16_t[NewSize];
+    if ( NewHeap==0 ) {
+      delete[] NewMsgs;
+      return -1;
+    }
+    for ( uint16_t i=0; i<PeriodicMsgCount; i++ ) {
+      NewMsgs[i]=PeriodicMsgs[i];
+      NewHeap[i]=PeriodicMsgHeap[i];
+    }
+    if ( PeriodicMsgs!=0 ) delete[] PeriodicMsgs;
+    if ( PeriodicMsgHeap!=0 ) delete[] PeriodicMsgHeap;
+    PeriodicMsgs=NewMsgs;
+    PeriodicMsgHeap=NewHeap;
+    PeriodicMsgSize=NewSize;
+  }
+
+  int Handle=PeriodicMsgCount;
+  tPeriodicMsg &Msg=PeriodicMsgs[Handle];
+  Msg.PGN=PGN;
+  Msg.Fill=Fill;
+  Msg.Context=Context;
+  Msg.DeviceIndex=DeviceIndex;
+  Msg.Scheduler.Disable();
+  Msg.HeapPos=PeriodicMsgCount;
+  PeriodicMsgHeap[PeriodicMsgCount]=Handle;
+  PeriodicMsgCount++;
+
+  SetPeriodicMsgPeriod(Handle,Period,Offset);
+
+  return Handle;
+}
+
+//*****************************************************************************
+bool tNMEA2000::SetPeriodicMsgPeriod(int Handle, uint32_t Period, uint32_t Offset) {
+  if ( Handle<0 || Handle>=PeriodicMsgCount ) return false;
+
+  tPeriodicMsg &Msg=PeriodicMsgs[Handle];
+  if ( Offset==N2kPeriodicAutoOffset ) Offset=AutoPeriodicMsgOffset(Handle,Period);
+  Msg.Scheduler.SetPeriodAndOffset(Period,Offset);
+  PeriodicMsgHeapDown(PeriodicMsgHeapUp(Msg.HeapPos));
+
+  return true;
+}
+
+//*****************************************************************************
+uint32_t tNMEA2000::GetPeriodicMsgPeriod(int Handle) const {
+  if ( Handle<0 || Handle>=PeriodicMsgCount || PeriodicMsgs[Handle].Scheduler.IsDisabled() ) return 0;
+  return PeriodicMsgs[Handle].Scheduler.GetPeriod();
+}
+
+//*****************************************************************************
+uint32_t tNMEA2000::GetPeriodicMsgOffset(int Handle) const {
+  if ( Handle<0 || Handle>=PeriodicMsgCount ) return 0;
+  return PeriodicMsgs[Handle].Scheduler.GetOffset();
+}
+
+//*****************************************************************************
+uint32_t tNMEA2000::AutoPeriodicMsgOffset(int Handle, uint32_t Period) const {
+  uint16_t k=0;
+
+  if ( Period==0 ) return 0;
+
+  for ( uint16_t i=0; i<PeriodicMsgCount; i++ ) {
+    if ( i!=Handle && PeriodicMsgs[i].Scheduler.IsEnabled() && PeriodicMsgs[i].Scheduler.GetPeriod()==Period ) k++;
+  }
+
+  // Reverse bits of k to get van der Corput fraction 0, 1/2, 1/4, 3/4,...
+  uint16_t Rev=0;
+  for ( uint8_t b=0; b<16; b++, k>>=1 ) Rev=(Rev<<1) | (k & 1);
+
+  return ((uint64_t)Period*Rev)>>16;
+}
+
+//*****************************************************************************
+uint16_t tNMEA2000::PeriodicMsgHeapUp(uint16_t Pos) {
+  uint16_t Handle=PeriodicMsgHeap[Pos];
+  uint64_t NextTime=PeriodicMsgs[Handle].Scheduler.GetNextTime();
+
+  while ( Pos>0 ) {
+    uint16_t Parent=(Pos-1)/2;
+    if ( !(NextTime<PeriodicMsgs[PeriodicMsgHeap[Parent]].Scheduler.GetNextTime()) ) break;
+    PeriodicMsgHeap[Pos]=PeriodicMsgHeap[Parent];
+    PeriodicMsgs[PeriodicMsgHeap[Pos]].HeapPos=Pos;
+    Pos=Parent;
+  }
+  PeriodicMsgHeap[Pos]=Handle;
+  PeriodicMsgs[Handle].HeapPos=Pos;
+
+  return Pos;
+}
+
+//*****************************************************************************
+void tNMEA2000::PeriodicMsgHeapDown(uint16_t Pos) {
+  uint16_t Handle=PeriodicMsgHeap[Pos];
+  uint64_t NextTime=PeriodicMsgs[Handle].Scheduler.GetNextTime();
+
+  while ( true ) {
+    uint16_t Child=2*Pos+1;
+    if ( Child>=PeriodicMsgCount ) break;
+    if ( Child+1<PeriodicMsgCount &&
+         PeriodicMsgs[PeriodicMsgHeap[Child+1]].Scheduler.GetNextTime()<PeriodicMsgs[PeriodicMsgHeap[Child]].Scheduler.GetNextTime() ) Child++;
+    if ( !(PeriodicMsgs[PeriodicMsgHeap[Child]].Scheduler.GetNextTime()<NextTime) ) break;
+    PeriodicMsgHeap[Pos]=PeriodicMsgHeap[Child];
+    PeriodicMsgs[PeriodicMsgHeap[Pos]].HeapPos=Pos;
+    Pos=Child;
+  }
+  PeriodicMsgHeap[Pos]=Handle;
+  PeriodicMsgs[Handle].HeapPos=Pos;
+}
+
+//*****************************************************************************
+void tNMEA2000::RestartPeriodicMsgs() {
+  for ( uint16_t i=0; i<PeriodicMsgCount; i++ ) {
+    if ( PeriodicMsgs[i].Scheduler.IsEnabled() ) PeriodicMsgs[i].Scheduler.UpdateNextTime();
+  }
+  for ( uint16_t i=PeriodicMsgCount/2; i>0; i-- ) PeriodicMsgHeapDown(i-1);
+}
+
+//*****************************************************************************
+void tNMEA2000::SendPeriodicMsgs() {
+  if ( PeriodicMsgCount==0 ) return;
+
+  uint64_t Now=N2kMillis64();
+  while ( true ) {
+    uint16_t Handle=PeriodicMsgHeap[0];
+    if ( !(Now>PeriodicMsgs[Handle].Scheduler.GetNextTime()) ) break; // Nothing due. Disabled ones are never due.
+
+    PeriodicMsgs[Handle].Scheduler.UpdateNextTime();
+    PeriodicMsgHeapDown(0);
+
+    // Fill may add new messages, which reallocates PeriodicMsgs
+    tPeriodicMsgFill Fill=PeriodicMsgs[Handle].Fill;
+    void *Context=PeriodicMsgs[Handle].Context;
+    int DeviceIndex=PeriodicMsgs[Handle].DeviceIndex;
+    tN2kMsg N2kMsg;
+    if ( Fill(N2kMsg,Context) ) SendMsg(N2kMsg,DeviceIndex);
+  }
+}
+#endif
 
-  uint16_t temp = (CANSendFrameBufferWrite + 1) % MaxCANSendFrames;
+//*****************************************************************************
+tNMEA2000::tCANSendFrame *tNMEA2000::GetNextFreeCANSendFrame(uint8_t Priority) {
+  if (CANSendFrameBuf==0) return 0;
 
-  if (temp != CANSendFrameBufferRead) {
-    CANSendFrameBufferWrite = temp;
-    return &(CANSendFrameBuf[CANSendFrameBufferWrite]);
+  tCANSendFrame *Frame=CANSendFrameBuf->getAddRef(Priority & 0x7);
+#if !defined(N2K_NO_SEND_QUEUE_STATS)
+  if ( Frame!=0 ) {
+    Frame->QueueTime=N2kMicros();
   } else {
-    return 0;
+    SendQueueStats[Priority & 0x7].DroppedFrames++;
+  }
+#endif
+#if !defined(N2K_NO_STATISTICS)
+  if ( Frame!=0 ) {
+    Statistics.FramesBuffered++;
+    Statistics.SendBufFrames++;
+    if ( Statistics.SendBufFrames>Statistics.SendBufHighWater ) Statistics.SendBufHighWater=Statistics.SendBufFrames;
+  } else {
+    Statistics.SendFailures++;
   }
+#endif
+
+  return Frame;
 }
 
 //*****************************************************************************
@@ -1488,6 +1995,37 @@ void tNMEA2000::SendPendingInformation() {
   }
 }
 
+#if defined(N2K_THREAD_SAFE_SEND)
+//*****************************************************************************
+bool tNMEA2000::PostMsg(const tN2kMsg &N2kMsg, int DeviceIndex) {
+  tPostedMsg Posted;
+
+  Posted.N2kMsg=N2kMsg;
+  Posted.DeviceIndex=DeviceIndex;
+  if ( PostMsgBuf->add(Posted) ) return true;
+
+  PostMsgOverflows.fetch_add(1,std::memory_order_relaxed);
+  return false;
+}
+
+//*****************************************************************************
+void tNMEA2000::SetPostMsgBufSize(uint16_t MaxPostMsgs) {
+  delete PostMsgBuf;
+  PostMsgBuf=new tMPSCRingBuffer<tPostedMsg>(MaxPostMsgs);
+}
+
+//*****************************************************************************
+void tNMEA2000::SendPostedMsgs() {
+  tPostedMsg *Posted;
+
+  for ( uint16_t i=PostMsgBuf->getSize(); i>0 && (Posted=PostMsgBuf->peek())!=0; i-- ) {
+    // Failed message will be dropped as with SendMsg. Frame failures are counted on statistics.
+    SendMsg(Posted->N2kMsg,Posted->DeviceIndex);
+    PostMsgBuf->pop();
+  }
+}
+#endif
+
 //*****************************************************************************
 // Sends message to N2k bus
 //
@@ -1524,8 +2062,13 @@ bool tNMEA2000::SendMsg(const tN2kMsg &N2kMsg, int DeviceIndex) {
       if ( IsAddressClaimStarted(DeviceIndex) && N2kMsg.PGN!=N2kPGNIsoAddressClaim ) return false;
 
       if (N2kMsg.DataLen<=8 && !IsFastPacket(N2kMsg) ) { // We can send single frame
+          uint8_t Instance;
           DbgPrintBuf(N2kMsg.DataLen, N2kMsg.Data,true);
-          result=SendFrame(canId, N2kMsg.DataLen, N2kMsg.Data,false);
+          if ( IsSendCoalesceMsg(N2kMsg,Instance) ) {
+            result=SendCoalescedFrame(canId, Instance, N2kMsg.DataLen, N2kMsg.Data);
+          } else {
+            result=SendFrame(canId, N2kMsg.DataLen, N2kMsg.Data,false);
+          }
           if (!result && ForwardStream!=0 && ForwardType==tNMEA2000::fwdt_Text) { ForwardStream->print(F("PGN ")); ForwardStream->print(N2kMsg.PGN); ForwardStream->println(F(" send failed")); }
           N2kPrintFreeMemory("SendMsg, single frame");
       } else { // Send it as fast packet in multiple frames
@@ -1535,12 +2078,17 @@ bool tNMEA2000::SendMsg(const tN2kMsg &N2kMsg, int DeviceIndex) {
         } else
 #endif
         {
-          unsigned char temp[8]; // {0,0,0,0,0,0,0,0};
+          tCANFrame Frames[N2kCANSendFramesBatch];
+          uint16_t nFrames=0;
           int cur=0;
           int frames=(N2kMsg.DataLen>6 ? (N2kMsg.DataLen-6-1)/7+1+1 : 1 );
           int Order=GetSequenceCounter(N2kMsg.PGN,DeviceIndex)<<5;
           result=true;
           for (int i = 0; i<frames && result; i++) {
+              unsigned char *temp=Frames[nFrames].buf;
+              Frames[nFrames].id=canId;
+              Frames[nFrames].len=8;
+              nFrames++;
               temp[0] = i|Order; //frame counter
               if (i==0) {
                   temp[1] = N2kMsg.DataLen; //total bytes in fast packet
@@ -1563,7 +2111,10 @@ bool tNMEA2000::SendMsg(const tN2kMsg &N2kMsg, int DeviceIndex) {
               }
 
               DbgPrintBuf(8,temp,true);
-              result=SendFrame(canId, 8, temp, true);
+              if ( nFrames<N2kCANSendFramesBatch && i<frames-1 ) continue; // Collect more frames
+
+              result=SendFrameBatch(Frames, nFrames, true);
+              nFrames=0;
               if (!result && ForwardStream!=0 && ForwardType==tNMEA2000::fwdt_Text) {
                 ForwardStream->print(F("PGN ")); ForwardStream->print(N2kMsg.PGN);
                 ForwardStream->print(F(", frame:")); ForwardStream->print(i); ForwardStream->print(F("/")); ForwardStream->print(frames);
@@ -1594,22 +2145,7 @@ void tNMEA2000::SetDebugMode(tDebugMode _dbMode) {
 
 //*****************************************************************************
 bool tNMEA2000::IsFastPacketPGN(unsigned long PGN) {
-  if ( IsFastPacketSystemMessage(PGN) || IsMandatoryFastPacketMessage(PGN) ||
-       ( FastPacketMessages[0]==0 && IsDefaultFastPacketMessage(PGN) ) ||
-       IsProprietaryFastPacketMessage(PGN) ) return true;
-
-  int i;
-
-    for (unsigned char igroup=0; (igroup<N2kMessageGroups); igroup++)  {
-      if (FastPacketMessages[igroup]!=0) {
-        for (i=0; pgm_read_dword(&FastPacketMessages[igroup][i])!=PGN && pgm_read_dword(&FastPacketMessages[igroup][i])!=0; i++);
-        if (pgm_read_dword(&FastPacketMessages[igroup][i])==PGN) {
-         return true;
-        }
-      }
-    }
-
-    return false;
+  return (ClassifyPGN(PGN) & N2kPGNClassTxFastPacket)!=0;
 }
 
 //*****************************************************************************
@@ -1621,42 +2157,113 @@ bool tNMEA2000::IsFastPacket(const tN2kMsg &N2kMsg) {
 
 //*****************************************************************************
 bool tNMEA2000::CheckKnownMessage(unsigned long PGN, bool &SystemMessage, bool &FastPacket) {
+  uint8_t Class=ClassifyPGN(PGN);
+
+    SystemMessage=(Class & N2kPGNClassSystem)!=0;
+    FastPacket=(Class & N2kPGNClassFastPacket)!=0;
+
+    return (Class & N2kPGNClassKnown)!=0;
+}
+
+// User list index flags. Entries are packed as PGN<<2 | flags.
+#define N2kUserPGNRxFastPacket  0x01 // First list containing PGN is fast packet list
+#define N2kUserPGNInFastList    0x02 // PGN is on some fast packet list
+#define N2kUserPGNListed        0x80 // Returned by FindUserPGNClass for any listed PGN
+
+//*****************************************************************************
+void tNMEA2000::BuildUserPGNClasses() {
+  uint16_t Count=0;
   int i;
-//    return true;
-    FastPacket=false;
-    SystemMessage=false;
-    if ( PGN==0 ) { return false; }  // Unknown
-
-    // Check other messages
-    if ( SingleFrameMessages[0]==0 && IsDefaultSingleFrameMessage(PGN) ) return true;
-    if ( (FastPacket=IsMandatoryFastPacketMessage(PGN)) ) return true;
-    if ( FastPacketMessages[0]==0 && (FastPacket=IsDefaultFastPacketMessage(PGN))==true ) return true;
-
-    // Check system messages
-    if ( IsSingleFrameSystemMessage(PGN) || (FastPacket=IsFastPacketSystemMessage(PGN))==true ) {
-      SystemMessage=true;
-      return true;
-    }
 
-    // Check user defined messages
-    for (unsigned char igroup=0; (igroup<N2kMessageGroups); igroup++)  {
-      if (SingleFrameMessages[igroup]!=0) {
-        for (i=0; pgm_read_dword(&SingleFrameMessages[igroup][i])!=PGN && pgm_read_dword(&SingleFrameMessages[igroup][i])!=0; i++);
-        if (pgm_read_dword(&SingleFrameMessages[igroup][i])==PGN) return true;
-      }
+    UserPGNClassesChanged=false;
+    if ( UserPGNClasses!=0 ) delete[] UserPGNClasses;
+    UserPGNClasses=0;
+    UserPGNClassCount=0;
 
-      if (FastPacketMessages[igroup]!=0) {
-        for (i=0; pgm_read_dword(&FastPacketMessages[igroup][i])!=PGN && pgm_read_dword(&FastPacketMessages[igroup][i])!=0; i++);
-        if (pgm_read_dword(&FastPacketMessages[igroup][i])==PGN) {
-         FastPacket=true;
-         return true;
+    for (unsigned char igroup=0; igroup<N2kMessageGroups; igroup++) {
+      if ( SingleFrameMessages[igroup]!=0 ) for (i=0; pgm_read_dword(&SingleFrameMessages[igroup][i])!=0; i++) Count++;
+      if ( FastPacketMessages[igroup]!=0 ) for (i=0; pgm_read_dword(&FastPacketMessages[igroup][i])!=0; i++) Count++;
+    }
+    if ( Count==0 ) return;
+
+    UserPGNClasses=new uint32_t[Count];
+
+    // Lists are handled in same order as they were earlier scanned, so first list containing PGN defines receive framing.
+    for (unsigned char igroup=0; igroup<N2kMessageGroups; igroup++) {
+      for (uint8_t FastList=0; FastList<2; FastList++) {
+        const unsigned long *List=(FastList?FastPacketMessages[igroup]:SingleFrameMessages[igroup]);
+        if ( List==0 ) continue;
+        for (i=0; ; i++) {
+          unsigned long PGN=pgm_read_dword(&List[i]);
+          if ( PGN==0 ) break;
+          uint32_t Key=(uint32_t)PGN<<2;
+          uint16_t Pos;
+          for (Pos=UserPGNClassCount; Pos>0 && (UserPGNClasses[Pos-1] & ~3UL)>Key; Pos--);
+          if ( Pos>0 && (UserPGNClasses[Pos-1] & ~3UL)==Key ) { // Already on index
+            if ( FastList ) UserPGNClasses[Pos-1]|=N2kUserPGNInFastList;
+          } else {
+            for (uint16_t j=UserPGNClassCount; j>Pos; j--) UserPGNClasses[j]=UserPGNClasses[j-1];
+            UserPGNClasses[Pos]=Key | (FastList?N2kUserPGNRxFastPacket | N2kUserPGNInFastList:0);
+            UserPGNClassCount++;
+          }
         }
       }
     }
+}
 
-    FastPacket=IsProprietaryFastPacketMessage(PGN);
-    
-    return false;
+//*****************************************************************************
+uint8_t tNMEA2000::FindUserPGNClass(unsigned long PGN) {
+  if ( UserPGNClassesChanged ) BuildUserPGNClasses();
+  if ( UserPGNClassCount==0 ) return 0;
+
+  int Low=0;
+  int High=UserPGNClassCount-1;
+  uint32_t Key=(uint32_t)PGN<<2;
+
+    while ( Low<=High ) {
+      int Mid=(Low+High)>>1;
+      uint32_t Entry=UserPGNClasses[Mid];
+      if ( (Entry & ~3UL)==Key ) return (Entry & 3) | N2kUserPGNListed;
+      if ( Entry<Key ) { Low=Mid+1; } else { High=Mid-1; }
+    }
+
+    return 0;
+}
+
+//*****************************************************************************
+uint8_t tNMEA2000::ClassifyPGN(unsigned long PGN) {
+  if ( PGN==0 || PGN>0x1ffffUL ) return 0; // Unknown
+
+  uint8_t Class=N2kPGNClassKnown;
+  uint8_t UserClass;
+
+    switch ( FindDefaultPGNClass(PGN) ) {
+      case N2kpgnc_DefaultSingleFrame:
+        if ( SingleFrameMessages[0]!=0 ) break;
+        UserClass=FindUserPGNClass(PGN);
+        return Class | ( (UserClass & N2kUserPGNInFastList)?N2kPGNClassTxFastPacket:0 );
+      case N2kpgnc_MandatoryFastPacket:
+        return Class | N2kPGNClassFastPacket | N2kPGNClassTxFastPacket;
+      case N2kpgnc_DefaultFastPacket:
+        if ( FastPacketMessages[0]!=0 ) break;
+        return Class | N2kPGNClassFastPacket | N2kPGNClassTxFastPacket;
+      case N2kpgnc_SingleFrameSystem:
+        UserClass=FindUserPGNClass(PGN);
+        return Class | N2kPGNClassSystem | ( (UserClass & N2kUserPGNInFastList)?N2kPGNClassTxFastPacket:0 );
+      case N2kpgnc_FastPacketSystem:
+        return Class | N2kPGNClassSystem | N2kPGNClassFastPacket | N2kPGNClassTxFastPacket;
+    }
+
+    // Not on default lists or default lists has been replaced by user lists.
+    UserClass=FindUserPGNClass(PGN);
+    if ( UserClass==0 ) {
+      return ( IsProprietaryFastPacketMessage(PGN)?N2kPGNClassFastPacket | N2kPGNClassTxFastPacket:0 );
+    }
+
+    if ( UserClass & N2kUserPGNRxFastPacket ) Class|=N2kPGNClassFastPacket;
+    if ( (UserClass & N2kUserPGNInFastList) || IsProprietaryFastPacketMessage(PGN) ) Class|=N2kPGNClassTxFastPacket;
+
+    return Class;
 }
 
 /************************************************************************//**
@@ -1668,9 +2275,11 @@ bool tNMEA2000::CheckKnownMessage(unsigned long PGN, bool &SystemMessage, bool &
  * \param buf     Pointer to a buffer
  */
 void CopyBufToCANMsg(tN2kCANMsg &CANMsg, unsigned char start, unsigned char len, unsigned char *buf) {
-        for (int j=start; (j<len) & (CANMsg.CopiedLen<CANMsg.N2kMsg.MaxDataLen); j++, CANMsg.CopiedLen++) {
-          CANMsg.N2kMsg.Data[CANMsg.CopiedLen]=buf[j];
-        }
+  if ( start>=len || CANMsg.CopiedLen>=CANMsg.DataLen ) return;
+  uint16_t n=len-start;
+  if ( n>CANMsg.DataLen-CANMsg.CopiedLen ) n=CANMsg.DataLen-CANMsg.CopiedLen;
+  memcpy(CANMsg.GetData()+CANMsg.CopiedLen,buf+start,n);
+  CANMsg.CopiedLen+=n;
 }
 
 //*****************************************************************************
@@ -1678,32 +2287,96 @@ void CopyBufToCANMsg(tN2kCANMsg &CANMsg, unsigned char start, unsigned char len,
 void tNMEA2000::FindFreeCANMsgIndex(unsigned long PGN, unsigned char Source, unsigned char Destination, bool TPMsg, uint8_t &MsgIndex) {
 #else
 void tNMEA2000::FindFreeCANMsgIndex(unsigned long PGN, unsigned char Source, unsigned char Destination, uint8_t &MsgIndex) {
+  const bool TPMsg=false;
 #endif
+  // Same message under reassembly will be restarted
+  MsgIndex=N2kCANMsgIndex.Find(N2kCANMsgBuf,PGN,Source,Destination,TPMsg);
+  if ( MsgIndex==N2kCANMsgIndexEmpty ) MsgIndex=N2kCANMsgIndex.PeekFree();
+  if ( MsgIndex!=N2kCANMsgIndexEmpty ) return;
+
+  // Buffer is full, so use the oldest one, if it has timed out
   unsigned long OldestMsgTime,CurTime;
-  int OldestIndex;
-
-  for (MsgIndex=0, CurTime=OldestMsgTime=N2kMillis(), OldestIndex=MaxN2kCANMsgs;
-       MsgIndex<MaxN2kCANMsgs &&
-       !( N2kCANMsgBuf[MsgIndex].FreeMsg ||
-         ( N2kCANMsgBuf[MsgIndex].N2kMsg.PGN==PGN
-           && N2kCANMsgBuf[MsgIndex].N2kMsg.Source==Source
-           && N2kCANMsgBuf[MsgIndex].N2kMsg.Destination==Destination
-#if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
-           && N2kCANMsgBuf[MsgIndex].N2kMsg.IsTPMessage()==TPMsg
-#endif
-         )
-        );
-       MsgIndex++) { // Find free message place
+  uint8_t OldestIndex=MaxN2kCANMsgs;
+
+  CurTime=OldestMsgTime=N2kMillis();
+  for (MsgIndex=0; MsgIndex<MaxN2kCANMsgs; MsgIndex++) {
     if ( N2kIsTimeBefore(N2kCANMsgBuf[MsgIndex].N2kMsg.MsgTime,OldestMsgTime) ) {
       OldestIndex=MsgIndex;
       OldestMsgTime=N2kCANMsgBuf[MsgIndex].N2kMsg.MsgTime;
     }
   }
-  if ( MsgIndex==MaxN2kCANMsgs && N2kHasElapsed(OldestMsgTime,Max_N2kMsgBuf_Time,CurTime) ) {
+  MsgIndex=MaxN2kCANMsgs;
+  if ( OldestIndex<MaxN2kCANMsgs && N2kHasElapsed(OldestMsgTime,Max_N2kMsgBuf_Time,CurTime) ) {
     MsgIndex=OldestIndex; // Use the old one, which has timed out
-    N2kCANMsgBuf[MsgIndex].FreeMessage();
+    FreeCANMsg(MsgIndex);
+    N2kStatsAdd(SlotEvictions,1);
+  }
+}
+
+//*****************************************************************************
+void tNMEA2000::ClaimCANMsg(uint8_t MsgIndex) {
+  N2kCANMsgIndex.Claim(N2kCANMsgBuf,MsgIndex);
+  N2kCANMsgBuf[MsgIndex].FreeMsg=false;
+#if !defined(N2K_NO_STATISTICS)
+  uint8_t SlotsInUse=MaxN2kCANMsgs-N2kCANMsgIndex.GetFreeCount();
+  if ( SlotsInUse>Statistics.SlotsHighWater ) Statistics.SlotsHighWater=SlotsInUse;
+#endif
+}
+
+//*****************************************************************************
+void tNMEA2000::FreeCANMsg(uint8_t MsgIndex) {
+  N2kCANMsgIndex.Release(N2kCANMsgBuf,MsgIndex);
+  if ( N2kCANMsgBuf[MsgIndex].IsLongMessage() ) N2kMsgBufPool.Free(N2kCANMsgBuf[MsgIndex].GetData());
+  N2kCANMsgBuf[MsgIndex].FreeMessage();
+}
+
+//*****************************************************************************
+bool tNMEA2000::AllocCANMsgData(uint8_t MsgIndex, uint16_t DataLen) {
+  tN2kCANMsg &CANMsg=N2kCANMsgBuf[MsgIndex];
+
+  // Restarted message may already have buffer.
+  if ( CANMsg.IsLongMessage() ) N2kMsgBufPool.Free(CANMsg.GetData());
+  CANMsg.DataLen=0;
+
+  // Message fitting to tN2kMsg will be reassembled directly to it.
+  if ( DataLen<=tN2kMsg::MaxDataLen ) {
+    CANMsg.DataLen=DataLen;
+    return true;
+  }
+  if ( !CANMsg.IsTPMessage() ) return false;
+
+  uint16_t BufSize;
+  unsigned char *Buf=N2kMsgBufPool.Alloc(DataLen,BufSize);
+
+  // Pool is empty, so release timed out long messages
+  unsigned long CurTime=N2kMillis();
+  for (uint8_t i=0; Buf==0 && i<MaxN2kCANMsgs; i++) {
+    if ( i==MsgIndex || N2kCANMsgBuf[i].FreeMsg || !N2kCANMsgBuf[i].IsLongMessage() ) continue;
+    if ( !N2kHasElapsed(N2kCANMsgBuf[i].N2kMsg.MsgTime,Max_N2kMsgBuf_Time,CurTime) ) continue;
+    FreeCANMsg(i);
+    N2kStatsAdd(SlotEvictions,1);
+    Buf=N2kMsgBufPool.Alloc(DataLen,BufSize);
+  }
+  if ( Buf==0 ) return false;
+
+  CANMsg.SetPoolData(Buf,DataLen);
+  return true;
+}
+
+//*****************************************************************************
+bool tNMEA2000::StartCANMsg(uint8_t MsgIndex, uint16_t DataLen) {
+  if ( !AllocCANMsgData(MsgIndex,DataLen) ) {
+    FreeCANMsg(MsgIndex);
+    N2kStatsAdd(NoFreeSlot,1);
+    return false;
   }
 
+  N2kCANMsgBuf[MsgIndex].CopiedLen=0;
+#if !defined(N2K_NO_RX_TIMESTAMP)
+  N2kCANMsgBuf[MsgIndex].N2kMsg.RxStartTime=N2kCANMsgBuf[MsgIndex].N2kMsg.RxTime=FrameRxTime;
+#endif
+  ClaimCANMsg(MsgIndex);
+  return true;
 }
 
 #if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
@@ -1787,6 +2460,7 @@ void tNMEA2000::SendTPCM_Abort(unsigned long PGN, unsigned char Destination, int
   tN2kMsg N2kMsg;
 
   if ( !IsActiveNode() ) return;
+  N2kStatsAdd(TPAborts,1);
   N2kMsg.Source=Devices[iDev].N2kSource;
   N2kMsg.Destination=Destination;
   N2kMsg.SetPGN(TP_CM);
@@ -1851,21 +2525,24 @@ bool tNMEA2000::TestHandleTPMessage(unsigned long PGN, unsigned char Source, uns
 
         if (MsgIndex==MaxN2kCANMsgs) { // No free msg place
           N2kMsgDbgStart("No free msg slot"); N2kMsgDbgln();
+          N2kStatsAdd(NoFreeSlot,1);
           if ( (TP_CM_Control==TP_CM_RTS) && (iDev>=0) ) { // If it was for us and not broadcast, we need to abort transport
             SendTPCM_Abort(TransportPGN,Source,iDev,TP_CM_AbortBusy);
           }
         } else { // Start transport
           N2kMsgDbgStart("Use msg slot: "); N2kMsgDbgln(MsgIndex);
           bool FastPacket;
-          N2kCANMsgBuf[MsgIndex].KnownMessage=CheckKnownMessage(TransportPGN,N2kCANMsgBuf[MsgIndex].SystemMessage,FastPacket);
-          if ( nBytes < tN2kMsg::MaxDataLen &&  // Currently we can handle only tN2kMsg::MaxDataLen long messages
+          bool SystemMessage;
+          N2kCANMsgBuf[MsgIndex].KnownMessage=CheckKnownMessage(TransportPGN,SystemMessage,FastPacket);
+          N2kCANMsgBuf[MsgIndex].SystemMessage=SystemMessage;
+          if ( (nBytes <= tN2kMsg::MaxDataLen || nBytes <= N2kMsgBufPool.MaxSize()) &&  // Pool limits long message length
                (N2kCANMsgBuf[MsgIndex].KnownMessage || !HandleOnlyKnownMessages()) ) {
-            N2kCANMsgBuf[MsgIndex].FreeMsg=false;
-            N2kCANMsgBuf[MsgIndex].N2kMsg.Init(7 /* Priority? */,TransportPGN,Source,Destination);
-            N2kCANMsgBuf[MsgIndex].CopiedLen=0;
-            N2kCANMsgBuf[MsgIndex].LastFrame=0;
-            N2kCANMsgBuf[MsgIndex].N2kMsg.DataLen=nBytes;
-            N2kCANMsgBuf[MsgIndex].N2kMsg.SetIsTPMessage();
+            N2kCANMsgBuf[MsgIndex].Init(7 /* Priority? */,TransportPGN,Source,Destination,true);
+            if ( !StartCANMsg(MsgIndex,nBytes) ) MsgIndex=MaxN2kCANMsgs;
+          } else {
+            MsgIndex=MaxN2kCANMsgs;
+          }
+          if ( MsgIndex<MaxN2kCANMsgs ) {
             N2kCANMsgBuf[MsgIndex].TPMaxPackets=TPMaxPackets;
             if ( (TP_CM_Control==TP_CM_RTS) && (iDev>=0) ) { // If it was for us and not broadcast, we need to response
               SendTPCM_CTS(TransportPGN,Source,iDev,N2kCANMsgBuf[MsgIndex].TPMaxPackets,N2kCANMsgBuf[MsgIndex].LastFrame+1);
@@ -1873,7 +2550,7 @@ bool tNMEA2000::TestHandleTPMessage(unsigned long PGN, unsigned char Source, uns
             } else {
               N2kCANMsgBuf[MsgIndex].TPMaxPackets=0xff; // TPMaxPackets>0 indicates that it is TP message
             }
-          } else { // Too long or unknown
+          } else { // Too long, unknown or no buffer
             if ( (TP_CM_Control==TP_CM_RTS) && (iDev>=0) ) { // If it was for us and not broadcast, we need to response
               SendTPCM_Abort(TransportPGN,Source,iDev,TP_CM_AbortBusy);  // Abort
             }
@@ -1911,6 +2588,7 @@ bool tNMEA2000::TestHandleTPMessage(unsigned long PGN, unsigned char Source, uns
       case TP_CM_Abort:
         if ( !IsValidDevice(iDev) ) break; // Should never fail
         N2kMsgDbgStart("Got TP Abort"); N2kMsgDbgln(MsgIndex);
+        N2kStatsAdd(TPAborts,1);
         if ( IsBroadcast(Devices[iDev].PendingTPMsg.Destination) ) break; // We should not get controls for broadcast TP msg
         EndSendTPMessage(iDev);
         break;
@@ -1925,7 +2603,7 @@ bool tNMEA2000::TestHandleTPMessage(unsigned long PGN, unsigned char Source, uns
     for (MsgIndex=0;
          MsgIndex<MaxN2kCANMsgs &&
          !( !N2kCANMsgBuf[MsgIndex].FreeMsg
-            && N2kCANMsgBuf[MsgIndex].N2kMsg.IsTPMessage()
+            && N2kCANMsgBuf[MsgIndex].IsTPMessage()
             && N2kCANMsgBuf[MsgIndex].N2kMsg.Destination==Destination
             && N2kCANMsgBuf[MsgIndex].N2kMsg.Source==Source
           );
@@ -1940,10 +2618,13 @@ bool tNMEA2000::TestHandleTPMessage(unsigned long PGN, unsigned char Source, uns
         N2kCANMsgBuf[MsgIndex].LastFrame=buf[0];
         // Transport protocol is slower, so to avoid timeout, we reset message time
         N2kCANMsgBuf[MsgIndex].N2kMsg.MsgTime=N2kMillis();
-        if ( N2kCANMsgBuf[MsgIndex].CopiedLen>=N2kCANMsgBuf[MsgIndex].N2kMsg.DataLen ) { // all done
+#if !defined(N2K_NO_RX_TIMESTAMP)
+        N2kCANMsgBuf[MsgIndex].N2kMsg.RxTime=FrameRxTime;
+#endif
+        if ( N2kCANMsgBuf[MsgIndex].CopiedLen>=N2kCANMsgBuf[MsgIndex].DataLen ) { // all done
           N2kCANMsgBuf[MsgIndex].Ready=true;
           if ( N2kCANMsgBuf[MsgIndex].TPRequireCTS>0 && iDev>=0 ) { // send response
-            SendTPCM_EndAck(N2kCANMsgBuf[MsgIndex].N2kMsg.PGN,Source,iDev,N2kCANMsgBuf[MsgIndex].N2kMsg.DataLen,N2kCANMsgBuf[MsgIndex].LastFrame);
+            SendTPCM_EndAck(N2kCANMsgBuf[MsgIndex].N2kMsg.PGN,Source,iDev,N2kCANMsgBuf[MsgIndex].DataLen,N2kCANMsgBuf[MsgIndex].LastFrame);
           }
         } else {
           if ( N2kCANMsgBuf[MsgIndex].TPRequireCTS>0 && ((N2kCANMsgBuf[MsgIndex].LastFrame)%N2kCANMsgBuf[MsgIndex].TPRequireCTS)==0 ) { // send response
@@ -1952,10 +2633,11 @@ bool tNMEA2000::TestHandleTPMessage(unsigned long PGN, unsigned char Source, uns
         }
       } else { // Wrong packet - either we lost packet or sender sends wrong, so free this
         N2kMsgDbgStart("Invalid packet: "); N2kMsgDbgln(buf[0]);
+        N2kStatsAdd(LostFrames,1);
         if ( N2kCANMsgBuf[MsgIndex].TPRequireCTS>0 && iDev>=0 ) { // We need to abort transport
           SendTPCM_Abort(N2kCANMsgBuf[MsgIndex].N2kMsg.PGN,Source,iDev,TP_CM_AbortTimeout);  // Abort transport
         }
-        N2kCANMsgBuf[MsgIndex].FreeMessage();
+        FreeCANMsg(MsgIndex);
 
       }
       if ( !N2kCANMsgBuf[MsgIndex].Ready ) MsgIndex=MaxN2kCANMsgs;
@@ -2016,8 +2698,9 @@ inline bool IsFastPacketFirstFrame(unsigned char b) { return ((b & 0x1F)==0); }
 
 //*****************************************************************************
 // Function handles received CAN frame and adds it to tN2kCANMsg.
-// Returns: Index to ready tN2kCANMsg or MaxN2kCANMsgs, if we skipped the frame
-//          or message is not ready (fast packet or ISO Multi-Packet)
+// Returns: Index to ready tN2kCANMsg or MaxN2kCANMsgs, if we skipped the frame,
+//          message is not ready (fast packet or ISO Multi-Packet) or it was
+//          single frame message, which has been already handled.
 uint8_t tNMEA2000::SetN2kCANBufMsg(unsigned long canId, unsigned char len, unsigned char *buf) {
   unsigned char Priority;
   unsigned long PGN;
@@ -2038,30 +2721,31 @@ uint8_t tNMEA2000::SetN2kCANBufMsg(unsigned long canId, unsigned char len, unsig
         if (FastPacket && !IsFastPacketFirstFrame(buf[0]) ) { // Not first frame
         N2kFrameInDbgStart("New frame="); N2kFrameInDbg(PGN); N2kFrameInDbg(" frame="); N2kFrameInDbg(buf[0],HEX); N2kFrameInDbgln();
           // Find previous slot for this PGN
-          for (MsgIndex=0;
-               MsgIndex<MaxN2kCANMsgs &&
-               !( N2kCANMsgBuf[MsgIndex].N2kMsg.PGN==PGN
-                  && N2kCANMsgBuf[MsgIndex].N2kMsg.Source==Source
-#if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
-                  && !N2kCANMsgBuf[MsgIndex].N2kMsg.IsTPMessage()
-#endif
-                );
-               MsgIndex++);
+          MsgIndex=N2kCANMsgIndex.Find(N2kCANMsgBuf,PGN,Source,Destination,false);
+          if ( MsgIndex==N2kCANMsgIndexEmpty ) MsgIndex=MaxN2kCANMsgs;
           if (MsgIndex<MaxN2kCANMsgs) { // we found start for this message, so add data to it.
             N2kMsgRxDbgStart("Use msg slot: "); N2kMsgRxDbgln(MsgIndex);
             if (N2kCANMsgBuf[MsgIndex].LastFrame+1 == buf[0]) { // Right frame is coming
               N2kCANMsgBuf[MsgIndex].LastFrame=buf[0];
               CopyBufToCANMsg(N2kCANMsgBuf[MsgIndex],1,len,buf);
+#if !defined(N2K_NO_RX_TIMESTAMP)
+              N2kCANMsgBuf[MsgIndex].N2kMsg.RxTime=FrameRxTime;
+#endif
             } else { // We have lost frame, so free this
               N2kFrameErrDbgStart("Lost frame ");  N2kFrameErrDbg(N2kCANMsgBuf[MsgIndex].LastFrame); N2kFrameErrDbg("/");  N2kFrameErrDbg(buf[0]);
               N2kFrameErrDbg(", source ");  N2kFrameErrDbg(Source); N2kFrameErrDbg(" for: "); N2kFrameErrDbgln(PGN);
-              N2kCANMsgBuf[MsgIndex].FreeMessage();
+              FreeCANMsg(MsgIndex);
+              N2kStatsAdd(LostFrames,1);
               MsgIndex=MaxN2kCANMsgs;
             }
           } else {  // Orphan frame
               N2kFrameErrDbgStart("Orphan frame "); N2kFrameErrDbg(buf[0]); N2kFrameErrDbg(", source ");
               N2kFrameErrDbg(Source); N2kFrameErrDbg(" for: "); N2kFrameErrDbgln(PGN);
+              N2kStatsAdd(OrphanFrames,1);
           }
+        } else if ( !FastPacket ) { // Single frame does not need slot
+          N2kFrameInDbgStart("Single frame="); N2kFrameInDbg(PGN); N2kFrameInDbgln();
+          HandleSingleFrameMsg(Priority,PGN,Source,Destination,len,buf,SystemMessage,KnownMessage);
         } else { // Handle first frame
 #if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
           FindFreeCANMsgIndex(PGN,Source,Destination,false,MsgIndex);
@@ -2070,30 +2754,24 @@ uint8_t tNMEA2000::SetN2kCANBufMsg(unsigned long canId, unsigned char len, unsig
 #endif
           if ( MsgIndex<MaxN2kCANMsgs ) { // we found free place, so handle frame
             N2kMsgRxDbgStart("Use msg slot: "); N2kMsgRxDbgln(MsgIndex);
-            N2kCANMsgBuf[MsgIndex].FreeMsg=false;
             N2kCANMsgBuf[MsgIndex].KnownMessage=KnownMessage;
             N2kCANMsgBuf[MsgIndex].SystemMessage=SystemMessage;
-            N2kCANMsgBuf[MsgIndex].N2kMsg.Init(Priority,PGN,Source,Destination);
-#if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
-            N2kCANMsgBuf[MsgIndex].N2kMsg.SetIsTPMessage(false);
-#endif
-            N2kCANMsgBuf[MsgIndex].CopiedLen=0;
-            if (FastPacket) {
+            N2kCANMsgBuf[MsgIndex].Init(Priority,PGN,Source,Destination);
+            if ( !StartCANMsg(MsgIndex,buf[1]) ) { // No buffer for the message
+              N2kFrameErrDbgStart("No buffer for: "); N2kFrameErrDbgln(PGN);
+              MsgIndex=MaxN2kCANMsgs;
+            } else {
               CopyBufToCANMsg(N2kCANMsgBuf[MsgIndex],2,len,buf);
               N2kFrameInDbgStart("First frame="); N2kFrameInDbg(PGN);  N2kFrameInDbgln();
               N2kCANMsgBuf[MsgIndex].LastFrame=buf[0];
-              N2kCANMsgBuf[MsgIndex].N2kMsg.DataLen=buf[1];
-            } else {
-              CopyBufToCANMsg(N2kCANMsgBuf[MsgIndex],0,len,buf);
-              N2kFrameInDbgStart("Single frame="); N2kFrameInDbg(PGN); N2kFrameInDbgln();
-              N2kCANMsgBuf[MsgIndex].LastFrame=0;
-              N2kCANMsgBuf[MsgIndex].N2kMsg.DataLen=len;
             }
+          } else {
+            N2kStatsAdd(NoFreeSlot,1);
           }
         }
 
         if ( MsgIndex<MaxN2kCANMsgs ) {
-          N2kCANMsgBuf[MsgIndex].Ready=(N2kCANMsgBuf[MsgIndex].CopiedLen>=N2kCANMsgBuf[MsgIndex].N2kMsg.DataLen);
+          N2kCANMsgBuf[MsgIndex].Ready=(N2kCANMsgBuf[MsgIndex].CopiedLen>=N2kCANMsgBuf[MsgIndex].DataLen);
           if ( !N2kCANMsgBuf[MsgIndex].Ready ) MsgIndex=MaxN2kCANMsgs; // If packet is not ready, do not return index to it
         }
       }
@@ -2133,8 +2811,8 @@ void tNMEA2000::ForwardMessage(const tN2kMsg &N2kMsg) {
 }
 
 //*****************************************************************************
-void tNMEA2000::ForwardMessage(const tN2kCANMsg &N2kCanMsg) {
-  if ( N2kCanMsg.KnownMessage || !ForwardOnlyKnownMessages() ) ForwardMessage(N2kCanMsg.N2kMsg);
+void tNMEA2000::ForwardMessage(const tN2kMsg &N2kMsg, bool KnownMessage) {
+  if ( KnownMessage || !ForwardOnlyKnownMessages() ) ForwardMessage(N2kMsg);
 }
 
 //*****************************************************************************
@@ -2590,29 +3268,29 @@ void tNMEA2000::GetNextAddress(int DeviceIndex, bool RestartAtEnd) {
 }
 
 //*****************************************************************************
-bool tNMEA2000::HandleReceivedSystemMessage(int MsgIndex) {
+bool tNMEA2000::HandleReceivedSystemMessage(const tN2kMsg &N2kMsg, bool SystemMessage) {
   bool result=false;
 
    if ( N2kMode==N2km_SendOnly || N2kMode==N2km_ListenAndSend ) return result;
 
-    if ( N2kCANMsgBuf[MsgIndex].SystemMessage ) {
-      if ( ForwardSystemMessages() ) ForwardMessage(N2kCANMsgBuf[MsgIndex].N2kMsg);
+    if ( SystemMessage ) {
+      if ( ForwardSystemMessages() ) ForwardMessage(N2kMsg);
       if ( N2kMode!=N2km_ListenOnly ) { // Note that in listen only mode we will not inform us to the bus
-        switch (N2kCANMsgBuf[MsgIndex].N2kMsg.PGN) {
+        switch (N2kMsg.PGN) {
           case 59392L: /*ISO Acknowledgement*/
             break;
           case 59904L: /*ISO Request*/
-            HandleISORequest(N2kCANMsgBuf[MsgIndex].N2kMsg);
+            HandleISORequest(N2kMsg);
             break;
           case 60928L: /*ISO Address Claim*/
-            HandleISOAddressClaim(N2kCANMsgBuf[MsgIndex].N2kMsg);
+            HandleISOAddressClaim(N2kMsg);
             break;
           case 65240L: /*Commanded Address*/
-            HandleCommandedAddress(N2kCANMsgBuf[MsgIndex].N2kMsg);
+            HandleCommandedAddress(N2kMsg);
             break;
 #if !defined(N2K_NO_GROUP_FUNCTION_SUPPORT)
           case 126208L: /*NMEA Request/Command/Acknowledge group function*/
-            HandleGroupFunction(N2kCANMsgBuf[MsgIndex].N2kMsg);
+            HandleGroupFunction(N2kMsg);
             break;
 #endif
         }
@@ -2623,20 +3301,31 @@ bool tNMEA2000::HandleReceivedSystemMessage(int MsgIndex) {
   return result;
 }
 
+//*****************************************************************************
+uint16_t tNMEA2000::CANGetFrames(tCANFrame *Frames, uint16_t MaxFrames) {
+  uint16_t Count=0;
+
+  for ( ; Count<MaxFrames && CANGetFrame(Frames[Count].id,Frames[Count].len,Frames[Count].buf); Count++ );
+
+  return Count;
+}
+
 //*****************************************************************************
 void tNMEA2000::ParseMessages() {
-    unsigned long canId;
-    unsigned char len = 0;
-    unsigned char buf[8];
+    tCANFrame Frames[N2kMaxCANGetFrames];
+    uint16_t nFrames;
     uint8_t MsgIndex;
-    static const int MaxReadFramesOnParse=20;
-    int FramesRead=0;
-//    tN2kMsg N2kMsg;
+    uint16_t FramesRead=0;
+    uint32_t StartTime;
 
     if ( OpenState!=os_Open ) {
       if ( !(Open() && OpenState==os_Open) ) return;  // Can not do much
     }
 
+#if defined(N2K_THREAD_SAFE_SEND)
+    SendPostedMsgs();
+#endif
+
     if (dbMode != dm_None) return; // No much to do here, when in Debug mode
 
     SendFrames();
@@ -2645,40 +3334,345 @@ void tNMEA2000::ParseMessages() {
     TestISR();
 #endif
 
-    while (FramesRead<MaxReadFramesOnParse && CANGetFrame(canId,len,buf) ) {           // check if data coming
-        FramesRead++;
-        N2kMsgRxDbgStart("Received frame, can ID:"); N2kMsgRxDbg(canId); N2kMsgRxDbg(" len:"); N2kMsgRxDbg(len); N2kMsgRxDbg(" data:"); DbgPrintBuf(len,buf,false); N2kMsgRxDbgln();
-        MsgIndex=SetN2kCANBufMsg(canId,len,buf);
+    StartTime=(MaxParseTime!=0?N2kMicros():0);
+    ReadLimitReached=true;
+    while ( FramesRead<MaxReadFramesOnParse ) {
+      nFrames=MaxReadFramesOnParse-FramesRead;
+      if ( nFrames>N2kMaxCANGetFrames ) nFrames=N2kMaxCANGetFrames;
+#if !defined(N2K_NO_RX_TIMESTAMP)
+      for ( uint16_t i=0; i<nFrames; i++ ) Frames[i].RxTime=0;
+#endif
+      uint16_t FramesGot=ReadFrames(Frames,nFrames);
+      FramesRead+=FramesGot;
+      N2kStatsAdd(FramesReceived,FramesGot);
+#if !defined(N2K_NO_RX_TIMESTAMP)
+      uint64_t ReadTime=(FramesGot>0?N2kMicros64():0);
+#endif
+
+      for ( uint16_t i=0; i<FramesGot; i++ ) {
+        tCANFrame &Frame=Frames[i];
+#if !defined(N2K_NO_RX_TIMESTAMP)
+        FrameRxTime=(Frame.RxTime!=0?Frame.RxTime:ReadTime);
+#endif
+        N2kMsgRxDbgStart("Received frame, can ID:"); N2kMsgRxDbg(Frame.id); N2kMsgRxDbg(" len:"); N2kMsgRxDbg(Frame.len); N2kMsgRxDbg(" data:"); DbgPrintBuf(Frame.len,Frame.buf,false); N2kMsgRxDbgln();
+        if ( FrameHandler!=0 ) FrameHandler->HandleFrame(Frame);
+        MsgIndex=SetN2kCANBufMsg(Frame.id,Frame.len,Frame.buf);
         if (MsgIndex<MaxN2kCANMsgs) {
-          if ( !HandleReceivedSystemMessage(MsgIndex) ) {
-            N2kMsgRxDbgStart(" - Non system message, MsgIndex: "); N2kMsgRxDbgln(MsgIndex);
-            ForwardMessage(N2kCANMsgBuf[MsgIndex]);
-          }
-//          N2kCANMsgBuf[MsgIndex].N2kMsg.Print(Serial);
-          RunMessageHandlers(N2kCANMsgBuf[MsgIndex].N2kMsg);
-          N2kCANMsgBuf[MsgIndex].FreeMessage();
+          HandleCANMsg(N2kCANMsgBuf[MsgIndex]);
+          FreeCANMsg(MsgIndex);
           N2kMsgRxDbgStart(" - Free message, MsgIndex: "); N2kMsgRxDbg(MsgIndex); N2kMsgRxDbgln();
         }
+      }
+
+      if ( FramesGot<nFrames ) { ReadLimitReached=false; break; } // No more frames available
+      if ( MaxParseTime!=0 && N2kMicros()-StartTime>=MaxParseTime ) break;
     }
 
 #if !defined(N2K_NO_HEARTBEAT_SUPPORT)
     SendHeartbeat();
 #endif
+#if !defined(N2K_NO_PERIODIC_MSG_SUPPORT)
+    SendPeriodicMsgs();
+#endif
+}
+
+//*****************************************************************************
+static inline void N2kWakeupAt(uint64_t &Next, uint64_t Time) {
+  if ( Time<Next ) Next=Time;
+}
+
+//*****************************************************************************
+static inline void N2kWakeupAt(uint64_t &Next, uint64_t Now, const tN2kScheduler &Scheduler) {
+  if ( Scheduler.IsEnabled() ) N2kWakeupAt(Next,Now+Scheduler.Remaining());
+}
+
+//*****************************************************************************
+uint64_t tNMEA2000::GetNextWakeupTime() {
+  uint64_t Now=N2kMillis64();
+  uint64_t Next=N2kScheduler64Disabled;
+
+  switch ( OpenState ) {
+    case os_None: return Now;
+    case os_OpenCAN:
+    case os_WaitOpen: N2kWakeupAt(Next,Now,OpenScheduler); return Next;
+    default: break;
+  }
+#if defined(N2K_THREAD_SAFE_SEND)
+  if ( !PostMsgBuf->isEmpty() ) return Now;
+#endif
+  if ( dbMode!=dm_None ) return Next;
+  if ( ReadLimitReached ) return Now;
+#if defined(N2K_THREADED_RECEIVE)
+  if ( RxFrameRing!=0 && !RxFrameRing->isEmpty() ) return Now;
+#endif
+
+  if ( CANSendFrameBuf!=0 && !CANSendFrameBuf->isEmpty() ) N2kWakeupAt(Next,Now+N2kSendRetryWakeupTime);
+
+  for ( int i=0; i<DeviceCount; i++ ) {
+    tInternalDevice &Device=Devices[i];
+    if ( Device.HasPendingInformation ) {
+      #if !defined(N2K_NO_ISO_MULTI_PACKET_SUPPORT)
+      if ( Device.PendingTPMsg.PGN!=0 ) N2kWakeupAt(Next,Now,Device.NextDTSendTime);
+      #endif
+      N2kWakeupAt(Next,Now,Device.PendingIsoAddressClaim);
+      N2kWakeupAt(Next,Now,Device.PendingProductInformation);
+      N2kWakeupAt(Next,Now,Device.PendingConfigurationInformation);
+    }
+    N2kWakeupAt(Next,Now,Device.AddressClaimTimer);
+    #if !defined(N2K_NO_HEARTBEAT_SUPPORT)
+    // Sync scheduler fires, when time has passed NextTime
+    if ( IsActiveNode() && Device.HeartbeatScheduler.IsEnabled() ) N2kWakeupAt(Next,Device.HeartbeatScheduler.GetNextTime()+1);
+    #endif
+  }
+
+#if !defined(N2K_NO_PERIODIC_MSG_SUPPORT)
+  if ( PeriodicMsgCount>0 ) {
+    const tN2kSyncScheduler &Scheduler=PeriodicMsgs[PeriodicMsgHeap[0]].Scheduler;
+    if ( Scheduler.IsEnabled() ) N2kWakeupAt(Next,Scheduler.GetNextTime()+1);
+  }
+#endif
+
+  return ( Next<Now ? Now : Next );
+}
+
+//*****************************************************************************
+uint32_t tNMEA2000::GetWakeupTimeout(uint32_t MaxTimeout) {
+  uint64_t Next=GetNextWakeupTime();
+  uint64_t Now=N2kMillis64();
+
+  if ( Next<=Now ) return 0;
+  return ( Next-Now<MaxTimeout ? (uint32_t)(Next-Now) : MaxTimeout );
+}
+
+//*****************************************************************************
+uint16_t tNMEA2000::ReadFrames(tCANFrame *Frames, uint16_t MaxFrames) {
+#if defined(N2K_THREADED_RECEIVE)
+  if ( RxFrameRing!=0 ) {
+    uint16_t Count=0;
+    for ( ; Count<MaxFrames && RxFrameRing->read(Frames[Count]); Count++ );
+    // After thread has been stopped, continue from driver, when ring is empty.
+    if ( Count>0 || IsReceiveThreadRunning() ) return Count;
+  }
+#endif
+  return CANGetFrames(Frames,MaxFrames);
+}
+
+#if defined(N2K_THREADED_RECEIVE)
+//*****************************************************************************
+bool tNMEA2000::StartReceiveThread(uint16_t RingSize, uint32_t IdleTime) {
+  if ( !IsOpen() || IsReceiveThreadRunning() ) return false;
+
+  if ( RxFrameRing!=0 && !RxFrameRing->isEmpty() ) return false; // Old frames has not been handled
+  delete RxFrameRing;
+  RxFrameRing=new tSPSCRingBuffer<tCANFrame>(RingSize);
+  ReceiveIdleTime=IdleTime;
+  ReceiveThreadRun.store(true,std::memory_order_release);
+  ReceiveThread=std::thread(&tNMEA2000::ReceiveThreadLoop,this);
+
+  return true;
+}
+
+//*****************************************************************************
+void tNMEA2000::StopReceiveThread() {
+  ReceiveThreadRun.store(false,std::memory_order_release);
+  if ( ReceiveThread.joinable() ) ReceiveThread.join();
+}
+
+//*****************************************************************************
+void tNMEA2000::ReceiveThreadLoop() {
+  tCANFrame Frames[N2kMaxCANGetFrames];
+#if defined(__linux__)
+  int Fd=CANGetPollFd();
+#endif
+
+  while ( IsReceiveThreadRunning() ) {
+#if !defined(N2K_NO_RX_TIMESTAMP)
+    for ( uint16_t i=0; i<N2kMaxCANGetFrames; i++ ) Frames[i].RxTime=0;
+#endif
+    uint16_t FramesGot=CANGetFrames(Frames,N2kMaxCANGetFrames);
+    if ( FramesGot>0 ) {
+#if !defined(N2K_NO_RX_TIMESTAMP)
+      uint64_t ReadTime=N2kMicros64();
+#endif
+      for ( uint16_t i=0; i<FramesGot; i++ ) {
+#if !defined(N2K_NO_RX_TIMESTAMP)
+        if ( Frames[i].RxTime==0 ) Frames[i].RxTime=ReadTime;
+#endif
+        if ( !RxFrameRing->add(Frames[i]) ) RxRingOverflows.fetch_add(1,std::memory_order_relaxed);
+      }
+      if ( ReceiveNotify!=0 ) ReceiveNotify(ReceiveNotifyContext);
+      continue;
+    }
+
+#if defined(__linux__)
+    if ( Fd>=0 ) {
+      struct pollfd PollFd={ Fd, POLLIN, 0 };
+      poll(&PollFd,1,(ReceiveIdleTime+999)/1000);
+      continue;
+    }
+#endif
+    std::this_thread::sleep_for(std::chrono::microseconds(ReceiveIdleTime));
+  }
+}
+#endif
+
+//*****************************************************************************
+void tNMEA2000::HandleCANMsg(tN2kCANMsg &CANMsg) {
+  const tN2kMsg &N2kMsg=CANMsg.PrepareN2kMsg();
+
+  if ( CANMsg.IsLongMessage() ) { // Can be delivered only with payload pointer
+    N2kStatsAdd(MsgsDispatched,1);
+    N2kLatencyReady(N2kMsg);
+    RunLongMessageHandlers(N2kMsg,CANMsg.GetData(),CANMsg.DataLen);
+    N2kLatencyDone();
+    return;
+  }
+
+  HandleReceivedMsg(N2kMsg,CANMsg.SystemMessage,CANMsg.KnownMessage);
+}
+
+//*****************************************************************************
+void tNMEA2000::HandleSingleFrameMsg(unsigned char Priority, unsigned long PGN, unsigned char Source, unsigned char Destination,
+                                     unsigned char len, const unsigned char *buf, bool SystemMessage, bool KnownMessage) {
+  SingleFrameMsg.Priority=Priority;
+  SingleFrameMsg.PGN=PGN;
+  SingleFrameMsg.Source=Source;
+  SingleFrameMsg.Destination=Destination;
+  SingleFrameMsg.MsgTime=N2kMillis();
+#if !defined(N2K_NO_RX_TIMESTAMP)
+  SingleFrameMsg.RxStartTime=SingleFrameMsg.RxTime=FrameRxTime;
+#endif
+  if ( len>8 ) len=8;
+  memcpy(SingleFrameMsg.Data,buf,len);
+  SingleFrameMsg.DataLen=len;
+
+  HandleReceivedMsg(SingleFrameMsg,SystemMessage,KnownMessage);
+}
+
+//*****************************************************************************
+void tNMEA2000::HandleReceivedMsg(const tN2kMsg &N2kMsg, bool SystemMessage, bool KnownMessage) {
+  N2kStatsAdd(MsgsDispatched,1);
+  N2kLatencyReady(N2kMsg);
+  if ( !HandleReceivedSystemMessage(N2kMsg,SystemMessage) ) {
+    N2kMsgRxDbgStart(" - Non system message, PGN: "); N2kMsgRxDbgln(N2kMsg.PGN);
+    ForwardMessage(N2kMsg,KnownMessage);
+  }
+  RunMessageHandlers(N2kMsg);
+  N2kLatencyDone();
+}
+
+#if defined(N2K_LATENCY_STATS)
+//*****************************************************************************
+static inline uint32_t N2kLatency(uint64_t From, uint64_t To) {
+  if ( To<=From ) return 0;
+  return ( To-From>0xffffffffULL ? 0xffffffffUL : (uint32_t)(To-From) );
+}
+
+//*****************************************************************************
+void tNMEA2000::LatencyReady(const tN2kMsg &N2kMsg) {
+  LatencyEntry=LatencyStats.Find(N2kMsg.PGN);
+  if ( LatencyEntry==0 ) return;
+
+  LatencyReadyTime=N2kMicros64();
+#if !defined(N2K_NO_RX_TIMESTAMP)
+  // Driver may provide hardware time on different time base, so ignore future times.
+  if ( N2kMsg.RxStartTime!=0 && N2kMsg.RxStartTime<=LatencyReadyTime ) {
+    tN2kLatencyStats::Add(LatencyEntry,tN2kLatencyStats::ls_ArrivalToReady,N2kLatency(N2kMsg.RxStartTime,LatencyReadyTime));
+  }
+#endif
+}
+
+//*****************************************************************************
+uint64_t tNMEA2000::LatencyHandlerStart() {
+  if ( LatencyEntry==0 ) return 0;
+
+  uint64_t Start=N2kMicros64();
+  tN2kLatencyStats::Add(LatencyEntry,tN2kLatencyStats::ls_ReadyToHandler,N2kLatency(LatencyReadyTime,Start));
+  return Start;
+}
+
+//*****************************************************************************
+void tNMEA2000::LatencyHandlerEnd(uint64_t Start) {
+  // Entry may have been cleared by handler calling EnableLatencyStats or ResetLatencyStats
+  if ( LatencyEntry==0 || Start==0 ) return;
+
+  tN2kLatencyStats::Add(LatencyEntry,tN2kLatencyStats::ls_HandlerDuration,N2kLatency(Start,N2kMicros64()));
+}
+#endif
+
+//*****************************************************************************
+void tNMEA2000::RunLongMessageHandlers(const tN2kMsg &N2kMsg, const unsigned char *Data, uint16_t DataLen) {
+  if ( LongMsgHandler!=0 ) N2kTimedHandlerCall(LongMsgHandler(N2kMsg,Data,DataLen));
+
+  tMsgHandler *MsgHandler=MsgHandlers;
+  // Loop through all PGN handlers
+  for ( ;MsgHandler!=0 && MsgHandler->GetPGN()==0; MsgHandler=MsgHandler->pNext) N2kTimedHandlerCall(MsgHandler->HandleLongMsg(N2kMsg,Data,DataLen));
+  // Loop through specific PGN handlers
+  for ( MsgHandler=FindMsgHandlers(N2kMsg.PGN); MsgHandler!=0 && MsgHandler->GetPGN()==N2kMsg.PGN; MsgHandler=MsgHandler->pNext) {
+    N2kTimedHandlerCall(MsgHandler->HandleLongMsg(N2kMsg,Data,DataLen));
+  }
 }
 
 //*****************************************************************************
 void tNMEA2000::RunMessageHandlers(const tN2kMsg &N2kMsg) {
-  if ( MsgHandler!=0 ) MsgHandler(N2kMsg);
+  if ( MsgHandler!=0 ) N2kTimedHandlerCall(MsgHandler(N2kMsg));
 
   tMsgHandler *MsgHandler=MsgHandlers;
   // Loop through all PGN handlers
-  for ( ;MsgHandler!=0 && MsgHandler->GetPGN()==0; MsgHandler=MsgHandler->pNext) MsgHandler->HandleMsg(N2kMsg);
+  for ( ;MsgHandler!=0 && MsgHandler->GetPGN()==0; MsgHandler=MsgHandler->pNext) N2kTimedHandlerCall(MsgHandler->HandleMsg(N2kMsg));
   // Loop through specific PGN handlers
-  for ( ;MsgHandler!=0 && MsgHandler->GetPGN()<=N2kMsg.PGN; MsgHandler=MsgHandler->pNext) {
-    if ( MsgHandler->GetPGN()==N2kMsg.PGN ) MsgHandler->HandleMsg(N2kMsg);
+  for ( MsgHandler=FindMsgHandlers(N2kMsg.PGN); MsgHandler!=0 && MsgHandler->GetPGN()==N2kMsg.PGN; MsgHandler=MsgHandler->pNext) {
+    N2kTimedHandlerCall(MsgHandler->HandleMsg(N2kMsg));
+  }
+}
+
+//*****************************************************************************
+void tNMEA2000::BuildMsgHandlerIndex() {
+  uint16_t Count=0;
+  tMsgHandler *MsgHandler;
+  unsigned long PGN=0;
+
+  MsgHandlerIndexChanged=false;
+
+  // List is sorted by PGN, so count distinct PGNs
+  for ( MsgHandler=MsgHandlers; MsgHandler!=0; MsgHandler=MsgHandler->pNext ) {
+    if ( MsgHandler->GetPGN()!=PGN ) { PGN=MsgHandler->GetPGN(); Count++; }
+  }
+
+  if ( Count>MsgHandlerIndexSize ) {
+    if ( MsgHandlerIndex!=0 ) delete[] MsgHandlerIndex;
+    MsgHandlerIndex=new tMsgHandlerIndexEntry[Count];
+    MsgHandlerIndexSize=Count;
+  }
+
+  MsgHandlerIndexCount=0;
+  PGN=0;
+  for ( MsgHandler=MsgHandlers; MsgHandler!=0; MsgHandler=MsgHandler->pNext ) {
+    if ( MsgHandler->GetPGN()!=PGN ) {
+      PGN=MsgHandler->GetPGN();
+      MsgHandlerIndex[MsgHandlerIndexCount].PGN=PGN;
+      MsgHandlerIndex[MsgHandlerIndexCount].First=MsgHandler;
+      MsgHandlerIndexCount++;
+    }
   }
 }
 
+//*****************************************************************************
+tNMEA2000::tMsgHandler *tNMEA2000::FindMsgHandlers(unsigned long PGN) {
+  if ( MsgHandlerIndexChanged ) BuildMsgHandlerIndex();
+
+  int Low=0;
+  int High=MsgHandlerIndexCount-1;
+
+  while ( Low<=High ) {
+    int Mid=(Low+High)>>1;
+    if ( MsgHandlerIndex[Mid].PGN==PGN ) return MsgHandlerIndex[Mid].First;
+    if ( MsgHandlerIndex[Mid].PGN<PGN ) { Low=Mid+1; } else { High=Mid-1; }
+  }
+
+  return 0;
+}
+
 //*****************************************************************************
 void tNMEA2000::SetOnOpen(void (*_OnOpen)()) {
   OnOpen=_OnOpen;
@@ -2689,6 +3683,11 @@ void tNMEA2000::SetMsgHandler(void (*_MsgHandler)(const tN2kMsg &N2kMsg)) {
   MsgHandler=_MsgHandler;
 }
 
+//*****************************************************************************
+void tNMEA2000::SetLongMsgHandler(void (*_LongMsgHandler)(const tN2kMsg &N2kMsg, const unsigned char *Data, uint16_t DataLen)) {
+  LongMsgHandler=_LongMsgHandler;
+}
+
 //*****************************************************************************
 void tNMEA2000::AttachMsgHandler(tMsgHandler *_MsgHandler) {
   if ( _MsgHandler==0 ) return;
@@ -2712,6 +3711,7 @@ void tNMEA2000::AttachMsgHandler(tMsgHandler *_MsgHandler) {
   }
 
   _MsgHandler->pNMEA2000=this;
+  MsgHandlerIndexChanged=true;
 }
 
 //*****************************************************************************
@@ -2726,6 +3726,7 @@ void tNMEA2000::DetachMsgHandler(tMsgHandler *_MsgHandler) {
     for ( ; MsgHandler!=0 && MsgHandler->pNext!=_MsgHandler; MsgHandler=MsgHandler->pNext );
     if ( MsgHandler!=0 ) MsgHandler->pNext=_MsgHandler->pNext;
   }
+  _MsgHandler->pNMEA2000->MsgHandlerIndexChanged=true;
   _MsgHandler->pNext=0;
   _MsgHandler->pNMEA2000=0;
 }
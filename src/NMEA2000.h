@@ -51,10 +51,22 @@
 #include "N2kMsg.h"
 #include "N2kCANMsg.h"
 #include "N2kTimer.h"
+#include "N2kLatencyStats.h"
 
 #if !defined(N2K_NO_GROUP_FUNCTION_SUPPORT)
 #include "N2kGroupFunction.h"
 #endif
+
+template <typename T> class tPriorityRingBuffer;
+#if defined(N2K_THREAD_SAFE_SEND)
+#include <atomic>
+template <typename T> class tMPSCRingBuffer;
+#endif
+#if defined(N2K_THREADED_RECEIVE)
+#include <atomic>
+#include <thread>
+template <typename T> class tSPSCRingBuffer;
+#endif
 /** \brief PGN for an ISO Address Claim message */
 #define N2kPGNIsoAddressClaim 60928L
 /** \brief PGN for a Production Information message */
@@ -102,10 +114,45 @@
 #define Max_N2kMsgBuf_Time 100
 /** \brief Number of message groups */
 #define N2kMessageGroups 2
+/** \brief \ref tNMEA2000::ClassifyPGN flag: message is known by the library*/
+#define N2kPGNClassKnown         0x01
+/** \brief \ref tNMEA2000::ClassifyPGN flag: message is system message*/
+#define N2kPGNClassSystem        0x02
+/** \brief \ref tNMEA2000::ClassifyPGN flag: received message is handled as fast packet*/
+#define N2kPGNClassFastPacket    0x04
+/** \brief \ref tNMEA2000::ClassifyPGN flag: message is sent as fast packet*/
+#define N2kPGNClassTxFastPacket  0x08
+/** \brief Max number of frames \ref tNMEA2000::ParseMessages reads with
+ * single \ref tNMEA2000::CANGetFrames call. Frames are kept on stack. */
+#if !defined(N2kMaxCANGetFrames)
+#define N2kMaxCANGetFrames 8
+#endif
+/** \brief Max number of fast packet frames \ref tNMEA2000::SendMsg encodes
+ * before passing them to \ref tNMEA2000::CANSendFrames. Frames are kept on stack. */
+#if !defined(N2kCANSendFramesBatch)
+#define N2kCANSendFramesBatch 8
+#endif
+/** \brief Default size of \ref tNMEA2000::PostMsg buffer */
+#if !defined(N2kDefaultPostMsgBufSize)
+#define N2kDefaultPostMsgBufSize 32
+#endif
+/** \brief Default size of \ref tNMEA2000::StartReceiveThread frame ring */
+#if !defined(N2kDefaultRxFrameRingSize)
+#define N2kDefaultRxFrameRingSize 256
+#endif
+/** \brief Time in milliseconds \ref tNMEA2000::GetNextWakeupTime gives for
+ * retrying frames on library send buffer. */
+#if !defined(N2kSendRetryWakeupTime)
+#define N2kSendRetryWakeupTime 1
+#endif
 /** \brief Max CAN Bus Address given by the library*/
 #define N2kMaxCanBusAddress 251
 /** \brief Null Address (???)*/
 #define N2kNullCanBusAddress 254
+/** \brief \ref tNMEA2000::tSendCoalesceMsg has no instance byte*/
+#define N2kNoInstanceByte 0xff
+/** \brief \ref tNMEA2000::AddPeriodicMsg selects offset automatically*/
+#define N2kPeriodicAutoOffset 0xffffffffUL
 
 /************************************************************************//**
  * \class tNMEA2000
@@ -628,6 +675,20 @@ public:
        * \param N2kMsg Reference to a N2kMsg Object
        */
       virtual void HandleMsg(const tN2kMsg &N2kMsg)=0;
+      /*******************************************************************//**
+       * \brief Handles a message longer than tN2kMsg::MaxDataLen
+       *
+       * Long ISO Transport Protocol messages can be received, if buffer pool
+       * has been configured with large enough buffers. See 
+       * \ref tNMEA2000::AddN2kCANMsgBufClass. Those messages can not be
+       * delivered as tN2kMsg, so they will be delivered here with pointer
+       * to the payload on library buffer. Payload is valid only during call.
+       *
+       * \param N2kMsg   Message header. N2kMsg.DataLen is 0.
+       * \param Data     Pointer to message payload
+       * \param DataLen  Payload length
+       */
+      virtual void HandleLongMsg(const tN2kMsg &N2kMsg, const unsigned char *Data, uint16_t DataLen) { (void)N2kMsg; (void)Data; (void)DataLen; }
       /** \brief Returns the tNMEA2000 object of this handler
        * \return  tNMEA2000   */
       tNMEA2000 *GetNMEA2000() { return pNMEA2000; }
@@ -962,6 +1023,25 @@ protected:
     /** \brief  Pointer to a buffer for Message Handlers*/
     tMsgHandler *MsgHandlers;
 
+    /************************************************************************//**
+     * \brief Entry on \ref MsgHandlerIndex
+     */
+    struct tMsgHandlerIndexEntry {
+      /** \brief PGN of the handlers */
+      unsigned long PGN;
+      /** \brief First handler for the PGN on \ref MsgHandlers list */
+      tMsgHandler *First;
+    };
+    /** \brief Sorted index of first handler for each PGN on \ref MsgHandlers.
+     *  Wildcard (PGN 0) handlers are not on index. */
+    tMsgHandlerIndexEntry *MsgHandlerIndex;
+    /** \brief Allocated size of \ref MsgHandlerIndex */
+    uint16_t MsgHandlerIndexSize;
+    /** \brief Number of PGNs on \ref MsgHandlerIndex */
+    uint16_t MsgHandlerIndexCount;
+    /** \brief Handlers has been attached or detached and \ref MsgHandlerIndex must be rebuilt */
+    bool MsgHandlerIndexChanged;
+
     /** Open the Scheduler */
     tN2kScheduler OpenScheduler;
     /** State of the .... */
@@ -984,6 +1064,13 @@ protected:
 
     const unsigned long *SingleFrameMessages[N2kMessageGroups];
     const unsigned long *FastPacketMessages[N2kMessageGroups];
+    /** \brief Sorted index built from \ref SingleFrameMessages and
+     *  \ref FastPacketMessages lists. \sa \ref BuildUserPGNClasses */
+    uint32_t *UserPGNClasses;
+    /** \brief Number of entries on \ref UserPGNClasses */
+    uint16_t UserPGNClassCount;
+    /** \brief Message lists have changed and \ref UserPGNClasses must be rebuilt */
+    bool UserPGNClassesChanged;
 
     /*********************************************************************//**
      * \struct  tCANSendFrame
@@ -1000,12 +1087,150 @@ protected:
       unsigned char buf[8];
       /** \brief  Has the CAN Message to wait before sending*/
       bool wait_sent;
+#if !defined(N2K_NO_SEND_QUEUE_STATS)
+      /** \brief  N2kMicros() time, when frame was buffered*/
+      uint32_t QueueTime;
+#endif
 
     public:
       /** Clears all the fields of the CAN Message */
       void Clear() {id=0; len=0; for (int i=0; i<8; i++) { buf[i]=0; } }
     };
 
+public:
+    /*********************************************************************//**
+     * \struct  tCANFrame
+     * \brief   CAN frame for \ref tNMEA2000::CANGetFrames and 
+     *          \ref tNMEA2000::CANSendFrames
+     */
+    struct tCANFrame {
+      /** \brief  ID of the CAN frame*/
+      unsigned long id;
+      /** \brief  Length of payload*/
+      unsigned char len;
+      /** \brief  Payload of the CAN frame*/
+      unsigned char buf[8];
+#if !defined(N2K_NO_RX_TIMESTAMP)
+      /** \brief  Receive time of the frame (N2kMicros64). Driver can set
+       * hardware or kernel receive time on \ref CANGetFrames. 0 means
+       * unknown and library uses time, when frames were read. Ignored on
+       * sending.*/
+      uint64_t RxTime;
+#endif
+    };
+
+    /*********************************************************************//**
+     * \class   tFrameHandler
+     * \brief   Handler for received raw CAN frames
+     *
+     * Frame handler set with \ref tNMEA2000::SetFrameHandler will be called
+     * by \ref tNMEA2000::ParseMessages for each received frame before
+     * library handles it. This is e.g., for \ref tN2kGateway, which
+     * forwards frames to other buses without reassembly.
+     */
+    class tFrameHandler {
+      public:
+        /** \brief Destroy the frame handler object */
+        virtual ~tFrameHandler() {}
+        /*******************************************************************//**
+         * \brief Handle received frame
+         *
+         * \param Frame   Received frame. Frame.RxTime is valid only, if
+         *                driver provided it.
+         */
+        virtual void HandleFrame(const tCANFrame &Frame)=0;
+    };
+
+#if !defined(N2K_NO_PERIODIC_MSG_SUPPORT)
+    /*********************************************************************//**
+     * \brief Function type for filling periodic message
+     *
+     * Function fills message to be sent. Return false, if message should not
+     * be sent this time, e.g., because data is not valid.
+     * \sa \ref tNMEA2000::AddPeriodicMsg
+     */
+    typedef bool (*tPeriodicMsgFill)(tN2kMsg &N2kMsg, void *Context);
+#endif
+
+    /*********************************************************************//**
+     * \struct  tSendCoalesceMsg
+     * \brief   Message definition for send coalescing
+     * \sa \ref tNMEA2000::SetSendCoalescing
+     */
+    struct tSendCoalesceMsg {
+      /** \brief  PGN of the message. List is terminated with PGN 0.*/
+      unsigned long PGN;
+      /** \brief  Index of instance byte on message data or 
+       *          \ref N2kNoInstanceByte, if message does not have instance*/
+      uint8_t InstanceByte;
+    };
+
+#if !defined(N2K_NO_SEND_QUEUE_STATS)
+    /*********************************************************************//**
+     * \struct  tCANSendQueueStats
+     * \brief   Send statistics for one CAN priority
+     *
+     * Latency is time frame spent on library send buffer \ref CANSendFrameBuf.
+     * Frames sent immediately are counted only to Frames.
+     * \sa \ref tNMEA2000::GetSendQueueStats
+     */
+    struct tCANSendQueueStats {
+      /** \brief  Frames sent with this priority*/
+      uint32_t Frames;
+      /** \brief  Frames, which had to wait on library send buffer*/
+      uint32_t BufferedFrames;
+      /** \brief  Frames dropped, because send buffer was full*/
+      uint32_t DroppedFrames;
+      /** \brief  Buffered frames replaced by newer value*/
+      uint32_t CoalescedFrames;
+      /** \brief  Max latency of buffered frame in microseconds*/
+      uint32_t MaxLatency;
+      /** \brief  Sum of latencies of buffered frames in microseconds*/
+      uint64_t TotalLatency;
+    };
+#endif
+
+#if !defined(N2K_NO_STATISTICS)
+    /*********************************************************************//**
+     * \struct  tStatistics
+     * \brief   Runtime counters of frame and message handling
+     *
+     * Counters are cumulative since start or last 
+     * \ref tNMEA2000::ResetStatistics. 
+     * \sa \ref tNMEA2000::GetStatistics
+     */
+    struct tStatistics {
+      /** \brief  Frames read from driver*/
+      uint32_t FramesReceived;
+      /** \brief  Frames passed to driver*/
+      uint32_t FramesSent;
+      /** \brief  Frames, which had to be buffered to \ref CANSendFrameBuf*/
+      uint32_t FramesBuffered;
+      /** \brief  Frames, which could not be sent nor buffered*/
+      uint32_t SendFailures;
+      /** \brief  Fast packet frames without first frame*/
+      uint32_t OrphanFrames;
+      /** \brief  Fast packet or ISO TP messages dropped due to sequence break*/
+      uint32_t LostFrames;
+      /** \brief  Timed out messages dropped from reassembly slots*/
+      uint32_t SlotEvictions;
+      /** \brief  Messages dropped, because there was no free slot or buffer*/
+      uint32_t NoFreeSlot;
+      /** \brief  ISO TP aborts sent or received*/
+      uint32_t TPAborts;
+      /** \brief  Received messages dispatched to handlers*/
+      uint32_t MsgsDispatched;
+      /** \brief  Current number of frames on \ref CANSendFrameBuf*/
+      uint16_t SendBufFrames;
+      /** \brief  Max number of frames on \ref CANSendFrameBuf*/
+      uint16_t SendBufHighWater;
+      /** \brief  Current number of reassembly slots in use*/
+      uint8_t SlotsInUse;
+      /** \brief  Max number of reassembly slots in use*/
+      uint8_t SlotsHighWater;
+    };
+#endif
+
 protected:
     /** \brief Buffer for receiving messages
      * \sa
@@ -1019,6 +1244,23 @@ protected:
      * - \ref tNMEA2000::SetN2kCANMsgBufSize()
      */
     uint8_t MaxN2kCANMsgs;
+    /** \brief Hash index for messages under reassembly on N2kCANMsgBuf
+     * 
+     * Index makes lookup for fast packet and multi packet frames independent
+     * of \ref MaxN2kCANMsgs. It must be updated with \ref ClaimCANMsg and 
+     * \ref FreeCANMsg, when slot state changes.
+     */
+    tN2kCANMsgIndex N2kCANMsgIndex;
+    /** \brief Payload buffer pool for long messages on \ref N2kCANMsgBuf
+     * \sa \ref tNMEA2000::AddN2kCANMsgBufClass()
+     */
+    tN2kMsgBufPool N2kMsgBufPool;
+    /** \brief Message used for delivering single frame messages. Message
+     * handling is not re-entrant, so one message is enough and there is no
+     * need to reserve it from stack on every frame.
+     * \sa \ref HandleSingleFrameMsg
+     */
+    tN2kMsg SingleFrameMsg;
 
     /** \brief Buffer for library send out CAN frames
      * 
@@ -1031,8 +1273,13 @@ protected:
      * and library buffer. Inherited class can even disable library buffer.
      * 
      * \ref InitCANFrameBuffers(). 
+     *
+     * Frames are ordered by CAN priority (bits 26-28 of id), so that 
+     * pending low priority frames do not delay higher priority frames.
+     * Frames with same priority are kept in order, so fast packet frame
+     * order will be maintained.
     */
-    tCANSendFrame *CANSendFrameBuf;
+    tPriorityRingBuffer<tCANSendFrame> *CANSendFrameBuf;
     /** \brief Size of CANSendFrameBuf or before initialization requested
      *         total frame buffering size.
      * 
@@ -1047,18 +1294,136 @@ protected:
      *  - \ref InitCANFrameBuffers()
      */
     uint16_t MaxCANSendFrames;
-    /** \brief  Next read index for the library CAN send frame buffer.
+#if !defined(N2K_NO_SEND_QUEUE_STATS)
+    /** \brief Send statistics for each CAN priority
+     * \sa \ref tNMEA2000::GetSendQueueStats()
+     */
+    tCANSendQueueStats SendQueueStats[8];
+#endif
+#if !defined(N2K_NO_STATISTICS)
+    /** \brief Runtime counters
+     * \sa \ref tNMEA2000::GetStatistics()
+     */
+    tStatistics Statistics;
+#endif
+#if defined(N2K_THREAD_SAFE_SEND)
+    /** \brief Message posted with \ref tNMEA2000::PostMsg */
+    struct tPostedMsg {
+      /** \brief Message */
+      tN2kMsg N2kMsg;
+      /** \brief Device index for \ref tNMEA2000::SendMsg */
+      int DeviceIndex;
+    };
+    /** \brief Messages posted from other threads
+     * \sa \ref tNMEA2000::SetPostMsgBufSize()
      */
-    uint16_t CANSendFrameBufferWrite;
-    /** \brief  Next write index for the library CAN send frame buffer.
+    tMPSCRingBuffer<tPostedMsg> *PostMsgBuf;
+    /** \brief Count of messages, which did not fit to \ref PostMsgBuf */
+    std::atomic<uint32_t> PostMsgOverflows;
+#endif
+#if defined(N2K_THREADED_RECEIVE)
+    /** \brief Frames read by receive thread for \ref ParseMessages
+     * \sa \ref tNMEA2000::StartReceiveThread()
+     */
+    tSPSCRingBuffer<tCANFrame> *RxFrameRing;
+    /** \brief Count of frames, which did not fit to \ref RxFrameRing */
+    std::atomic<uint32_t> RxRingOverflows;
+    /** \brief Receive thread should run */
+    std::atomic<bool> ReceiveThreadRun;
+    /** \brief Receive thread */
+    std::thread ReceiveThread;
+    /** \brief Time in microseconds receive thread waits, when there are no frames */
+    uint32_t ReceiveIdleTime;
+    /** \brief Called by receive thread after it has added frames to \ref RxFrameRing */
+    void (*ReceiveNotify)(void *Context);
+    /** \brief Context for \ref ReceiveNotify */
+    void *ReceiveNotifyContext;
+#endif
+
+    /*********************************************************************//**
+     * \struct  tCoalescePending
+     * \brief   Buffered single frame, which can be replaced by newer value
+     */
+    struct tCoalescePending {
+      /** \brief  ID of the buffered frame*/
+      unsigned long id;
+      /** \brief  Instance of the message or \ref N2kNoInstanceByte*/
+      uint8_t Instance;
+      /** \brief  Buffered frame on \ref CANSendFrameBuf*/
+      tCANSendFrame *Frame;
+    };
+    /** \brief Messages, which will be coalesced
+     * \sa \ref tNMEA2000::SetSendCoalescing()
+     */
+    const tSendCoalesceMsg *SendCoalesceMsgs;
+    /** \brief Buffered frames, which can still be replaced*/
+    tCoalescePending *CoalescePending;
+    /** \brief Size of \ref CoalescePending*/
+    uint8_t MaxCoalescePending;
+    /** \brief Number of entries on \ref CoalescePending*/
+    uint8_t CoalescePendingCount;
+
+#if !defined(N2K_NO_PERIODIC_MSG_SUPPORT)
+    /*********************************************************************//**
+     * \struct  tPeriodicMsg
+     * \brief   Periodic message registered with \ref AddPeriodicMsg
      */
-    uint16_t CANSendFrameBufferRead;
+    struct tPeriodicMsg {
+      /** \brief  Scheduler for the message*/
+      tN2kSyncScheduler Scheduler;
+      /** \brief  PGN of the message*/
+      unsigned long PGN;
+      /** \brief  Function, which fills message before sending*/
+      tPeriodicMsgFill Fill;
+      /** \brief  Context for Fill*/
+      void *Context;
+      /** \brief  Device index used for sending*/
+      int DeviceIndex;
+      /** \brief  Position on \ref PeriodicMsgHeap*/
+      uint16_t HeapPos;
+    };
+    /** \brief Registered periodic messages*/
+    tPeriodicMsg *PeriodicMsgs;
+    /** \brief Min-heap of \ref PeriodicMsgs indexes ordered by next send time.
+     * Disabled messages are at the end of heap. */
+    uint16_t *PeriodicMsgHeap;
+    /** \brief Number of registered periodic messages*/
+    uint16_t PeriodicMsgCount;
+    /** \brief Allocated size of \ref PeriodicMsgs and \ref PeriodicMsgHeap*/
+    uint16_t PeriodicMsgSize;
+#endif
     /** \brief Max number received CAN messages that can go to the buffer 
      * \sa
      *  - \ref tNMEA2000::SetN2kCANReceiveFrameBufSize()
      *  - \ref InitCANFrameBuffers()
     */
     uint16_t MaxCANReceiveFrames;
+    /** \brief Max number of frames read on single \ref ParseMessages call
+     * \sa \ref tNMEA2000::SetMaxReadFramesOnParse()
+     */
+    uint16_t MaxReadFramesOnParse;
+    /** \brief Max time in microseconds used for reading frames on single 
+     * \ref ParseMessages call. 0 means no time limit.
+     * \sa \ref tNMEA2000::SetMaxParseTime()
+     */
+    uint32_t MaxParseTime;
+    /** \brief Last \ref ParseMessages stopped on read limit and driver may
+     *  still have frames. See \ref GetNextWakeupTime */
+    bool ReadLimitReached;
+#if !defined(N2K_NO_RX_TIMESTAMP)
+    /** \brief Receive time of the frame under handling. See \ref tCANFrame::RxTime */
+    uint64_t FrameRxTime;
+#endif
+#if defined(N2K_LATENCY_STATS)
+    /** \brief Receive latency histograms
+     * \sa \ref tNMEA2000::EnableLatencyStats()
+     */
+    tN2kLatencyStats LatencyStats;
+    /** \brief Latency entry of the message under dispatch or 0 */
+    tN2kLatencyStats::tEntry *LatencyEntry;
+    /** \brief Time (N2kMicros64) when message under dispatch was ready */
+    uint64_t LatencyReadyTime;
+#endif
 
     /** \brief Callback function, which will be called when library start bus communication.
     * 
@@ -1075,6 +1440,10 @@ protected:
         
     /** \brief Handler callbacks for normal messages */
     void (*MsgHandler)(const tN2kMsg &N2kMsg);  
+    /** \brief Handler callback for messages longer than tN2kMsg::MaxDataLen */
+    void (*LongMsgHandler)(const tN2kMsg &N2kMsg, const unsigned char *Data, uint16_t DataLen);
+    /** \brief Handler for received raw frames */
+    tFrameHandler *FrameHandler;
     /** \brief Handler callbacks for 'ISORequest' messages */
     bool (*ISORqstHandler)(unsigned long RequestedPGN, unsigned char Requester, int DeviceIndex);
 
@@ -1104,6 +1473,25 @@ protected:
     */
     virtual bool CANSendFrame(unsigned long id, unsigned char len, const unsigned char *buf, bool wait_sent=true)=0;
 
+    /*********************************************************************//**
+     * \brief Send several frames to driver class.
+     *
+     * \ref SendMsg passes fast packet frames with this function in batches
+     * of max \ref N2kCANSendFramesBatch frames. Default implementation calls
+     * \ref CANSendFrame for each frame until it fails. Driver, which can
+     * send several frames at once, can override this.
+     *
+     * Frames must be sent in given order. Function returns number of 
+     * frames accepted from the beginning of the list. Rest of the frames
+     * will be buffered by library.
+     *
+     * \param Frames     Frames to send
+     * \param Count      Number of frames
+     * \param wait_sent  Frames are part of fast packet and must be sent in order
+     * \return Number of frames accepted
+     */
+    virtual uint16_t CANSendFrames(const tCANFrame *Frames, uint16_t Count, bool wait_sent=true);
+
     /*********************************************************************//**
      * \brief Abstract class for initializing and opening CAN interface.
      * 
@@ -1133,6 +1521,42 @@ protected:
      * \retval false  Nothing read. 
      */
     virtual bool CANGetFrame(unsigned long &id, unsigned char &len, unsigned char *buf)=0;
+
+    /*********************************************************************//**
+     * \brief Read several frames from driver class.
+     *
+     * \ref ParseMessages reads frames with this function. Default 
+     * implementation calls \ref CANGetFrame until MaxFrames has been read
+     * or there is no more frames. Driver, which can read several frames at
+     * once (e.g. with recvmmsg on Linux), can override this to drain its
+     * queue with single call.
+     *
+     * Function should return less than MaxFrames only, when there is no
+     * more frames available at the moment.
+     *
+     * Driver, which knows hardware or kernel receive time of frames, can
+     * set it to \ref tCANFrame::RxTime with \ref N2kMicros64 time base. 
+     * Library clears RxTime before call and sets time of read for frames, 
+     * which RxTime is left to 0. Time will be delivered on \ref tN2kMsg::RxTime.
+     *
+     * \param Frames     Buffer for frames
+     * \param MaxFrames  Max number of frames to read
+     * \return Number of frames read
+     */
+    virtual uint16_t CANGetFrames(tCANFrame *Frames, uint16_t MaxFrames);
+
+    /*********************************************************************//**
+     * \brief Get pollable file descriptor of the driver
+     *
+     * Driver on system with file descriptors (e.g. SocketCAN on Linux) can
+     * override this to return descriptor, which becomes readable, when
+     * there are received frames. Application can then wait on it with
+     * poll or epoll until frame arrives or \ref GetNextWakeupTime expires.
+     * Default returns -1, which means that driver must be polled.
+     *
+     * \return File descriptor or -1
+     */
+    virtual int CANGetPollFd() { return -1; }
     
     /*********************************************************************//**
      * \brief Initialize CAN Frame buffers
@@ -1185,11 +1609,62 @@ protected:
      */
     bool SendFrame(unsigned long id, unsigned char len, const unsigned char *buf, bool wait_sent=true);
 
+    /**********************************************************************//**
+     * \brief Check is message on coalesced message list
+     *
+     * \param N2kMsg     Message to be sent
+     * \param Instance   Instance of the message or \ref N2kNoInstanceByte
+     *
+     * \retval true   Message will be coalesced
+     * \retval false  Message is not on list
+     */
+    bool IsSendCoalesceMsg(const tN2kMsg &N2kMsg, uint8_t &Instance) const;
+
+    /**********************************************************************//**
+     * \brief Send single frame message with coalescing
+     *
+     * If frame with same id and instance is still waiting on send buffer,
+     * its payload will be replaced with new one. Otherwise frame will be sent
+     * with \ref SendFrame and remembered, if it had to be buffered.
+     *
+     * \param id         ID of the frame
+     * \param Instance   Instance of the message or \ref N2kNoInstanceByte
+     * \param len        Payload length
+     * \param buf        Payload
+     *
+     * \retval true   success
+     * \retval false  failed
+     */
+    bool SendCoalescedFrame(unsigned long id, uint8_t Instance, unsigned char len, const unsigned char *buf);
+
+    /**********************************************************************//**
+     * \brief Forget buffered frame, which will be sent to driver
+     * \param Frame   Frame on \ref CANSendFrameBuf
+     */
+    void ReleaseCoalescePending(const tCANSendFrame *Frame);
+
+    /**********************************************************************//**
+     * \brief Send several CAN frames
+     *
+     * Pending frames will be sent first. Then frames will be passed to 
+     * \ref CANSendFrames() with single call and those, which could not be
+     * sent immediately, will be buffered.
+     *
+     * \param Frames     Frames to send
+     * \param Count      Number of frames
+     * \param wait_sent  Frames has to wait before sending
+     *
+     * \retval true   success
+     * \retval false  there was no room for all frames
+     */
+    bool SendFrameBatch(const tCANFrame *Frames, uint16_t Count, bool wait_sent=true);
+
     /*********************************************************************//**
      * \brief Get the Next Free CAN Frame from \ref CANSendFrameBuf
+     * \param Priority  CAN priority of the frame
      * \return tCANSendFrame* 
      */
-    tCANSendFrame *GetNextFreeCANSendFrame();
+    tCANSendFrame *GetNextFreeCANSendFrame(uint8_t Priority=7);
 
     /*********************************************************************//**
      * \brief Send ISO AddressClaim, Product Information and Config 
@@ -1267,6 +1742,49 @@ protected:
      */
     void FindFreeCANMsgIndex(unsigned long PGN, unsigned char Source, unsigned char Destination, uint8_t &MsgIndex);
 #endif
+    /*********************************************************************//**
+     * \brief Mark message slot on \ref N2kCANMsgBuf to be in use
+     *
+     * Slot key (PGN, source, destination and TP flag) must be set before
+     * calling this.
+     * 
+     * \param MsgIndex      Index of the slot
+     */
+    void ClaimCANMsg(uint8_t MsgIndex);
+    /*********************************************************************//**
+     * \brief Free message slot on \ref N2kCANMsgBuf
+     *
+     * Removes slot from \ref N2kCANMsgIndex and clears it.
+     * 
+     * \param MsgIndex      Index of the slot
+     */
+    void FreeCANMsg(uint8_t MsgIndex);
+    /*********************************************************************//**
+     * \brief Get payload buffer for message slot
+     *
+     * Messages up to tN2kMsg::MaxDataLen use slot message data. Longer ISO
+     * TP messages take buffer from \ref N2kMsgBufPool. If pool has no free 
+     * buffer, timed out long messages will be released.
+     * 
+     * \param MsgIndex      Index of the slot
+     * \param DataLen       Required payload length
+     * \retval true         Slot has buffer
+     * \retval false        No buffer available
+     */
+    bool AllocCANMsgData(uint8_t MsgIndex, uint16_t DataLen);
+    /*********************************************************************//**
+     * \brief Start reassembly on message slot
+     *
+     * Slot header must be initialized before calling this. Function gets
+     * payload buffer for the slot and claims it. If there is no buffer,
+     * slot will be freed.
+     * 
+     * \param MsgIndex      Index of the slot
+     * \param DataLen       Payload length of the message
+     * \retval true         Reassembly started
+     * \retval false        No buffer available
+     */
+    bool StartCANMsg(uint8_t MsgIndex, uint16_t DataLen);
     /*********************************************************************//**
      * \brief Function handles received CAN frame and adds it to tN2kCANMsg
      *  
@@ -1274,6 +1792,10 @@ protected:
      * \ref N2kCANMsgBuf (max \ref MaxN2kCANMsgs), 
      * if we skipped the frame or message is not ready (fast packet or 
      * ISO Multi-Packet)
+     *
+     * Single frame messages do not use \ref N2kCANMsgBuf. They are
+     * handled directly with \ref HandleSingleFrameMsg and function returns
+     * \ref MaxN2kCANMsgs.
      * 
      * \param canId     ID of CAN message
      * \param len       length of payload
@@ -1327,6 +1849,38 @@ protected:
      */
     bool CheckKnownMessage(unsigned long PGN, bool &SystemMessage, bool &FastPacket);
 
+    /*********************************************************************//**
+     * \brief Build sorted index of user defined message lists
+     * 
+     * Index is built from \ref SingleFrameMessages and 
+     * \ref FastPacketMessages so that user lists need not to be scanned
+     * linearly for every received or sent message. Index will be rebuilt
+     * on next classification after any of the lists has been changed.
+     */
+    void BuildUserPGNClasses();
+
+    /*********************************************************************//**
+     * \brief Find PGN from user defined message lists index
+     * 
+     * \param PGN    PGN to be searched
+     * \return Internal user list flags of the PGN or 0, if PGN is not on
+     *         any user defined list.
+     */
+    uint8_t FindUserPGNClass(unsigned long PGN);
+
+    /*********************************************************************//**
+     * \brief Classify PGN
+     * 
+     * Classifies PGN with single binary search on default PGN table and
+     * on user defined message lists index. Result is same as with 
+     * \ref CheckKnownMessage and \ref IsFastPacketPGN.
+     * 
+     * \param PGN    PGN to be classified
+     * \return Combination of flags N2kPGNClassKnown, N2kPGNClassSystem,
+     *         N2kPGNClassFastPacket and N2kPGNClassTxFastPacket.
+     */
+    uint8_t ClassifyPGN(unsigned long PGN);
+
     /*********************************************************************//**
      * \brief Handles a received system message
      *  
@@ -1339,11 +1893,12 @@ protected:
      *  - \ref HandleCommandedAddress
      *  - \ref HandleCommandedAddress
      * 
-     * \param MsgIndex  Message Index on \ref N2kCANMsgBuf
+     * \param N2kMsg         Received message
+     * \param SystemMessage  Message has been classified as system message
      * \retval true    message was handled
      * \retval false 
      */
-    bool HandleReceivedSystemMessage(int MsgIndex);
+    bool HandleReceivedSystemMessage(const tN2kMsg &N2kMsg, bool SystemMessage);
 
     /*********************************************************************//**
      * \brief Forwards a N2k message
@@ -1363,9 +1918,11 @@ protected:
      * \ref ForwardType( \ref  tForwardType) to the correct 
      * \ref ForwardStream.
      *
-     * \param N2kCanMsg  N2k CAN message object, see \ref tN2kCANMsg
+     * \param N2kMsg        N2k message object
+     * \param KnownMessage  Message is known. Unknown messages will not be
+     *                      forwarded, if forward only known messages is set.
      */
-    void ForwardMessage(const tN2kCANMsg &N2kCanMsg);
+    void ForwardMessage(const tN2kMsg &N2kMsg, bool KnownMessage);
     
     /*********************************************************************//**
      * \brief Respond to an ISO request
@@ -1558,6 +2115,129 @@ protected:
      */
     void RunMessageHandlers(const tN2kMsg &N2kMsg);
 
+    /*********************************************************************//**
+     * \brief Run all long message handlers
+     *
+     * \param N2kMsg        Message header
+     * \param Data          Pointer to message payload
+     * \param DataLen       Payload length
+     */
+    void RunLongMessageHandlers(const tN2kMsg &N2kMsg, const unsigned char *Data, uint16_t DataLen);
+
+    /*********************************************************************//**
+     * \brief Handle ready message from \ref N2kCANMsgBuf
+     *
+     * Message will be handled as system message, forwarded and delivered
+     * to handlers.
+     *
+     * \param CANMsg        Ready message
+     */
+    void HandleCANMsg(tN2kCANMsg &CANMsg);
+
+    /*********************************************************************//**
+     * \brief Handle received single frame message
+     *
+     * Frame payload is copied directly to \ref SingleFrameMsg and delivered
+     * same way as \ref HandleCANMsg does. This avoids slot search and
+     * buffer handling for most common traffic.
+     *
+     * \param Priority      Priority of the message
+     * \param PGN           PGN of the message
+     * \param Source        Source address
+     * \param Destination   Destination address
+     * \param len           Frame payload length
+     * \param buf           Frame payload
+     * \param SystemMessage Message is system message
+     * \param KnownMessage  Message is known message
+     */
+    void HandleSingleFrameMsg(unsigned char Priority, unsigned long PGN, unsigned char Source, unsigned char Destination,
+                              unsigned char len, const unsigned char *buf, bool SystemMessage, bool KnownMessage);
+
+    /*********************************************************************//**
+     * \brief Deliver complete received message
+     *
+     * Message will be handled as system message, forwarded and delivered
+     * to handlers.
+     *
+     * \param N2kMsg        Received message
+     * \param SystemMessage Message is system message
+     * \param KnownMessage  Message is known message
+     */
+    void HandleReceivedMsg(const tN2kMsg &N2kMsg, bool SystemMessage, bool KnownMessage);
+
+    /*********************************************************************//**
+     * \brief Read received frames for \ref ParseMessages
+     *
+     * Frames are read from \ref RxFrameRing on threaded mode and otherwise
+     * from driver with \ref CANGetFrames.
+     *
+     * \param Frames     Buffer for frames
+     * \param MaxFrames  Max number of frames to read
+     * \return Number of frames read
+     */
+    uint16_t ReadFrames(tCANFrame *Frames, uint16_t MaxFrames);
+
+#if defined(N2K_THREADED_RECEIVE)
+    /*********************************************************************//**
+     * \brief Receive thread function
+     */
+    void ReceiveThreadLoop();
+#endif
+
+#if defined(N2K_THREAD_SAFE_SEND)
+    /*********************************************************************//**
+     * \brief Send messages posted with \ref PostMsg
+     *
+     * At most queue size messages will be sent on one call, so that
+     * producers can not block \ref ParseMessages.
+     */
+    void SendPostedMsgs();
+#endif
+
+#if defined(N2K_LATENCY_STATS)
+    /*********************************************************************//**
+     * \brief Start latency measurement of message dispatch
+     *
+     * Records arrival to ready latency and saves ready time for
+     * \ref LatencyHandlerStart.
+     *
+     * \param N2kMsg        Message ready for dispatch
+     */
+    void LatencyReady(const tN2kMsg &N2kMsg);
+
+    /*********************************************************************//**
+     * \brief Record ready to handler latency before handler call
+     *
+     * \return Handler start time for \ref LatencyHandlerEnd or 0, if
+     *         message is not measured.
+     */
+    uint64_t LatencyHandlerStart();
+
+    /*********************************************************************//**
+     * \brief Record handler duration after handler call
+     *
+     * \param Start         Value returned by \ref LatencyHandlerStart
+     */
+    void LatencyHandlerEnd(uint64_t Start);
+#endif
+
+    /*********************************************************************//**
+     * \brief Build PGN index for message handlers
+     *
+     * Index is rebuilt on next \ref RunMessageHandlers after handler has been
+     * attached or detached. Index buffer will be reused if it is large enough.
+     */
+    void BuildMsgHandlerIndex();
+
+    /*********************************************************************//**
+     * \brief Find first message handler for PGN
+     *
+     * \param PGN    PGN of the message
+     * \return First handler on \ref MsgHandlers list for PGN or 0, if there
+     *         is no handlers for it.
+     */
+    tMsgHandler *FindMsgHandlers(unsigned long PGN);
+
     /*********************************************************************//**
      * \brief Should received message be handled depending on the destination
      *        of the received message
@@ -1815,6 +2495,36 @@ public:
      */
     void SetN2kCANMsgBufSize(const uint8_t _MaxN2kCANMsgs) { if (N2kCANMsgBuf==0) { MaxN2kCANMsgs=_MaxN2kCANMsgs; }; }
 
+    /*********************************************************************//**
+     * \brief Add payload buffer size class for long received messages.
+     * 
+     * Every message slot set with \ref SetN2kCANMsgBufSize holds messages
+     * up to tN2kMsg::MaxDataLen (223 bytes), so they will be reassembled
+     * and handled without copying. By default longer ISO Transport Protocol
+     * messages will be dropped. With this function you can define buffer
+     * pool for them. Pool can have up to 4 size classes and message takes
+     * smallest free buffer it fits. E.g.,
+     * \code
+     * NMEA2000.SetN2kCANMsgBufSize(12);
+     * NMEA2000.AddN2kCANMsgBufClass(400,2);   // Short long messages
+     * NMEA2000.AddN2kCANMsgBufClass(1785,1);  // Max ISO TP message
+     * \endcode
+     * 
+     * ISO Transport Protocol messages up to largest buffer size (max 1785 bytes)
+     * will be received. Messages longer than tN2kMsg::MaxDataLen will be 
+     * delivered with payload pointer to \ref SetLongMsgHandler callback and 
+     * tMsgHandler::HandleLongMsg. Message will be dropped, if there is 
+     * no free buffer large enough.
+     * 
+     * Function has to be called before communication opens. See \ref tNMEA2000::Open().
+     * 
+     * \param BufSize   Size of buffers in bytes
+     * \param BufCount  Count of buffers
+     * \retval true     Class has been added
+     * \retval false    Too many classes or communication has been opened.
+     */
+    bool AddN2kCANMsgBufClass(uint16_t BufSize, uint8_t BufCount) { return ( N2kCANMsgBuf==0 && N2kMsgBufPool.AddClass(BufSize,BufCount) ); }
+
     /*********************************************************************//**
      * \brief Set CAN send frame buffer size.
      * 
@@ -1869,6 +2579,149 @@ public:
      */
     virtual void SetN2kCANReceiveFrameBufSize(const uint16_t _MaxCANReceiveFrames) { if ( !IsInitialized() ) MaxCANReceiveFrames=_MaxCANReceiveFrames; }
 
+    /*********************************************************************//**
+     * \brief Set max number of frames read on single ParseMessages call
+     *
+     * \ref ParseMessages reads frames until driver has no more frames or
+     * this limit has been reached. Default is 20. Increase this, if your
+     * loop is slow and bus busy, so that driver receive buffer does not
+     * overflow.
+     *
+     * \sa
+     *  - \ref tNMEA2000::SetMaxParseTime
+     *  - \ref tNMEA2000::ParseMessages
+     *
+     * \param _MaxReadFramesOnParse Max number of frames. 0 sets default.
+     */
+    void SetMaxReadFramesOnParse(uint16_t _MaxReadFramesOnParse) { MaxReadFramesOnParse=(_MaxReadFramesOnParse>0?_MaxReadFramesOnParse:20); }
+
+    /*********************************************************************//**
+     * \brief Set max time used for reading frames on single ParseMessages call
+     *
+     * Time is checked after each read batch of max \ref N2kMaxCANGetFrames
+     * frames, so it may be exceeded by handling time of one batch. Frame
+     * count limit set with \ref SetMaxReadFramesOnParse is still valid, so
+     * set it large, if you want to limit reading only by time.
+     *
+     * \param _MaxParseTime Max time in microseconds. 0 disables time limit.
+     */
+    void SetMaxParseTime(uint32_t _MaxParseTime) { MaxParseTime=_MaxParseTime; }
+
+#if !defined(N2K_NO_SEND_QUEUE_STATS)
+    /*********************************************************************//**
+     * \brief Get send statistics for CAN priority
+     *
+     * Statistics can be used to verify, how long frames of each priority
+     * has to wait on library send buffer. Average latency is 
+     * TotalLatency/BufferedFrames.
+     *
+     * \param Priority  CAN priority 0-7
+     * \param Stats     Statistics for the priority
+     * \retval true     Success
+     * \retval false    Invalid priority
+     */
+    bool GetSendQueueStats(uint8_t Priority, tCANSendQueueStats &Stats) const;
+
+    /*********************************************************************//**
+     * \brief Reset send statistics of all priorities
+     */
+    void ResetSendQueueStats();
+#endif
+
+#if !defined(N2K_NO_STATISTICS)
+    /*********************************************************************//**
+     * \brief Get snapshot of runtime counters
+     *
+     * Counters are updated on normal frame and message handling, so 
+     * reading them is cheap and can be done e.g., periodically for
+     * monitoring. For interval values read snapshot and then call
+     * \ref ResetStatistics.
+     *
+     * Counters can be disabled with N2K_NO_STATISTICS.
+     *
+     * \param Stats     Snapshot of counters
+     */
+    void GetStatistics(tStatistics &Stats) const;
+
+    /*********************************************************************//**
+     * \brief Reset runtime counters
+     *
+     * Cumulative counters will be cleared and high-water marks will be set
+     * to current values.
+     */
+    void ResetStatistics();
+#endif
+
+#if defined(N2K_LATENCY_STATS)
+    /*********************************************************************//**
+     * \brief Enable receive latency histograms
+     *
+     * Library records for each received message log bucketed histograms of
+     * first frame arrival to message ready, ready to each handler start
+     * and handler duration. Histograms are kept for max MaxPGNs PGNs in
+     * order of reception, rest will be collected to "other" entry. Memory
+     * will be allocated on call. See \ref tN2kLatencyStats.
+     *
+     * Instrumentation will be compiled only with N2K_LATENCY_STATS. Arrival
+     * time requires receive timestamps, so with N2K_NO_RX_TIMESTAMP only
+     * handler stages will be recorded.
+     *
+     * \param MaxPGNs   Max number of separately tracked PGNs. 0 disables
+     *                  recording and frees memory.
+     */
+    void EnableLatencyStats(uint8_t MaxPGNs=N2kLatencyDefaultMaxPGNs) { LatencyStats.Init(MaxPGNs); LatencyEntry=0; }
+
+    /*********************************************************************//**
+     * \brief Get receive latency histograms
+     */
+    const tN2kLatencyStats &GetLatencyStats() const { return LatencyStats; }
+
+    /*********************************************************************//**
+     * \brief Clear receive latency histograms
+     */
+    void ResetLatencyStats() { LatencyStats.Reset(); LatencyEntry=0; }
+
+    /*********************************************************************//**
+     * \brief Print receive latency histograms
+     *
+     * \param Stream    Stream to print to
+     * \sa \ref tN2kLatencyStats::Dump
+     */
+    void DumpLatencyStats(N2kStream *Stream) const { LatencyStats.Dump(Stream); }
+#endif
+
+    /*********************************************************************//**
+     * \brief Set messages, which will be sent with latest value wins rule
+     *
+     * When driver can not send frames immediately, they will be buffered on 
+     * library send buffer. For rapid update messages it has no sense to send
+     * old values after congestion. With coalescing a single frame message,
+     * which is still waiting on send buffer, will be replaced in place with
+     * new value of same message. Messages are same, if they have same PGN,
+     * source (device), destination, priority and instance.
+     *
+     * Only single frame messages will be coalesced. Fast packet messages are
+     * always sent as complete sequence.
+     *
+     * \code
+     * const tNMEA2000::tSendCoalesceMsg CoalesceMsgs[]={
+     *   {127250L,N2kNoInstanceByte},
+     *   {127251L,N2kNoInstanceByte},
+     *   {129025L,N2kNoInstanceByte},
+     *   {127488L,0}, // Engine instance is first byte
+     *   {0,0}
+     * };
+     * ...
+     * NMEA2000.SetSendCoalescing(CoalesceMsgs);
+     * \endcode
+     *
+     * \param _Messages    List of messages terminated with PGN 0. List must
+     *                     be static. Use 0 to disable coalescing.
+     * \param MaxPending   Max number of buffered frames tracked. Has effect
+     *                     only on first call.
+     */
+    void SetSendCoalescing(const tSendCoalesceMsg *_Messages, uint8_t MaxPending=8);
+
     /*********************************************************************//**
      * \brief Set the Product Information of this device.
      *
@@ -2549,6 +3402,106 @@ public:
     void SetHeartbeatInterval(unsigned long interval, bool SetAsDefault=true, int iDev=-1) __attribute__ ((deprecated));
 #endif
 
+#if !defined(N2K_NO_PERIODIC_MSG_SUPPORT)
+    /*********************************************************************//**
+     * \brief Register message to be sent periodically
+     *
+     * Library calls Fill on \ref ParseMessages, when message is due and 
+     * sends message with \ref SendMsg. Scheduling uses \ref tN2kSyncScheduler, 
+     * so messages are synchronized to open like heartbeat. Only due messages
+     * are handled on each call, so one can register hundreds of messages.
+     *
+     * With Offset \ref N2kPeriodicAutoOffset library spreads messages with
+     * same period evenly over the period, so that they are not sent at same
+     * time.
+     *
+     * \code
+     * bool FillHeading(tN2kMsg &N2kMsg, void *) {
+     *   SetN2kTrueHeading(N2kMsg,0xff,ReadHeading());
+     *   return true;
+     * }
+     * ...
+     * NMEA2000.AddPeriodicMsg(127250L,100,FillHeading);
+     * \endcode
+     *
+     * \param PGN          PGN of the message. Used for information only.
+     * \param Period       Period in ms. 0 registers message disabled.
+     * \param Fill         Function, which fills message
+     * \param Context      Context pointer for Fill
+     * \param DeviceIndex  Device index for \ref SendMsg
+     * \param Offset       Offset in ms or \ref N2kPeriodicAutoOffset
+     * \return Handle of periodic message or -1, if there is no memory.
+     */
+    int AddPeriodicMsg(unsigned long PGN, uint32_t Period, tPeriodicMsgFill Fill, void *Context=0, int DeviceIndex=0, uint32_t Offset=N2kPeriodicAutoOffset);
+
+    /*********************************************************************//**
+     * \brief Change period and offset of periodic message
+     *
+     * \param Handle   Handle returned by \ref AddPeriodicMsg
+     * \param Period   Period in ms. 0 disables message.
+     * \param Offset   Offset in ms or \ref N2kPeriodicAutoOffset
+     * \retval true    Success
+     * \retval false   Invalid handle
+     */
+    bool SetPeriodicMsgPeriod(int Handle, uint32_t Period, uint32_t Offset=N2kPeriodicAutoOffset);
+
+    /*********************************************************************//**
+     * \brief Get period of periodic message
+     * \param Handle   Handle returned by \ref AddPeriodicMsg
+     * \return Period in ms, 0 if message is disabled or handle is invalid.
+     */
+    uint32_t GetPeriodicMsgPeriod(int Handle) const;
+
+    /*********************************************************************//**
+     * \brief Get offset of periodic message
+     * \param Handle   Handle returned by \ref AddPeriodicMsg
+     * \return Offset in ms
+     */
+    uint32_t GetPeriodicMsgOffset(int Handle) const;
+
+protected:
+    /*********************************************************************//**
+     * \brief Send periodic messages, which are due
+     *
+     * Called by \ref ParseMessages.
+     */
+    void SendPeriodicMsgs();
+
+    /*********************************************************************//**
+     * \brief Select offset for new period so that messages are spread
+     *
+     * k:th message with same period gets offset by van der Corput sequence
+     * 0, 1/2, 1/4, 3/4, 1/8,... of period.
+     *
+     * \param Handle   Handle of the message
+     * \param Period   Period of the message
+     * \return Offset in ms
+     */
+    uint32_t AutoPeriodicMsgOffset(int Handle, uint32_t Period) const;
+
+    /*********************************************************************//**
+     * \brief Move message at Pos up on \ref PeriodicMsgHeap, if it is due earlier than parent
+     * \param Pos  Position on \ref PeriodicMsgHeap
+     * \return New position
+     */
+    uint16_t PeriodicMsgHeapUp(uint16_t Pos);
+
+    /*********************************************************************//**
+     * \brief Move message at Pos down on \ref PeriodicMsgHeap, if it is due later than children
+     * \param Pos  Position on \ref PeriodicMsgHeap
+     */
+    void PeriodicMsgHeapDown(uint16_t Pos);
+
+    /*********************************************************************//**
+     * \brief Reschedule all periodic messages
+     *
+     * Called on open after scheduler synchronization.
+     */
+    void RestartPeriodicMsgs();
+
+public:
+#endif
+
     /*********************************************************************//**
      * \brief Set the library mode and start source address.
      *
@@ -2687,6 +3640,107 @@ public:
      */
     bool SendMsg(const tN2kMsg &N2kMsg, int DeviceIndex=0);
 
+#if defined(N2K_THREAD_SAFE_SEND)
+    /*********************************************************************//**
+     * \brief Post message for sending from any thread
+     *
+     * \ref SendMsg is not reentrant, so it must be called only from the
+     * thread calling \ref ParseMessages. PostMsg can be called 
+     * concurrently from any number of threads. Message will be copied to
+     * lock free queue and \ref ParseMessages sends queued messages with
+     * \ref SendMsg in posting order. Since all encoding is done on single
+     * thread, fast packet sequence counters stay valid per PGN and device.
+     *
+     * If the thread calling \ref ParseMessages sleeps on 
+     * \ref GetNextWakeupTime, application should wake it after posting.
+     *
+     * Available only with N2K_THREAD_SAFE_SEND.
+     *
+     * \param N2kMsg          Reference to a N2kMsg Object
+     * \param DeviceIndex     index of the device on \ref Devices. 
+     *                        See \ref SendMsg.
+     * \retval true           Message has been queued
+     * \retval false          Queue is full. See \ref GetPostMsgOverflows.
+     */
+    bool PostMsg(const tN2kMsg &N2kMsg, int DeviceIndex=0);
+
+    /*********************************************************************//**
+     * \brief Set size of queue for \ref PostMsg
+     *
+     * Queue will be reallocated, so call this before starting any thread
+     * using \ref PostMsg. Default size is \ref N2kDefaultPostMsgBufSize.
+     * Size will be rounded up to power of two.
+     *
+     * \param MaxPostMsgs   Number of messages on queue
+     */
+    void SetPostMsgBufSize(uint16_t MaxPostMsgs);
+
+    /*********************************************************************//**
+     * \brief Count of messages \ref PostMsg has dropped, because queue was full
+     */
+    uint32_t GetPostMsgOverflows() const { return PostMsgOverflows.load(std::memory_order_relaxed); }
+#endif
+
+#if defined(N2K_THREADED_RECEIVE)
+    /*********************************************************************//**
+     * \brief Start thread, which reads frames from driver
+     *
+     * On threaded mode receive thread reads frames from driver with 
+     * \ref CANGetFrames to lock free single producer, single consumer ring
+     * and \ref ParseMessages takes frames from ring for reassembly and 
+     * handlers. In this way slow handlers do not cause driver or kernel 
+     * buffer overflow. Frames, which do not fit to ring, are dropped and
+     * counted, see \ref GetRxRingOverflows. Receive time is set by
+     * receive thread, if driver does not provide it.
+     *
+     * Driver must allow \ref CANGetFrames to be called in parallel with
+     * \ref CANSendFrame (e.g. SocketCAN). If driver provides 
+     * \ref CANGetPollFd, thread waits on it, otherwise it sleeps IdleTime
+     * when there are no frames.
+     *
+     * Thread can be started only after open, e.g., on OnOpen callback
+     * (\ref SetOnOpen) or after \ref IsOpen returns true. Call
+     * \ref StopReceiveThread before destroying object.
+     *
+     * Available only with N2K_THREADED_RECEIVE.
+     *
+     * \param RingSize  Size of frame ring. Will be rounded up to power of two.
+     * \param IdleTime  Wait time in microseconds, when there are no frames.
+     * \retval true     Thread has been started
+     * \retval false     Not open or thread is already running
+     */
+    bool StartReceiveThread(uint16_t RingSize=N2kDefaultRxFrameRingSize, uint32_t IdleTime=1000);
+
+    /*********************************************************************//**
+     * \brief Stop receive thread
+     *
+     * Frames left on ring will be handled by \ref ParseMessages before
+     * it continues reading driver directly.
+     */
+    void StopReceiveThread();
+
+    /*********************************************************************//**
+     * \brief Is receive thread running
+     */
+    bool IsReceiveThreadRunning() const { return ReceiveThreadRun.load(std::memory_order_acquire); }
+
+    /*********************************************************************//**
+     * \brief Count of frames receive thread has dropped, because ring was full
+     */
+    uint32_t GetRxRingOverflows() const { return RxRingOverflows.load(std::memory_order_relaxed); }
+
+    /*********************************************************************//**
+     * \brief Set function receive thread calls after it has got frames
+     *
+     * Function is called on receive thread. It can be used e.g., to wake
+     * main loop waiting on \ref GetNextWakeupTime with eventfd.
+     *
+     * \param Notify    Function to be called or 0 to disable
+     * \param Context   Context for the function
+     */
+    void SetReceiveNotify(void (*Notify)(void *Context), void *Context=0) { ReceiveNotify=Notify; ReceiveNotifyContext=Context; }
+#endif
+
     /*********************************************************************//**
      * \brief Parse all incoming Messages
      *
@@ -2712,6 +3766,46 @@ public:
      * See example TemperatureMonitor.ino.
      */
     void ParseMessages();
+
+    /*********************************************************************//**
+     * \brief Get time, when \ref ParseMessages must be called next time
+     *
+     * Time is earliest pending deadline of open, address claim, pending
+     * information, ISO TP broadcast, heartbeat and periodic message 
+     * schedulers. If library send buffer has frames, next retry will be 
+     * after \ref N2kSendRetryWakeupTime. Received frames are not included, 
+     * so \ref ParseMessages must also be called, when there are frames
+     * available. With driver providing \ref GetPollFd main loop on Linux
+     * can be e.g.:
+     * \code
+     * while ( true ) {
+     *   NMEA2000.ParseMessages();
+     *   epoll_wait(epfd,events,1,NMEA2000.GetWakeupTimeout(1000));
+     * }
+     * \endcode
+     * Note that sending messages from outside changes deadlines, so after
+     * that wait must be recalculated.
+     *
+     * \return Time in \ref N2kMillis64 time base. 0xffffffffffffffff, if
+     *         there is nothing scheduled.
+     */
+    uint64_t GetNextWakeupTime();
+
+    /*********************************************************************//**
+     * \brief Get time to \ref GetNextWakeupTime in milliseconds
+     *
+     * \param MaxTimeout    Max result. Return value will be limited to this.
+     * \return Milliseconds until next \ref ParseMessages call is required.
+     */
+    uint32_t GetWakeupTimeout(uint32_t MaxTimeout=0xffffffffUL);
+
+    /*********************************************************************//**
+     * \brief Get pollable file descriptor of the driver
+     *
+     * \return File descriptor or -1, if driver does not provide it.
+     * \sa \ref CANGetPollFd, \ref GetNextWakeupTime
+     */
+    int GetPollFd() { return CANGetPollFd(); }
     
     /*********************************************************************//**
      * \brief Set OnOpen callback function
@@ -2742,6 +3836,44 @@ public:
      */
     void SetMsgHandler(void (*_MsgHandler)(const tN2kMsg &N2kMsg));
 
+    /*********************************************************************//**
+     * \brief Set the message handler for long incoming messages.
+     *
+     * Messages longer than tN2kMsg::MaxDataLen can be received only with
+     * ISO Transport Protocol and when buffer pool has been configured
+     * for them with \ref AddN2kCANMsgBufClass. Handler gets message header
+     * and pointer to payload on library buffer without copying. Payload
+     * is valid only during call.
+     * 
+     * \param _LongMsgHandler  Callback function pointer
+     */
+    void SetLongMsgHandler(void (*_LongMsgHandler)(const tN2kMsg &N2kMsg, const unsigned char *Data, uint16_t DataLen));
+
+    /*********************************************************************//**
+     * \brief Set the handler for received raw frames.
+     *
+     * Handler will be called for each frame read from driver before library
+     * handles it. Only one frame handler can be set.
+     *
+     * \param _FrameHandler  Pointer to handler or 0 to remove it
+     */
+    void SetFrameHandler(tFrameHandler *_FrameHandler) { FrameHandler=_FrameHandler; }
+
+    /*********************************************************************//**
+     * \brief Send raw frame
+     *
+     * Frame will be sent as is with its own CAN id, so source address will
+     * not be set to device address. Frames are sent in order and frames,
+     * which can not be sent immediately, will be buffered as with 
+     * \ref SendMsg. This is e.g., for forwarding frames received from other
+     * bus.
+     *
+     * \param Frame  Frame to send
+     * \retval true  Frame has been sent or buffered
+     * \retval false Not open, listen only mode or buffer full
+     */
+    bool SendRawFrame(const tCANFrame &Frame);
+
     /*********************************************************************//**
      * \brief Attach a  message handler for incoming N2kMessages
      * 
@@ -3314,4 +4446,26 @@ inline void SetHeartbeat(tN2kMsg &N2kMsg, uint32_t timeInterval_ms, uint8_t sequ
 	SetN2kPGN126993(N2kMsg, timeInterval_ms, sequenceCounter);
 }
 
+/************************************************************************//**
+ * \brief Convert a CAN Id to NMEA2000 values
+ *
+ * \param id    given CAN Id
+ * \param prio  Priority of the N2k message
+ * \param pgn   PGN of the N2k message
+ * \param src   Source of the N2k message
+ * \param dst   Destination of the N2k message. 0xff for PDU2 format.
+ */
+void CanIdToN2k(unsigned long id, unsigned char &prio, unsigned long &pgn, unsigned char &src, unsigned char &dst);
+
+/************************************************************************//**
+ * \brief Convert NMEA2000 values into a CAN Id
+ *
+ * \param priority     Priority of the N2k message
+ * \param PGN          PGN of the N2k message
+ * \param Source       Source of the N2k message
+ * \param Destination  Destination of the N2k message
+ * \return CAN Id or 0 for invalid PDU1 PGN
+ */
+unsigned long N2ktoCanID(unsigned char priority, unsigned long PGN, unsigned long Source, unsigned char Destination);
+
 #endif
@@ -78,4 +78,83 @@
  */
 // #define N2K_NO_HEARTBEAT_SUPPORT 1          //Uncomment as needed
 
+/***********************************************************************//**
+ * \brief Deactivation of frame receive timestamps
+ * Received messages carry 64 bit microsecond receive time of first and
+ * last frame in tN2kMsg::RxStartTime and tN2kMsg::RxTime. This uses 16 B
+ * ram for each tN2kMsg and message under reassembly and 8 B for each frame
+ * read or sent on batch. Timestamps are disabled as default on AVR.
+ */
+// #define N2K_NO_RX_TIMESTAMP 1               //Uncomment as needed
+
+/** \brief Frame receive timestamps are disabled as default on AVR to save
+ * RAM. Definition must be seen by every unit using tN2kMsg, so it is here
+ * and not on N2kMsg.h. */
+#if defined(__AVR__) && !defined(N2K_NO_RX_TIMESTAMP)
+#define N2K_NO_RX_TIMESTAMP 1
+#endif
+
+/***********************************************************************//**
+ * \brief Deactivation of runtime statistics
+ * tNMEA2000::GetStatistics provides frame and message counters for
+ * monitoring. Counters use appr. 50 B ram.
+ */
+// #define N2K_NO_STATISTICS 1                 //Uncomment as needed
+
+/***********************************************************************//**
+ * \brief Deactivation of send queue statistics
+ * tNMEA2000::GetSendQueueStats provides per priority queueing counters
+ * and delays for library send frame buffer. This uses 4 B ram for each
+ * frame on send buffer and appr. 230 B for counters. Statistics are
+ * disabled as default on AVR.
+ */
+// #define N2K_NO_SEND_QUEUE_STATS 1           //Uncomment as needed
+
+/** \brief Send queue statistics are disabled as default on AVR to save
+ * RAM. Definition changes tNMEA2000 layout, so it is here and not on
+ * NMEA2000.h. */
+#if defined(__AVR__) && !defined(N2K_NO_SEND_QUEUE_STATS)
+#define N2K_NO_SEND_QUEUE_STATS 1
+#endif
+
+/***********************************************************************//**
+ * \brief Activation of receive latency histograms
+ * tNMEA2000::EnableLatencyStats records per PGN histograms of receive
+ * and handler latencies. Instrumentation is disabled as default and it
+ * will not have any cost, when not defined.
+ */
+// #define N2K_LATENCY_STATS 1                 //Uncomment as needed
+
+/***********************************************************************//**
+ * \brief Activation of thread safe message posting
+ * tNMEA2000::PostMsg can be called from any thread and messages will be
+ * sent by tNMEA2000::ParseMessages. Requires std::atomic, so it is
+ * disabled as default.
+ */
+// #define N2K_THREAD_SAFE_SEND 1              //Uncomment as needed
+
+/***********************************************************************//**
+ * \brief Activation of threaded receive
+ * tNMEA2000::StartReceiveThread starts thread, which reads frames from
+ * driver, so that slow handlers do not cause driver buffer overflow.
+ * Requires std::thread and std::atomic, so it is disabled as default.
+ */
+// #define N2K_THREADED_RECEIVE 1              //Uncomment as needed
+
+/***********************************************************************//**
+ * \brief Activation of threaded gateway
+ * tN2kGateway::StartThreads runs each bus on own thread and frames are
+ * passed between buses with lock free queues. Requires std::thread and
+ * std::atomic, so it is disabled as default.
+ */
+// #define N2K_THREADED_GATEWAY 1              //Uncomment as needed
+
+/***********************************************************************//**
+ * \brief Activation of lock free ring buffers
+ * tMPSCRingBuffer and tSPSCRingBuffer for interrupt or thread producers.
+ * Requires std::atomic. Defined automatically by N2K_THREAD_SAFE_SEND
+ * and N2K_THREADED_RECEIVE.
+ */
+// #define N2K_ATOMIC_RING_BUFFERS 1           //Uncomment as needed
+
 #endif
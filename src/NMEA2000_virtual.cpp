@@ -0,0 +1,248 @@
+/* 
+ * NMEA2000_virtual.cpp
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+
+#include "NMEA2000_virtual.h"
+#include "RingBuffer.h"
+#include <string.h>
+
+//*****************************************************************************
+// tN2kVirtualCANBus
+//*****************************************************************************
+tN2kVirtualCANBus::tN2kVirtualCANBus(uint32_t _BitRate) : Nodes(0), NodeCount(0), MaxNodes(0),
+    BitRate(_BitRate), TimeSource(N2kMicros), PendingFrames(0), InFlightSender(0), BusFreeTime(0),
+    FramesTransmitted(0), BusyTime(0) {
+  ResetRxTime64();
+}
+
+//*****************************************************************************
+tN2kVirtualCANBus::~tN2kVirtualCANBus() {
+  for ( uint16_t i=0; i<NodeCount; i++ ) Nodes[i]->Bus=0;
+  delete[] Nodes;
+}
+
+//*****************************************************************************
+void tN2kVirtualCANBus::SetTimeSource(tTimeSource _TimeSource) {
+  TimeSource=( _TimeSource!=0?_TimeSource:N2kMicros );
+  BusFreeTime=TimeSource();
+  ResetRxTime64();
+}
+
+//*****************************************************************************
+void tN2kVirtualCANBus::ResetRxTime64() {
+  LastRxTime=TimeSource();
+  RxTimeBase=( TimeSource==N2kMicros?N2kMicros64():LastRxTime );
+}
+
+//*****************************************************************************
+uint64_t tN2kVirtualCANBus::RxTime64(uint32_t Time) {
+  RxTimeBase+=(int32_t)(Time-LastRxTime);
+  LastRxTime=Time;
+  return RxTimeBase;
+}
+
+//*****************************************************************************
+void tN2kVirtualCANBus::Attach(tNMEA2000_virtual *Node) {
+  if ( NodeCount>=MaxNodes ) {
+    uint16_t NewMaxNodes=( MaxNodes>0?2*MaxNodes:8 );
+    tNMEA2000_virtual **NewNodes=new tNMEA2000_virtual*[NewMaxNodes];
+    for ( uint16_t i=0; i<NodeCount; i++ ) NewNodes[i]=Nodes[i];
+    delete[] Nodes;
+    Nodes=NewNodes;
+    MaxNodes=NewMaxNodes;
+  }
+  Nodes[NodeCount++]=Node;
+}
+
+//*****************************************************************************
+void tN2kVirtualCANBus::Detach(tNMEA2000_virtual *Node) {
+  for ( uint16_t i=0; i<NodeCount; i++ ) {
+    if ( Nodes[i]!=Node ) continue;
+    for ( NodeCount--; i<NodeCount; i++ ) Nodes[i]=Nodes[i+1];
+    break;
+  }
+  if ( Node->TxFrames!=0 ) PendingFrames-=Node->TxFrames->count();
+  if ( InFlightSender==Node ) InFlightSender=0;
+}
+
+//*****************************************************************************
+uint32_t tN2kVirtualCANBus::FrameTime(unsigned char len, uint32_t _BitRate) {
+  if ( _BitRate==0 ) return 0;
+  if ( len>8 ) len=8;
+  // Extended frame has 67 bits and data. Stuffing is possible for 54 bits and data.
+  uint32_t Bits=67+8*len+(54+8*len-1)/4;
+  return (Bits*1000000UL+_BitRate/2)/_BitRate;
+}
+
+//*****************************************************************************
+void tN2kVirtualCANBus::Deliver(tNMEA2000_virtual *Sender, const tNMEA2000::tCANFrame &Frame, uint32_t DeliveryTime) {
+  tNMEA2000::tCANFrame RxFrame=Frame;
+#if !defined(N2K_NO_RX_TIMESTAMP)
+  RxFrame.RxTime=RxTime64(DeliveryTime);
+#else
+  (void)DeliveryTime;
+#endif
+
+  FramesTransmitted++;
+  for ( uint16_t i=0; i<NodeCount; i++ ) {
+    tNMEA2000_virtual *Node=Nodes[i];
+    if ( Node==Sender || Node->RxFrames==0 ) continue;
+    if ( !Node->RxFrames->add(RxFrame) ) Node->RxOverflows++;
+  }
+}
+
+//*****************************************************************************
+tNMEA2000_virtual *tN2kVirtualCANBus::Arbitrate() {
+  if ( PendingFrames==0 ) return 0;
+
+  tNMEA2000_virtual *Winner=0;
+  unsigned long WinnerId=0;
+  for ( uint16_t i=0; i<NodeCount; i++ ) {
+    tNMEA2000_virtual *Node=Nodes[i];
+    if ( Node->TxFrames==0 ) continue;
+    tNMEA2000::tCANFrame *Frame=Node->TxFrames->peek();
+    if ( Frame==0 ) continue;
+    if ( Winner==0 || Frame->id<WinnerId ) {
+      Winner=Node;
+      WinnerId=Frame->id;
+    }
+  }
+
+  return Winner;
+}
+
+//*****************************************************************************
+void tN2kVirtualCANBus::Run() {
+  if ( BitRate==0 ) return;
+
+  uint32_t Now=TimeSource();
+
+  while ( true ) {
+    if ( InFlightSender!=0 ) {
+      if ( (int32_t)(BusFreeTime-Now)>0 ) return;
+      tNMEA2000_virtual *Sender=InFlightSender;
+      InFlightSender=0;
+      Deliver(Sender,InFlightFrame,BusFreeTime);
+    }
+
+    tNMEA2000_virtual *Winner=Arbitrate();
+    if ( Winner==0 ) return;
+    Winner->TxFrames->read(InFlightFrame);
+    PendingFrames--;
+    InFlightSender=Winner;
+    uint32_t Time=FrameTime(InFlightFrame.len,BitRate);
+    BusFreeTime+=Time;
+    BusyTime+=Time;
+  }
+}
+
+//*****************************************************************************
+bool tN2kVirtualCANBus::Send(tNMEA2000_virtual *Sender, const tNMEA2000::tCANFrame &Frame) {
+  if ( BitRate==0 ) {
+    Deliver(Sender,Frame,TimeSource());
+    return true;
+  }
+
+  if ( Sender->TxFrames==0 ) return false;
+
+  Run();
+  if ( InFlightSender==0 && PendingFrames==0 ) {
+    // Bus has been idle, so transmission starts now.
+    uint32_t Now=TimeSource();
+    if ( (int32_t)(Now-BusFreeTime)>0 ) BusFreeTime=Now;
+  }
+  if ( !Sender->TxFrames->add(Frame) ) return false;
+  PendingFrames++;
+  Run();
+
+  return true;
+}
+
+//*****************************************************************************
+// tNMEA2000_virtual
+//*****************************************************************************
+tNMEA2000_virtual::tNMEA2000_virtual(tN2kVirtualCANBus &_Bus) : tNMEA2000(),
+    Bus(&_Bus), RxFrames(0), TxFrames(0), MaxTxFrames(N2kVirtualCANTxMailboxes), RxOverflows(0) {
+  Bus->Attach(this);
+}
+
+//*****************************************************************************
+tNMEA2000_virtual::~tNMEA2000_virtual() {
+  if ( Bus!=0 ) Bus->Detach(this);
+  delete RxFrames;
+  delete TxFrames;
+}
+
+//*****************************************************************************
+void tNMEA2000_virtual::InitCANFrameBuffers() {
+  if ( RxFrames==0 ) {
+    if ( MaxCANReceiveFrames==0 ) MaxCANReceiveFrames=N2kVirtualCANRxFrames;
+    // Ring buffer keeps one entry free.
+    RxFrames=new tRingBuffer<tCANFrame>(MaxCANReceiveFrames+1);
+    TxFrames=new tRingBuffer<tCANFrame>(MaxTxFrames+1);
+  }
+
+  tNMEA2000::InitCANFrameBuffers();
+}
+
+//*****************************************************************************
+bool tNMEA2000_virtual::CANOpen() {
+  return ( Bus!=0 );
+}
+
+//*****************************************************************************
+bool tNMEA2000_virtual::CANSendFrame(unsigned long id, unsigned char len, const unsigned char *buf, bool /*wait_sent*/) {
+  if ( Bus==0 ) return false;
+
+  tCANFrame Frame;
+  Frame.id=id;
+  Frame.len=( len<=8?len:8 );
+  memcpy(Frame.buf,buf,Frame.len);
+
+  return Bus->Send(this,Frame);
+}
+
+//*****************************************************************************
+bool tNMEA2000_virtual::CANGetFrame(unsigned long &id, unsigned char &len, unsigned char *buf) {
+  if ( Bus==0 || RxFrames==0 ) return false;
+
+  Bus->Run();
+  const tCANFrame *Frame=RxFrames->getReadRef();
+  if ( Frame==0 ) return false;
+
+  id=Frame->id;
+  len=Frame->len;
+  memcpy(buf,Frame->buf,len);
+
+  return true;
+}
+
+//*****************************************************************************
+uint16_t tNMEA2000_virtual::CANGetFrames(tCANFrame *Frames, uint16_t MaxFrames) {
+  if ( Bus==0 || RxFrames==0 ) return 0;
+
+  Bus->Run();
+  uint16_t Count=0;
+  for ( ; Count<MaxFrames && RxFrames->read(Frames[Count]); Count++ );
+
+  return Count;
+}
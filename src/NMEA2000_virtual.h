@@ -0,0 +1,301 @@
+/* 
+ * NMEA2000_virtual.h
+ * Copyright (c) 2026 Timo Lappalainen, Kave Oy, www.kave.fi
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS 
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+
+/*************************************************************************//**
+ * \file  NMEA2000_virtual.h
+ * \brief In-memory virtual CAN bus and driver class for tNMEA2000
+ * 
+ * tNMEA2000_virtual is driver class, which does not need any hardware. Any
+ * number of tNMEA2000_virtual instances can be attached to same
+ * tN2kVirtualCANBus and they will see each others frames as on real bus.
+ * So one can run complete devices with address claiming, fast packet and 
+ * ISO TP messages on single process e.g., for simulation, testing and 
+ * benchmarking.
+ * 
+ * As default bus has unlimited bandwidth and frames will be delivered to
+ * other nodes immediately. With \ref tN2kVirtualCANBus::SetBitRate bus
+ * models frame transmission time and arbitration: frames wait on node
+ * transmit mailboxes and frame with lowest CAN id wins the bus, when
+ * previous frame has been transmitted.
+ * 
+ * Bus and nodes are not thread safe. All nodes attached to same bus must
+ * be used from same thread.
+ * 
+ * \code
+ * tN2kVirtualCANBus Bus;
+ * tNMEA2000_virtual Node1(Bus);
+ * tNMEA2000_virtual Node2(Bus);
+ * ...
+ * Node1.Open();
+ * Node2.Open();
+ * while (true) {
+ *   Node1.ParseMessages();
+ *   Node2.ParseMessages();
+ * }
+ * \endcode
+ */
+
+#ifndef _NMEA2000_VIRTUAL_H_
+#define _NMEA2000_VIRTUAL_H_
+
+#include "NMEA2000.h"
+
+template <typename T> class tRingBuffer;
+class tNMEA2000_virtual;
+
+/** \brief Default size of node receive buffer, if it has not been set by
+ * \ref tNMEA2000::SetN2kCANReceiveFrameBufSize */
+#if !defined(N2kVirtualCANRxFrames)
+#define N2kVirtualCANRxFrames 64
+#endif
+/** \brief Default number of node transmit mailboxes used with bit rate model */
+#if !defined(N2kVirtualCANTxMailboxes)
+#define N2kVirtualCANTxMailboxes 3
+#endif
+
+/************************************************************************//**
+ * \class tN2kVirtualCANBus
+ * \brief Shared in-memory bus for tNMEA2000_virtual nodes
+ * \ingroup group_coreSupplementary
+ * 
+ * Bus delivers each frame sent by a node to all other opened nodes attached
+ * to the bus. Sender does not receive its own frames.
+ * 
+ * With bit rate set bus transmits frames in priority order and delivers
+ * them after frame transmission time has elapsed. Time is read from
+ * \ref N2kMicros as default. For repeatable results one can provide own 
+ * time source with \ref SetTimeSource. Frame receive time is also taken
+ * from the time source.
+ */
+class tN2kVirtualCANBus {
+  friend class tNMEA2000_virtual;
+public:
+  /** \brief Function type for bus time source in microseconds */
+  typedef uint32_t (*tTimeSource)();
+
+protected:
+  /** \brief Attached nodes */
+  tNMEA2000_virtual **Nodes;
+  /** \brief Number of attached nodes */
+  uint16_t NodeCount;
+  /** \brief Size of \ref Nodes */
+  uint16_t MaxNodes;
+  /** \brief Bit rate for transmission model. 0 means unlimited. */
+  uint32_t BitRate;
+  /** \brief Time source for transmission model and frame receive time */
+  tTimeSource TimeSource;
+  /** \brief Last time read from \ref TimeSource for \ref RxTime64 */
+  uint32_t LastRxTime;
+  /** \brief \ref LastRxTime extended to 64 bits */
+  uint64_t RxTimeBase;
+
+  /** \brief Number of frames waiting on node transmit mailboxes */
+  uint32_t PendingFrames;
+  /** \brief Frame on transmission */
+  tNMEA2000::tCANFrame InFlightFrame;
+  /** \brief Sender of \ref InFlightFrame or 0, if bus is idle */
+  tNMEA2000_virtual *InFlightSender;
+  /** \brief Time, when current transmission ends and bus is free */
+  uint32_t BusFreeTime;
+
+  /** \brief Number of frames transmitted */
+  uint32_t FramesTransmitted;
+  /** \brief Total time bus has been busy in microseconds */
+  uint64_t BusyTime;
+
+protected:
+  /*********************************************************************//**
+   * \brief Attach node to the bus.
+   * \param Node  Node to attach
+   */
+  void Attach(tNMEA2000_virtual *Node);
+  /*********************************************************************//**
+   * \brief Detach node from the bus.
+   * \param Node  Node to detach
+   */
+  void Detach(tNMEA2000_virtual *Node);
+  /*********************************************************************//**
+   * \brief Send frame from node to the bus.
+   *
+   * Without bit rate frame will be delivered immediately. Otherwise it
+   * will be saved to node transmit mailbox.
+   * 
+   * \param Sender  Sending node
+   * \param Frame   Frame to send
+   * \retval true   Frame accepted
+   * \retval false  Node transmit mailboxes are full.
+   */
+  bool Send(tNMEA2000_virtual *Sender, const tNMEA2000::tCANFrame &Frame);
+  /*********************************************************************//**
+   * \brief Deliver frame to all nodes except sender
+   * 
+   * Frame receive time will be set to delivery time.
+   * 
+   * \param Sender        Sending node
+   * \param Frame         Frame to deliver
+   * \param DeliveryTime  Delivery time read from \ref TimeSource
+   */
+  void Deliver(tNMEA2000_virtual *Sender, const tNMEA2000::tCANFrame &Frame, uint32_t DeliveryTime);
+  /*********************************************************************//**
+   * \brief Extend time read from \ref TimeSource to 64 bits
+   * 
+   * Time source wraps around every ~71.6 minutes. Consecutive calls must
+   * be less than half of that apart. With default time source result will
+   * be on same time base as \ref N2kMicros64.
+   * 
+   * \param Time  Time read from \ref TimeSource
+   * \return 64 bit time in microseconds.
+   */
+  uint64_t RxTime64(uint32_t Time);
+  /** \brief Reset \ref RxTime64 base to current time of \ref TimeSource */
+  void ResetRxTime64();
+  /*********************************************************************//**
+   * \brief Select next frame to be transmitted by arbitration.
+   * 
+   * Each node takes part to arbitration with oldest frame on its transmit
+   * mailboxes so that node frame order will be kept. Frame with lowest
+   * id wins.
+   * 
+   * \return Winning node or 0, if there is no pending frames.
+   */
+  tNMEA2000_virtual *Arbitrate();
+
+public:
+  /*********************************************************************//**
+   * \brief Constructor for the virtual bus
+   * \param _BitRate  Bit rate for transmission model. Default 0 means
+   *                  unlimited bandwidth. NMEA2000 bit rate is 250000.
+   */
+  tN2kVirtualCANBus(uint32_t _BitRate=0);
+  /*********************************************************************//**
+   * \brief Destructor. Detaches all nodes.
+   */
+  ~tN2kVirtualCANBus();
+
+  /*********************************************************************//**
+   * \brief Set bit rate for transmission model
+   * 
+   * Change bit rate only, when there is no traffic on the bus.
+   * 
+   * \param _BitRate  Bit rate or 0 for unlimited bandwidth.
+   */
+  void SetBitRate(uint32_t _BitRate) { BitRate=_BitRate; }
+  /** \brief Get bit rate. 0 means unlimited bandwidth. */
+  uint32_t GetBitRate() const { return BitRate; }
+  /*********************************************************************//**
+   * \brief Set time source for transmission model and frame receive time
+   * \param _TimeSource Function returning time in microseconds or 0 for
+   *                    \ref N2kMicros.
+   */
+  void SetTimeSource(tTimeSource _TimeSource);
+
+  /*********************************************************************//**
+   * \brief Transmit frames, which are due by transmission model
+   * 
+   * Nodes call this automatically, when they send or read frames. Without
+   * bit rate this does nothing.
+   */
+  void Run();
+
+  /** \brief Get number of attached nodes */
+  uint16_t GetNodeCount() const { return NodeCount; }
+  /** \brief Get number of frames waiting on node transmit mailboxes or on transmission */
+  uint32_t GetPendingFrames() const { return PendingFrames+(InFlightSender!=0?1:0); }
+  /** \brief Get number of frames transmitted on the bus */
+  uint32_t GetFramesTransmitted() const { return FramesTransmitted; }
+  /** \brief Get total time in microseconds bus has been busy with bit rate model */
+  uint64_t GetBusyTime() const { return BusyTime; }
+
+  /*********************************************************************//**
+   * \brief Calculate transmission time for extended frame
+   * 
+   * Time contains frame bits, worst case stuff bits and interframe space.
+   * 
+   * \param len       Frame data length
+   * \param _BitRate  Bit rate
+   * \return Transmission time in microseconds.
+   */
+  static uint32_t FrameTime(unsigned char len, uint32_t _BitRate);
+};
+
+/************************************************************************//**
+ * \class tNMEA2000_virtual
+ * \brief tNMEA2000 driver class for \ref tN2kVirtualCANBus
+ * \ingroup group_coreSupplementary
+ * 
+ * Node attaches to the bus on construction. It receives frames, after it
+ * has been opened. Receive buffer size can be set with 
+ * \ref tNMEA2000::SetN2kCANReceiveFrameBufSize. Frames, which do not fit
+ * to full receive buffer will be dropped and counted as on CAN controller
+ * overrun.
+ */
+class tNMEA2000_virtual : public tNMEA2000 {
+  friend class tN2kVirtualCANBus;
+protected:
+  /** \brief Bus, where node is attached */
+  tN2kVirtualCANBus *Bus;
+  /** \brief Received frames */
+  tRingBuffer<tCANFrame> *RxFrames;
+  /** \brief Transmit mailboxes used with bit rate model */
+  tRingBuffer<tCANFrame> *TxFrames;
+  /** \brief Number of transmit mailboxes */
+  uint16_t MaxTxFrames;
+  /** \brief Number of frames dropped due to full receive buffer */
+  uint32_t RxOverflows;
+
+protected:
+  bool CANSendFrame(unsigned long id, unsigned char len, const unsigned char *buf, bool wait_sent=true);
+  bool CANOpen();
+  bool CANGetFrame(unsigned long &id, unsigned char &len, unsigned char *buf);
+  uint16_t CANGetFrames(tCANFrame *Frames, uint16_t MaxFrames);
+
+public:
+  /*********************************************************************//**
+   * \brief Constructor for the virtual driver class
+   * \param _Bus  Bus, where node will be attached
+   */
+  tNMEA2000_virtual(tN2kVirtualCANBus &_Bus);
+  /*********************************************************************//**
+   * \brief Destructor. Detaches node from the bus.
+   */
+  virtual ~tNMEA2000_virtual();
+
+  void InitCANFrameBuffers();
+
+  /*********************************************************************//**
+   * \brief Set number of transmit mailboxes used with bit rate model
+   * 
+   * Real CAN controllers have typically few transmit mailboxes. If they
+   * are full, library buffers frames to its own send buffer. Must be set
+   * before open.
+   * 
+   * \param _MaxTxFrames  Number of transmit mailboxes
+   */
+  void SetTxMailboxes(uint16_t _MaxTxFrames) { if ( TxFrames==0 && _MaxTxFrames>0 ) MaxTxFrames=_MaxTxFrames; }
+  /** \brief Get number of frames dropped due to full receive buffer */
+  uint32_t GetRxOverflows() const { return RxOverflows; }
+  /** \brief Get bus, where node is attached or 0 if bus has been destroyed */
+  tN2kVirtualCANBus *GetBus() const { return Bus; }
+};
+
+#endif
@@ -93,7 +93,20 @@
 #ifndef _RING_BUFFER_H_
 #define _RING_BUFFER_H_
 
-#include <cstdint>
+#include <stdint.h>
+#include <string.h>
+#include "NMEA2000_CompilerDefns.h"
+
+#if !defined(N2K_ATOMIC_RING_BUFFERS) && ( defined(N2K_THREAD_SAFE_SEND) || defined(N2K_THREADED_RECEIVE) || defined(N2K_THREADED_GATEWAY) )
+/** \brief Lock free ring buffers require std::atomic, so they are available
+ *         only, when some feature requiring them has been enabled. */
+#define N2K_ATOMIC_RING_BUFFERS 1
+#endif
+
+#if defined(N2K_ATOMIC_RING_BUFFERS)
+#include <atomic>
+#endif
+
 /************************************************************************//**
  * \class tRingBuffer
  * \brief Template Class that holds values in a ring buffer
@@ -244,6 +257,12 @@ public:
  * continuous block for all priorities instead of reserve one buffer for each
  * priority.
  * 
+ * Values are read out of add order, so free slots are kept on own list
+ * instead of ring head and tail. Slot released by read can be reused
+ * immediately, so low priority value waiting on buffer does not block
+ * adding new values. Values do not move on buffer, so pointer got with
+ * \ref getAddRef stays valid until value has been read.
+ * 
  * \note You have to take care of data locking from other threads 
  * or interrupts around calls using buffer handling routines.
  * 
@@ -270,7 +289,7 @@ protected:
   struct tValueSlot {
     /** \brief Value stored in ring buffer*/
     T Value;
-    /** \brief Index of the next value in the ring buffer (???)*/
+    /** \brief Index of the next value with same priority or next free slot */
     uint16_t next;
     /** \brief Priority of this value*/
     uint8_t priority;
@@ -294,10 +313,13 @@ protected:
   tValueSlot *buffer;
   /** \brief Pointer to priority references in buffer */
   tPriorityRef *priorityReferencies;
-  /** \brief Index of the first free index in the ring buffer */
-  uint16_t head;
-  /** \brief Index of the last occupied index in the ring buffer */
-  uint16_t tail;
+  /** \brief Index of the first free slot. Slots will be taken from here. */
+  uint16_t freeHead;
+  /** \brief Index of the last free slot. Released slots will be added here,
+   *         so that just read slot will be reused last. */
+  uint16_t freeTail;
+  /** \brief Number of values in the buffer */
+  uint16_t used;
   /** \brief Number of values that can be stored in the ring buffer*/
   uint16_t size;
   /** \brief highest priority possible*/
@@ -350,14 +372,12 @@ public:
    * \brief Clears the whole ring buffer */
   void clear();
   /************************************************************************//**
-   * \brief This function does nothing at the moment!*/
+   * \brief Buffer does not need cleaning, since released slots will be
+   *        reused directly. Function is kept for compatibility.*/
   void clean();
   /************************************************************************//**
    * \brief Returns the number of values in the ring buffer
    * 
-   * Currently function returns simple buffer count instead of true value
-   * count. Priority ring buffer may have values released between other values.
-   * 
    * \retval uint16_t Number of values in buffer
    */
   uint16_t count();
@@ -441,8 +461,250 @@ public:
    * \retval 0           No values available.
    */
   const T *getReadRef(uint8_t *_priority=0);
+
+  /************************************************************************//**
+   * \brief Get pointer to highest priority value without reading it out.
+   *
+   * Value stays on the ring buffer. Use \ref getReadRef with returned
+   * priority to read it out, e.g., after it has been successfully handled.
+   *
+   * \param *_priority   Pointer to priority, which will be set to priority
+   *                     of the value.
+   * \retval "T*"        Pointer to value, which would be next read out
+   * \retval 0           No values available.
+   */
+  T *peek(uint8_t *_priority=0);
 };
 
+#if defined(N2K_ATOMIC_RING_BUFFERS)
+/************************************************************************//**
+ * \class tMPSCRingBuffer
+ * \brief Lock free multi producer, single consumer ring buffer
+ * \ingroup group_coreSupplementary
+ *
+ * Any number of threads can \ref add values concurrently without locking.
+ * Only one thread may read values out. Each slot has sequence counter,
+ * which tells producers and consumer, whether slot is free or ready, so
+ * producers only have to compete for the head index. Size will be rounded
+ * up to power of two.
+ *
+ * Buffer is available only with N2K_ATOMIC_RING_BUFFERS, since it
+ * requires std::atomic.
+ *
+ * \tparam T Template used for the class
+ */
+template <typename T> class tMPSCRingBuffer {
+
+protected:
+  /** \brief Buffer slot */
+  struct tCell {
+    /** \brief Slot sequence. Equals position, when slot is free for
+     *  position and position+1, when value is ready for reading */
+    std::atomic<uint32_t> seq;
+    /** \brief Value */
+    T val;
+  };
+  /** \brief Pointer to the ring buffer of slots in memory*/
+  tCell *buffer;
+  /** \brief Size-1 for index masking */
+  uint32_t mask;
+  /** \brief Next position for producers */
+  std::atomic<uint32_t> head;
+  /** \brief Next position for consumer */
+  uint32_t tail;
+
+public:
+  /************************************************************************//**
+   * \brief Construct a new ring buffer object
+   *
+   * \param _size Min number of values, which can be stored. Will be
+   *              rounded up to power of two, max 32768.
+   */
+  tMPSCRingBuffer(uint16_t _size);
+  /************************************************************************//**
+   * \brief Destroy the ring buffer object
+   */
+  virtual ~tMPSCRingBuffer();
+  /************************************************************************//**
+   * \brief Get the size of the ring buffer
+   */
+  uint16_t getSize() const { return mask+1; }
+  /************************************************************************//**
+   * \brief Checks if the ring buffer is empty. Call only from consumer.
+   */
+  bool isEmpty() const;
+  /************************************************************************//**
+   * \brief Adds a new value to the ring buffer. Can be called from any
+   *        thread.
+   *
+   * \param val         Value to be added
+   * \retval true       Add succeeded
+   * \retval false      Buffer is full
+   */
+  bool add(const T &val);
+  /************************************************************************//**
+   * \brief Get pointer to next value without reading it out. Call only from
+   *        consumer.
+   *
+   * Use \ref pop to release value after it has been handled.
+   *
+   * \retval "T*"      Pointer to next value
+   * \retval 0         No values available
+   */
+  T *peek();
+  /************************************************************************//**
+   * \brief Release value got with \ref peek. Call only from consumer.
+   */
+  void pop();
+  /************************************************************************//**
+   * \brief Reads a value out from the ring buffer. Call only from consumer.
+   *
+   * \param val       Reference to the value read out from the ring buffer
+   * \retval true     Value read out from buffer.
+   * \retval false    There is no data available inside the buffer.
+   */
+  bool read(T &val);
+};
+
+/** \brief Cache line size used for separating producer and consumer data */
+#if !defined(N2kCacheLineSize)
+#define N2kCacheLineSize 64
+#endif
+
+/************************************************************************//**
+ * \class tSPSCRingBuffer
+ * \brief Wait free single producer, single consumer ring buffer
+ * \ingroup group_coreSupplementary
+ *
+ * tSPSCRingBuffer is lock free variant of \ref tRingBuffer for case, where
+ * one thread or interrupt adds values and other thread reads them out. No
+ * locking is needed around calls. Head is written only by producer and
+ * tail only by consumer. Producer and consumer data are on separate cache
+ * lines and both sides keep cached copy of other side index, so shared
+ * cache lines are touched only, when buffer seems to be full or empty.
+ * Size will be rounded up to power of two.
+ *
+ * As with \ref tRingBuffer values can be handled without copying with 
+ * \ref getAddRef and \ref getReadRef. Since other side runs in parallel,
+ * value will be passed only after \ref commitAdd or \ref commitRead.
+ *
+ * \code
+ *  tSPSCRingBuffer<tCANData> CANMessages(64);
+ *  ...
+ *  void CANInterrupt() { // Producer
+ *    tCANData *msgIn=CANMessages.getAddRef();
+ *    if ( msgIn!=0 ) {
+ *      ReadCANFrame(msgIn);
+ *      CANMessages.commitAdd();
+ *    }
+ *  }
+ *  ...
+ *  void HandleFrames() { // Consumer
+ *    const tCANData *msg;
+ *    while ( (msg=CANMessages.getReadRef())!=0 ) {
+ *      HandleFrame(msg);
+ *      CANMessages.commitRead();
+ *    }
+ *  }
+ * \endcode
+ *
+ * Buffer is available only with N2K_ATOMIC_RING_BUFFERS, since it
+ * requires std::atomic.
+ *
+ * \tparam T Template used for the class
+ */
+template <typename T> class tSPSCRingBuffer {
+
+protected:
+  /** \brief Pointer to the ring buffer of values in memory*/
+  T *buffer;
+  /** \brief Size-1 for index masking */
+  uint32_t mask;
+  /** \brief Separates shared read only data from producer data */
+  char padShared[N2kCacheLineSize];
+  /** \brief Next position to write. Written only by producer. */
+  std::atomic<uint32_t> head;
+  /** \brief Producer copy of \ref tail */
+  uint32_t cachedTail;
+  /** \brief Separates producer data from consumer data */
+  char padProducer[N2kCacheLineSize];
+  /** \brief Next position to read. Written only by consumer. */
+  std::atomic<uint32_t> tail;
+  /** \brief Consumer copy of \ref head */
+  uint32_t cachedHead;
+  /** \brief Separates consumer data from following data */
+  char padConsumer[N2kCacheLineSize];
+
+public:
+  /************************************************************************//**
+   * \brief Construct a new ring buffer object
+   *
+   * \param _size Min number of values, which can be stored. Will be
+   *              rounded up to power of two, max 32768.
+   */
+  tSPSCRingBuffer(uint16_t _size);
+  /************************************************************************//**
+   * \brief Destroy the ring buffer object
+   */
+  virtual ~tSPSCRingBuffer();
+  /************************************************************************//**
+   * \brief Get the size of the ring buffer
+   */
+  uint16_t getSize() const { return mask+1; }
+  /************************************************************************//**
+   * \brief Checks if the ring buffer is empty
+   */
+  bool isEmpty() const;
+  /************************************************************************//**
+   * \brief Returns the number of values in the ring buffer
+   */
+  uint16_t count() const;
+  /************************************************************************//**
+   * \brief Get pointer to free slot for new value. Call only from producer.
+   *
+   * Value will be visible to consumer after \ref commitAdd. Calling 
+   * getAddRef again before commit returns same slot.
+   *
+   * \retval "T *"      Pointer to free slot
+   * \retval 0          Buffer is full
+   */
+  T *getAddRef();
+  /************************************************************************//**
+   * \brief Pass value filled to slot got with \ref getAddRef to consumer
+   */
+  void commitAdd();
+  /************************************************************************//**
+   * \brief Adds a new value to the ring buffer. Call only from producer.
+   *
+   * \param val         Value to be added
+   * \retval true       Add succeeded
+   * \retval false      Buffer is full
+   */
+  bool add(const T &val);
+  /************************************************************************//**
+   * \brief Get pointer to next value. Call only from consumer.
+   *
+   * Slot will be given back to producer after \ref commitRead. Calling 
+   * getReadRef again before commit returns same value.
+   *
+   * \retval "const T*" Pointer to next value
+   * \retval 0          No values available
+   */
+  const T *getReadRef();
+  /************************************************************************//**
+   * \brief Release value got with \ref getReadRef
+   */
+  void commitRead();
+  /************************************************************************//**
+   * \brief Reads a value out from the ring buffer. Call only from consumer.
+   *
+   * \param val       Reference to the value read out from the ring buffer
+   * \retval true     Value read out from buffer.
+   * \retval false    There is no data available inside the buffer.
+   */
+  bool read(T &val);
+};
+#endif
 
 #include "RingBuffer.tpp"
 
@@ -175,7 +175,7 @@ T *tRingBuffer<T>::peek() {
 // *****************************************************************************
 template<typename T>
 tPriorityRingBuffer<T>::tPriorityRingBuffer(uint16_t _size, uint8_t _maxPriorities) : 
-    head(0), tail(0), size(_size), maxPriorities(_maxPriorities) {
+    freeHead(INVALID_RING_REF), freeTail(INVALID_RING_REF), used(0), size(_size), maxPriorities(_maxPriorities) {
   if ( size<3 ) size=3;
   if ( maxPriorities<1 ) maxPriorities=1;
   if ( maxPriorities==255 ) maxPriorities=254;
@@ -185,6 +185,7 @@ tPriorityRingBuffer<T>::tPriorityRingBuffer(uint16_t _size, uint8_t _maxPrioriti
   RingBufferInitDbgf(" - ring buffer allocated to %x\n",(uint32_t)buffer);
   priorityReferencies=new tPriorityRef[maxPriorities];
   RingBufferInitDbgf(" - priorityReferencies allocated to %x\n",(uint32_t)priorityReferencies);
+  clear();
 }
 
 // *****************************************************************************
@@ -208,7 +209,7 @@ uint32_t tPriorityRingBuffer<T>::getMemSize(uint16_t _size, uint8_t _maxPrioriti
 template<typename T>
 bool tPriorityRingBuffer<T>::isEmpty(uint8_t _priority) const {
   if ( _priority>=maxPriorities) {
-    return head==tail;
+    return used==0;
   } else {
     return priorityReferencies[_priority].next==INVALID_RING_REF;
   }
@@ -217,7 +218,13 @@ bool tPriorityRingBuffer<T>::isEmpty(uint8_t _priority) const {
 // *****************************************************************************
 template<typename T>
 void tPriorityRingBuffer<T>::clear() {
-  head=tail=0;
+  for ( uint16_t i=0; i<size; i++ ) {
+    buffer[i].next=( i+1<size ? i+1 : INVALID_RING_REF );
+    buffer[i].priority=INVALID_PRIORITY;
+  }
+  freeHead=0;
+  freeTail=size-1;
+  used=0;
   for ( uint16_t i=0; i<maxPriorities; i++ ) priorityReferencies[i].clear();
 }
 
@@ -229,11 +236,7 @@ void tPriorityRingBuffer<T>::clean() {
 // *****************************************************************************
 template<typename T>
 uint16_t tPriorityRingBuffer<T>::count() {
-    int32_t entries = head - tail;
-
-    if ( entries < 0 ) entries += size;
-
-    return (uint16_t)entries;
+  return used;
 }
 
 // *****************************************************************************
@@ -267,32 +270,29 @@ T *tPriorityRingBuffer<T>::getAddRef(uint8_t _priority) {
 
   if ( _priority>=maxPriorities ) _priority=maxPriorities-1;
 
-  uint16_t nextEntry = (head + 1) % size;
-
   // Check if the ring buffer is full
-  if ( nextEntry == tail ) {
-    clean();
-    // check again
-    if ( nextEntry == tail ) {
-      RingBufferErrDbgf("tPriorityRingBuffer<T>::getAddRef, ring buffer full\n");
-      return ret;
-    }
+  uint16_t ref=freeHead;
+  if ( ref==INVALID_RING_REF ) {
+    RingBufferErrDbgf("tPriorityRingBuffer<T>::getAddRef, ring buffer full\n");
+    return ret;
   }
 
-  ret=&(buffer[head].Value);
-  buffer[head].priority=_priority;
-  buffer[head].next=INVALID_RING_REF;
+  // Take first free slot
+  freeHead=buffer[ref].next;
+  if ( freeHead==INVALID_RING_REF ) freeTail=INVALID_RING_REF;
+  used++;
+
+  ret=&(buffer[ref].Value);
+  buffer[ref].priority=_priority;
+  buffer[ref].next=INVALID_RING_REF;
   if ( priorityReferencies[_priority].next==INVALID_RING_REF ) {
-    priorityReferencies[_priority].next=head;
+    priorityReferencies[_priority].next=ref;
   } else {
-    buffer[priorityReferencies[_priority].last].next=head;
+    buffer[priorityReferencies[_priority].last].next=ref;
   }
-  priorityReferencies[_priority].last=head;
+  priorityReferencies[_priority].last=ref;
 
-  RingBufferDbgf("tPriorityRingBuffer<T>::getAddRef, added new item head:%u, priority:%u\n",head,_priority);
-
-  // Bump the head to point to the next free entry
-  head = nextEntry;
+  RingBufferDbgf("tPriorityRingBuffer<T>::getAddRef, added new item ref:%u, priority:%u\n",ref,_priority);
 
   return ret;
 }
@@ -315,16 +315,18 @@ const T *tPriorityRingBuffer<T>::getReadRef(uint8_t _priority) {
   if ( priorityReferencies[_priority].next==INVALID_RING_REF ) {
     priorityReferencies[_priority].last=INVALID_RING_REF;
   }
-  // Update tail, if we are removing first
-  if ( ref==tail ) {
-    for ( tail = (tail + 1) % size; 
-          tail!=head && buffer[tail].priority==INVALID_PRIORITY;
-          tail = (tail + 1) % size );
-  }
-  buffer[ref].next=INVALID_RING_REF; // Release slot
+  // Release slot to the end of free list
+  buffer[ref].next=INVALID_RING_REF;
   buffer[ref].priority=INVALID_PRIORITY;
+  if ( freeTail==INVALID_RING_REF ) {
+    freeHead=ref;
+  } else {
+    buffer[freeTail].next=ref;
+  }
+  freeTail=ref;
+  used--;
 
-  RingBufferDbgf("tPriorityRingBuffer<T>::getReadRef, read item ref:%u, priority:%u, tail:%u\n",ref,_priority,tail);
+  RingBufferDbgf("tPriorityRingBuffer<T>::getReadRef, read item ref:%u, priority:%u, used:%u\n",ref,_priority,used);
 
   return ret;
 }
@@ -341,3 +343,182 @@ const T *tPriorityRingBuffer<T>::getReadRef(uint8_t *_priority) {
 
   return 0;
 }
+
+// *****************************************************************************
+template<typename T>
+T *tPriorityRingBuffer<T>::peek(uint8_t *_priority) {
+  for ( uint8_t _pri=0; _pri<maxPriorities; _pri++ ) {
+    uint16_t ref=priorityReferencies[_pri].next;
+    if ( ref!=INVALID_RING_REF ) {
+      if ( _priority!=0 ) *_priority=_pri;
+      return &(buffer[ref].Value);
+    }
+  }
+
+  return 0;
+}
+
+#if defined(N2K_ATOMIC_RING_BUFFERS)
+// *****************************************************************************
+template<typename T>
+tMPSCRingBuffer<T>::tMPSCRingBuffer(uint16_t _size) : head(0), tail(0) {
+  uint32_t size=2;
+  while ( size<_size && size<0x8000 ) size<<=1;
+  mask=size-1;
+  buffer=new tCell[size];
+  for ( uint32_t i=0; i<size; i++ ) buffer[i].seq.store(i,std::memory_order_relaxed);
+}
+
+// *****************************************************************************
+template<typename T>
+tMPSCRingBuffer<T>::~tMPSCRingBuffer() {
+  delete[] buffer;
+}
+
+// *****************************************************************************
+template<typename T>
+bool tMPSCRingBuffer<T>::isEmpty() const {
+  return (int32_t)(buffer[tail & mask].seq.load(std::memory_order_acquire)-(tail+1))<0;
+}
+
+// *****************************************************************************
+template<typename T>
+bool tMPSCRingBuffer<T>::add(const T &val) {
+  uint32_t pos=head.load(std::memory_order_relaxed);
+  tCell *cell;
+
+  while ( true ) {
+    cell=&buffer[pos & mask];
+    int32_t diff=(int32_t)(cell->seq.load(std::memory_order_acquire)-pos);
+    if ( diff==0 ) { // Slot is free for this position, so try to claim it
+      if ( head.compare_exchange_weak(pos,pos+1,std::memory_order_relaxed) ) break;
+    } else if ( diff<0 ) { // Consumer has not yet released slot, so buffer is full
+      return false;
+    } else { // Other producer took the position
+      pos=head.load(std::memory_order_relaxed);
+    }
+  }
+
+  cell->val=val;
+  cell->seq.store(pos+1,std::memory_order_release);
+
+  return true;
+}
+
+// *****************************************************************************
+template<typename T>
+T *tMPSCRingBuffer<T>::peek() {
+  if ( isEmpty() ) return 0;
+
+  return &buffer[tail & mask].val;
+}
+
+// *****************************************************************************
+template<typename T>
+void tMPSCRingBuffer<T>::pop() {
+  // Slot will be free for position one round later
+  buffer[tail & mask].seq.store(tail+mask+1,std::memory_order_release);
+  tail++;
+}
+
+// *****************************************************************************
+template<typename T>
+bool tMPSCRingBuffer<T>::read(T &val) {
+  T *ref=peek();
+  if ( ref==0 ) return false;
+
+  val=*ref;
+  pop();
+
+  return true;
+}
+
+// *****************************************************************************
+template<typename T>
+tSPSCRingBuffer<T>::tSPSCRingBuffer(uint16_t _size) : head(0), cachedTail(0), tail(0), cachedHead(0) {
+  uint32_t size=2;
+  while ( size<_size && size<0x8000 ) size<<=1;
+  mask=size-1;
+  buffer=new T[size];
+}
+
+// *****************************************************************************
+template<typename T>
+tSPSCRingBuffer<T>::~tSPSCRingBuffer() {
+  delete[] buffer;
+}
+
+// *****************************************************************************
+template<typename T>
+bool tSPSCRingBuffer<T>::isEmpty() const {
+  return head.load(std::memory_order_acquire)==tail.load(std::memory_order_acquire);
+}
+
+// *****************************************************************************
+template<typename T>
+uint16_t tSPSCRingBuffer<T>::count() const {
+  return head.load(std::memory_order_acquire)-tail.load(std::memory_order_acquire);
+}
+
+// *****************************************************************************
+template<typename T>
+T *tSPSCRingBuffer<T>::getAddRef() {
+  uint32_t pos=head.load(std::memory_order_relaxed);
+
+  if ( pos-cachedTail>mask ) { // Seems to be full, so check real tail
+    cachedTail=tail.load(std::memory_order_acquire);
+    if ( pos-cachedTail>mask ) return 0;
+  }
+
+  return &buffer[pos & mask];
+}
+
+// *****************************************************************************
+template<typename T>
+void tSPSCRingBuffer<T>::commitAdd() {
+  head.store(head.load(std::memory_order_relaxed)+1,std::memory_order_release);
+}
+
+// *****************************************************************************
+template<typename T>
+bool tSPSCRingBuffer<T>::add(const T &val) {
+  T *ref=getAddRef();
+  if ( ref==0 ) return false;
+
+  *ref=val;
+  commitAdd();
+
+  return true;
+}
+
+// *****************************************************************************
+template<typename T>
+const T *tSPSCRingBuffer<T>::getReadRef() {
+  uint32_t pos=tail.load(std::memory_order_relaxed);
+
+  if ( pos==cachedHead ) { // Seems to be empty, so check real head
+    cachedHead=head.load(std::memory_order_acquire);
+    if ( pos==cachedHead ) return 0;
+  }
+
+  return &buffer[pos & mask];
+}
+
+// *****************************************************************************
+template<typename T>
+void tSPSCRingBuffer<T>::commitRead() {
+  tail.store(tail.load(std::memory_order_relaxed)+1,std::memory_order_release);
+}
+
+// *****************************************************************************
+template<typename T>
+bool tSPSCRingBuffer<T>::read(T &val) {
+  const T *ref=getReadRef();
+  if ( ref==0 ) return false;
+
+  val=*ref;
+  commitRead();
+
+  return true;
+}
+#endif
@@ -94,6 +94,10 @@ size_t N2kToSeasmart(const tN2kMsg &msg, uint32_t timestamp, char *buffer, size_
   return (size_t)(s - buffer);
 }
 
+size_t N2kToSeasmart(const tN2kMsg &msg, char *buffer, size_t size) {
+  return N2kToSeasmart(msg, msg.GetMsgTimeMs(), buffer, size);
+}
+
 /*
  * Attempts to read n bytes in hexadecimal from input string to value.
  *
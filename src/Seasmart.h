@@ -58,6 +58,20 @@
  */
 size_t N2kToSeasmart(const tN2kMsg &msg, uint32_t timestamp, char *buffer, size_t size);
 
+/************************************************************************//**
+ * \brief Converts a tN2kMsg into a $PCDIN NMEA sentence with message time
+ * 
+ * As \ref N2kToSeasmart above, but timestamp will be taken from message
+ * with \ref tN2kMsg::GetMsgTimeMs. For messages received from bus it is
+ * receive time of the last frame.
+ * 
+ * \param msg         Reference to a N2kMsg Object 
+ * \param buffer      char array buffer for seasmart message
+ * \param size        size of the char buffer
+ * \return size_t 
+ */
+size_t N2kToSeasmart(const tN2kMsg &msg, char *buffer, size_t size);
+
 /************************************************************************//**
  * \brief Converts a null terminated $PCDIN NMEA sentence into a tN2kMsg
  * 
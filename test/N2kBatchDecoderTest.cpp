@@ -0,0 +1,140 @@
+#include <catch.hpp>
+#include <string.h>
+#include <N2kMessages.h>
+#include <N2kBatchDecoder.h>
+
+// Tests for columnar batch decoding. Every column value must be same as
+// corresponding ParseN2kPGN* output. Message counts are over block size
+// used internally by decoder, so block boundaries get tested too.
+#define BATCH_COUNT 150
+
+static tN2kMsg Msgs[BATCH_COUNT];
+
+// Payload record as application might store it on log.
+struct tPayloadRecord {
+  unsigned long Time;
+  unsigned char Payload[8];
+  unsigned char Source;
+};
+
+TEST_CASE("Batch decode PGN 127250") {
+  unsigned char SID[BATCH_COUNT];
+  double Heading[BATCH_COUNT], Deviation[BATCH_COUNT], Variation[BATCH_COUNT];
+  tN2kHeadingReference Ref[BATCH_COUNT];
+  tN2kPGN127250Columns Columns={SID,Heading,Deviation,Variation,Ref};
+
+  for ( int i=0; i<BATCH_COUNT; i++ ) {
+    SetN2kPGN127250(Msgs[i],i,( i%5==0 ? N2kDoubleNA : 0.04*i ),( i%7==0 ? N2kDoubleNA : -0.001*i ),0.0002*i,
+                    ( i%2==0 ? N2khr_true : N2khr_magnetic ));
+  }
+
+  SECTION("messages") {
+    REQUIRE(N2kBatchDecodePGN127250(Msgs,BATCH_COUNT,Columns)==BATCH_COUNT);
+    for ( int i=0; i<BATCH_COUNT; i++ ) {
+      unsigned char pSID; double pHeading, pDeviation, pVariation; tN2kHeadingReference pRef;
+      REQUIRE(ParseN2kPGN127250(Msgs[i],pSID,pHeading,pDeviation,pVariation,pRef));
+      INFO("Message " << i);
+      CHECK(SID[i]==pSID);
+      CHECK(Heading[i]==pHeading);
+      CHECK(Deviation[i]==pDeviation);
+      CHECK(Variation[i]==pVariation);
+      CHECK(Ref[i]==pRef);
+    }
+    CHECK(Heading[0]==N2kDoubleNA);
+    CHECK(Deviation[7]==N2kDoubleNA);
+  }
+
+  SECTION("stop at other PGN") {
+    SetN2kPGN129025(Msgs[100],60.0,20.0);
+    Heading[100]=1.0;
+    CHECK(N2kBatchDecodePGN127250(Msgs,BATCH_COUNT,Columns)==100);
+    CHECK(Heading[100]==1.0);
+    CHECK(N2kBatchDecodePGN127250(Msgs+100,BATCH_COUNT-100,Columns)==0);
+  }
+
+  SECTION("stop at short message") {
+    Msgs[70].DataLen=7;
+    CHECK(N2kBatchDecodePGN127250(Msgs,BATCH_COUNT,Columns)==70);
+  }
+
+  SECTION("null columns") {
+    tN2kPGN127250Columns HeadingOnly={0,Heading,0,0,0};
+    REQUIRE(N2kBatchDecodePGN127250(Msgs,BATCH_COUNT,HeadingOnly)==BATCH_COUNT);
+    double pHeading=0;
+    ParseN2kPGN127250(Msgs[3],SID[0],pHeading,Deviation[0],Variation[0],Ref[0]);
+    CHECK(Heading[3]==pHeading);
+  }
+
+  SECTION("payload records") {
+    tPayloadRecord Records[BATCH_COUNT];
+    for ( int i=0; i<BATCH_COUNT; i++ ) memcpy(Records[i].Payload,Msgs[i].Data,8);
+    N2kBatchDecodePGN127250(Records[0].Payload,sizeof(tPayloadRecord),BATCH_COUNT,Columns);
+    for ( int i=0; i<BATCH_COUNT; i++ ) {
+      unsigned char pSID; double pHeading, pDeviation, pVariation; tN2kHeadingReference pRef;
+      ParseN2kPGN127250(Msgs[i],pSID,pHeading,pDeviation,pVariation,pRef);
+      INFO("Record " << i);
+      CHECK(SID[i]==pSID);
+      CHECK(Heading[i]==pHeading);
+      CHECK(Deviation[i]==pDeviation);
+      CHECK(Variation[i]==pVariation);
+      CHECK(Ref[i]==pRef);
+    }
+  }
+}
+
+TEST_CASE("Batch decode PGN 129025") {
+  double Latitude[BATCH_COUNT], Longitude[BATCH_COUNT];
+  tN2kPGN129025Columns Columns={Latitude,Longitude};
+  unsigned char Payloads[BATCH_COUNT][8];
+
+  for ( int i=0; i<BATCH_COUNT; i++ ) {
+    SetN2kPGN129025(Msgs[i],( i%9==0 ? N2kDoubleNA : 60.1234567+1e-5*i ),-22.7654321-1e-5*i);
+    memcpy(Payloads[i],Msgs[i].Data,8);
+  }
+
+  SECTION("messages") {
+    REQUIRE(N2kBatchDecodePGN129025(Msgs,BATCH_COUNT,Columns)==BATCH_COUNT);
+  }
+
+  SECTION("packed payloads") {
+    N2kBatchDecodePGN129025(Payloads[0],8,BATCH_COUNT,Columns);
+  }
+
+  for ( int i=0; i<BATCH_COUNT; i++ ) {
+    double pLatitude, pLongitude;
+    REQUIRE(ParseN2kPGN129025(Msgs[i],pLatitude,pLongitude));
+    INFO("Message " << i);
+    CHECK(Latitude[i]==pLatitude);
+    CHECK(Longitude[i]==pLongitude);
+  }
+  CHECK(Latitude[9]==N2kDoubleNA);
+}
+
+TEST_CASE("Batch decode PGN 130306") {
+  unsigned char SID[BATCH_COUNT];
+  double Speed[BATCH_COUNT], Angle[BATCH_COUNT];
+  tN2kWindReference Ref[BATCH_COUNT];
+  tN2kPGN130306Columns Columns={SID,Speed,Angle,Ref};
+
+  for ( int i=0; i<BATCH_COUNT; i++ ) {
+    SetN2kPGN130306(Msgs[i],i,( i%4==0 ? N2kDoubleNA : 0.25*i ),( i%6==0 ? N2kDoubleNA : 0.04*i ),
+                    ( i%3==0 ? N2kWind_True_North : N2kWind_Apparent ));
+  }
+  // Message with only 6 data bytes is still valid for 130306.
+  Msgs[BATCH_COUNT-1].DataLen=6;
+
+  REQUIRE(N2kBatchDecodePGN130306(Msgs,BATCH_COUNT,Columns)==BATCH_COUNT);
+  for ( int i=0; i<BATCH_COUNT; i++ ) {
+    unsigned char pSID; double pSpeed, pAngle; tN2kWindReference pRef;
+    REQUIRE(ParseN2kPGN130306(Msgs[i],pSID,pSpeed,pAngle,pRef));
+    INFO("Message " << i);
+    CHECK(SID[i]==pSID);
+    CHECK(Speed[i]==pSpeed);
+    CHECK(Angle[i]==pAngle);
+    CHECK(Ref[i]==pRef);
+  }
+  CHECK(Speed[4]==N2kDoubleNA);
+
+  Msgs[64].DataLen=5;
+  CHECK(N2kBatchDecodePGN130306(Msgs,BATCH_COUNT,Columns)==64);
+}
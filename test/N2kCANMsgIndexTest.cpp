@@ -0,0 +1,81 @@
+#include <catch.hpp>
+#include <N2kCANMsg.h>
+
+// Tests for tN2kCANMsgIndex used by tNMEA2000 for message reassembly lookup.
+
+namespace {
+const uint8_t Slots=20;
+
+void ClaimSlot(tN2kCANMsg *Buf, tN2kCANMsgIndex &Index, uint8_t Slot, unsigned long PGN, unsigned char Source) {
+  Buf[Slot].Init(6,PGN,Source,0xff);
+  Index.Claim(Buf,Slot);
+  Buf[Slot].FreeMsg=false;
+}
+
+void ReleaseSlot(tN2kCANMsg *Buf, tN2kCANMsgIndex &Index, uint8_t Slot) {
+  Index.Release(Buf,Slot);
+  Buf[Slot].FreeMessage();
+}
+}
+
+TEST_CASE("CAN message index finds claimed slots") {
+  tN2kCANMsg Buf[Slots];
+  tN2kCANMsgIndex Index;
+  Index.Init(Slots);
+
+  REQUIRE(Index.Find(Buf,129029L,1,0xff,false)==N2kCANMsgIndexEmpty);
+
+  for ( uint8_t i=0; i<Slots; i++ ) {
+    uint8_t Slot=Index.PeekFree();
+    REQUIRE(Slot==i);
+    ClaimSlot(Buf,Index,Slot,129029L,i);
+  }
+  CHECK(Index.PeekFree()==N2kCANMsgIndexEmpty);
+
+  for ( uint8_t i=0; i<Slots; i++ ) {
+    CHECK(Index.Find(Buf,129029L,i,0xff,false)==i);
+  }
+  CHECK(Index.Find(Buf,129029L,Slots,0xff,false)==N2kCANMsgIndexEmpty);
+  CHECK(Index.Find(Buf,129029L,1,0x10,false)==N2kCANMsgIndexEmpty);
+  CHECK(Index.Find(Buf,129029L,1,0xff,true)==N2kCANMsgIndexEmpty);
+}
+
+TEST_CASE("CAN message index keeps probe chains on release") {
+  tN2kCANMsg Buf[Slots];
+  tN2kCANMsgIndex Index;
+  Index.Init(Slots);
+
+  for ( uint8_t i=0; i<Slots; i++ ) ClaimSlot(Buf,Index,Index.PeekFree(),126996L+i*256,i%3);
+
+  // Release every other and check that rest can still be found
+  for ( uint8_t i=0; i<Slots; i+=2 ) ReleaseSlot(Buf,Index,i);
+  for ( uint8_t i=0; i<Slots; i++ ) {
+    uint8_t Expected=(i%2==0?N2kCANMsgIndexEmpty:i);
+    CHECK(Index.Find(Buf,126996L+i*256,i%3,0xff,false)==Expected);
+  }
+
+  // Released slots are reused
+  for ( uint8_t i=0; i<Slots/2; i++ ) {
+    uint8_t Slot=Index.PeekFree();
+    REQUIRE(Slot!=N2kCANMsgIndexEmpty);
+    CHECK(Slot%2==0);
+    ClaimSlot(Buf,Index,Slot,130306L,100+i);
+  }
+  CHECK(Index.PeekFree()==N2kCANMsgIndexEmpty);
+}
+
+TEST_CASE("CAN message index release handles changed key") {
+  tN2kCANMsg Buf[Slots];
+  tN2kCANMsgIndex Index;
+  Index.Init(Slots);
+
+  ClaimSlot(Buf,Index,Index.PeekFree(),127250L,5);
+  // Key changed after claim.
+  Buf[0].N2kMsg.Source=22;
+  ReleaseSlot(Buf,Index,0);
+  CHECK(Index.PeekFree()==0);
+  ClaimSlot(Buf,Index,Index.PeekFree(),127250L,5);
+  CHECK(Index.Find(Buf,127250L,5,0xff,false)==0);
+  ReleaseSlot(Buf,Index,0);
+  CHECK(Index.Find(Buf,127250L,5,0xff,false)==N2kCANMsgIndexEmpty);
+}
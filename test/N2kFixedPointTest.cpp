@@ -0,0 +1,246 @@
+#include <catch.hpp>
+#include <N2kMessages.h>
+#include <N2kFixedPoint.h>
+#include <string.h>
+
+// Tests for fixed point API. Messages set with fixed point overloads must
+// be identical to ones set with double functions and parsed values must
+// match.
+
+namespace {
+bool SameData(const tN2kMsg &a, const tN2kMsg &b) {
+  return a.PGN==b.PGN && a.Priority==b.Priority && a.DataLen==b.DataLen && memcmp(a.Data,b.Data,a.DataLen)==0;
+}
+}
+
+TEST_CASE("Fixed point type limits") {
+  CHECK(tN2kFixedSpeed::NARaw()==0xffff);
+  CHECK(tN2kFixedSpeed::ORRaw()==0xfffe);
+  CHECK(tN2kFixedSignedAngle::NARaw()==0x7fff);
+  CHECK(tN2kFixedLatLonHighRes::NARaw()==N2kInt64NA);
+  CHECK(tN2kFixedTemperatureHighRes::NARaw()==0xffffff);
+  CHECK(tN2kFixedTemperatureHighRes::ORRaw()==0xfffffe);
+  CHECK(tN2kFixedDepthRange::NARaw()==0xff);
+  CHECK(tN2kFixedSpeed().IsNA());
+  CHECK(N2kIsNA(tN2kFixedSpeed()));
+  CHECK(!N2kIsNA(tN2kFixedSpeed(0)));
+  CHECK(tN2kFixedSpeed(0xfffe).IsOR());
+
+  CHECK(tN2kFixedRateOfTurn::Resolution()==3.125E-08);
+  CHECK(tN2kFixedPressure::Resolution()==100);
+  CHECK(tN2kFixedSpeed::FromDouble(12.5).Raw==1250);
+  CHECK(tN2kFixedSpeed::FromDouble(-1).IsOR());
+  CHECK(tN2kFixedSpeed::FromDouble(N2kDoubleNA).IsNA());
+  CHECK(tN2kFixedSignedAngle::FromDouble(-0.5).Raw==-5000);
+  CHECK(tN2kFixedSignedAngle(-5000).ToDouble()==-0.5);
+  CHECK(tN2kFixedSignedAngle().ToDouble()==N2kDoubleNA);
+}
+
+TEST_CASE("Fixed point get and add") {
+  tN2kMsg N2kMsg;
+  N2kMsg.SetPGN(65280L);
+
+  // 3 byte field value does not fit and will be OR
+  N2kAddFixed(N2kMsg,tN2kFixedTemperatureHighRes(0x1000000));
+  N2kAddFixed(N2kMsg,tN2kFixedTemperatureHighRes(290123));
+  N2kAddFixed(N2kMsg,tN2kFixedLatLonHighRes(-601234567890123456LL));
+  REQUIRE(N2kMsg.DataLen==14);
+  CHECK(N2kMsg.Data[0]==0xfe); CHECK(N2kMsg.Data[1]==0xff); CHECK(N2kMsg.Data[2]==0xff);
+
+  int Index=0;
+  tN2kFixedTemperatureHighRes Temperature;
+  tN2kFixedLatLonHighRes Latitude;
+  N2kGetFixed(N2kMsg,Index,Temperature);
+  CHECK(Temperature.IsOR());
+  N2kGetFixed(N2kMsg,Index,Temperature);
+  CHECK(Temperature.Raw==290123);
+  N2kGetFixed(N2kMsg,Index,Latitude);
+  CHECK(Latitude.Raw==-601234567890123456LL);
+  CHECK(Index==14);
+  // Beyond data
+  N2kGetFixed(N2kMsg,Index,Temperature);
+  CHECK(Temperature.IsNA());
+  CHECK(Index==17);
+
+  // Signed short field will be sign extended
+  tN2kFixed<N2kfu_None,int32_t,3,1,0> Signed(-2);
+  N2kMsg.SetPGN(65280L);
+  N2kAddFixed(N2kMsg,Signed);
+  Index=0;
+  Signed.Raw=0;
+  N2kGetFixed(N2kMsg,Index,Signed);
+  CHECK(Signed.Raw==-2);
+}
+
+TEST_CASE("Fixed point PGNs match double functions") {
+  tN2kMsg Double, Fixed;
+
+  SECTION("126992") {
+    SetN2kPGN126992(Double,1,19500,43200.5,N2ktimes_GPS);
+    SetN2kPGN126992(Fixed,1,19500,tN2kFixedTimeOfDay(432005000),N2ktimes_GPS);
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID; uint16_t Date; tN2kFixedTimeOfDay Time; tN2kTimeSource Source;
+    REQUIRE(ParseN2kPGN126992(Fixed,SID,Date,Time,Source));
+    CHECK(Date==19500);
+    CHECK(Time.Raw==432005000);
+    CHECK(Source==N2ktimes_GPS);
+  }
+
+  SECTION("127250") {
+    SetN2kPGN127250(Double,1,1.2345,N2kDoubleNA,-0.0123,N2khr_magnetic);
+    SetN2kPGN127250(Fixed,1,tN2kFixedAngle(12345),tN2kFixedSignedAngle(),tN2kFixedSignedAngle(-123),N2khr_magnetic);
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID; tN2kFixedAngle Heading; tN2kFixedSignedAngle Deviation, Variation; tN2kHeadingReference Ref;
+    REQUIRE(ParseN2kPGN127250(Fixed,SID,Heading,Deviation,Variation,Ref));
+    CHECK(Heading.Raw==12345);
+    CHECK(Deviation.IsNA());
+    CHECK(Variation.Raw==-123);
+    CHECK(Ref==N2khr_magnetic);
+  }
+
+  SECTION("127251") {
+    SetN2kPGN127251(Double,1,-0.05);
+    SetN2kPGN127251(Fixed,1,tN2kFixedRateOfTurn::FromDouble(-0.05));
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID; tN2kFixedRateOfTurn Rate;
+    REQUIRE(ParseN2kPGN127251(Fixed,SID,Rate));
+    CHECK(Rate.Raw==-1600000);
+  }
+
+  SECTION("127257") {
+    SetN2kPGN127257(Double,1,0.5,-0.1,N2kDoubleNA);
+    SetN2kPGN127257(Fixed,1,tN2kFixedSignedAngle(5000),tN2kFixedSignedAngle(-1000),tN2kFixedSignedAngle());
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID; tN2kFixedSignedAngle Yaw, Pitch, Roll;
+    REQUIRE(ParseN2kPGN127257(Fixed,SID,Yaw,Pitch,Roll));
+    CHECK(Pitch.Raw==-1000);
+    CHECK(Roll.IsNA());
+  }
+
+  SECTION("127508") {
+    SetN2kPGN127508(Double,1,12.85,-3.5);
+    SetN2kPGN127508(Fixed,1,tN2kFixedVoltage(1285),tN2kFixedCurrent(-35));
+    CHECK(SameData(Double,Fixed));
+    unsigned char Instance, SID; tN2kFixedVoltage Voltage; tN2kFixedCurrent Current; tN2kFixedTemperature Temperature;
+    REQUIRE(ParseN2kPGN127508(Fixed,Instance,Voltage,Current,Temperature,SID));
+    CHECK(Voltage.Raw==1285);
+    CHECK(Current.Raw==-35);
+    CHECK(Temperature.IsNA());
+    CHECK(SID==0xff);
+  }
+
+  SECTION("128259") {
+    SetN2kPGN128259(Double,1,3.25);
+    SetN2kPGN128259(Fixed,1,tN2kFixedSpeed(325));
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID; tN2kFixedSpeed Water, Ground; tN2kSpeedWaterReferenceType SWRT;
+    REQUIRE(ParseN2kPGN128259(Fixed,SID,Water,Ground,SWRT));
+    CHECK(Water.Raw==325);
+    CHECK(Ground.IsNA());
+  }
+
+  SECTION("128267") {
+    SetN2kPGN128267(Double,1,12.34,-0.5,100);
+    SetN2kPGN128267(Fixed,1,tN2kFixedDepth(1234),tN2kFixedDepthOffset(-500),tN2kFixedDepthRange(10));
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID; tN2kFixedDepth Depth; tN2kFixedDepthOffset Offset; tN2kFixedDepthRange Range;
+    REQUIRE(ParseN2kPGN128267(Fixed,SID,Depth,Offset,Range));
+    CHECK(Depth.Raw==1234);
+    CHECK(Offset.Raw==-500);
+    CHECK(Range.ToDouble()==100);
+  }
+
+  SECTION("129025") {
+    SetN2kPGN129025(Double,60.1234567,-22.7654321);
+    SetN2kPGN129025(Fixed,tN2kFixedLatLon(601234567),tN2kFixedLatLon(-227654321));
+    CHECK(SameData(Double,Fixed));
+    tN2kFixedLatLon Latitude, Longitude;
+    REQUIRE(ParseN2kPGN129025(Fixed,Latitude,Longitude));
+    CHECK(Latitude.Raw==601234567);
+    CHECK(Longitude.Raw==-227654321);
+  }
+
+  SECTION("129026") {
+    SetN2kPGN129026(Double,1,N2khr_true,3.1,5.25);
+    SetN2kPGN129026(Fixed,1,N2khr_true,tN2kFixedAngle(31000),tN2kFixedSpeed(525));
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID; tN2kHeadingReference Ref; tN2kFixedAngle COG; tN2kFixedSpeed SOG;
+    REQUIRE(ParseN2kPGN129026(Fixed,SID,Ref,COG,SOG));
+    CHECK(COG.Raw==31000);
+    CHECK(SOG.Raw==525);
+  }
+
+  SECTION("129029") {
+    SetN2kPGN129029(Double,1,19500,3600.5,60.5,-22.25,15.5,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,1.2,18.5,1,N2kGNSSt_GPS,100,2.5);
+    SetN2kPGN129029(Fixed,1,19500,tN2kFixedTimeOfDay(36005000),
+                    tN2kFixedLatLonHighRes(605000000000000000LL),tN2kFixedLatLonHighRes(-222500000000000000LL),
+                    tN2kFixedAltitude(15500000),N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,tN2kFixedDOP(80),tN2kFixedDOP(120),
+                    tN2kFixedSignedDistance(1850),1,N2kGNSSt_GPS,100,tN2kFixedDuration(250));
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID, nSatellites, nReferenceStations; uint16_t Days, StationID;
+    tN2kFixedTimeOfDay Seconds; tN2kFixedLatLonHighRes Latitude, Longitude; tN2kFixedAltitude Altitude;
+    tN2kGNSStype GNSStype, StationType; tN2kGNSSmethod Method;
+    tN2kFixedDOP HDOP, PDOP; tN2kFixedSignedDistance Geoidal; tN2kFixedDuration Age;
+    REQUIRE(ParseN2kPGN129029(Fixed,SID,Days,Seconds,Latitude,Longitude,Altitude,GNSStype,Method,
+                              nSatellites,HDOP,PDOP,Geoidal,nReferenceStations,StationType,StationID,Age));
+    CHECK(Latitude.Raw==605000000000000000LL);
+    CHECK(Longitude.Raw==-222500000000000000LL);
+    CHECK(Altitude.Raw==15500000);
+    CHECK(nSatellites==12);
+    CHECK(HDOP.Raw==80);
+    CHECK(StationID==100);
+    CHECK(Age.Raw==250);
+
+    // Without reference stations
+    SetN2kPGN129029(Fixed,1,19500,tN2kFixedTimeOfDay(36005000),tN2kFixedLatLonHighRes(),tN2kFixedLatLonHighRes(),
+                    tN2kFixedAltitude(),N2kGNSSt_GPS,N2kGNSSm_noGNSS,0,tN2kFixedDOP());
+    REQUIRE(ParseN2kPGN129029(Fixed,SID,Days,Seconds,Latitude,Longitude,Altitude,GNSStype,Method,
+                              nSatellites,HDOP,PDOP,Geoidal,nReferenceStations,StationType,StationID,Age));
+    CHECK(Latitude.IsNA());
+    CHECK(nReferenceStations==0);
+    CHECK(Age.IsNA());
+  }
+
+  SECTION("130306") {
+    SetN2kPGN130306(Double,1,12.5,0.7854,N2kWind_Apparent);
+    SetN2kPGN130306(Fixed,1,tN2kFixedSpeed(1250),tN2kFixedAngle(7854),N2kWind_Apparent);
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID; tN2kFixedSpeed Speed; tN2kFixedAngle Angle; tN2kWindReference Ref;
+    REQUIRE(ParseN2kPGN130306(Fixed,SID,Speed,Angle,Ref));
+    CHECK(Speed.Raw==1250);
+    CHECK(Angle.Raw==7854);
+    CHECK(Ref==N2kWind_Apparent);
+  }
+
+  SECTION("130310") {
+    SetN2kPGN130310(Double,1,285.15,N2kDoubleNA,101300);
+    SetN2kPGN130310(Fixed,1,tN2kFixedTemperature(28515),tN2kFixedTemperature(),tN2kFixedPressure(1013));
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID; tN2kFixedTemperature Water, Air; tN2kFixedPressure Pressure;
+    REQUIRE(ParseN2kPGN130310(Fixed,SID,Water,Air,Pressure));
+    CHECK(Water.Raw==28515);
+    CHECK(Air.IsNA());
+    CHECK(Pressure.ToDouble()==101300);
+  }
+
+  SECTION("130312") {
+    SetN2kPGN130312(Double,1,2,N2kts_EngineRoomTemperature,310.15);
+    SetN2kPGN130312(Fixed,1,2,N2kts_EngineRoomTemperature,tN2kFixedTemperature(31015));
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID, Instance; tN2kTempSource Source; tN2kFixedTemperature Actual, Set;
+    REQUIRE(ParseN2kPGN130312(Fixed,SID,Instance,Source,Actual,Set));
+    CHECK(Instance==2);
+    CHECK(Actual.Raw==31015);
+    CHECK(Set.IsNA());
+  }
+
+  SECTION("130316") {
+    SetN2kPGN130316(Double,1,0,N2kts_SeaTemperature,290.123,295.5);
+    SetN2kPGN130316(Fixed,1,0,N2kts_SeaTemperature,tN2kFixedTemperatureHighRes(290123),tN2kFixedTemperatureLowRes(2955));
+    CHECK(SameData(Double,Fixed));
+    unsigned char SID, Instance; tN2kTempSource Source; tN2kFixedTemperatureHighRes Actual; tN2kFixedTemperatureLowRes Set;
+    REQUIRE(ParseN2kPGN130316(Fixed,SID,Instance,Source,Actual,Set));
+    CHECK(Actual.Raw==290123);
+    CHECK(Set.Raw==2955);
+  }
+}
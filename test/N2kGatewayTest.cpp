@@ -0,0 +1,280 @@
+#include <catch.hpp>
+#include <N2kGateway.h>
+#include <N2kMessages.h>
+#include <deque>
+#include <mutex>
+#include "N2kTestNMEA2000.h"
+
+// Tests for multi bus gateway. Threaded tests are built with
+// N2K_THREADED_GATEWAY and own copy of library sources.
+
+namespace {
+void Run(tN2kGateway **Gateways, int GatewayCount, tTestNode **Nodes, int Count, int ms) {
+  auto End=std::chrono::steady_clock::now()+std::chrono::milliseconds(ms);
+  while ( std::chrono::steady_clock::now()<End ) {
+    for ( int i=0; i<GatewayCount; i++ ) Gateways[i]->ParseMessages();
+    for ( int i=0; i<Count; i++ ) Nodes[i]->ParseMessages();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+void SetGNSS(tN2kMsg &N2kMsg, unsigned char Source, double Latitude) {
+  SetN2kGNSS(N2kMsg,1,19000,3600,Latitude,22.5,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,0.5,15,1,N2kGNSSt_GPS,15,2);
+  N2kMsg.Source=Source;
+}
+
+// Two virtual buses bridged by gateway
+struct tTwoBuses {
+  tN2kVirtualCANBus BusA, BusB;
+  tTestNode GwA, GwB;
+  tTestNode NodeA, NodeB;
+  tN2kGateway Gateway;
+  tN2kGateway *Gateways[1];
+  tTestNode *Nodes[2];
+  uint8_t A, B;
+
+  tTwoBuses() : GwA(BusA), GwB(BusB), NodeA(BusA), NodeB(BusB) {
+    A=Gateway.AddBus(&GwA);
+    B=Gateway.AddBus(&GwB);
+    Gateways[0]=&Gateway;
+    Nodes[0]=&NodeA; Nodes[1]=&NodeB;
+  }
+  void Run(int ms) { ::Run(Gateways,1,Nodes,2,ms); }
+  void Open() {
+    for ( int i=0; i<100 && !(GwA.IsOpen() && GwB.IsOpen() && NodeA.IsOpen() && NodeB.IsOpen()); i++ ) Run(20);
+    REQUIRE(GwA.IsOpen());
+    REQUIRE(GwB.IsOpen());
+    REQUIRE(NodeA.IsOpen());
+    REQUIRE(NodeB.IsOpen());
+    NodeA.Received.clear();
+    NodeB.Received.clear();
+    Gateway.ResetBusStats();
+  }
+};
+}
+
+TEST_CASE("Gateway forwards frames without re-encoding") {
+  tTwoBuses Net;
+  tTestNode Claimer(Net.BusA,tNMEA2000::N2km_ListenAndNode);
+  Claimer.SetDeviceInformation(1,130,25,2046);
+  tTestNode *Nodes[]={ &Net.NodeA, &Net.NodeB, &Claimer };
+
+  Net.Open();
+  Run(Net.Gateways,1,Nodes,3,400); // Claimer claims address on bus A
+  REQUIRE(Claimer.IsOpen());
+  CHECK(Net.NodeA.Collector.Count(N2kPGNIsoAddressClaim)>0);
+  CHECK(Net.NodeB.Collector.Count(N2kPGNIsoAddressClaim)==0);
+  Net.NodeB.Received.clear();
+  Net.Gateway.ResetBusStats();
+
+  tN2kMsg GNSS;
+  SetGNSS(GNSS,10,60.1);
+  REQUIRE(Net.NodeA.Send(10,127250L));
+  REQUIRE(Net.NodeA.SendMsg(GNSS,-1));
+  Net.Run(50);
+
+  REQUIRE(Net.NodeB.Received.size()==2);
+  CHECK(Net.NodeB.Received[0].PGN==127250L);
+  CHECK(Net.NodeB.Received[0].Source==10);
+  CHECK(Net.NodeB.Received[1].PGN==129029L);
+  CHECK(Net.NodeB.Received[1].Source==10);
+  CHECK(Net.NodeB.Received[1].DataLen==GNSS.DataLen);
+  CHECK(memcmp(Net.NodeB.Received[1].Data,GNSS.Data,GNSS.DataLen)==0);
+  CHECK(Net.Gateway.GetBusStats(Net.A)->FramesForwarded==0); // Nothing comes back
+
+  const tN2kGateway::tBusStats *StatsA=Net.Gateway.GetBusStats(Net.A);
+  const tN2kGateway::tBusStats *StatsB=Net.Gateway.GetBusStats(Net.B);
+  REQUIRE(StatsA!=0);
+  REQUIRE(StatsB!=0);
+  CHECK(Net.Gateway.GetBusStats(2)==0);
+  CHECK(StatsA->FramesReceived>=8);
+  CHECK(StatsB->FramesForwarded==StatsA->FramesReceived-StatsA->FramesFiltered);
+  CHECK(StatsB->FramesLooped==0);
+}
+
+TEST_CASE("Gateway rules") {
+  tTwoBuses Net;
+
+  CHECK(Net.Gateway.AddRule(tN2kGateway::ga_Block,127250L,Net.A,Net.B));
+  CHECK(Net.Gateway.AddRule(tN2kGateway::ga_Block,0,N2kGatewayAny,N2kGatewayAny,20));
+  CHECK(Net.Gateway.AddRule(tN2kGateway::ga_Forward,59904L,Net.B,Net.A));
+  Net.Open();
+
+  REQUIRE(Net.NodeA.Send(10,127250L));   // Blocked by PGN
+  REQUIRE(Net.NodeB.Send(11,127250L));   // Other direction
+  REQUIRE(Net.NodeA.Send(20,127251L));   // Blocked by source
+  REQUIRE(Net.NodeA.Send(10,127251L));
+  REQUIRE(Net.NodeA.Send(10,59904L));    // Bus local
+  REQUIRE(Net.NodeB.Send(11,59904L));    // Forwarded by rule
+  Net.Run(50);
+
+  REQUIRE(Net.NodeB.Received.size()==1);
+  CHECK(Net.NodeB.Received[0].PGN==127251L);
+  REQUIRE(Net.NodeA.Received.size()==2);
+  CHECK(Net.NodeA.Received[0].PGN==127250L);
+  CHECK(Net.NodeA.Received[0].Source==11);
+  CHECK(Net.NodeA.Received[1].PGN==59904L);
+  CHECK(Net.Gateway.GetBusStats(Net.A)->FramesFiltered==3);
+
+  // Default block
+  Net.Gateway.ClearRules();
+  Net.Gateway.SetDefaultAction(tN2kGateway::ga_Block);
+  Net.Gateway.AddRule(tN2kGateway::ga_Forward,130306L);
+  Net.NodeB.Received.clear();
+  REQUIRE(Net.NodeA.Send(10,127251L));
+  REQUIRE(Net.NodeA.Send(10,130306L));
+  Net.Run(50);
+  REQUIRE(Net.NodeB.Received.size()==1);
+  CHECK(Net.NodeB.Received[0].PGN==130306L);
+  CHECK(tN2kGateway::IsBusLocalPGN(N2kPGNIsoAddressClaim));
+  CHECK(!tN2kGateway::IsBusLocalPGN(126208L));
+}
+
+TEST_CASE("Gateway translates addresses") {
+  tTwoBuses Net;
+
+  CHECK(Net.Gateway.AddAddressMap(Net.A,10,Net.B,100));
+  CHECK(!Net.Gateway.AddAddressMap(Net.A,11,Net.B,100)); // Already in use
+  CHECK(!Net.Gateway.AddAddressMap(Net.A,10,Net.A,100));
+  Net.Open();
+
+  REQUIRE(Net.NodeA.Send(10,127250L));
+  REQUIRE(Net.NodeA.Send(12,127250L));
+  Net.Run(50);
+  REQUIRE(Net.NodeB.Received.size()==2);
+  CHECK(Net.NodeB.Received[0].Source==100);
+  CHECK(Net.NodeB.Received[1].Source==12);
+
+  // Addressed to mapped device
+  REQUIRE(Net.NodeB.Send(30,61184L,100,1));
+  REQUIRE(Net.NodeB.Send(30,61184L,12,2));
+  // Mapped address can not be used by other device on bus B
+  REQUIRE(Net.NodeB.Send(100,127250L));
+  Net.Run(50);
+  REQUIRE(Net.NodeA.Received.size()==2);
+  CHECK(Net.NodeA.Received[0].PGN==61184L);
+  CHECK(Net.NodeA.Received[0].Destination==10);
+  CHECK(Net.NodeA.Received[0].Data[0]==1);
+  CHECK(Net.NodeA.Received[1].Destination==12);
+  CHECK(Net.Gateway.GetBusStats(Net.B)->FramesLooped==1);
+}
+
+TEST_CASE("Parallel gateways do not loop frames") {
+  tTwoBuses Net;
+  tTestNode GwA2(Net.BusA), GwB2(Net.BusB);
+  tN2kGateway Gateway2;
+  Gateway2.AddBus(&GwA2);
+  Gateway2.AddBus(&GwB2);
+  tN2kGateway *Gateways[]={ &Net.Gateway, &Gateway2 };
+  tTestNode *Nodes[]={ &Net.NodeA, &Net.NodeB };
+
+  Net.Open();
+  for ( int i=0; i<100 && !(GwA2.IsOpen() && GwB2.IsOpen()); i++ ) Run(Gateways,2,Nodes,2,20);
+  REQUIRE(GwA2.IsOpen());
+  REQUIRE(GwB2.IsOpen());
+  uint32_t FramesA=Net.BusA.GetFramesTransmitted();
+  uint32_t FramesB=Net.BusB.GetFramesTransmitted();
+  Net.NodeB.Received.clear();
+
+  REQUIRE(Net.NodeA.Send(10,127250L));
+  Run(Gateways,2,Nodes,2,100);
+
+  // Both gateways forward frame once and drop copy forwarded by other one.
+  CHECK(Net.BusA.GetFramesTransmitted()-FramesA==1);
+  CHECK(Net.BusB.GetFramesTransmitted()-FramesB==2);
+  CHECK(Net.NodeB.Received.size()==2);
+  CHECK(Net.Gateway.GetBusStats(1)->FramesLooped==1);
+  CHECK(Gateway2.GetBusStats(1)->FramesLooped==1);
+}
+
+#if defined(N2K_THREADED_GATEWAY)
+namespace {
+// Thread safe bus for gateway threads. Each node can be used from own thread.
+class tLockedNode;
+struct tLockedBus {
+  std::mutex Lock;
+  std::vector<tLockedNode *> Nodes;
+};
+
+class tLockedNode : public tNMEA2000 {
+protected:
+  tLockedBus &Bus;
+  std::deque<tCANFrame> RxFrames;
+
+  bool CANSendFrame(unsigned long id, unsigned char len, const unsigned char *buf, bool) {
+    tCANFrame Frame={ id, len, {0} };
+    memcpy(Frame.buf,buf,len);
+    std::lock_guard<std::mutex> Guard(Bus.Lock);
+    for ( size_t i=0; i<Bus.Nodes.size(); i++ ) {
+      if ( Bus.Nodes[i]!=this ) Bus.Nodes[i]->RxFrames.push_back(Frame);
+    }
+    return true;
+  }
+  bool CANOpen() { return true; }
+  bool CANGetFrame(unsigned long &id, unsigned char &len, unsigned char *buf) {
+    std::lock_guard<std::mutex> Guard(Bus.Lock);
+    if ( RxFrames.empty() ) return false;
+    const tCANFrame &Frame=RxFrames.front();
+    id=Frame.id; len=Frame.len; memcpy(buf,Frame.buf,len);
+    RxFrames.pop_front();
+    return true;
+  }
+
+public:
+  tLockedNode(tLockedBus &_Bus) : Bus(_Bus) {
+    SetMode(N2km_ListenAndSend);
+    std::lock_guard<std::mutex> Guard(Bus.Lock);
+    Bus.Nodes.push_back(this);
+  }
+};
+}
+
+TEST_CASE("Gateway runs each bus on own thread") {
+  tLockedBus BusA, BusB;
+  tLockedNode GwA(BusA), GwB(BusB), Sender(BusA), Listener(BusB);
+  tCollector Collector(&Listener,129029L);
+  tN2kGateway Gateway;
+  const int Count=100;
+
+  Gateway.AddBus(&GwA);
+  Gateway.AddBus(&GwB);
+  CHECK(!Gateway.StartThreads()); // Buses must be open
+  while ( !GwA.IsOpen() || !GwB.IsOpen() || !Sender.IsOpen() || !Listener.IsOpen() ) {
+    Gateway.ParseMessages();
+    Sender.ParseMessages();
+    Listener.ParseMessages();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  CHECK(!Gateway.IsRunning());
+  REQUIRE(Gateway.StartThreads(1024,200));
+  CHECK(Gateway.IsRunning());
+  CHECK(!Gateway.StartThreads());
+  CHECK(Gateway.AddBus(&Sender)==-1);
+
+  auto End=std::chrono::steady_clock::now()+std::chrono::seconds(5);
+  for ( int i=0; i<Count; i++ ) {
+    tN2kMsg GNSS;
+    SetGNSS(GNSS,10,60.0+i*0.001);
+    REQUIRE(Sender.SendMsg(GNSS,-1));
+  }
+  while ( Collector.Msgs.size()<(size_t)Count && std::chrono::steady_clock::now()<End ) {
+    Listener.ParseMessages();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  // Counters can be read while threads are running
+  CHECK(Gateway.GetBusStats(0)->FramesReceived>=(uint32_t)Count*7);
+  Gateway.StopThreads();
+  CHECK(!Gateway.IsRunning());
+
+  REQUIRE(Collector.Msgs.size()==(size_t)Count);
+  bool InOrder=true;
+  for ( int i=0; i<Count; i++ ) {
+    tN2kMsg GNSS;
+    SetGNSS(GNSS,10,60.0+i*0.001);
+    InOrder&=( Collector.Msgs[i].Source==10 && memcmp(Collector.Msgs[i].Data,GNSS.Data,GNSS.DataLen)==0 );
+  }
+  CHECK(InOrder);
+  CHECK(Gateway.GetBusStats(0)->QueueOverflows==0);
+  CHECK(Gateway.GetBusStats(1)->FramesForwarded==(uint32_t)Count*7);
+}
+#endif
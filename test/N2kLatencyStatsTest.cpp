@@ -0,0 +1,124 @@
+#include <catch.hpp>
+#include "N2kTestNMEA2000.h"
+
+// Tests for receive latency histograms. Test target is built with
+// N2K_LATENCY_STATS and its own copy of library sources.
+
+#if defined(N2K_LATENCY_STATS)
+namespace {
+class tLatencyNMEA2000 : public tTestNMEA2000 {
+public:
+  tLatencyNMEA2000() : tTestNMEA2000(N2km_ListenOnly,true) {
+    SetN2kCANMsgBufSize(4);
+  }
+  // Add frame, which has been received Age microseconds ago.
+  void AddFrame(unsigned long PGN, unsigned char Source, unsigned char b0, uint64_t Age) {
+    tCANFrame Frame={ (3UL<<26) | (PGN<<8) | Source, 8, { b0, 10, 1, 2, 3, 4, 5, 6 } };
+#if !defined(N2K_NO_RX_TIMESTAMP)
+    Frame.RxTime=N2kMicros64()-Age;
+#endif
+    tTestNMEA2000::AddFrame(Frame);
+  }
+};
+
+class tSlowHandler : public tNMEA2000::tMsgHandler {
+public:
+  tSlowHandler(unsigned long PGN, tNMEA2000 *pNMEA2000) : tNMEA2000::tMsgHandler(PGN,pNMEA2000) {}
+  void HandleMsg(const tN2kMsg &) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); }
+};
+
+void EmptyMsgHandler(const tN2kMsg &) {}
+}
+
+TEST_CASE("Latency buckets") {
+  CHECK(tN2kLatencyStats::Bucket(0)==0);
+  CHECK(tN2kLatencyStats::Bucket(1)==1);
+  CHECK(tN2kLatencyStats::Bucket(2)==2);
+  CHECK(tN2kLatencyStats::Bucket(3)==2);
+  CHECK(tN2kLatencyStats::Bucket(1000)==10);
+  CHECK(tN2kLatencyStats::Bucket(1024)==11);
+  CHECK(tN2kLatencyStats::Bucket(0xffffffffUL)==N2kLatencyBuckets-1);
+  for ( uint8_t i=0; i<N2kLatencyBuckets-1; i++ ) {
+    CHECK(tN2kLatencyStats::Bucket(tN2kLatencyStats::BucketLimit(i)-1)==i);
+    CHECK(tN2kLatencyStats::Bucket(tN2kLatencyStats::BucketLimit(i))==i+1);
+  }
+}
+
+TEST_CASE("Latency table is bounded") {
+  tN2kLatencyStats Stats;
+
+  CHECK(Stats.Find(127250L)==0);
+  Stats.Init(2);
+  tN2kLatencyStats::tEntry *Heading=Stats.Find(127250L);
+  REQUIRE(Heading!=0);
+  CHECK(Stats.Find(129025L)!=Heading);
+  CHECK(Stats.Find(127250L)==Heading);
+  CHECK(Stats.Find(130306L)==Stats.GetOther());
+  CHECK(Stats.Find(128259L)==Stats.GetOther());
+  CHECK(Stats.GetCount()==2);
+  CHECK(Stats.Get(130306L)==0);
+
+  tN2kLatencyStats::Add(Heading,tN2kLatencyStats::ls_HandlerDuration,5);
+  tN2kLatencyStats::Add(Heading,tN2kLatencyStats::ls_HandlerDuration,7);
+  const tN2kLatencyStats::tHistogram &Histogram=Stats.Get(127250L)->Stages[tN2kLatencyStats::ls_HandlerDuration];
+  CHECK(Histogram.Samples==2);
+  CHECK(Histogram.Max==7);
+  CHECK(Histogram.Total==12);
+  CHECK(Histogram.Buckets[3]==2);
+
+  tStringStream Stream;
+  Stats.Dump(&Stream);
+  CHECK(Stream.Text=="PGN 127250 handler n:2 avg:6 max:7 <1:0 <2:0 <4:0 <8:2\r\n");
+
+  Stats.Reset();
+  CHECK(Stats.GetCount()==0);
+  CHECK(Stats.Get(127250L)==0);
+}
+
+TEST_CASE("Latency histograms of received messages") {
+  tLatencyNMEA2000 NMEA2000;
+  tSlowHandler SlowHandler(127250L,&NMEA2000);
+
+  NMEA2000.SetMsgHandler(EmptyMsgHandler);
+  NMEA2000.OpenNow();
+  // Nothing will be recorded before enabled
+  NMEA2000.AddFrame(127250L,1,1,0);
+  NMEA2000.ParseMessages();
+  CHECK(NMEA2000.GetLatencyStats().GetOther()==0);
+
+  NMEA2000.EnableLatencyStats(4);
+  NMEA2000.AddFrame(127250L,1,1,1000);
+  NMEA2000.AddFrame(127250L,1,1,1000);
+  NMEA2000.AddFrame(129029L,1,0x20,3000);
+  NMEA2000.AddFrame(129029L,1,0x21,2000);
+  NMEA2000.ParseMessages();
+
+  const tN2kLatencyStats::tEntry *Heading=NMEA2000.GetLatencyStats().Get(127250L);
+  REQUIRE(Heading!=0);
+#if !defined(N2K_NO_RX_TIMESTAMP)
+  CHECK(Heading->Stages[tN2kLatencyStats::ls_ArrivalToReady].Samples==2);
+  CHECK(Heading->Stages[tN2kLatencyStats::ls_ArrivalToReady].Max>=3000); // Second message waits handling of first one
+#endif
+  // Callback and slow handler for each message
+  CHECK(Heading->Stages[tN2kLatencyStats::ls_ReadyToHandler].Samples==4);
+  CHECK(Heading->Stages[tN2kLatencyStats::ls_HandlerDuration].Samples==4);
+  CHECK(Heading->Stages[tN2kLatencyStats::ls_HandlerDuration].Max>=2000);
+
+  const tN2kLatencyStats::tEntry *GNSS=NMEA2000.GetLatencyStats().Get(129029L);
+  REQUIRE(GNSS!=0);
+#if !defined(N2K_NO_RX_TIMESTAMP)
+  // Fast packet arrival is measured from first frame
+  CHECK(GNSS->Stages[tN2kLatencyStats::ls_ArrivalToReady].Samples==1);
+  CHECK(GNSS->Stages[tN2kLatencyStats::ls_ArrivalToReady].Max>=3000);
+#endif
+  CHECK(GNSS->Stages[tN2kLatencyStats::ls_HandlerDuration].Samples==1);
+
+  tStringStream Stream;
+  NMEA2000.DumpLatencyStats(&Stream);
+  CHECK(Stream.Text.find("PGN 127250 handler n:4")!=std::string::npos);
+  CHECK(Stream.Text.find("PGN 129029 ready-handler n:1")!=std::string::npos);
+
+  NMEA2000.ResetLatencyStats();
+  CHECK(NMEA2000.GetLatencyStats().GetCount()==0);
+}
+#endif
@@ -0,0 +1,320 @@
+#include <string.h>
+#include <type_traits>
+#include <catch.hpp>
+#include <N2kMessageStructs.h>
+
+// Tests for structure based Set/Parse overloads. Each test sets message
+// from structure, parses it back to other structure and checks that
+// setting message from parsed structure gives same message data. Fields,
+// which are on different order on argument list than on structure, are
+// also checked against argument list functions.
+
+static void CheckSameData(const tN2kMsg &A, const tN2kMsg &B) {
+  INFO("PGN " << A.PGN);
+  REQUIRE(A.PGN==B.PGN);
+  REQUIRE(A.DataLen==B.DataLen);
+  CHECK(memcmp(A.Data,B.Data,A.DataLen)==0);
+}
+
+template <typename TData>
+static void CheckRoundTrip(const TData &In, void (*Set)(tN2kMsg &, const TData &), bool (*Parse)(const tN2kMsg &, TData &), TData &Out) {
+  tN2kMsg N2kMsg, N2kMsgOut;
+  Set(N2kMsg,In);
+  REQUIRE(Parse(N2kMsg,Out));
+  Set(N2kMsgOut,Out);
+  CheckSameData(N2kMsg,N2kMsgOut);
+}
+
+#define ROUND_TRIP(Prefix,PGN,In,Out) \
+  CheckRoundTrip<t##Prefix##PGN##Data>(In,Set##Prefix##PGN,Parse##Prefix##PGN,Out)
+
+TEST_CASE("Structures can be copied as such") {
+  CHECK(std::is_standard_layout<tN2kPGN129029Data>::value);
+  CHECK(std::is_trivially_copyable<tN2kPGN129029Data>::value);
+  CHECK(std::is_trivially_copyable<tN2kPGN127489Data>::value);
+  CHECK(std::is_trivially_copyable<tN2kPGN129794Data>::value);
+  CHECK(std::is_trivially_copyable<tN2kMaretronPGN65286Data>::value);
+}
+
+TEST_CASE("Parse overload fails on wrong PGN") {
+  tN2kMsg N2kMsg;
+  tN2kPGN127250Data Heading;
+  SetN2kPGN129025(N2kMsg,60.0,22.0);
+  CHECK(!ParseN2kPGN127250(N2kMsg,Heading));
+}
+
+TEST_CASE("Navigation structures") {
+  SECTION("126992") {
+    tN2kPGN126992Data In={1,N2ktimes_GPS,19500,3600.5}, Out;
+    ROUND_TRIP(N2kPGN,126992,In,Out);
+    CHECK(Out.TimeSource==N2ktimes_GPS);
+    CHECK(Out.SystemDate==19500);
+    CHECK(Out.SystemTime==Approx(3600.5));
+  }
+  SECTION("127245") {
+    tN2kPGN127245Data In={2,N2kRDO_MoveToPort,0.1,-0.05}, Out;
+    ROUND_TRIP(N2kPGN,127245,In,Out);
+    tN2kMsg N2kMsg, N2kMsgArgs;
+    SetN2kPGN127245(N2kMsg,In);
+    SetN2kPGN127245(N2kMsgArgs,-0.05,2,N2kRDO_MoveToPort,0.1);
+    CheckSameData(N2kMsg,N2kMsgArgs);
+    CHECK(Out.Instance==2);
+    CHECK(Out.RudderPosition==Approx(-0.05));
+    CHECK(Out.AngleOrder==Approx(0.1));
+  }
+  SECTION("127250") {
+    tN2kPGN127250Data In={1,1.234,N2kDoubleNA,-0.012,N2khr_magnetic}, Out;
+    ROUND_TRIP(N2kPGN,127250,In,Out);
+    CHECK(Out.Heading==Approx(1.234));
+    CHECK(Out.Deviation==N2kDoubleNA);
+    CHECK(Out.Reference==N2khr_magnetic);
+  }
+  SECTION("127251, 127252, 127257, 127258") {
+    tN2kPGN127251Data Rot={1,-0.05}, RotOut;
+    ROUND_TRIP(N2kPGN,127251,Rot,RotOut);
+    tN2kPGN127252Data Heave={1,0.5,0.01,N2kDD374_FactoryDefault}, HeaveOut;
+    ROUND_TRIP(N2kPGN,127252,Heave,HeaveOut);
+    tN2kPGN127257Data Attitude={1,0.5,-0.1,0.2}, AttitudeOut;
+    ROUND_TRIP(N2kPGN,127257,Attitude,AttitudeOut);
+    tN2kPGN127258Data Variation={1,N2kmagvar_WMM2020,19500,0.1}, VariationOut;
+    ROUND_TRIP(N2kPGN,127258,Variation,VariationOut);
+    CHECK(AttitudeOut.Pitch==Approx(-0.1));
+    CHECK(VariationOut.DaysSince1970==19500);
+  }
+  SECTION("127233, 127237") {
+    tN2kPGN127233Data Mob={1,12345,MOBEmitterActivated,3600,PositionEstimatedByVessel,
+                           19500,3601,60.1,22.2,N2khr_true,1.0,2.5,230000001,Good}, MobOut;
+    ROUND_TRIP(N2kPGN,127233,Mob,MobOut);
+    CHECK(MobOut.MMSI==230000001);
+    tN2kPGN127237Data Control={N2kOnOff_Off,N2kOnOff_On,N2kOnOff_Off,N2kOnOff_Off,N2kSM_HeadingControl,
+                               N2kTM_RudderLimitControlled,N2khr_true,N2kRDO_MoveToStarboard,0.1,1.0,1.1,
+                               0.5,0.2,100,0.05,20,1.05}, ControlOut;
+    ROUND_TRIP(N2kPGN,127237,Control,ControlOut);
+    CHECK(ControlOut.OffHeadingLimitExceeded==N2kOnOff_On);
+    CHECK(ControlOut.VesselHeading==Approx(1.05));
+  }
+  SECTION("128000, 128259, 128267, 128275") {
+    tN2kPGN128000Data Leeway={1,0.05}, LeewayOut;
+    ROUND_TRIP(N2kPGN,128000,Leeway,LeewayOut);
+    tN2kPGN128259Data Speed={1,3.25,N2kDoubleNA,N2kSWRT_Paddle_wheel}, SpeedOut;
+    ROUND_TRIP(N2kPGN,128259,Speed,SpeedOut);
+    tN2kPGN128267Data Depth={1,12.34,-0.5,100}, DepthOut;
+    ROUND_TRIP(N2kPGN,128267,Depth,DepthOut);
+    tN2kPGN128275Data Log={19500,3600,100000,5000}, LogOut;
+    ROUND_TRIP(N2kPGN,128275,Log,LogOut);
+    CHECK(DepthOut.Range==Approx(100));
+    CHECK(LogOut.TripLog==5000);
+  }
+  SECTION("129025, 129026, 129029, 129033") {
+    tN2kPGN129025Data Pos={60.1234567,-22.7654321}, PosOut;
+    ROUND_TRIP(N2kPGN,129025,Pos,PosOut);
+    tN2kPGN129026Data CogSog={1,N2khr_true,3.1,5.25}, CogSogOut;
+    ROUND_TRIP(N2kPGN,129026,CogSog,CogSogOut);
+    tN2kPGN129029Data GNSS={1,19500,3600.5,60.5,-22.25,15.5,N2kGNSSt_GLONASS,N2kGNSSm_DGNSS,12,0.8,1.2,18.5,
+                            1,N2kGNSSt_GPS,100,2.5}, GNSSOut;
+    ROUND_TRIP(N2kPGN,129029,GNSS,GNSSOut);
+    tN2kPGN129033Data Time={19500,3600,-120}, TimeOut;
+    ROUND_TRIP(N2kPGN,129033,Time,TimeOut);
+    CHECK(PosOut.Longitude==Approx(-22.7654321));
+    CHECK(GNSSOut.ReferenceStationID==100);
+    CHECK(GNSSOut.AgeOfCorrection==Approx(2.5));
+    CHECK(TimeOut.LocalOffset==-120);
+  }
+  SECTION("129283, 129284, 129539") {
+    tN2kPGN129283Data XTE={1,N2kxtem_Autonomous,false,12.5}, XTEOut;
+    ROUND_TRIP(N2kPGN,129283,XTE,XTEOut);
+    tN2kPGN129284Data Nav={1,1000,N2khr_true,false,true,N2kdct_GreatCircle,3600,19500,1.0,1.1,1,2,60.1,22.2,2.5}, NavOut;
+    ROUND_TRIP(N2kPGN,129284,Nav,NavOut);
+    tN2kPGN129539Data DOP={1,N2kGNSSdm_Auto,N2kGNSSdm_3D,0.8,1.2,1.0}, DOPOut;
+    CheckRoundTrip<tN2kPGN129539Data>(DOP,SetN2kPGN129539,ParseN2kPgn129539,DOPOut);
+    CHECK(NavOut.DestinationWaypointNumber==2);
+    CHECK(NavOut.ArrivalCircleEntered);
+    CHECK(DOPOut.ActualMode==N2kGNSSdm_3D);
+  }
+  SECTION("130306, 130577") {
+    tN2kPGN130306Data Wind={1,7.5,1.2,N2kWind_Apparent}, WindOut;
+    ROUND_TRIP(N2kPGN,130306,Wind,WindOut);
+    tN2kPGN130577Data Direction={N2kDD025_Estimated,N2khr_true,1,1.0,2.5,1.1,2.4,0.2,0.3}, DirectionOut;
+    ROUND_TRIP(N2kPGN,130577,Direction,DirectionOut);
+    CHECK(WindOut.WindReference==N2kWind_Apparent);
+    CHECK(DirectionOut.Drift==Approx(0.3));
+  }
+}
+
+TEST_CASE("Engine and electrical structures") {
+  SECTION("127488, 127489") {
+    tN2kPGN127488Data Rapid={1,1850.25,120000,-5}, RapidOut;
+    ROUND_TRIP(N2kPGN,127488,Rapid,RapidOut);
+    tN2kPGN127489Data Dynamic={1,300000,350,360,14.2,10.5,3600*100,N2kDoubleNA,N2kDoubleNA,
+                               tN2kEngineDiscreteStatus1(0x0003),tN2kEngineDiscreteStatus2(0x0001),50,-10}, DynamicOut;
+    ROUND_TRIP(N2kPGN,127489,Dynamic,DynamicOut);
+    CHECK(RapidOut.EngineTiltTrim==-5);
+    CHECK(DynamicOut.Status1.Status==0x0003);
+    CHECK(DynamicOut.Status2.Status==0x0001);
+    CHECK(DynamicOut.EngineLoad==50);
+    CHECK(DynamicOut.EngineTorque==-10);
+  }
+  SECTION("127493, 127497") {
+    tN2kPGN127493Data Transmission={1,N2kTG_Forward,200000,330,0}, TransmissionOut;
+    ROUND_TRIP(N2kPGN,127493,Transmission,TransmissionOut);
+    tN2kPGN127497Data Trip={1,100,10,11,12}, TripOut;
+    ROUND_TRIP(N2kPGN,127497,Trip,TripOut);
+    CHECK(TransmissionOut.TransmissionGear==N2kTG_Forward);
+  }
+  SECTION("127501, 127502") {
+    tN2kBinaryStatus Status;
+    N2kResetBinaryStatus(Status);
+    N2kSetStatusBinaryOnStatus(Status,N2kOnOff_On,3);
+    tN2kPGN127501Data Binary={4,Status}, BinaryOut;
+    ROUND_TRIP(N2kPGN,127501,Binary,BinaryOut);
+    tN2kPGN127502Data Control={4,Status}, ControlOut;
+    ROUND_TRIP(N2kPGN,127502,Control,ControlOut);
+    CHECK(BinaryOut.DeviceBankInstance==4);
+    CHECK(N2kGetStatusOnBinaryStatus(BinaryOut.BankStatus,3)==N2kOnOff_On);
+  }
+  SECTION("127505 .. 127513") {
+    tN2kPGN127505Data Level={1,N2kft_Fuel,50.0,200}, LevelOut;
+    ROUND_TRIP(N2kPGN,127505,Level,LevelOut);
+    tN2kPGN127506Data DC={1,2,N2kDCt_Battery,80,90,3600,0.1,360000}, DCOut;
+    ROUND_TRIP(N2kPGN,127506,DC,DCOut);
+    tN2kPGN127507Data Charger={1,2,N2kCS_Bulk,N2kCM_Standalone,N2kOnOff_On,N2kOnOff_Off,N2kDoubleNA}, ChargerOut;
+    ROUND_TRIP(N2kPGN,127507,Charger,ChargerOut);
+    tN2kPGN127508Data Battery={1,12.85,-3.5,N2kDoubleNA,7}, BatteryOut;
+    ROUND_TRIP(N2kPGN,127508,Battery,BatteryOut);
+    tN2kPGN127510Data Conf={1,2,N2kOnOff_On,50,N2kCA_3State,N2kCM_Standalone,N2kOnOff_On,N2kOnOff_Off,N2kBT_cold,120}, ConfOut;
+    ROUND_TRIP(N2kPGN,127510,Conf,ConfOut);
+    tN2kPGN127513Data BatConf={1,N2kDCbt_AGM,N2kDCES_Yes,N2kDCbnv_12v,N2kDCbc_LeadAcid,360000,-1,1.2,90}, BatConfOut;
+    ROUND_TRIP(N2kPGN,127513,BatConf,BatConfOut);
+    CHECK(DCOut.StateOfHealth==90);
+    CHECK(BatteryOut.SID==7);
+    CHECK(ConfOut.ChargerInstance==1);
+    CHECK(ConfOut.OverChargeEnable==N2kOnOff_On);
+    CHECK(ConfOut.EqualizationEnabled==N2kOnOff_Off);
+    CHECK(ConfOut.BatteryTemperature==N2kBT_cold);
+    CHECK(ConfOut.EqualizationTimeRemaining==120);
+    CHECK(BatConfOut.ChargeEfficiencyFactor==90);
+  }
+  SECTION("127750, 127751") {
+    tN2kPGN127750Data Conv={1,2,N2kCICS_Bulk,N2kRP_OK,N2kDCVS_Warning,N2kOS_OK,N2kTS_OK}, ConvOut;
+    ROUND_TRIP(N2kPGN,127750,Conv,ConvOut);
+    tN2kMsg N2kMsg, N2kMsgArgs;
+    SetN2kPGN127750(N2kMsg,Conv);
+    SetN2kPGN127750(N2kMsgArgs,1,2,N2kCICS_Bulk,N2kTS_OK,N2kOS_OK,N2kDCVS_Warning,N2kRP_OK);
+    CheckSameData(N2kMsg,N2kMsgArgs);
+    CHECK(ConvOut.LowDcVoltageState==N2kDCVS_Warning);
+
+    tN2kPGN127751Data DC={7,1,12.5,2.5}, DCOut;
+    ROUND_TRIP(N2kPGN,127751,DC,DCOut);
+    SetN2kPGN127751(N2kMsg,DC);
+    SetN2kPGN127751(N2kMsgArgs,1,12.5,2.5,7);
+    CheckSameData(N2kMsg,N2kMsgArgs);
+    CHECK(DCOut.SID==7);
+    CHECK(DCOut.Instance==1);
+  }
+  SECTION("Windlass") {
+    tN2kPGN128776Data Control={1,2,N2kDD484_Down,N2kDD002_On,N2kDD488_DualSpeed,80,N2kDD002_On,N2kDD002_Off,
+                               N2kDD002_Off,N2kDD002_On,0.4,tN2kWindlassControlEvents()}, ControlOut;
+    ROUND_TRIP(N2kPGN,128776,Control,ControlOut);
+    tN2kPGN128777Data Operating={1,2,N2kDD480_DeploymentOccurring,N2kDD481_RopePresentlyDetected,12.5,0.5,
+                                 N2kDD482_FullyDocked,tN2kWindlassOperatingEvents()}, OperatingOut;
+    ROUND_TRIP(N2kPGN,128777,Operating,OperatingOut);
+    tN2kPGN128778Data Monitoring={1,2,tN2kWindlassMonitoringEvents(),12.4,20,3600}, MonitoringOut;
+    ROUND_TRIP(N2kPGN,128778,Monitoring,MonitoringOut);
+    CHECK(ControlOut.SpeedControl==80);
+    CHECK(ControlOut.SpeedControlType==N2kDD488_DualSpeed);
+    CHECK(ControlOut.AnchorLight==N2kDD002_On);
+    CHECK(OperatingOut.RodeCounterValue==Approx(12.5));
+    CHECK(MonitoringOut.TotalMotorTime==Approx(3600));
+    CHECK(MonitoringOut.MotorCurrent==Approx(20));
+  }
+}
+
+TEST_CASE("Environmental structures") {
+  tN2kPGN130310Data Outside={1,285.15,N2kDoubleNA,101300}, OutsideOut;
+  ROUND_TRIP(N2kPGN,130310,Outside,OutsideOut);
+  tN2kPGN130311Data Env={1,N2kts_OutsideTemperature,N2khs_OutsideHumidity,285.15,55.5,101300}, EnvOut;
+  ROUND_TRIP(N2kPGN,130311,Env,EnvOut);
+  tN2kPGN130312Data Temp={1,2,N2kts_EngineRoomTemperature,310.15,N2kDoubleNA}, TempOut;
+  ROUND_TRIP(N2kPGN,130312,Temp,TempOut);
+  tN2kPGN130313Data Humidity={1,2,N2khs_InsideHumidity,45.5,50}, HumidityOut;
+  ROUND_TRIP(N2kPGN,130313,Humidity,HumidityOut);
+  tN2kPGN130314Data Pressure={1,2,N2kps_Atmospheric,101300}, PressureOut;
+  ROUND_TRIP(N2kPGN,130314,Pressure,PressureOut);
+  tN2kPGN130316Data TempExt={1,0,N2kts_SeaTemperature,290.123,295.5}, TempExtOut;
+  ROUND_TRIP(N2kPGN,130316,TempExt,TempExtOut);
+  tN2kPGN130576Data Trim={10,-20}, TrimOut;
+  ROUND_TRIP(N2kPGN,130576,Trim,TrimOut);
+
+  CHECK(EnvOut.HumiditySource==N2khs_OutsideHumidity);
+  CHECK(EnvOut.Humidity==Approx(55.5));
+  CHECK(HumidityOut.SetHumidity==Approx(50));
+  CHECK(TempExtOut.ActualTemperature==Approx(290.123));
+  CHECK(TrimOut.StbdTrimTab==-20);
+
+  tN2kMsg N2kMsg, N2kMsgArgs;
+  tN2kPGN130315Data SetPressure={1,2,N2kps_Atmospheric,101000};
+  SetN2kPGN130315(N2kMsg,SetPressure);
+  SetN2kPGN130315(N2kMsgArgs,1,2,N2kps_Atmospheric,101000);
+  CheckSameData(N2kMsg,N2kMsgArgs);
+}
+
+TEST_CASE("AIS structures") {
+  SECTION("129038, 129039") {
+    tN2kPGN129038Data ClassA={1,N2kaisr_Initial,230000001,22.5,60.5,true,false,30,1.0,5.5,
+                              N2kaischannel_A_VDL_reception,1.1,0.01,N2kaisns_Under_Way_Motoring,5}, ClassAOut;
+    ROUND_TRIP(N2kPGN,129038,ClassA,ClassAOut);
+    tN2kMsg N2kMsg, N2kMsgArgs;
+    SetN2kPGN129038(N2kMsg,ClassA);
+    SetN2kPGN129038(N2kMsgArgs,1,N2kaisr_Initial,230000001,60.5,22.5,true,false,30,1.0,5.5,
+                    N2kaischannel_A_VDL_reception,1.1,0.01,N2kaisns_Under_Way_Motoring,5);
+    CheckSameData(N2kMsg,N2kMsgArgs);
+    CHECK(ClassAOut.Latitude==Approx(60.5));
+    CHECK(ClassAOut.Longitude==Approx(22.5));
+    CHECK(ClassAOut.NavStatus==N2kaisns_Under_Way_Motoring);
+
+    tN2kPGN129039Data ClassB={18,N2kaisr_Initial,230000002,22.5,60.5,true,false,30,1.0,5.5,
+                              N2kaischannel_B_VDL_transmission,1.1,N2kaisunit_ClassB_CS,true,false,false,true,
+                              N2kaismode_Autonomous,true,6}, ClassBOut;
+    ROUND_TRIP(N2kPGN,129039,ClassB,ClassBOut);
+    CHECK(ClassBOut.Msg22);
+    CHECK(ClassBOut.SID==6);
+  }
+  SECTION("129794, 129809, 129810") {
+    tN2kPGN129794Data Static={5,N2kaisr_Initial,230000001,9074729,"OH1234","VESSEL NAME",36,25.5,6.2,3.1,10,
+                              19500,3600,2.5,"HELSINKI",N2kaisv_ITU_R_M_1371_3,N2kGNSSt_GPS,N2kaisdte_Ready,
+                              N2kaischannel_A_VDL_reception,1}, StaticOut;
+    ROUND_TRIP(N2kPGN,129794,Static,StaticOut);
+    CHECK(strcmp(StaticOut.Callsign,"OH1234")==0);
+    CHECK(strcmp(StaticOut.Name,"VESSEL NAME")==0);
+    CHECK(strcmp(StaticOut.Destination,"HELSINKI")==0);
+    CHECK(StaticOut.IMOnumber==9074729);
+
+    tN2kPGN129809Data PartA={24,N2kaisr_Initial,230000002,"SAILBOAT",N2kaischannel_B_VDL_reception,2}, PartAOut;
+    ROUND_TRIP(N2kPGN,129809,PartA,PartAOut);
+    CHECK(strcmp(PartAOut.Name,"SAILBOAT")==0);
+
+    tN2kPGN129810Data PartB={24,N2kaisr_Initial,230000002,36,"VENDOR","OH5678",12,4,2,6,0,
+                             N2kaischannel_B_VDL_reception,3}, PartBOut;
+    ROUND_TRIP(N2kPGN,129810,PartB,PartBOut);
+    CHECK(strcmp(PartBOut.Vendor,"VENDOR")==0);
+    CHECK(strcmp(PartBOut.Callsign,"OH5678")==0);
+  }
+  SECTION("129802") {
+    tN2kPGN129802Data Safety={14,N2kaisr_Initial,230000001,N2kaischannel_A_VDL_reception,"TEST MESSAGE"}, SafetyOut;
+    ROUND_TRIP(N2kPGN,129802,Safety,SafetyOut);
+    CHECK(strcmp(SafetyOut.SafetyRelatedText,"TEST MESSAGE")==0);
+    CHECK(SafetyOut.SourceID==230000001);
+  }
+}
+
+TEST_CASE("Maretron structures") {
+  tN2kMaretronPGN130823Data Temp={1,2,N2kts_ExhaustGasTemperature,700,N2kDoubleNA}, TempOut;
+  ROUND_TRIP(N2kMaretronPGN,130823,Temp,TempOut);
+  tN2kMaretronPGN65286Data Flow={1,2,N2kft_Fuel,12.5}, FlowOut;
+  ROUND_TRIP(N2kMaretronPGN,65286,Flow,FlowOut);
+  tN2kMaretronPGN65287Data Volume={1,2,N2kft_Fuel,150}, VolumeOut;
+  ROUND_TRIP(N2kMaretronPGN,65287,Volume,VolumeOut);
+  CHECK(TempOut.ActualTemperature==Approx(700));
+  CHECK(FlowOut.FlowRateInstance==2);
+  CHECK(VolumeOut.TripVolume==Approx(150));
+}
@@ -0,0 +1,226 @@
+#include <catch.hpp>
+#include <N2kMessages.h>
+#include <N2kMessageViews.h>
+
+// Tests for typed message views. Each view accessor must return same value
+// as corresponding ParseN2kPGN* output.
+
+TEST_CASE("View validity") {
+  tN2kMsg N2kMsg;
+
+  SetN2kPGN129026(N2kMsg,1,N2khr_true,3.1,5.25);
+  CHECK(tN2kPGN129026View(N2kMsg).IsValid());
+  CHECK(!tN2kPGN127250View(N2kMsg).IsValid());
+  CHECK(&tN2kPGN129026View(N2kMsg).GetMsg()==&N2kMsg);
+  N2kMsg.DataLen=5;
+  CHECK(!tN2kPGN129026View(N2kMsg).IsValid());
+
+  // Range on 128267 is optional
+  SetN2kPGN128267(N2kMsg,1,12.34,-0.5,100);
+  N2kMsg.DataLen=7;
+  tN2kPGN128267View Depth(N2kMsg);
+  REQUIRE(Depth.IsValid());
+  CHECK(Depth.Range()==N2kDoubleNA);
+  N2kMsg.DataLen=6;
+  CHECK(!tN2kPGN128267View(N2kMsg).IsValid());
+}
+
+TEST_CASE("View accessors match parse functions") {
+  tN2kMsg N2kMsg;
+
+  SECTION("126992") {
+    SetN2kPGN126992(N2kMsg,5,19500,43200.5,N2ktimes_GPS);
+    unsigned char SID; uint16_t Date; double Time; tN2kTimeSource Source;
+    REQUIRE(ParseN2kPGN126992(N2kMsg,SID,Date,Time,Source));
+    tN2kPGN126992View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.SID()==SID);
+    CHECK(View.TimeSource()==Source);
+    CHECK(View.SystemDate()==Date);
+    CHECK(View.SystemTime()==Time);
+  }
+
+  SECTION("127250") {
+    SetN2kPGN127250(N2kMsg,1,1.234,N2kDoubleNA,-0.012,N2khr_magnetic);
+    unsigned char SID; double Heading, Deviation, Variation; tN2kHeadingReference Ref;
+    REQUIRE(ParseN2kPGN127250(N2kMsg,SID,Heading,Deviation,Variation,Ref));
+    tN2kPGN127250View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.SID()==SID);
+    CHECK(View.Heading()==Heading);
+    CHECK(View.Deviation()==Deviation);
+    CHECK(View.Variation()==Variation);
+    CHECK(View.Reference()==Ref);
+  }
+
+  SECTION("127251") {
+    SetN2kPGN127251(N2kMsg,2,-0.05);
+    unsigned char SID; double Rate;
+    REQUIRE(ParseN2kPGN127251(N2kMsg,SID,Rate));
+    tN2kPGN127251View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.RateOfTurn()==Rate);
+  }
+
+  SECTION("127257") {
+    SetN2kPGN127257(N2kMsg,4,0.5,-0.1,N2kDoubleNA);
+    unsigned char SID; double Yaw, Pitch, Roll;
+    REQUIRE(ParseN2kPGN127257(N2kMsg,SID,Yaw,Pitch,Roll));
+    tN2kPGN127257View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.Yaw()==Yaw);
+    CHECK(View.Pitch()==Pitch);
+    CHECK(View.Roll()==Roll);
+  }
+
+  SECTION("127488") {
+    SetN2kPGN127488(N2kMsg,1,1850.25,120000,-5);
+    unsigned char Instance; double Speed, Boost; int8_t Trim;
+    REQUIRE(ParseN2kPGN127488(N2kMsg,Instance,Speed,Boost,Trim));
+    tN2kPGN127488View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.EngineInstance()==Instance);
+    CHECK(View.EngineSpeed()==Speed);
+    CHECK(View.EngineBoostPressure()==Boost);
+    CHECK(View.EngineTiltTrim()==Trim);
+  }
+
+  SECTION("127508") {
+    SetN2kPGN127508(N2kMsg,1,12.85,-3.5,N2kDoubleNA,7);
+    unsigned char Instance, SID; double Voltage, Current, Temperature;
+    REQUIRE(ParseN2kPGN127508(N2kMsg,Instance,Voltage,Current,Temperature,SID));
+    tN2kPGN127508View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.BatteryInstance()==Instance);
+    CHECK(View.BatteryVoltage()==Voltage);
+    CHECK(View.BatteryCurrent()==Current);
+    CHECK(View.BatteryTemperature()==Temperature);
+    CHECK(View.SID()==SID);
+  }
+
+  SECTION("128259") {
+    SetN2kPGN128259(N2kMsg,1,3.25,N2kDoubleNA,N2kSWRT_Paddle_wheel);
+    unsigned char SID; double Water, Ground; tN2kSpeedWaterReferenceType SWRT;
+    REQUIRE(ParseN2kPGN128259(N2kMsg,SID,Water,Ground,SWRT));
+    tN2kPGN128259View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.WaterReferenced()==Water);
+    CHECK(View.GroundReferenced()==Ground);
+    CHECK(View.SWRT()==SWRT);
+  }
+
+  SECTION("128267") {
+    SetN2kPGN128267(N2kMsg,1,12.34,-0.5,100);
+    unsigned char SID; double Depth, Offset, Range;
+    REQUIRE(ParseN2kPGN128267(N2kMsg,SID,Depth,Offset,Range));
+    tN2kPGN128267View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.DepthBelowTransducer()==Depth);
+    CHECK(View.Offset()==Offset);
+    CHECK(View.Range()==Range);
+  }
+
+  SECTION("129025") {
+    SetN2kPGN129025(N2kMsg,60.1234567,-22.7654321);
+    double Latitude, Longitude;
+    REQUIRE(ParseN2kPGN129025(N2kMsg,Latitude,Longitude));
+    tN2kPGN129025View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.Latitude()==Latitude);
+    CHECK(View.Longitude()==Longitude);
+  }
+
+  SECTION("129026") {
+    SetN2kPGN129026(N2kMsg,1,N2khr_true,3.1,5.25);
+    unsigned char SID; tN2kHeadingReference Ref; double COG, SOG;
+    REQUIRE(ParseN2kPGN129026(N2kMsg,SID,Ref,COG,SOG));
+    tN2kPGN129026View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.SID()==SID);
+    CHECK(View.Reference()==Ref);
+    CHECK(View.COG()==COG);
+    CHECK(View.SOG()==SOG);
+  }
+
+  SECTION("129029") {
+    unsigned char SID, nSatellites, nReferenceStations; uint16_t Days, StationID;
+    double Seconds, Latitude, Longitude, Altitude, HDOP, PDOP, Geoidal, Age;
+    tN2kGNSStype GNSStype, StationType; tN2kGNSSmethod Method;
+
+    SetN2kPGN129029(N2kMsg,1,19500,3600.5,60.5,-22.25,15.5,N2kGNSSt_GLONASS,N2kGNSSm_DGNSS,12,0.8,1.2,18.5,1,N2kGNSSt_GPS,100,2.5);
+    REQUIRE(ParseN2kPGN129029(N2kMsg,SID,Days,Seconds,Latitude,Longitude,Altitude,GNSStype,Method,
+                              nSatellites,HDOP,PDOP,Geoidal,nReferenceStations,StationType,StationID,Age));
+    tN2kPGN129029View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.SID()==SID);
+    CHECK(View.DaysSince1970()==Days);
+    CHECK(View.SecondsSinceMidnight()==Seconds);
+    CHECK(View.Latitude()==Latitude);
+    CHECK(View.Longitude()==Longitude);
+    CHECK(View.Altitude()==Altitude);
+    CHECK(View.GNSStype()==GNSStype);
+    CHECK(View.GNSSmethod()==Method);
+    CHECK(View.nSatellites()==nSatellites);
+    CHECK(View.HDOP()==HDOP);
+    CHECK(View.PDOP()==PDOP);
+    CHECK(View.GeoidalSeparation()==Geoidal);
+    CHECK(View.nReferenceStations()==nReferenceStations);
+    CHECK(View.ReferenceStationType()==StationType);
+    CHECK(View.ReferenceStationID()==StationID);
+    CHECK(View.AgeOfCorrection()==Age);
+
+    SetN2kPGN129029(N2kMsg,1,19500,3600.5,60.5,-22.25,15.5,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8);
+    REQUIRE(ParseN2kPGN129029(N2kMsg,SID,Days,Seconds,Latitude,Longitude,Altitude,GNSStype,Method,
+                              nSatellites,HDOP,PDOP,Geoidal,nReferenceStations,StationType,StationID,Age));
+    tN2kPGN129029View NoStations(N2kMsg);
+    REQUIRE(NoStations.IsValid());
+    CHECK(NoStations.nReferenceStations()==0);
+    CHECK(NoStations.ReferenceStationType()==StationType);
+    CHECK(NoStations.ReferenceStationID()==StationID);
+    CHECK(NoStations.AgeOfCorrection()==Age);
+  }
+
+  SECTION("130306") {
+    SetN2kPGN130306(N2kMsg,1,7.5,1.2,N2kWind_Apparent);
+    unsigned char SID; double Speed, Angle; tN2kWindReference Ref;
+    REQUIRE(ParseN2kPGN130306(N2kMsg,SID,Speed,Angle,Ref));
+    tN2kPGN130306View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.WindSpeed()==Speed);
+    CHECK(View.WindAngle()==Angle);
+    CHECK(View.WindReference()==Ref);
+  }
+
+  SECTION("130310") {
+    SetN2kPGN130310(N2kMsg,1,285.15,N2kDoubleNA,101300);
+    unsigned char SID; double Water, Air, Pressure;
+    REQUIRE(ParseN2kPGN130310(N2kMsg,SID,Water,Air,Pressure));
+    tN2kPGN130310View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.WaterTemperature()==Water);
+    CHECK(View.OutsideAmbientAirTemperature()==Air);
+    CHECK(View.AtmosphericPressure()==Pressure);
+  }
+
+  SECTION("130312") {
+    SetN2kPGN130312(N2kMsg,1,2,N2kts_EngineRoomTemperature,310.15,N2kDoubleNA);
+    unsigned char SID, Instance; tN2kTempSource Source; double Actual, Set;
+    REQUIRE(ParseN2kPGN130312(N2kMsg,SID,Instance,Source,Actual,Set));
+    tN2kPGN130312View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.TempInstance()==Instance);
+    CHECK(View.TempSource()==Source);
+    CHECK(View.ActualTemperature()==Actual);
+    CHECK(View.SetTemperature()==Set);
+  }
+
+  SECTION("130316") {
+    SetN2kPGN130316(N2kMsg,1,0,N2kts_SeaTemperature,290.123,295.5);
+    unsigned char SID, Instance; tN2kTempSource Source; double Actual, Set;
+    REQUIRE(ParseN2kPGN130316(N2kMsg,SID,Instance,Source,Actual,Set));
+    tN2kPGN130316View View(N2kMsg);
+    REQUIRE(View.IsValid());
+    CHECK(View.ActualTemperature()==Actual);
+    CHECK(View.SetTemperature()==Set);
+  }
+}
@@ -0,0 +1,196 @@
+#include <catch.hpp>
+#include "N2kTestNMEA2000.h"
+
+// Tests for payload buffer pool and long ISO TP message reception.
+
+TEST_CASE("Buffer pool gives smallest free buffer large enough") {
+  tN2kMsgBufPool Pool;
+  uint16_t Size;
+
+  REQUIRE(Pool.AddClass(223,1));
+  REQUIRE(Pool.AddClass(8,2));
+  REQUIRE(Pool.AddClass(1785,1));
+  Pool.Init();
+  CHECK(Pool.MaxSize()==1785);
+
+  unsigned char *Small1=Pool.Alloc(8,Size);
+  CHECK(Size==8);
+  unsigned char *Small2=Pool.Alloc(5,Size);
+  CHECK(Size==8);
+  CHECK(Small1!=Small2);
+  // Small ones used, so next goes to larger class
+  unsigned char *Fast=Pool.Alloc(8,Size);
+  CHECK(Size==223);
+  unsigned char *Long=Pool.Alloc(100,Size);
+  CHECK(Size==1785);
+  CHECK(Pool.Alloc(1,Size)==0);
+  CHECK(Size==0);
+
+  Pool.Free(Small2);
+  CHECK(Pool.Alloc(8,Size)==Small2);
+  Pool.Free(Long);
+  Pool.Free(Fast);
+  CHECK(Pool.Alloc(1000,Size)==Long);
+  CHECK(Pool.Alloc(2000,Size)==0);
+}
+
+namespace {
+const unsigned char TPSource=35;
+
+class tPoolNMEA2000 : public tTestNMEA2000 {
+public:
+  // Feed frame and handle ready message. Returns true, if message was ready.
+  bool Frame(unsigned long PGN, unsigned char Destination, const unsigned char *buf, unsigned char len=8) {
+    unsigned long canId=(6UL<<26) | (PGN<<8) | ((unsigned long)Destination<<8) | TPSource;
+    uint8_t MsgIndex=SetN2kCANBufMsg(canId,len,(unsigned char *)buf);
+    if ( MsgIndex>=MaxN2kCANMsgs ) return false;
+    HandleCANMsg(N2kCANMsgBuf[MsgIndex]);
+    FreeCANMsg(MsgIndex);
+    return true;
+  }
+  // Send broadcast message with TP BAM. Returns true, if message was ready after last frame.
+  bool SendBAM(unsigned long PGN, const std::vector<unsigned char> &Data) {
+    uint16_t nBytes=Data.size();
+    uint8_t nPackets=(nBytes+6)/7;
+    unsigned char cm[8]={ 32, (unsigned char)(nBytes & 0xff), (unsigned char)(nBytes>>8), nPackets, 0xff,
+                          (unsigned char)(PGN & 0xff), (unsigned char)((PGN>>8) & 0xff), (unsigned char)(PGN>>16) };
+    Frame(60416L,0xff,cm);
+    bool Ready=false;
+    for ( uint8_t i=0; i<nPackets; i++ ) {
+      unsigned char dt[8]={ (unsigned char)(i+1), 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+      for ( int j=0; j<7 && i*7+j<nBytes; j++ ) dt[j+1]=Data[i*7+j];
+      Ready=Frame(60160L,0xff,dt);
+    }
+    return Ready;
+  }
+};
+
+std::vector<unsigned char> LongPayload;
+unsigned long LongPGN=0;
+int MsgCount=0;
+
+void OnLongMsg(const tN2kMsg &N2kMsg, const unsigned char *Data, uint16_t DataLen) {
+  LongPGN=N2kMsg.PGN;
+  LongPayload.assign(Data,Data+DataLen);
+}
+
+void OnMsg(const tN2kMsg &) { MsgCount++; }
+
+std::vector<unsigned char> TestPayload(uint16_t Len) {
+  std::vector<unsigned char> Data(Len);
+  for ( uint16_t i=0; i<Len; i++ ) Data[i]=(unsigned char)(i*7+3);
+  return Data;
+}
+}
+
+TEST_CASE("Long TP message is delivered with payload pointer") {
+  tPoolNMEA2000 NMEA2000;
+  NMEA2000.SetN2kCANMsgBufSize(4);
+  REQUIRE(NMEA2000.AddN2kCANMsgBufClass(8,2));
+  REQUIRE(NMEA2000.AddN2kCANMsgBufClass(1785,1));
+  NMEA2000.SetLongMsgHandler(OnLongMsg);
+  NMEA2000.SetMsgHandler(OnMsg);
+  NMEA2000.Open();
+  LongPayload.clear(); MsgCount=0;
+
+  std::vector<unsigned char> Data=TestPayload(1785);
+  CHECK(NMEA2000.SendBAM(126464L,Data));
+  CHECK(LongPGN==126464L);
+  CHECK(LongPayload==Data);
+  CHECK(MsgCount==0);
+
+  // Short TP message goes to normal handler
+  CHECK(NMEA2000.SendBAM(126464L,TestPayload(30)));
+  CHECK(MsgCount==1);
+
+  // Pool is configured after open, so it can not be changed
+  CHECK(!NMEA2000.AddN2kCANMsgBufClass(223,1));
+}
+
+TEST_CASE("Default buffers do not accept long TP message") {
+  tPoolNMEA2000 NMEA2000;
+  NMEA2000.SetLongMsgHandler(OnLongMsg);
+  NMEA2000.Open();
+  LongPayload.clear();
+
+  CHECK(!NMEA2000.SendBAM(126464L,TestPayload(500)));
+  CHECK(LongPayload.empty());
+}
+
+TEST_CASE("Long TP message is dropped when pool has no buffer large enough") {
+  tPoolNMEA2000 NMEA2000;
+  NMEA2000.SetN2kCANMsgBufSize(4);
+  REQUIRE(NMEA2000.AddN2kCANMsgBufClass(300,1));
+  NMEA2000.SetLongMsgHandler(OnLongMsg);
+  NMEA2000.Open();
+  LongPayload.clear();
+
+  CHECK(!NMEA2000.SendBAM(126464L,TestPayload(500)));
+  CHECK(LongPayload.empty());
+
+  std::vector<unsigned char> Data=TestPayload(280);
+  CHECK(NMEA2000.SendBAM(126464L,Data));
+  CHECK(LongPayload==Data);
+}
+
+TEST_CASE("Fast packet does not need pool buffer") {
+  tPoolNMEA2000 NMEA2000;
+  NMEA2000.SetN2kCANMsgBufSize(4);
+  REQUIRE(NMEA2000.AddN2kCANMsgBufClass(1785,1));
+  NMEA2000.SetLongMsgHandler(OnLongMsg);
+  NMEA2000.SetMsgHandler(OnMsg);
+  NMEA2000.Open();
+  LongPayload.clear(); MsgCount=0;
+
+  // Fast packet 129029 (43 bytes) is reassembled to slot message
+  unsigned char Frame[8]={ 0x20, 43, 1, 2, 3, 4, 5, 6 };
+  CHECK(!NMEA2000.Frame(129029L,0,Frame));
+  for ( unsigned char i=1; i<7; i++ ) {
+    Frame[0]=0x20+i;
+    for ( int j=1; j<8; j++ ) Frame[j]=7*i+j-1;
+    CHECK(NMEA2000.Frame(129029L,0,Frame)==(i==6));
+  }
+  CHECK(MsgCount==1);
+
+  // Long TP message can be received at same time
+  std::vector<unsigned char> Data=TestPayload(1000);
+  CHECK(NMEA2000.SendBAM(126464L,Data));
+  CHECK(LongPayload==Data);
+}
+
+TEST_CASE("Receive slot is only slightly larger than tN2kMsg") {
+  // Slot header is kept on its tN2kMsg
+  CHECK(sizeof(tN2kCANMsg)<=sizeof(tN2kMsg)+8);
+}
+
+namespace {
+tN2kMsg LastMsg;
+void OnSingleFrame(const tN2kMsg &N2kMsg) { MsgCount++; LastMsg=N2kMsg; }
+}
+
+TEST_CASE("Single frame is delivered while all slots are busy") {
+  tPoolNMEA2000 NMEA2000;
+  NMEA2000.SetN2kCANMsgBufSize(2);
+  NMEA2000.SetMsgHandler(OnSingleFrame);
+  NMEA2000.Open();
+  MsgCount=0;
+
+  // Fill slots with fast packets under reassembly
+  unsigned char First[8]={ 0x20, 43, 1, 2, 3, 4, 5, 6 };
+  CHECK(!NMEA2000.Frame(129029L,0,First));
+  CHECK(!NMEA2000.Frame(129038L,0,First));
+
+  unsigned char Heading[8]={ 1, 0x10, 0x27, 0xff, 0x7f, 0xff, 0x7f, 0xfd };
+  CHECK(!NMEA2000.Frame(127250L,0,Heading));
+  REQUIRE(MsgCount==1);
+  CHECK(LastMsg.PGN==127250L);
+  CHECK(LastMsg.Source==TPSource);
+  CHECK(LastMsg.Priority==6);
+  CHECK(LastMsg.DataLen==8);
+  CHECK(memcmp(LastMsg.Data,Heading,8)==0);
+
+  // Short frame keeps its length
+  NMEA2000.Frame(127251L,0,Heading,5);
+  CHECK(MsgCount==2);
+  CHECK(LastMsg.DataLen==5);
+}
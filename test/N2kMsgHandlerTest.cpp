@@ -0,0 +1,107 @@
+#include <catch.hpp>
+#include "N2kTestNMEA2000.h"
+
+// Tests for message handler dispatch of tNMEA2000.
+
+namespace {
+class tHandlerNMEA2000 : public tTestNMEA2000 {
+public:
+  void Dispatch(unsigned long PGN) {
+    tN2kMsg N2kMsg;
+    N2kMsg.SetPGN(PGN);
+    RunMessageHandlers(N2kMsg);
+  }
+};
+
+class tTestHandler : public tNMEA2000::tMsgHandler {
+protected:
+  void HandleMsg(const tN2kMsg &N2kMsg) {
+    Count++;
+    LastPGN=N2kMsg.PGN;
+    if ( DetachOnHandle!=0 ) { tNMEA2000 *NMEA2000=GetNMEA2000(); NMEA2000->DetachMsgHandler(DetachOnHandle); }
+  }
+public:
+  int Count;
+  unsigned long LastPGN;
+  tMsgHandler *DetachOnHandle;
+  tTestHandler(unsigned long _PGN, tNMEA2000 *_pNMEA2000) : tNMEA2000::tMsgHandler(_PGN,_pNMEA2000), Count(0), LastPGN(0), DetachOnHandle(0) {}
+};
+}
+
+TEST_CASE("Message handlers are called for their PGN only") {
+  tHandlerNMEA2000 NMEA2000;
+  tTestHandler Heading(127250L,&NMEA2000);
+  tTestHandler Position(129025L,&NMEA2000);
+  tTestHandler Position2(129025L,&NMEA2000);
+  tTestHandler Wind(130306L,&NMEA2000);
+
+  NMEA2000.Dispatch(129025L);
+  NMEA2000.Dispatch(129026L);
+  NMEA2000.Dispatch(130306L);
+  NMEA2000.Dispatch(127250L);
+  NMEA2000.Dispatch(127250L);
+
+  CHECK(Heading.Count==2);
+  CHECK(Position.Count==1);
+  CHECK(Position2.Count==1);
+  CHECK(Wind.Count==1);
+}
+
+TEST_CASE("Wildcard message handlers get all messages") {
+  tHandlerNMEA2000 NMEA2000;
+  tTestHandler All(0,&NMEA2000);
+  tTestHandler All2(0,&NMEA2000);
+  tTestHandler Wind(130306L,&NMEA2000);
+
+  NMEA2000.Dispatch(59904L);
+  NMEA2000.Dispatch(130306L);
+  NMEA2000.Dispatch(131000L);
+
+  CHECK(All.Count==3);
+  CHECK(All.LastPGN==131000L);
+  CHECK(All2.Count==3);
+  CHECK(Wind.Count==1);
+}
+
+TEST_CASE("Attaching and detaching message handlers updates dispatch") {
+  tHandlerNMEA2000 NMEA2000;
+  tTestHandler Heading(127250L,&NMEA2000);
+  tTestHandler Position(129025L,&NMEA2000);
+
+  NMEA2000.Dispatch(129025L);
+  CHECK(Position.Count==1);
+
+  NMEA2000.DetachMsgHandler(&Position);
+  NMEA2000.Dispatch(129025L);
+  CHECK(Position.Count==1);
+
+  {
+    tTestHandler Temporary(129025L,&NMEA2000);
+    tTestHandler Rudder(127245L,&NMEA2000);
+    NMEA2000.Dispatch(129025L);
+    NMEA2000.Dispatch(127245L);
+    CHECK(Temporary.Count==1);
+    CHECK(Rudder.Count==1);
+  }
+  // Destroyed handlers detach themselves
+  NMEA2000.Dispatch(129025L);
+  NMEA2000.Dispatch(127245L);
+
+  NMEA2000.AttachMsgHandler(&Position);
+  NMEA2000.Dispatch(129025L);
+  NMEA2000.Dispatch(127250L);
+  CHECK(Position.Count==2);
+  CHECK(Heading.Count==1);
+}
+
+TEST_CASE("Message handler can detach other handler while dispatching") {
+  tHandlerNMEA2000 NMEA2000;
+  tTestHandler All(0,&NMEA2000);
+  tTestHandler Position(129025L,&NMEA2000);
+  tTestHandler Position2(129025L,&NMEA2000);
+
+  All.DetachOnHandle=&Position;
+  NMEA2000.Dispatch(129025L);
+  CHECK(Position.Count==0);
+  CHECK(Position2.Count==1);
+}
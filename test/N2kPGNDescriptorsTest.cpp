@@ -0,0 +1,334 @@
+#include <catch.hpp>
+#include <N2kMessages.h>
+#include <N2kPGNDescriptors.h>
+#include "N2kTestNMEA2000.h"
+
+// Tests for table driven PGN descriptors. Messages are set with hand written
+// SetN2kPGN* functions and then decoded and encoded with descriptor engine.
+// Engine must give same values as ParseN2kPGN* and same data as SetN2kPGN*.
+
+namespace {
+// Decode message with engine, encode values back and check that data is same.
+void DecodeAndCheck(const tN2kMsg &N2kMsg, double *Values) {
+  const tN2kPGNDescriptor *Descriptor=N2kFindPGNDescriptor(N2kMsg.PGN);
+  REQUIRE(Descriptor!=0);
+  REQUIRE(N2kDecodeFields(N2kMsg,*Descriptor,Values,N2kMaxDescriptorFields)==Descriptor->FieldCount);
+
+  tN2kMsg Encoded;
+  N2kEncodeFields(Encoded,*Descriptor,Values);
+  CHECK(Encoded.PGN==N2kMsg.PGN);
+  CHECK(Encoded.Priority==N2kMsg.Priority);
+  REQUIRE(Encoded.DataLen==N2kMsg.DataLen);
+  CHECK(memcmp(Encoded.Data,N2kMsg.Data,N2kMsg.DataLen)==0);
+}
+}
+
+TEST_CASE("Descriptor table") {
+  REQUIRE(N2kGetPGNDescriptorCount()>0);
+  CHECK(N2kGetPGNDescriptor(N2kGetPGNDescriptorCount())==0);
+
+  for ( uint8_t i=0; i<N2kGetPGNDescriptorCount(); i++ ) {
+    const tN2kPGNDescriptor *Descriptor=N2kGetPGNDescriptor(i);
+    INFO("PGN " << Descriptor->PGN);
+    if ( i>0 ) CHECK(N2kGetPGNDescriptor(i-1)->PGN<Descriptor->PGN);
+    CHECK(N2kFindPGNDescriptor(Descriptor->PGN)==Descriptor);
+    CHECK(Descriptor->FieldCount<=N2kMaxDescriptorFields);
+    // Fields must cover data without gaps or overlaps.
+    uint16_t BitOffset=0;
+    for ( uint8_t f=0; f<Descriptor->FieldCount; f++ ) {
+      CHECK(Descriptor->Fields[f].BitOffset==BitOffset);
+      BitOffset+=Descriptor->Fields[f].BitLength;
+    }
+    CHECK(BitOffset==Descriptor->DataLen*8);
+  }
+
+  CHECK(N2kFindPGNDescriptor(129029L)==0);
+  CHECK(N2kFindPGNDescriptor(0)==0);
+  CHECK(N2kFindPGNDescriptor(0xffffffffUL)==0);
+}
+
+TEST_CASE("Bit fields") {
+  unsigned char Data[10];
+
+  memset(Data,0,sizeof(Data));
+  N2kSetBits(Data,4,4,0x0f);
+  CHECK(Data[0]==0xf0);
+  N2kSetBits(Data,3,10,0x2aa);
+  CHECK(N2kGetBits(Data,3,10)==0x2aa);
+  CHECK(N2kGetBits(Data,0,3)==0);
+  CHECK(N2kGetBits(Data,13,3)==0);
+
+  // Unaligned 64 bit field spans 9 bytes
+  memset(Data,0xff,sizeof(Data));
+  N2kSetBits(Data,5,64,0x0123456789abcdefULL);
+  CHECK(N2kGetBits(Data,5,64)==0x0123456789abcdefULL);
+  CHECK(N2kGetBits(Data,0,5)==0x1f);
+  CHECK(N2kGetBits(Data,69,11)==0x7ff);
+}
+
+TEST_CASE("Descriptor decode and encode match hand written functions") {
+  tN2kMsg N2kMsg;
+  double Values[N2kMaxDescriptorFields];
+
+  SECTION("126992") {
+    SetN2kPGN126992(N2kMsg,5,19500,43200.5,N2ktimes_GPS);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; uint16_t Date; double Time; tN2kTimeSource Source;
+    REQUIRE(ParseN2kPGN126992(N2kMsg,SID,Date,Time,Source));
+    CHECK(Values[0]==SID);
+    CHECK(Values[1]==Source);
+    CHECK(Values[3]==Date);
+    CHECK(Values[4]==Time);
+  }
+
+  SECTION("127245") {
+    SetN2kPGN127245(N2kMsg,-0.1,1,N2kRDO_MoveToStarboard,0.2);
+    DecodeAndCheck(N2kMsg,Values);
+    double Position, AngleOrder; unsigned char Instance; tN2kRudderDirectionOrder Order;
+    REQUIRE(ParseN2kPGN127245(N2kMsg,Position,Instance,Order,AngleOrder));
+    CHECK(Values[0]==Instance);
+    CHECK(Values[1]==Order);
+    CHECK(Values[3]==AngleOrder);
+    CHECK(Values[4]==Position);
+  }
+
+  SECTION("127250") {
+    SetN2kPGN127250(N2kMsg,1,1.234,N2kDoubleNA,-0.012,N2khr_magnetic);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; double Heading, Deviation, Variation; tN2kHeadingReference Ref;
+    REQUIRE(ParseN2kPGN127250(N2kMsg,SID,Heading,Deviation,Variation,Ref));
+    CHECK(Values[1]==Heading);
+    CHECK(Values[2]==N2kDoubleNA);
+    CHECK(Deviation==N2kDoubleNA);
+    CHECK(Values[3]==Variation);
+    CHECK(Values[4]==Ref);
+  }
+
+  SECTION("127251") {
+    SetN2kPGN127251(N2kMsg,2,-0.05);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; double Rate;
+    REQUIRE(ParseN2kPGN127251(N2kMsg,SID,Rate));
+    CHECK(Values[1]==Rate);
+  }
+
+  SECTION("127252") {
+    SetN2kPGN127252(N2kMsg,3,-0.55,0.3,N2kDD374_FactoryDefault);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; double Heave, Delay; tN2kDelaySource Source;
+    REQUIRE(ParseN2kPGN127252(N2kMsg,SID,Heave,Delay,Source));
+    CHECK(Values[1]==Heave);
+    CHECK(Values[2]==Delay);
+    CHECK(Values[3]==Source);
+  }
+
+  SECTION("127257") {
+    SetN2kPGN127257(N2kMsg,4,0.5,-0.1,N2kDoubleNA);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; double Yaw, Pitch, Roll;
+    REQUIRE(ParseN2kPGN127257(N2kMsg,SID,Yaw,Pitch,Roll));
+    CHECK(Values[1]==Yaw);
+    CHECK(Values[2]==Pitch);
+    CHECK(Values[3]==N2kDoubleNA);
+  }
+
+  SECTION("127488") {
+    SetN2kPGN127488(N2kMsg,1,1850.25,120000,-5);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char Instance; double Speed, Boost; int8_t Trim;
+    REQUIRE(ParseN2kPGN127488(N2kMsg,Instance,Speed,Boost,Trim));
+    CHECK(Values[1]==Speed);
+    CHECK(Values[2]==Boost);
+    CHECK(Values[3]==Trim);
+  }
+
+  SECTION("127505") {
+    SetN2kPGN127505(N2kMsg,3,N2kft_Water,72.5,200);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char Instance; tN2kFluidType Type; double Level, Capacity;
+    REQUIRE(ParseN2kPGN127505(N2kMsg,Instance,Type,Level,Capacity));
+    CHECK(Values[0]==Instance);
+    CHECK(Values[1]==Type);
+    CHECK(Values[2]==Level);
+    CHECK(Values[3]==Capacity);
+  }
+
+  SECTION("127508") {
+    SetN2kPGN127508(N2kMsg,1,12.85,-3.5,N2kDoubleNA,7);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char Instance, SID; double Voltage, Current, Temperature;
+    REQUIRE(ParseN2kPGN127508(N2kMsg,Instance,Voltage,Current,Temperature,SID));
+    CHECK(Values[1]==Voltage);
+    CHECK(Values[2]==Current);
+    CHECK(Values[3]==N2kDoubleNA);
+    CHECK(Values[4]==SID);
+  }
+
+  SECTION("128259") {
+    SetN2kPGN128259(N2kMsg,1,3.25,N2kDoubleNA,N2kSWRT_Paddle_wheel);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; double Water, Ground; tN2kSpeedWaterReferenceType SWRT;
+    REQUIRE(ParseN2kPGN128259(N2kMsg,SID,Water,Ground,SWRT));
+    CHECK(Values[1]==Water);
+    CHECK(Values[2]==N2kDoubleNA);
+    CHECK(Values[3]==SWRT);
+  }
+
+  SECTION("128267") {
+    SetN2kPGN128267(N2kMsg,1,12.34,-0.5,100);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; double Depth, Offset, Range;
+    REQUIRE(ParseN2kPGN128267(N2kMsg,SID,Depth,Offset,Range));
+    CHECK(Values[1]==Depth);
+    CHECK(Values[2]==Offset);
+    CHECK(Values[3]==Range);
+  }
+
+  SECTION("129025") {
+    SetN2kPGN129025(N2kMsg,60.1234567,-22.7654321);
+    DecodeAndCheck(N2kMsg,Values);
+    double Latitude, Longitude;
+    REQUIRE(ParseN2kPGN129025(N2kMsg,Latitude,Longitude));
+    CHECK(Values[0]==Latitude);
+    CHECK(Values[1]==Longitude);
+  }
+
+  SECTION("129026") {
+    SetN2kPGN129026(N2kMsg,1,N2khr_true,3.1,5.25);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; tN2kHeadingReference Ref; double COG, SOG;
+    REQUIRE(ParseN2kPGN129026(N2kMsg,SID,Ref,COG,SOG));
+    CHECK(Values[1]==Ref);
+    CHECK(Values[3]==COG);
+    CHECK(Values[4]==SOG);
+  }
+
+  SECTION("129033") {
+    SetN2kPGN129033(N2kMsg,19500,3600.25,-120);
+    DecodeAndCheck(N2kMsg,Values);
+    uint16_t Days; double Seconds; int16_t Offset;
+    REQUIRE(ParseN2kPGN129033(N2kMsg,Days,Seconds,Offset));
+    CHECK(Values[0]==Days);
+    CHECK(Values[1]==Seconds);
+    CHECK(Values[2]==Offset);
+  }
+
+  SECTION("130306") {
+    SetN2kPGN130306(N2kMsg,1,7.5,1.2,N2kWind_Apparent);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; double Speed, Angle; tN2kWindReference Ref;
+    REQUIRE(ParseN2kPGN130306(N2kMsg,SID,Speed,Angle,Ref));
+    CHECK(Values[1]==Speed);
+    CHECK(Values[2]==Angle);
+    CHECK(Values[3]==Ref);
+  }
+
+  SECTION("130310") {
+    SetN2kPGN130310(N2kMsg,1,285.15,N2kDoubleNA,101300);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; double Water, Air, Pressure;
+    REQUIRE(ParseN2kPGN130310(N2kMsg,SID,Water,Air,Pressure));
+    CHECK(Values[1]==Water);
+    CHECK(Values[2]==N2kDoubleNA);
+    CHECK(Values[3]==Pressure);
+  }
+
+  SECTION("130311") {
+    SetN2kPGN130311(N2kMsg,1,N2kts_OutsideTemperature,290.5,N2khs_OutsideHumidity,65.2,101300);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID; tN2kTempSource TempSource; double Temperature, Humidity, Pressure; tN2kHumiditySource HumiditySource;
+    REQUIRE(ParseN2kPGN130311(N2kMsg,SID,TempSource,Temperature,HumiditySource,Humidity,Pressure));
+    CHECK(Values[1]==TempSource);
+    CHECK(Values[2]==HumiditySource);
+    CHECK(Values[3]==Temperature);
+    CHECK(Values[4]==Humidity);
+    CHECK(Values[5]==Pressure);
+  }
+
+  SECTION("130312") {
+    SetN2kPGN130312(N2kMsg,1,2,N2kts_EngineRoomTemperature,310.15,N2kDoubleNA);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID, Instance; tN2kTempSource Source; double Actual, Set;
+    REQUIRE(ParseN2kPGN130312(N2kMsg,SID,Instance,Source,Actual,Set));
+    CHECK(Values[1]==Instance);
+    CHECK(Values[2]==Source);
+    CHECK(Values[3]==Actual);
+    CHECK(Values[4]==N2kDoubleNA);
+  }
+
+  SECTION("130313") {
+    SetN2kPGN130313(N2kMsg,1,0,N2khs_InsideHumidity,45.5,50);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID, Instance; tN2kHumiditySource Source; double Actual, Set;
+    REQUIRE(ParseN2kPGN130313(N2kMsg,SID,Instance,Source,Actual,Set));
+    CHECK(Values[3]==Actual);
+    CHECK(Values[4]==Set);
+  }
+
+  SECTION("130314") {
+    SetN2kPGN130314(N2kMsg,1,0,N2kps_Atmospheric,101325.5);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID, Instance; tN2kPressureSource Source; double Pressure;
+    REQUIRE(ParseN2kPGN130314(N2kMsg,SID,Instance,Source,Pressure));
+    CHECK(Values[3]==Pressure);
+  }
+
+  SECTION("130316") {
+    SetN2kPGN130316(N2kMsg,1,0,N2kts_SeaTemperature,290.123,295.5);
+    DecodeAndCheck(N2kMsg,Values);
+    unsigned char SID, Instance; tN2kTempSource Source; double Actual, Set;
+    REQUIRE(ParseN2kPGN130316(N2kMsg,SID,Instance,Source,Actual,Set));
+    CHECK(Values[3]==Actual);
+    CHECK(Values[4]==Set);
+  }
+}
+
+TEST_CASE("Descriptor encode out of range and short data") {
+  const tN2kPGNDescriptor *Descriptor=N2kFindPGNDescriptor(127250L);
+  REQUIRE(Descriptor!=0);
+  double Values[N2kMaxDescriptorFields]={ 1, 10.0, -10.0, 0.1, 0, 0 };
+  tN2kMsg N2kMsg;
+
+  N2kEncodeFields(N2kMsg,*Descriptor,Values);
+  // Heading 10 rad does not fit to 0.0001 resolution u16, deviation does
+  // not fit to i16, so both will be OR.
+  CHECK(N2kMsg.Data[1]==0xfe); CHECK(N2kMsg.Data[2]==0xff);
+  CHECK(N2kMsg.Data[3]==0xfe); CHECK(N2kMsg.Data[4]==0x7f);
+  CHECK(N2kMsg.Data[7]==0xfc);
+
+  tN2kMsg Handwritten;
+  SetN2kPGN127250(Handwritten,1,10.0,-10.0,0.1,N2khr_true);
+  CHECK(memcmp(Handwritten.Data,N2kMsg.Data,8)==0);
+
+  // Fields beyond data are NA
+  N2kMsg.DataLen=4;
+  REQUIRE(N2kDecodeFields(N2kMsg,*Descriptor,Values,N2kMaxDescriptorFields)==Descriptor->FieldCount);
+  CHECK(Values[0]==1);
+  CHECK(Values[2]==N2kDoubleNA);
+  CHECK(Values[4]==N2kDoubleNA);
+
+  // Wrong PGN and limited value buffer
+  N2kMsg.PGN=127251L;
+  CHECK(N2kDecodeFields(N2kMsg,*Descriptor,Values,N2kMaxDescriptorFields)==0);
+  N2kMsg.PGN=127250L;
+  CHECK(N2kDecodeFields(N2kMsg,*Descriptor,Values,2)==2);
+}
+
+TEST_CASE("Print described message") {
+  tN2kMsg N2kMsg;
+  tStringStream Stream;
+
+  SetN2kPGN127250(N2kMsg,1,1.234,N2kDoubleNA,-0.012,N2khr_magnetic);
+  REQUIRE(N2kPrintFields(N2kMsg,&Stream));
+  CHECK(Stream.Text=="127250 Vessel Heading: SID=1 Heading=1.2340 Deviation=NA Variation=-0.0120 Reference=1\r\n");
+
+  Stream.Text.clear();
+  SetN2kPGN127488(N2kMsg,0,1850.25,120000,-5);
+  REQUIRE(N2kPrintFields(N2kMsg,&Stream));
+  CHECK(Stream.Text=="127488 Engine Parameters, Rapid Update: Instance=0 Speed=1850.25 BoostPressure=120000 TiltTrim=-5\r\n");
+
+  Stream.Text.clear();
+  SetN2kPGN129029(N2kMsg,1,19000,0,60,22,0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,8,1,1,0);
+  CHECK(!N2kPrintFields(N2kMsg,&Stream));
+  CHECK(Stream.Text.empty());
+}
@@ -0,0 +1,108 @@
+#include <catch.hpp>
+#include "N2kTestNMEA2000.h"
+
+// Tests for frame reading of tNMEA2000::ParseMessages.
+
+namespace {
+class tParseNMEA2000 : public tTestNMEA2000 {
+public:
+  tParseNMEA2000(bool _Bulk=false) : tTestNMEA2000(N2km_ListenOnly,_Bulk) {}
+  void AddHeadingFrames(int Count) {
+    tCANFrame Frame={ (2UL<<26) | (127250UL<<8) | 22, 8, { 1, 0x10, 0x27, 0xff, 0x7f, 0xff, 0x7f, 0xfd } };
+    for ( int i=0; i<Count; i++ ) AddFrame(Frame);
+  }
+};
+
+int MsgCount=0;
+void OnMsg(const tN2kMsg &) { MsgCount++; }
+tN2kMsg LastMsg;
+void SaveMsg(const tN2kMsg &N2kMsg) { LastMsg=N2kMsg; }
+}
+
+TEST_CASE("ParseMessages reads default 20 frames with CANGetFrame") {
+  tParseNMEA2000 NMEA2000;
+  NMEA2000.SetMsgHandler(OnMsg);
+  NMEA2000.OpenNow();
+  MsgCount=0;
+
+  NMEA2000.AddHeadingFrames(50);
+  NMEA2000.ParseMessages();
+  CHECK(MsgCount==20);
+  CHECK(NMEA2000.PendingFrames()==30);
+  CHECK(NMEA2000.GetFrameCalls==20);
+
+  // Read stops on empty queue
+  NMEA2000.SetMaxReadFramesOnParse(100);
+  NMEA2000.ParseMessages();
+  CHECK(MsgCount==50);
+  CHECK(NMEA2000.PendingFrames()==0);
+}
+
+TEST_CASE("ParseMessages uses bulk read of driver") {
+  tParseNMEA2000 NMEA2000(true);
+  NMEA2000.SetMsgHandler(OnMsg);
+  NMEA2000.OpenNow();
+  MsgCount=0;
+
+  NMEA2000.SetMaxReadFramesOnParse(30);
+  NMEA2000.AddHeadingFrames(100);
+  NMEA2000.ParseMessages();
+  CHECK(MsgCount==30);
+  CHECK(NMEA2000.GetFrameCalls==0);
+  CHECK(NMEA2000.GetFramesCalls==(30+N2kMaxCANGetFrames-1)/N2kMaxCANGetFrames);
+}
+
+TEST_CASE("ParseMessages time budget limits reading") {
+  tParseNMEA2000 NMEA2000(true);
+  NMEA2000.SetMsgHandler(OnMsg);
+  NMEA2000.OpenNow();
+  MsgCount=0;
+
+  NMEA2000.SetMaxReadFramesOnParse(60000);
+  NMEA2000.SetMaxParseTime(1);
+  NMEA2000.AddHeadingFrames(50000);
+  NMEA2000.ParseMessages();
+  CHECK(MsgCount>0);
+  CHECK(MsgCount<50000);
+}
+
+#if !defined(N2K_NO_RX_TIMESTAMP)
+TEST_CASE("Frame receive times are delivered with message") {
+  tParseNMEA2000 NMEA2000(true);
+  NMEA2000.SetMsgHandler(SaveMsg);
+  NMEA2000.OpenNow();
+
+  // Driver provided times for fast packet frames
+  tNMEA2000::tCANFrame First={ (3UL<<26) | (129029UL<<8) | 22, 8, { 0x20, 10, 1, 2, 3, 4, 5, 6 }, 1000000 };
+  tNMEA2000::tCANFrame Last={ (3UL<<26) | (129029UL<<8) | 22, 8, { 0x21, 7, 8, 9, 10, 0xff, 0xff, 0xff }, 1000250 };
+  NMEA2000.AddFrame(First);
+  NMEA2000.AddFrame(Last);
+  NMEA2000.ParseMessages();
+  CHECK(LastMsg.PGN==129029L);
+  CHECK(LastMsg.DataLen==10);
+  CHECK(LastMsg.RxStartTime==1000000);
+  CHECK(LastMsg.RxTime==1000250);
+  CHECK(LastMsg.GetMsgTimeMs()==1000);
+
+  // Actisense writes MsgTime as default and receive time on request
+  tStringStream Default, RxTime;
+  LastMsg.MsgTime=0x01020304;
+  LastMsg.SendInActisenseFormat(&Default);
+  LastMsg.SendInActisenseFormat(&RxTime,true);
+  CHECK(Default.Text.substr(10,4)==std::string("\x04\x03\x02\x01"));
+  CHECK(RxTime.Text.substr(10,4)==std::string("\xe8\x03\x00\x00",4));
+
+  // Without driver time, time of read is used
+  uint64_t Before=N2kMicros64();
+  NMEA2000.AddHeadingFrames(1);
+  NMEA2000.ParseMessages();
+  CHECK(LastMsg.PGN==127250L);
+  CHECK(LastMsg.RxTime>=Before);
+  CHECK(LastMsg.RxTime<=N2kMicros64());
+  CHECK(LastMsg.RxStartTime==LastMsg.RxTime);
+
+  // Locally created message does not have receive time
+  LastMsg.SetPGN(127250L);
+  CHECK(LastMsg.RxTime==0);
+}
+#endif
@@ -0,0 +1,65 @@
+#include <catch.hpp>
+#include <N2kMessages.h>
+#include "N2kTestNMEA2000.h"
+
+// Tests for periodic message scheduler of tNMEA2000.
+
+namespace {
+int FillCalls=0;
+bool FillHeading(tN2kMsg &N2kMsg, void *Context) {
+  SetN2kTrueHeading(N2kMsg,*(unsigned char *)Context,0.5);
+  return true;
+}
+bool FillPosition(tN2kMsg &N2kMsg, void *) {
+  SetN2kLatLonRapid(N2kMsg,60.1,22.5);
+  return true;
+}
+bool FillNothing(tN2kMsg &, void *) { FillCalls++; return false; }
+}
+
+TEST_CASE("Automatic offsets spread messages with same period") {
+  tTestNMEA2000 NMEA2000(tNMEA2000::N2km_SendOnly);
+  unsigned char SID=0;
+
+  int h0=NMEA2000.AddPeriodicMsg(127250L,1000,FillHeading,&SID);
+  int h1=NMEA2000.AddPeriodicMsg(127250L,1000,FillHeading,&SID);
+  int h2=NMEA2000.AddPeriodicMsg(127250L,1000,FillHeading,&SID);
+  int h3=NMEA2000.AddPeriodicMsg(127250L,1000,FillHeading,&SID);
+  int Other=NMEA2000.AddPeriodicMsg(129025L,100,FillPosition);
+  CHECK(NMEA2000.GetPeriodicMsgOffset(h0)==0);
+  CHECK(NMEA2000.GetPeriodicMsgOffset(h1)==500);
+  CHECK(NMEA2000.GetPeriodicMsgOffset(h2)==250);
+  CHECK(NMEA2000.GetPeriodicMsgOffset(h3)==750);
+  CHECK(NMEA2000.GetPeriodicMsgOffset(Other)==0);
+
+  // Explicit offset and disabling
+  CHECK(NMEA2000.SetPeriodicMsgPeriod(h1,2000,300));
+  CHECK(NMEA2000.GetPeriodicMsgOffset(h1)==300);
+  CHECK(NMEA2000.SetPeriodicMsgPeriod(h2,0));
+  CHECK(NMEA2000.GetPeriodicMsgPeriod(h2)==0);
+  CHECK(!NMEA2000.SetPeriodicMsgPeriod(10,100));
+  CHECK(NMEA2000.AddPeriodicMsg(127250L,1000,0)==-1);
+}
+
+TEST_CASE("Periodic messages are sent by ParseMessages") {
+  tTestNMEA2000 NMEA2000(tNMEA2000::N2km_SendOnly);
+  unsigned char SID=1;
+
+  NMEA2000.AddPeriodicMsg(127250L,20,FillHeading,&SID);
+  NMEA2000.AddPeriodicMsg(129025L,100,FillPosition);
+  NMEA2000.AddPeriodicMsg(130306L,0,FillNothing);
+  NMEA2000.AddPeriodicMsg(127251L,50,FillNothing);
+  // Many disabled entries do not prevent due ones to be found
+  for ( int i=0; i<100; i++ ) NMEA2000.AddPeriodicMsg(127245L,0,FillPosition);
+  NMEA2000.OpenNow();
+  FillCalls=0;
+
+  NMEA2000.Run(400);
+  CHECK(NMEA2000.SentCount(127250L)>=10);
+  CHECK(NMEA2000.SentCount(127250L)<=21);
+  CHECK(NMEA2000.SentCount(129025L)>=2);
+  CHECK(NMEA2000.SentCount(129025L)<=5);
+  CHECK(NMEA2000.SentCount(127245L)==0);
+  CHECK(NMEA2000.SentCount(127251L)==0);
+  CHECK(FillCalls>=4);
+}
@@ -0,0 +1,109 @@
+#include <catch.hpp>
+#include <RingBuffer.h>
+#include <atomic>
+#include "N2kTestNMEA2000.h"
+
+// Tests for thread safe PostMsg. Test target is built with N2K_THREAD_SAFE_SEND
+// and its own copy of library sources.
+
+#if defined(N2K_THREAD_SAFE_SEND)
+namespace {
+const int Producers=4;
+const int MsgsPerProducer=500;
+const unsigned char MsgLen=20; // 3 fast packet frames
+
+void SetTestMsg(tN2kMsg &N2kMsg, unsigned char Producer, uint16_t Counter) {
+  N2kMsg.SetPGN(129029L);
+  N2kMsg.Priority=3;
+  N2kMsg.AddByte(Producer);
+  N2kMsg.Add2ByteUInt(Counter);
+  for ( int i=N2kMsg.DataLen; i<MsgLen; i++ ) N2kMsg.AddByte(0xff);
+}
+}
+
+TEST_CASE("MPSC ring buffer") {
+  tMPSCRingBuffer<int> Buf(5);
+  int Val;
+
+  CHECK(Buf.getSize()==8);
+  CHECK(Buf.isEmpty());
+  for ( int i=0; i<8; i++ ) CHECK(Buf.add(i));
+  CHECK(!Buf.add(8));
+  CHECK(Buf.read(Val));
+  CHECK(Val==0);
+  CHECK(Buf.add(8));
+  for ( int i=1; i<=8; i++ ) {
+    REQUIRE(Buf.peek()!=0);
+    CHECK(*Buf.peek()==i);
+    Buf.pop();
+  }
+  CHECK(Buf.isEmpty());
+  CHECK(!Buf.read(Val));
+}
+
+TEST_CASE("Post message queue full") {
+  tTestNMEA2000 NMEA2000(tNMEA2000::N2km_SendOnly);
+  tN2kMsg N2kMsg;
+
+  NMEA2000.SetPostMsgBufSize(4);
+  NMEA2000.OpenNow();
+  SetTestMsg(N2kMsg,0,0);
+  for ( int i=0; i<4; i++ ) CHECK(NMEA2000.PostMsg(N2kMsg));
+  CHECK(!NMEA2000.PostMsg(N2kMsg));
+  CHECK(NMEA2000.GetPostMsgOverflows()==1);
+  CHECK(NMEA2000.GetWakeupTimeout()==0);
+  CHECK(NMEA2000.Sent.empty()); // Nothing is sent before ParseMessages
+
+  NMEA2000.ParseMessages();
+  CHECK(NMEA2000.Sent.size()==4*3);
+}
+
+TEST_CASE("Post messages from several threads") {
+  tTestNMEA2000 NMEA2000(tNMEA2000::N2km_SendOnly);
+  std::vector<std::thread> Threads;
+  std::atomic<int> Done(0);
+
+  NMEA2000.SetPostMsgBufSize(16);
+  NMEA2000.OpenNow();
+
+  for ( int p=0; p<Producers; p++ ) {
+    Threads.push_back(std::thread([&NMEA2000,&Done,p]() {
+      tN2kMsg N2kMsg;
+      for ( int i=0; i<MsgsPerProducer; i++ ) {
+        N2kMsg.Clear();
+        SetTestMsg(N2kMsg,p,i);
+        while ( !NMEA2000.PostMsg(N2kMsg) ) std::this_thread::yield();
+      }
+      Done++;
+    }));
+  }
+
+  while ( Done<Producers || NMEA2000.GetWakeupTimeout()==0 ) {
+    NMEA2000.ParseMessages();
+    std::this_thread::yield();
+  }
+  for ( size_t i=0; i<Threads.size(); i++ ) Threads[i].join();
+  NMEA2000.ParseMessages();
+
+  // Each message must have its frames in row with same fast packet sequence
+  // and sequences must advance per message.
+  const std::vector<tNMEA2000::tCANFrame> &Frames=NMEA2000.Sent;
+  REQUIRE(Frames.size()==Producers*MsgsPerProducer*3);
+  int Expected[Producers]={0};
+  bool OrderOk=true, FramesOk=true;
+  for ( size_t m=0; m<Frames.size()/3; m++ ) {
+    const tNMEA2000::tCANFrame *Msg=&Frames[m*3];
+    unsigned char Sequence=Msg[0].buf[0]>>5;
+    FramesOk&=( Sequence==(m & 0x7) && Msg[0].buf[1]==MsgLen );
+    for ( int f=0; f<3; f++ ) FramesOk&=( Msg[f].buf[0]==((Sequence<<5) | f) );
+    unsigned char Producer=Msg[0].buf[2];
+    uint16_t Counter=Msg[0].buf[3] | (Msg[0].buf[4]<<8);
+    REQUIRE(Producer<Producers);
+    OrderOk&=( Counter==Expected[Producer] );
+    Expected[Producer]=Counter+1;
+  }
+  CHECK(FramesOk);
+  CHECK(OrderOk);
+  for ( int p=0; p<Producers; p++ ) CHECK(Expected[p]==MsgsPerProducer);
+}
+#endif
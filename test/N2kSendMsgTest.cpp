@@ -0,0 +1,219 @@
+#include <catch.hpp>
+#include <N2kMessages.h>
+#include <RingBuffer.h>
+#include "N2kTestNMEA2000.h"
+
+// Tests for frame sending of tNMEA2000::SendMsg.
+
+namespace {
+class tSendNMEA2000 : public tTestNMEA2000 {
+public:
+  tSendNMEA2000(bool _Bulk=false) : tTestNMEA2000(N2km_SendOnly,_Bulk) {}
+  // Rebuild message from sent fast packet frames
+  std::vector<unsigned char> FastPacketData() const {
+    std::vector<unsigned char> Data;
+    if ( Sent.empty() ) return Data;
+    size_t Len=Sent[0].buf[1];
+    for ( size_t i=0; i<Sent.size(); i++ ) {
+      if ( (Sent[i].buf[0] & 0x1f)!=i ) return std::vector<unsigned char>();
+      for ( int j=(i==0?2:1); j<8 && Data.size()<Len; j++ ) Data.push_back(Sent[i].buf[j]);
+    }
+    return Data;
+  }
+};
+
+void SetTestGNSS(tN2kMsg &N2kMsg) {
+  SetN2kGNSS(N2kMsg,1,19000,3600.0,60.1,22.5,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,1.2,15.0);
+}
+}
+
+TEST_CASE("Fast packet is sent in frame batches") {
+  for ( int Bulk=0; Bulk<=1; Bulk++ ) {
+    tSendNMEA2000 NMEA2000(Bulk!=0);
+    tN2kMsg N2kMsg;
+    NMEA2000.OpenNow();
+
+    SetTestGNSS(N2kMsg);
+    REQUIRE(NMEA2000.SendMsg(N2kMsg));
+    REQUIRE(NMEA2000.Sent.size()==7);
+    std::vector<unsigned char> Data(N2kMsg.Data,N2kMsg.Data+N2kMsg.DataLen);
+    CHECK(NMEA2000.FastPacketData()==Data);
+    CHECK((NMEA2000.Sent[0].id & 0x3ffff00)==(129029UL<<8));
+    if ( Bulk ) {
+      CHECK(NMEA2000.SendFrameCalls==0);
+      CHECK(NMEA2000.SendFramesCalls==1);
+    } else {
+      CHECK(NMEA2000.SendFrameCalls==7);
+    }
+  }
+}
+
+TEST_CASE("Frames not accepted by driver are buffered in order") {
+  for ( int Bulk=0; Bulk<=1; Bulk++ ) {
+    tSendNMEA2000 NMEA2000(Bulk!=0);
+    tN2kMsg N2kMsg;
+    NMEA2000.OpenNow();
+
+    SetTestGNSS(N2kMsg);
+    NMEA2000.Accept=3;
+    REQUIRE(NMEA2000.SendMsg(N2kMsg));
+    CHECK(NMEA2000.Sent.size()==3);
+
+    NMEA2000.Accept=100;
+    NMEA2000.Flush();
+    REQUIRE(NMEA2000.Sent.size()==7);
+    std::vector<unsigned char> Data(N2kMsg.Data,N2kMsg.Data+N2kMsg.DataLen);
+    CHECK(NMEA2000.FastPacketData()==Data);
+  }
+}
+
+TEST_CASE("Buffered frames are sent in CAN priority order") {
+  tSendNMEA2000 NMEA2000;
+  tN2kMsg N2kMsg;
+  NMEA2000.SetN2kCANSendFrameBufSize(40);
+  NMEA2000.OpenNow();
+  NMEA2000.ResetSendQueueStats();
+
+  // Driver is busy, so everything will be buffered
+  NMEA2000.Accept=0;
+  SetTestGNSS(N2kMsg); // priority 3
+  N2kMsg.Priority=6;
+  REQUIRE(NMEA2000.SendMsg(N2kMsg));
+  std::vector<unsigned char> Data(N2kMsg.Data,N2kMsg.Data+N2kMsg.DataLen);
+  SetN2kTrueHeading(N2kMsg,1,0.5); // priority 2
+  REQUIRE(NMEA2000.SendMsg(N2kMsg));
+  CHECK(NMEA2000.Sent.empty());
+
+  NMEA2000.Accept=100;
+  NMEA2000.Flush();
+  REQUIRE(NMEA2000.Sent.size()==8);
+  CHECK(((NMEA2000.Sent[0].id>>8) & 0x3ffff)==127250UL);
+  NMEA2000.Sent.erase(NMEA2000.Sent.begin());
+  CHECK(NMEA2000.FastPacketData()==Data);
+
+  tNMEA2000::tCANSendQueueStats Stats;
+  REQUIRE(NMEA2000.GetSendQueueStats(2,Stats));
+  CHECK(Stats.Frames==1);
+  CHECK(Stats.BufferedFrames==1);
+  REQUIRE(NMEA2000.GetSendQueueStats(6,Stats));
+  CHECK(Stats.Frames==7);
+  CHECK(Stats.BufferedFrames==7);
+  CHECK(Stats.TotalLatency>=Stats.MaxLatency);
+  CHECK(!NMEA2000.GetSendQueueStats(8,Stats));
+}
+
+TEST_CASE("Frame waiting on buffer does not block freed slots") {
+  tSendNMEA2000 NMEA2000;
+  tN2kMsg N2kMsg;
+  NMEA2000.SetN2kCANSendFrameBufSize(20);
+  NMEA2000.OpenNow();
+
+  // Low priority frame will be first on buffer and others fill it.
+  NMEA2000.Accept=0;
+  SetN2kTrueHeading(N2kMsg,0,0.5);
+  N2kMsg.Priority=6;
+  REQUIRE(NMEA2000.SendMsg(N2kMsg));
+  int Buffered=1;
+  for ( int i=1; i<100; i++ ) {
+    SetN2kTrueHeading(N2kMsg,i,0.5);
+    if ( !NMEA2000.SendMsg(N2kMsg) ) break;
+    Buffered++;
+  }
+  REQUIRE(Buffered==20);
+
+  // Send all high priority frames, low priority stays on buffer
+  NMEA2000.Accept=Buffered-1;
+  NMEA2000.Flush();
+  REQUIRE(NMEA2000.Sent.size()==(size_t)Buffered-1);
+
+  // All freed slots must be usable
+  NMEA2000.Accept=0;
+  for ( int i=0; i<Buffered-1; i++ ) {
+    SetN2kTrueHeading(N2kMsg,100+i,0.5);
+    REQUIRE(NMEA2000.SendMsg(N2kMsg));
+  }
+  SetN2kTrueHeading(N2kMsg,200,0.5);
+  CHECK(!NMEA2000.SendMsg(N2kMsg));
+
+  NMEA2000.Sent.clear();
+  NMEA2000.Accept=100;
+  NMEA2000.Flush();
+  REQUIRE(NMEA2000.Sent.size()==(size_t)Buffered);
+  for ( int i=0; i<Buffered-1; i++ ) CHECK(NMEA2000.Sent[i].buf[0]==100+i);
+  CHECK(((NMEA2000.Sent[Buffered-1].id>>26) & 0x7)==6);
+}
+
+TEST_CASE("Priority ring buffer reuses slots read out of order") {
+  tPriorityRingBuffer<int> Buf(4,8);
+
+  REQUIRE(Buf.add(7,7));
+  for ( int i=0; i<3; i++ ) REQUIRE(Buf.add(i,2));
+  CHECK(!Buf.add(99,2));
+  CHECK(Buf.count()==4);
+
+  for ( int Round=0; Round<5; Round++ ) {
+    int Val;
+    for ( int i=0; i<3; i++ ) {
+      REQUIRE(Buf.read(Val));
+      CHECK(Val==Round*10+i);
+    }
+    CHECK(Buf.count()==1);
+    for ( int i=0; i<3; i++ ) REQUIRE(Buf.add((Round+1)*10+i,2));
+    CHECK(!Buf.add(99,2));
+  }
+
+  const int *Low=Buf.getReadRef(7);
+  REQUIRE(Low!=0);
+  CHECK(*Low==7);
+  Buf.clear();
+  CHECK(Buf.isEmpty());
+  CHECK(Buf.count()==0);
+}
+
+TEST_CASE("Queued single frame is replaced by newer value") {
+  static const tNMEA2000::tSendCoalesceMsg CoalesceMsgs[]={
+    {127250L,N2kNoInstanceByte},
+    {127488L,0},
+    {129029L,N2kNoInstanceByte}, // fast packet is never coalesced
+    {0,0}
+  };
+  tSendNMEA2000 NMEA2000;
+  tN2kMsg N2kMsg;
+  NMEA2000.SetSendCoalescing(CoalesceMsgs);
+  NMEA2000.OpenNow();
+  NMEA2000.ResetSendQueueStats();
+
+  NMEA2000.Accept=0;
+  for ( int i=0; i<5; i++ ) {
+    SetN2kTrueHeading(N2kMsg,i,0.1*i);
+    REQUIRE(NMEA2000.SendMsg(N2kMsg));
+    SetN2kEngineParamRapid(N2kMsg,0,1000+i);
+    REQUIRE(NMEA2000.SendMsg(N2kMsg));
+    SetN2kEngineParamRapid(N2kMsg,1,2000+i);
+    REQUIRE(NMEA2000.SendMsg(N2kMsg));
+  }
+  SetTestGNSS(N2kMsg);
+  REQUIRE(NMEA2000.SendMsg(N2kMsg));
+  REQUIRE(NMEA2000.SendMsg(N2kMsg));
+
+  NMEA2000.Accept=100;
+  NMEA2000.Flush();
+  // heading, two engines and two complete fast packets
+  REQUIRE(NMEA2000.Sent.size()==3+2*7);
+
+  CHECK(((NMEA2000.Sent[0].id>>8) & 0x3ffff)==127250UL);
+  CHECK(NMEA2000.Sent[0].buf[0]==4); // SID of last heading
+
+  tNMEA2000::tCANSendQueueStats Stats;
+  REQUIRE(NMEA2000.GetSendQueueStats(2,Stats));
+  CHECK(Stats.CoalescedFrames==12);
+  CHECK(Stats.Frames==3);
+
+  // Frame already sent is not replaced anymore
+  SetN2kTrueHeading(N2kMsg,9,0.9);
+  NMEA2000.Accept=0;
+  REQUIRE(NMEA2000.SendMsg(N2kMsg));
+  NMEA2000.Accept=100;
+  NMEA2000.Flush();
+  CHECK(NMEA2000.Sent.size()==3+2*7+1);
+}
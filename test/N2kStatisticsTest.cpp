@@ -0,0 +1,135 @@
+#include <catch.hpp>
+#include <N2kMessages.h>
+#include "N2kTestNMEA2000.h"
+
+// Tests for runtime counters of tNMEA2000.
+
+#if !defined(N2K_NO_STATISTICS)
+namespace {
+class tStatsNMEA2000 : public tTestNMEA2000 {
+public:
+  tStatsNMEA2000(tN2kMode Mode) : tTestNMEA2000(Mode) {
+    SetN2kCANMsgBufSize(4);
+    SetN2kCANSendFrameBufSize(10);
+  }
+  void AddFrame(unsigned long PGN, unsigned char Source, unsigned char b0, unsigned char b1=0xff) {
+    tCANFrame Frame={ (3UL<<26) | (PGN<<8) | Source, 8, { b0, b1, 1, 2, 3, 4, 5, 6 } };
+    tTestNMEA2000::AddFrame(Frame);
+  }
+  // Add ISO TP frame from Source to this node
+  void AddTPFrame(unsigned long PGN, unsigned char Source, const unsigned char *buf) {
+    tCANFrame Frame={ (7UL<<26) | (PGN<<8) | ((unsigned long)GetN2kSource()<<8) | Source, 8, { 0 } };
+    memcpy(Frame.buf,buf,8);
+    tTestNMEA2000::AddFrame(Frame);
+  }
+  // Count TP connection management frames of given type sent by this node
+  size_t SentTPCM(unsigned char Control) const {
+    size_t n=0;
+    for ( size_t i=0; i<Sent.size(); i++ ) {
+      if ( ((Sent[i].id>>16) & 0x3ff)==(60416UL>>8) && Sent[i].buf[0]==Control ) n++;
+    }
+    return n;
+  }
+};
+}
+
+TEST_CASE("Receive counters") {
+  tStatsNMEA2000 NMEA2000(tNMEA2000::N2km_ListenOnly);
+  tNMEA2000::tStatistics Stats;
+
+  NMEA2000.OpenNow();
+  NMEA2000.ResetStatistics();
+
+  // Complete fast packet, single frame, orphan frame and sequence break
+  NMEA2000.AddFrame(129029L,1,0x20,10);
+  NMEA2000.AddFrame(129029L,1,0x21);
+  NMEA2000.AddFrame(127250L,1,1);
+  NMEA2000.AddFrame(129029L,2,0x41);
+  NMEA2000.AddFrame(129029L,3,0x60,20);
+  NMEA2000.AddFrame(129029L,3,0x62);
+  // Four messages under reassembly fill all slots, so fifth does not fit.
+  for ( unsigned char Source=10; Source<15; Source++ ) NMEA2000.AddFrame(129029L,Source,0x00,20);
+  NMEA2000.ParseMessages();
+
+  NMEA2000.GetStatistics(Stats);
+  CHECK(Stats.FramesReceived==11);
+  CHECK(Stats.MsgsDispatched==2);
+  CHECK(Stats.OrphanFrames==1);
+  CHECK(Stats.LostFrames==1);
+  CHECK(Stats.NoFreeSlot==1);
+  CHECK(Stats.SlotsInUse==4);
+  CHECK(Stats.SlotsHighWater==4);
+
+  NMEA2000.ResetStatistics();
+  NMEA2000.GetStatistics(Stats);
+  CHECK(Stats.FramesReceived==0);
+  CHECK(Stats.MsgsDispatched==0);
+  CHECK(Stats.SlotsHighWater==4);
+}
+
+TEST_CASE("Send counters") {
+  tStatsNMEA2000 NMEA2000(tNMEA2000::N2km_SendOnly);
+  tNMEA2000::tStatistics Stats;
+  tN2kMsg N2kMsg;
+
+  NMEA2000.OpenNow();
+  NMEA2000.ResetStatistics();
+
+  SetN2kGNSS(N2kMsg,1,19000,3600,60.1,22.5,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,1.2,15.0);
+  NMEA2000.Accept=3;
+  CHECK(NMEA2000.SendMsg(N2kMsg)); // 7 frames, 4 buffered
+  NMEA2000.GetStatistics(Stats);
+  CHECK(Stats.FramesSent==3);
+  CHECK(Stats.FramesBuffered==4);
+  CHECK(Stats.SendBufFrames==4);
+  CHECK(Stats.SendBufHighWater==4);
+
+  CHECK(!NMEA2000.SendMsg(N2kMsg)); // Buffer can not take all 7 frames
+  NMEA2000.GetStatistics(Stats);
+  CHECK(Stats.SendFailures==1);
+  CHECK(Stats.SendBufHighWater>=9);
+
+  NMEA2000.Accept=100;
+  NMEA2000.ParseMessages();
+  NMEA2000.GetStatistics(Stats);
+  CHECK(Stats.SendBufFrames==0);
+  CHECK(Stats.FramesSent==3+Stats.FramesBuffered);
+
+  NMEA2000.ResetStatistics();
+  NMEA2000.GetStatistics(Stats);
+  CHECK(Stats.FramesSent==0);
+  CHECK(Stats.SendBufHighWater==0);
+}
+
+TEST_CASE("TP abort counter") {
+  tStatsNMEA2000 NMEA2000(tNMEA2000::N2km_ListenAndNode);
+  tNMEA2000::tStatistics Stats;
+  const unsigned char TPSource=35;
+
+  NMEA2000.OpenNow();
+  NMEA2000.Run(300); // Address claim
+  NMEA2000.ResetStatistics();
+
+  // 20 byte RTS/CTS transfer. Node sends CTS and end of message ACK.
+  const unsigned char RTS[8]={ 16, 20, 0, 3, 0xff, 0x00, 0xef, 0x00 };
+  NMEA2000.AddTPFrame(60416L,TPSource,RTS);
+  NMEA2000.ParseMessages();
+  CHECK(NMEA2000.SentTPCM(17)==1);
+  for ( unsigned char i=1; i<=3; i++ ) {
+    const unsigned char DT[8]={ i, 1, 2, 3, 4, 5, 6, 7 };
+    NMEA2000.AddTPFrame(60160L,TPSource,DT);
+  }
+  NMEA2000.ParseMessages();
+  CHECK(NMEA2000.SentTPCM(19)==1);
+  NMEA2000.GetStatistics(Stats);
+  CHECK(Stats.TPAborts==0);
+
+  // Without pool buffer long message will be aborted.
+  const unsigned char LongRTS[8]={ 16, 0x2c, 0x01, 43, 0xff, 0x00, 0xef, 0x00 };
+  NMEA2000.AddTPFrame(60416L,TPSource,LongRTS);
+  NMEA2000.ParseMessages();
+  CHECK(NMEA2000.SentTPCM(255)==1);
+  NMEA2000.GetStatistics(Stats);
+  CHECK(Stats.TPAborts==1);
+}
+#endif
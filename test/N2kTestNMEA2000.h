@@ -0,0 +1,141 @@
+#ifndef _N2K_TEST_NMEA2000_H_
+#define _N2K_TEST_NMEA2000_H_
+
+// Common fixtures for tNMEA2000 tests.
+
+#include <NMEA2000.h>
+#include <NMEA2000_virtual.h>
+#include <deque>
+#include <vector>
+#include <string>
+#include <string.h>
+#include <thread>
+#include <chrono>
+
+// Driver without hardware. Frames added with AddFrame will be received and
+// sent frames are saved to Sent. Driver accepts Accept frames and after that
+// sending fails. With Bulk driver reads and sends frames with CANGetFrames
+// and CANSendFrames.
+class tTestNMEA2000 : public tNMEA2000 {
+protected:
+  std::deque<tCANFrame> RxFrames;
+  bool Bulk;
+
+  bool CANSendFrame(unsigned long id, unsigned char len, const unsigned char *buf, bool) {
+    SendFrameCalls++;
+    if ( Accept==0 ) return false;
+    Accept--;
+    tCANFrame Frame;
+    Frame.id=id; Frame.len=len; memcpy(Frame.buf,buf,len);
+    Sent.push_back(Frame);
+    return true;
+  }
+  uint16_t CANSendFrames(const tCANFrame *Frames, uint16_t Count, bool wait_sent) {
+    if ( !Bulk ) return tNMEA2000::CANSendFrames(Frames,Count,wait_sent);
+    SendFramesCalls++;
+    uint16_t i=0;
+    for ( ; i<Count && Accept>0; i++, Accept-- ) Sent.push_back(Frames[i]);
+    return i;
+  }
+  bool CANOpen() { return true; }
+  bool CANGetFrame(unsigned long &id, unsigned char &len, unsigned char *buf) {
+    GetFrameCalls++;
+    if ( RxFrames.empty() ) return false;
+    const tCANFrame &Frame=RxFrames.front();
+    id=Frame.id; len=Frame.len; memcpy(buf,Frame.buf,len);
+    RxFrames.pop_front();
+    return true;
+  }
+  uint16_t CANGetFrames(tCANFrame *Frames, uint16_t MaxFrames) {
+    if ( !Bulk ) return tNMEA2000::CANGetFrames(Frames,MaxFrames);
+    GetFramesCalls++;
+    uint16_t Count=0;
+    for ( ; Count<MaxFrames && !RxFrames.empty(); Count++ ) {
+      Frames[Count]=RxFrames.front();
+      RxFrames.pop_front();
+    }
+    return Count;
+  }
+
+public:
+  std::vector<tCANFrame> Sent;
+  size_t Accept;
+  int SendFrameCalls;
+  int SendFramesCalls;
+  int GetFrameCalls;
+  int GetFramesCalls;
+
+  tTestNMEA2000(tN2kMode Mode=N2km_ListenOnly, bool _Bulk=false) : Bulk(_Bulk), Accept(100000),
+      SendFrameCalls(0), SendFramesCalls(0), GetFrameCalls(0), GetFramesCalls(0) {
+    SetMode(Mode);
+  }
+  // Run ParseMessages until open. Clears sent frames and call counters.
+  void OpenNow() {
+    while ( !IsOpen() ) {
+      ParseMessages();
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    Sent.clear();
+    SendFrameCalls=0; SendFramesCalls=0; GetFrameCalls=0; GetFramesCalls=0;
+  }
+  // Run ParseMessages for ms milliseconds.
+  void Run(int ms) {
+    auto End=std::chrono::steady_clock::now()+std::chrono::milliseconds(ms);
+    while ( std::chrono::steady_clock::now()<End ) {
+      ParseMessages();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  void AddFrame(const tCANFrame &Frame) { RxFrames.push_back(Frame); }
+  size_t PendingFrames() const { return RxFrames.size(); }
+  size_t SentCount(unsigned long PGN) const {
+    size_t n=0;
+    for ( size_t i=0; i<Sent.size(); i++ ) if ( ((Sent[i].id>>8) & 0x3ffff)==PGN ) n++;
+    return n;
+  }
+  void Flush() { SendFrames(); }
+};
+
+// Stream collecting written text.
+class tStringStream : public N2kStream {
+public:
+  std::string Text;
+
+  int read() { return -1; }
+  int peek() { return -1; }
+  size_t write(const uint8_t *data, size_t size) { Text.append((const char *)data,size); return size; }
+};
+
+// Handler collecting received messages. PGN 0 collects all messages.
+class tCollector : public tNMEA2000::tMsgHandler {
+public:
+  std::vector<tN2kMsg> Msgs;
+  tCollector(tNMEA2000 *NMEA2000, unsigned long PGN=0) : tMsgHandler(PGN,NMEA2000) {}
+  void HandleMsg(const tN2kMsg &N2kMsg) { Msgs.push_back(N2kMsg); }
+  size_t Count(unsigned long PGN) const {
+    size_t n=0;
+    for ( size_t i=0; i<Msgs.size(); i++ ) if ( Msgs[i].PGN==PGN ) n++;
+    return n;
+  }
+};
+
+// Node on virtual bus collecting received messages.
+class tTestNode : public tNMEA2000_virtual {
+public:
+  tCollector Collector;
+  std::vector<tN2kMsg> &Received;
+
+  tTestNode(tN2kVirtualCANBus &Bus, tN2kMode Mode=N2km_ListenAndSend) : tNMEA2000_virtual(Bus), Collector(this), Received(Collector.Msgs) {
+    SetMode(Mode);
+  }
+  bool Send(unsigned long id, unsigned char len, const unsigned char *buf) { return CANSendFrame(id,len,buf); }
+  // Send single frame message with given source, PGN and destination.
+  bool Send(unsigned char Source, unsigned long PGN, unsigned char Destination=0xff, unsigned char b0=0) {
+    unsigned char buf[8]={ b0, 1, 2, 3, 4, 5, 6, 7 };
+    return CANSendFrame(N2ktoCanID(6,PGN,Source,Destination),8,buf);
+  }
+  bool Get(unsigned long &id) { unsigned char len; unsigned char buf[8]; return CANGetFrame(id,len,buf); }
+  bool Get(tCANFrame &Frame) { return CANGetFrames(&Frame,1)==1; }
+};
+
+#endif
@@ -0,0 +1,164 @@
+#include <catch.hpp>
+#include <RingBuffer.h>
+#include <mutex>
+#include <atomic>
+#include "N2kTestNMEA2000.h"
+
+// Tests for threaded receive. Test target is built with N2K_THREADED_RECEIVE
+// and its own copy of library sources.
+
+#if defined(N2K_THREADED_RECEIVE)
+namespace {
+// Driver is read by receive thread, so frame queue must be locked.
+class tThreadedNMEA2000 : public tTestNMEA2000 {
+protected:
+  std::mutex Lock;
+
+  bool CANGetFrame(unsigned long &id, unsigned char &len, unsigned char *buf) {
+    std::lock_guard<std::mutex> Guard(Lock);
+    return tTestNMEA2000::CANGetFrame(id,len,buf);
+  }
+
+public:
+  void AddFrame(unsigned long PGN, uint16_t Counter) {
+    tCANFrame Frame={ (2UL<<26) | (PGN<<8) | 1, 8, { (unsigned char)Counter, (unsigned char)(Counter>>8), 1, 2, 3, 4, 5, 6 } };
+    std::lock_guard<std::mutex> Guard(Lock);
+    tTestNMEA2000::AddFrame(Frame);
+  }
+  size_t PendingFrames() {
+    std::lock_guard<std::mutex> Guard(Lock);
+    return tTestNMEA2000::PendingFrames();
+  }
+};
+
+class tCounter : public tNMEA2000::tMsgHandler {
+public:
+  int Count;
+  bool InOrder;
+  int SleepMs;
+  tCounter(tNMEA2000 *pNMEA2000) : tNMEA2000::tMsgHandler(127250L,pNMEA2000), Count(0), InOrder(true), SleepMs(0) {}
+  void HandleMsg(const tN2kMsg &N2kMsg) {
+    int Index=0;
+    InOrder&=( N2kMsg.Get2ByteUInt(Index)==Count );
+    Count++;
+    if ( SleepMs>0 ) std::this_thread::sleep_for(std::chrono::milliseconds(SleepMs));
+  }
+};
+
+std::atomic<int> Notifications(0);
+void Notify(void *) { Notifications++; }
+}
+
+TEST_CASE("SPSC ring buffer") {
+  tSPSCRingBuffer<int> Buf(3);
+  int Val;
+
+  CHECK(Buf.getSize()==4);
+  CHECK(Buf.isEmpty());
+  for ( int i=0; i<4; i++ ) CHECK(Buf.add(i));
+  CHECK(!Buf.add(4));
+  CHECK(Buf.count()==4);
+  for ( int i=0; i<4; i++ ) {
+    CHECK(Buf.read(Val));
+    CHECK(Val==i);
+  }
+  CHECK(!Buf.read(Val));
+}
+
+TEST_CASE("SPSC ring buffer zero copy") {
+  tSPSCRingBuffer<int> Buf(2);
+
+  int *In=Buf.getAddRef();
+  REQUIRE(In!=0);
+  CHECK(Buf.getAddRef()==In); // Same slot until committed
+  *In=10;
+  CHECK(Buf.getReadRef()==0);
+  Buf.commitAdd();
+  REQUIRE(Buf.add(11));
+  CHECK(Buf.getAddRef()==0);
+
+  const int *Out=Buf.getReadRef();
+  REQUIRE(Out!=0);
+  CHECK(*Out==10);
+  CHECK(Buf.getReadRef()==Out);
+  CHECK(Buf.getAddRef()==0); // Slot not released before commit
+  Buf.commitRead();
+  CHECK(Buf.getAddRef()!=0);
+  CHECK(*Buf.getReadRef()==11);
+  Buf.commitRead();
+  CHECK(Buf.isEmpty());
+}
+
+TEST_CASE("SPSC ring buffer between threads") {
+  tSPSCRingBuffer<uint32_t> Buf(16);
+  const uint32_t Count=100000;
+
+  std::thread Producer([&]() {
+      for ( uint32_t i=0; i<Count; ) {
+        uint32_t *In=Buf.getAddRef();
+        if ( In==0 ) { std::this_thread::yield(); continue; }
+        *In=i++;
+        Buf.commitAdd();
+      }
+    });
+
+  bool InOrder=true;
+  for ( uint32_t i=0; i<Count; ) {
+    const uint32_t *Out=Buf.getReadRef();
+    if ( Out==0 ) { std::this_thread::yield(); continue; }
+    InOrder&=( *Out==i++ );
+    Buf.commitRead();
+  }
+  Producer.join();
+  CHECK(InOrder);
+  CHECK(Buf.isEmpty());
+}
+
+TEST_CASE("Receive thread decouples reading from handlers") {
+  tThreadedNMEA2000 NMEA2000;
+  tCounter Counter(&NMEA2000);
+  const int Frames=200;
+
+  CHECK(!NMEA2000.StartReceiveThread()); // Not open
+  NMEA2000.OpenNow();
+  NMEA2000.SetReceiveNotify(Notify);
+  REQUIRE(NMEA2000.StartReceiveThread(256,100));
+  CHECK(NMEA2000.IsReceiveThreadRunning());
+  CHECK(!NMEA2000.StartReceiveThread());
+
+  // Handler is slow, but receive thread keeps driver queue empty
+  Counter.SleepMs=1;
+  for ( int i=0; i<Frames; i++ ) NMEA2000.AddFrame(127250L,i);
+  for ( int i=0; i<1000 && NMEA2000.PendingFrames()>0; i++ ) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  CHECK(NMEA2000.PendingFrames()==0);
+  CHECK(Notifications>0);
+  CHECK(NMEA2000.GetWakeupTimeout()==0);
+
+  while ( Counter.Count<Frames ) NMEA2000.ParseMessages();
+  CHECK(Counter.InOrder);
+  CHECK(NMEA2000.GetRxRingOverflows()==0);
+
+  NMEA2000.StopReceiveThread();
+  CHECK(!NMEA2000.IsReceiveThreadRunning());
+  // After stop frames are read directly from driver
+  NMEA2000.AddFrame(127250L,Frames);
+  NMEA2000.ParseMessages();
+  CHECK(Counter.Count==Frames+1);
+}
+
+TEST_CASE("Receive ring overflow is counted") {
+  tThreadedNMEA2000 NMEA2000;
+  tCounter Counter(&NMEA2000);
+
+  NMEA2000.OpenNow();
+  REQUIRE(NMEA2000.StartReceiveThread(16,100));
+  for ( int i=0; i<40; i++ ) NMEA2000.AddFrame(127250L,i);
+  for ( int i=0; i<1000 && NMEA2000.PendingFrames()>0; i++ ) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  NMEA2000.StopReceiveThread();
+
+  CHECK(NMEA2000.GetRxRingOverflows()==40-16);
+  while ( NMEA2000.GetWakeupTimeout()==0 ) NMEA2000.ParseMessages();
+  CHECK(Counter.Count==16);
+  CHECK(Counter.InOrder); // Oldest frames were kept
+}
+#endif
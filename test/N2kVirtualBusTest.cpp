@@ -0,0 +1,165 @@
+#include <catch.hpp>
+#include <N2kMessages.h>
+#include "N2kTestNMEA2000.h"
+
+// Tests for virtual CAN bus driver tNMEA2000_virtual.
+
+namespace {
+void RunNodes(tTestNode **Nodes, int Count, int ms) {
+  auto End=std::chrono::steady_clock::now()+std::chrono::milliseconds(ms);
+  while ( std::chrono::steady_clock::now()<End ) {
+    for ( int i=0; i<Count; i++ ) Nodes[i]->ParseMessages();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+uint32_t BusTime=0;
+uint32_t GetBusTime() { return BusTime; }
+}
+
+TEST_CASE("Nodes on virtual bus resolve address conflict") {
+  tN2kVirtualCANBus Bus;
+  tTestNode Node1(Bus);
+  tTestNode Node2(Bus);
+  tTestNode *Nodes[]={ &Node1, &Node2 };
+
+  CHECK(Bus.GetNodeCount()==2);
+  Node1.SetDeviceInformation(1,130,25,2046);
+  Node2.SetDeviceInformation(2,130,25,2046);
+  Node1.SetMode(tNMEA2000::N2km_ListenAndNode,22);
+  Node2.SetMode(tNMEA2000::N2km_ListenAndNode,22);
+  RunNodes(Nodes,2,1000);
+
+  CHECK(Node1.IsOpen());
+  CHECK(Node2.IsOpen());
+  CHECK(Node1.GetN2kSource()!=Node2.GetN2kSource());
+  CHECK(Bus.GetFramesTransmitted()>=3);
+}
+
+TEST_CASE("Fast packet and ISO TP messages are delivered over virtual bus") {
+  tN2kVirtualCANBus Bus;
+  tTestNode Sender(Bus);
+  tTestNode Listener(Bus);
+  tTestNode *Nodes[]={ &Sender, &Listener };
+
+  Sender.SetMode(tNMEA2000::N2km_ListenAndNode,30);
+  Listener.SetMode(tNMEA2000::N2km_ListenOnly);
+  RunNodes(Nodes,2,600);
+  REQUIRE(Sender.IsOpen());
+  REQUIRE(Listener.IsOpen());
+  Listener.Received.clear();
+
+  tN2kMsg N2kMsg;
+  SetN2kGNSS(N2kMsg,1,19000,3600,60.1,22.5,10.0,N2kGNSSt_GPS,N2kGNSSm_GNSSfix,12,0.8,0.5,15,1,N2kGNSSt_GPS,15,2);
+  REQUIRE(Sender.SendMsg(N2kMsg));
+
+  tN2kMsg TPMsg;
+  TPMsg.SetPGN(65280L);
+  TPMsg.Priority=7;
+  for ( int i=0; i<40; i++ ) TPMsg.AddByte(i);
+  TPMsg.SetIsTPMessage();
+  REQUIRE(Sender.SendMsg(TPMsg));
+  RunNodes(Nodes,2,500);
+
+  REQUIRE(Listener.Received.size()==2);
+  CHECK(Listener.Received[0].PGN==129029L);
+  CHECK(Listener.Received[0].Source==30);
+  CHECK(Listener.Received[0].DataLen==N2kMsg.DataLen);
+  CHECK(memcmp(Listener.Received[0].Data,N2kMsg.Data,N2kMsg.DataLen)==0);
+  CHECK(Listener.Received[1].PGN==65280L);
+  CHECK(Listener.Received[1].DataLen==40);
+  CHECK(memcmp(Listener.Received[1].Data,TPMsg.Data,40)==0);
+  CHECK(Sender.Received.empty());
+}
+
+TEST_CASE("Virtual bus models bit rate and arbitration") {
+  const unsigned char Data[8]={ 1,2,3,4,5,6,7,8 };
+  unsigned long id;
+  tN2kVirtualCANBus Bus(250000);
+  tTestNode Node1(Bus);
+  tTestNode Node2(Bus);
+  tTestNode Listener(Bus);
+
+  Bus.SetTimeSource(GetBusTime);
+  Node1.SetTxMailboxes(2);
+  Node1.InitCANFrameBuffers();
+  Node2.InitCANFrameBuffers();
+  Listener.SetN2kCANReceiveFrameBufSize(3);
+  Listener.InitCANFrameBuffers();
+
+  const uint32_t FrameTime=tN2kVirtualCANBus::FrameTime(8,250000);
+  CHECK(FrameTime==640);
+
+  // First frame starts immediately. Rest will be arbitrated by id.
+  CHECK(Node1.Send(0x18000001,8,Data));
+  CHECK(Node1.Send(0x18000002,8,Data));
+  CHECK(Node1.Send(0x18000003,8,Data));
+  CHECK(!Node1.Send(0x18000004,8,Data));
+  CHECK(Node2.Send(0x08000001,8,Data));
+  CHECK(Bus.GetPendingFrames()==4);
+
+  BusTime=FrameTime-1;
+  CHECK(!Listener.Get(id));
+  BusTime=FrameTime;
+  REQUIRE(Listener.Get(id));
+  CHECK(id==0x18000001);
+  BusTime=4*FrameTime;
+  REQUIRE(Listener.Get(id));
+  CHECK(id==0x08000001);
+  REQUIRE(Listener.Get(id));
+  CHECK(id==0x18000002);
+  REQUIRE(Listener.Get(id));
+  CHECK(id==0x18000003);
+  CHECK(!Listener.Get(id));
+  CHECK(Bus.GetFramesTransmitted()==4);
+  CHECK(Bus.GetBusyTime()==4*FrameTime);
+
+  // Node2 and Listener receive frames from Node1. Listener buffer overflows.
+  for ( int i=0; i<4; i++ ) {
+    CHECK(Node1.Send(0x18000010+i,8,Data));
+    BusTime+=FrameTime;
+  }
+  Bus.Run();
+  CHECK(Listener.GetRxOverflows()==1);
+  CHECK(Node1.GetRxOverflows()==0);
+}
+
+#if !defined(N2K_NO_RX_TIMESTAMP)
+TEST_CASE("Virtual bus stamps receive time from bus time source") {
+  const unsigned char Data[8]={ 1,2,3,4,5,6,7,8 };
+  tNMEA2000::tCANFrame Frame;
+  tN2kVirtualCANBus Bus;
+  tTestNode Node1(Bus);
+  tTestNode Listener(Bus);
+
+  BusTime=0x70000000;
+  Bus.SetTimeSource(GetBusTime);
+  Node1.InitCANFrameBuffers();
+  Listener.InitCANFrameBuffers();
+
+  // Unlimited bandwidth delivers on send time.
+  BusTime+=1000;
+  CHECK(Node1.Send(0x18000001,8,Data));
+  REQUIRE(Listener.Get(Frame));
+  CHECK(Frame.RxTime==0x70000000ULL+1000);
+
+  // Receive time continues over time source wrap around.
+  BusTime=0xF0000000;
+  CHECK(Node1.Send(0x18000002,8,Data));
+  BusTime=0x100;
+  CHECK(Node1.Send(0x18000003,8,Data));
+  REQUIRE(Listener.Get(Frame));
+  CHECK(Frame.RxTime==0xF0000000ULL);
+  REQUIRE(Listener.Get(Frame));
+  CHECK(Frame.RxTime==0x100000100ULL);
+
+  // With bit rate frame is received, when its transmission ends.
+  const uint32_t FrameTime=tN2kVirtualCANBus::FrameTime(8,250000);
+  Bus.SetBitRate(250000);
+  Bus.SetTimeSource(GetBusTime);
+  CHECK(Node1.Send(0x18000004,8,Data));
+  BusTime+=2*FrameTime;
+  REQUIRE(Listener.Get(Frame));
+  CHECK(Frame.RxTime==0x100ULL+FrameTime);
+}
+#endif
@@ -0,0 +1,72 @@
+#include <catch.hpp>
+#include <N2kMessages.h>
+#include "N2kTestNMEA2000.h"
+
+// Tests for GetNextWakeupTime, which tells when ParseMessages must be called.
+
+namespace {
+class tWakeupNMEA2000 : public tTestNMEA2000 {
+public:
+  tWakeupNMEA2000() {
+    SetMode(tNMEA2000::N2km_ListenAndNode,22);
+    SetN2kCANSendFrameBufSize(20);
+  }
+  void AddFrame(unsigned long PGN, unsigned char Source) {
+    tCANFrame Frame={ (2UL<<26) | (PGN<<8) | Source, 8, { 1, 2, 3, 4, 5, 6, 7, 8 } };
+    tTestNMEA2000::AddFrame(Frame);
+  }
+};
+
+bool FillTemperature(tN2kMsg &N2kMsg, void *) {
+  SetN2kTemperature(N2kMsg,1,1,N2kts_MainCabinTemperature,293.15);
+  return true;
+}
+}
+
+TEST_CASE("Wakeup time") {
+  tWakeupNMEA2000 NMEA2000;
+
+  CHECK(NMEA2000.GetPollFd()==-1);
+  CHECK(NMEA2000.GetWakeupTimeout()==0); // Must be opened
+
+  NMEA2000.OpenNow();
+  // Address claim in progress
+  uint32_t Timeout=NMEA2000.GetWakeupTimeout();
+  CHECK(Timeout>0);
+  CHECK(Timeout<=251);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  NMEA2000.ParseMessages();
+  // Only heartbeat, which has 10 s offset from open
+  Timeout=NMEA2000.GetWakeupTimeout();
+  CHECK(Timeout>5000);
+  CHECK(Timeout<=10001);
+  CHECK(NMEA2000.GetWakeupTimeout(1000)==1000);
+
+  SECTION("Periodic message") {
+    NMEA2000.AddPeriodicMsg(130312L,100,FillTemperature,0,0,0);
+    Timeout=NMEA2000.GetWakeupTimeout();
+    CHECK(Timeout<=101);
+  }
+
+  SECTION("Send backlog") {
+    tN2kMsg N2kMsg;
+    NMEA2000.Accept=0;
+    FillTemperature(N2kMsg,0);
+    CHECK(NMEA2000.SendMsg(N2kMsg));
+    CHECK(NMEA2000.GetWakeupTimeout()<=N2kSendRetryWakeupTime);
+    NMEA2000.Accept=100;
+    NMEA2000.ParseMessages();
+    CHECK(NMEA2000.GetWakeupTimeout()>5000);
+  }
+
+  SECTION("Read limit") {
+    NMEA2000.SetMaxReadFramesOnParse(2);
+    for ( int i=0; i<5; i++ ) NMEA2000.AddFrame(127250L,1);
+    NMEA2000.ParseMessages();
+    CHECK(NMEA2000.GetWakeupTimeout()==0);
+    NMEA2000.ParseMessages();
+    NMEA2000.ParseMessages();
+    CHECK(NMEA2000.GetWakeupTimeout()>5000);
+  }
+}
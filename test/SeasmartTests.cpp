@@ -62,6 +62,15 @@ TEST_CASE("SEASMART EXPORT", "[seasmart]") {
 
     REQUIRE( N2kToSeasmart(msg, 0, buffer, sizeof(buffer)) == 0 );
   }
+
+#if !defined(N2K_NO_RX_TIMESTAMP)
+  SECTION("export with message receive time") {
+    char buffer[512];
+    msg.RxTime=0x12345ULL*1000+999;
+    REQUIRE( N2kToSeasmart(msg, buffer, sizeof(buffer)) > 0 );
+    REQUIRE( std::string(buffer).substr(0,23) == "$PCDIN,01F119,00012345," );
+  }
+#endif
 }
 
 TEST_CASE("SEASMART IMPORT") {